@@ -115,6 +115,22 @@ namespace castor3d
 		eSubmeshIndexComponentCount = makeChunkID( 'S', 'M', 'F', 'C', 'C', 'P', 'C', 'T' ),
 		eSubmeshIndexCount = makeChunkID( 'S', 'M', 'S', 'H', 'I', 'C', 'C', 'T' ),
 		eSubmeshIndices = makeChunkID( 'S', 'M', 'S', 'H', 'I', 'D', 'C', 'S' ),
+		// Submesh levels of detail
+		eSubmeshLodError = makeChunkID( 'S', 'M', 'L', 'O', 'D', 'E', 'R', 'R' ),
+		eSubmeshLodIndexCount = makeChunkID( 'S', 'M', 'L', 'O', 'D', 'I', 'C', 'T' ),
+		eSubmeshLodIndices = makeChunkID( 'S', 'M', 'L', 'O', 'D', 'I', 'D', 'X' ),
+		// Submesh meshlets
+		eSubmeshMeshletCount = makeChunkID( 'S', 'M', 'M', 'S', 'H', 'L', 'C', 'T' ),
+		eSubmeshMeshlets = makeChunkID( 'S', 'M', 'M', 'S', 'H', 'L', 'T', 'S' ),
+		// Binary scene
+		eScene = makeChunkID( 'S', 'C', 'E', 'N', 'E', ' ', ' ', ' ' ),
+		eSceneVersion = makeChunkID( 'S', 'C', 'N', 'V', 'R', 'S', 'N', ' ' ),
+		eSceneStrings = makeChunkID( 'S', 'C', 'N', 'S', 'T', 'R', 'N', 'G' ),
+		eSceneNodes = makeChunkID( 'S', 'C', 'N', 'N', 'O', 'D', 'E', 'S' ),
+		eSceneMeshes = makeChunkID( 'S', 'C', 'N', 'M', 'E', 'S', 'H', 'S' ),
+		eSceneSubmeshMaterials = makeChunkID( 'S', 'C', 'N', 'S', 'M', 'M', 'T', 'L' ),
+		eSceneGeometries = makeChunkID( 'S', 'C', 'N', 'G', 'E', 'O', 'M', 'S' ),
+		eSceneLights = makeChunkID( 'S', 'C', 'N', 'L', 'G', 'H', 'T', 'S' ),
 	};
 	/**
 	 *\~english
@@ -242,6 +258,17 @@ namespace castor3d
 		 *\return		\p false si une erreur quelconque est arrivée
 		 */
 		C3D_API bool read( castor::BinaryFile & file );
+		/**
+		 *\~english
+		 *\brief		From memory reader function
+		 *\param[in]	data	The memory containing the chunk
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir de la mémoire
+		 *\param[in]	data	La mémoire qui contient le chunk
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		C3D_API bool read( castor::ByteArray const & data );
 		/**
 		 *\~english
 		 *\brief		Retrieves the remaining data
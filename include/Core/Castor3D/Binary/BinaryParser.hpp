@@ -49,39 +49,26 @@ namespace castor3d
 		{
 			BinaryChunk header;
 			bool result = header.read( file );
-
-			if ( header.getChunkType() != ChunkType::eCmshFile )
-			{
-				result = false;
-				checkError( result, "Not a valid CMSH file." );
-			}
-
-			if ( result )
-			{
-				result = doParseHeader( header );
-			}
-
-			if ( result )
-			{
-				result = header.checkAvailable( 1 );
-				checkError( result, "No more data in chunk." );
-			}
-
-			BinaryChunk chunk;
-
-			if ( result )
-			{
-				result = header.getSubChunk( chunk );
-				checkError( result, "Couldn't retrieve subchunk." );
-			}
-
-			if ( result )
-			{
-				result = parse( obj, chunk );
-				checkError( result, "Couldn't parse chunk." );
-			}
-
-			return result;
+			return doParseFile( obj, header, result );
+		}
+		/**
+		 *\~english
+		 *\brief		From memory reader function
+		 *\param[out]	obj		The object to read
+		 *\param[in]	data	The file content
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir de la mémoire
+		 *\param[out]	obj		L'objet à lire
+		 *\param[in]	data	Le contenu du fichier
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		inline bool parse( TParsed & obj
+			, castor::ByteArray const & data )
+		{
+			BinaryChunk header;
+			bool result = header.read( data );
+			return doParseFile( obj, header, result );
 		}
 		/**
 		 *\~english
@@ -453,6 +440,49 @@ namespace castor3d
 		}
 
 	private:
+		/**
+		 *\~english
+		 *\brief		Parses the file header chunk, then the object chunk.
+		 *\~french
+		 *\brief		Traite le chunk d'en-tête du fichier, puis le chunk de l'objet.
+		 */
+		inline bool doParseFile( TParsed & obj
+			, BinaryChunk & header
+			, bool result )
+		{
+			if ( header.getChunkType() != ChunkType::eCmshFile )
+			{
+				result = false;
+				checkError( result, "Not a valid CMSH file." );
+			}
+
+			if ( result )
+			{
+				result = doParseHeader( header );
+			}
+
+			if ( result )
+			{
+				result = header.checkAvailable( 1 );
+				checkError( result, "No more data in chunk." );
+			}
+
+			BinaryChunk chunk;
+
+			if ( result )
+			{
+				result = header.getSubChunk( chunk );
+				checkError( result, "Couldn't retrieve subchunk." );
+			}
+
+			if ( result )
+			{
+				result = parse( obj, chunk );
+				checkError( result, "Couldn't parse chunk." );
+			}
+
+			return result;
+		}
 		/**
 		 *\~english
 		 *\brief		From chunk reader function
@@ -0,0 +1,103 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_BinaryScene_H___
+#define ___C3D_BinaryScene_H___
+
+#include "Castor3D/Binary/BinaryParser.hpp"
+#include "Castor3D/Binary/BinaryWriter.hpp"
+
+#include "Castor3D/Scene/SceneModule.hpp"
+
+#include <CastorUtils/Data/Path.hpp>
+
+namespace castor3d
+{
+	//!\~english	The current binary scene tables version number.
+	//!\~french		La version actuelle des tables de scène binaire.
+	uint32_t constexpr CurrentSceneBinaryVersion = makeCmshVersion( 0x01u, 0x00u, 0x0000u );
+	/**
+	\~english
+	\brief		Helper structure to find ChunkType from a type.
+	\remarks	Specialisation for Scene.
+	\~french
+	\brief		Classe d'aide pour récupéer un ChunkType depuis un type.
+	\remarks	Spécialisation pour Scene.
+	*/
+	template<>
+	struct ChunkTyper< Scene >
+	{
+		static ChunkType const Value = ChunkType::eScene;
+	};
+	/**
+	\~english
+	\brief		Scene binary writer.
+	\remarks	Writes the object nodes, lights, geometries and meshes references, as flat tables sharing a strings pool.
+				Materials are referenced by name, and meshes are referenced through their cmsh file (Meshes/<name>.cmsh).
+	\~french
+	\brief		Writer binaire de Scene.
+	\remarks	Ecrit les noeuds d'objets, sources lumineuses, géométries et références de maillages, sous forme de tables plates partageant un pool de chaînes.
+				Les matériaux sont référencés par nom, et les maillages sont référencés via leur fichier cmsh (Meshes/<nom>.cmsh).
+	*/
+	template<>
+	class BinaryWriter< Scene >
+		: public BinaryWriterBase< Scene >
+	{
+	private:
+		/**
+		 *\~english
+		 *\brief		Function used to fill the chunk from specific data.
+		 *\param[in]	obj	The object to write.
+		 *\return		\p false if any error occured.
+		 *\~french
+		 *\brief		Fonction utilisée afin de remplir le chunk de données spécifiques.
+		 *\param[in]	obj	L'objet à écrire.
+		 *\return		\p false si une erreur quelconque est arrivée.
+		 */
+		C3D_API bool doWrite( Scene const & obj )override;
+	};
+	/**
+	\~english
+	\brief		Scene binary parser.
+	\remarks	Fills an existing scene, whose materials are already defined.
+	\~french
+	\brief		Parser binaire de Scene.
+	\remarks	Remplit une scène existante, dont les matériaux sont déjà définis.
+	*/
+	template<>
+	class BinaryParser< Scene >
+		: public BinaryParserBase< Scene >
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	folder	The folder the meshes files are relative to.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	folder	Le dossier auquel les chemins des fichiers de maillages sont relatifs.
+		 */
+		explicit BinaryParser( castor::Path folder = castor::Path{} )
+			: m_folder{ std::move( folder ) }
+		{
+		}
+
+	private:
+		/**
+		 *\~english
+		 *\brief		Function used to retrieve specific data from the chunk
+		 *\param[out]	obj	The object to read
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction utilisée afin de récupérer des données spécifiques à partir d'un chunk
+		 *\param[out]	obj	L'objet à lire
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		C3D_API bool doParse( Scene & obj )override;
+
+	private:
+		castor::Path m_folder;
+	};
+}
+
+#endif
@@ -15,6 +15,7 @@ See LICENSE file in root folder
 
 #include <CastorUtils/Data/Endianness.hpp>
 #include <CastorUtils/Graphics/Colour.hpp>
+#include <CastorUtils/Graphics/Meshlet.hpp>
 #include <CastorUtils/Graphics/Position.hpp>
 #include <CastorUtils/Graphics/RgbaColour.hpp>
 #include <CastorUtils/Graphics/RgbColour.hpp>
@@ -1308,6 +1309,26 @@ namespace castor3d
 			castor::switchEndianness( value.m_index[1] );
 		}
 	}
+	/**
+	 *\~english
+	 *\brief			Sets given value to big endian.
+	 *\param[in,out]	value	The value.
+	 *\~french
+	 *\brief			Met la valeur donnée en big endian.
+	 *\param[in,out]	value	La valeur.
+	 */
+	static inline void prepareChunkData( castor::Meshlet & value )
+	{
+		if ( !castor::isBigEndian() )
+		{
+			castor::switchEndianness( value.firstIndex );
+			castor::switchEndianness( value.indexCount );
+			prepareChunkData( value.center );
+			castor::switchEndianness( value.radius );
+			prepareChunkData( value.coneAxis );
+			castor::switchEndianness( value.coneCutoff );
+		}
+	}
 	/**
 	 *\~english
 	 *\brief			Sets given value to big endian.
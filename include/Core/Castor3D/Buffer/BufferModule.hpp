@@ -125,6 +125,24 @@ namespace castor3d
 	*	Regroupe les pools d'uniform buffers.
 	*/
 	class UniformBufferPools;
+	/**
+	*\~english
+	*\brief
+	*	Ring allocator for the upload staging memory, with per frame budget and batches.
+	*\~french
+	*\brief
+	*	Allocateur circulaire de la mémoire de transit des mises en ligne, avec budget par frame et lots.
+	*/
+	class UploadRing;
+	/**
+	*\~english
+	*\brief
+	*	Batches the resources uploads, to submit them with few command buffers per frame.
+	*\~french
+	*\brief
+	*	Regroupe les mises en ligne de ressources, pour les soumettre avec peu de command buffers par frame.
+	*/
+	class UploadQueue;
 
 	CU_DeclareSmartPtr( GpuBufferPool );
 	CU_DeclareSmartPtr( UniformBufferBase );
@@ -132,6 +150,7 @@ namespace castor3d
 	CU_DeclareSmartPtr( PoolUniformBuffer );
 	CU_DeclareSmartPtr( UniformBufferPool );
 	CU_DeclareTemplateSmartPtr( UniformBuffer );
+	CU_DeclareSmartPtr( UploadQueue );
 
 	using GpuBufferBuddyAllocator = castor::BuddyAllocatorT< GpuBufferBuddyAllocatorTraits >;
 	using GpuBufferBuddyAllocatorUPtr = std::unique_ptr< GpuBufferBuddyAllocator >;
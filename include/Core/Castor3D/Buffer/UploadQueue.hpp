@@ -0,0 +1,228 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_UploadQueue_H___
+#define ___C3D_UploadQueue_H___
+
+#include "Castor3D/Buffer/UploadRing.hpp"
+
+#include <CastorUtils/Design/ArrayView.hpp>
+
+#include <ashespp/Buffer/Buffer.hpp>
+#include <ashespp/Command/CommandBuffer.hpp>
+#include <ashespp/Image/Image.hpp>
+#include <ashespp/Sync/Fence.hpp>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace castor3d
+{
+	class UploadQueue
+	{
+	public:
+		using OnReady = std::function< void() >;
+		using RecordFunc = std::function< void( ashes::CommandBuffer & ) >;
+		//!\~english	The default staging ring capacity, in bytes.
+		//!\~french		La capacité par défaut de l'anneau de transit, en octets.
+		static VkDeviceSize constexpr DefaultCapacity = 64u * 1024u * 1024u;
+		//!\~english	The default bytes count uploaded per frame.
+		//!\~french		Le nombre d'octets mis en ligne par frame, par défaut.
+		static VkDeviceSize constexpr DefaultFrameBudget = 32u * 1024u * 1024u;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	device		The GPU device.
+		 *\param[in]	capacity	The staging ring capacity, in bytes.
+		 *\param[in]	frameBudget	The maximum bytes count uploaded per frame.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	device		Le device GPU.
+		 *\param[in]	capacity	La capacité de l'anneau de transit, en octets.
+		 *\param[in]	frameBudget	Le nombre maximal d'octets mis en ligne par frame.
+		 */
+		C3D_API explicit UploadQueue( RenderDevice const & device
+			, VkDeviceSize capacity = DefaultCapacity
+			, VkDeviceSize frameBudget = DefaultFrameBudget );
+		/**
+		 *\~english
+		 *\brief		Destructor, waits for all the pushed operations.
+		 *\~french
+		 *\brief		Destructeur, attend toutes les opérations poussées.
+		 */
+		C3D_API ~UploadQueue();
+		/**
+		 *\~english
+		 *\brief		Pushes an image upload.
+		 *\remarks		The data is copied, the image ends in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL layout.
+		 *				<br />If the frame budget is consumed, the upload is postponed to a next frame, and the image is meanwhile usable, with undefined contents.
+		 *\param[in]	image	The destination image, in VK_IMAGE_LAYOUT_UNDEFINED layout.
+		 *\param[in]	range	The updated subresources.
+		 *\param[in]	data	The source data.
+		 *\param[in]	regions	The copy regions, their buffer offsets being relative to \p data.
+		 *\param[in]	onReady	Called when the upload is complete.
+		 *\return		The operation ticket.
+		 *\~french
+		 *\brief		Pousse une mise en ligne d'image.
+		 *\remarks		Les données sont copiées, l'image finit en layout VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+		 *				<br />Si le budget de la frame est consommé, la mise en ligne est reportée à une frame suivante, et l'image est entre temps utilisable, avec un contenu indéfini.
+		 *\param[in]	image	L'image de destination, en layout VK_IMAGE_LAYOUT_UNDEFINED.
+		 *\param[in]	range	Les sous-ressources mises à jour.
+		 *\param[in]	data	Les données source.
+		 *\param[in]	regions	Les régions de copie, leurs décalages dans le tampon étant relatifs à \p data.
+		 *\param[in]	onReady	Appelé lorsque la mise en ligne est terminée.
+		 *\return		Le ticket de l'opération.
+		 */
+		C3D_API uint64_t pushUpload( ashes::Image const & image
+			, VkImageSubresourceRange const & range
+			, castor::ArrayView< uint8_t const > data
+			, ashes::VkBufferImageCopyArray regions
+			, OnReady onReady = {} );
+		/**
+		 *\~english
+		 *\brief		Pushes commands, recorded after the previously pushed operations (mipmaps generation, for example).
+		 *\param[in]	record	Records the commands.
+		 *\param[in]	onReady	Called when the commands are complete.
+		 *\return		The operation ticket.
+		 *\~french
+		 *\brief		Pousse des commandes, enregistrées après les opérations précédemment poussées (génération de mipmaps, par exemple).
+		 *\param[in]	record	Enregistre les commandes.
+		 *\param[in]	onReady	Appelé lorsque les commandes sont terminées.
+		 *\return		Le ticket de l'opération.
+		 */
+		C3D_API uint64_t pushCommands( RecordFunc record
+			, OnReady onReady = {} );
+		/**
+		 *\~english
+		 *\brief		Frame update: retires the completed batches, then submits the pushed operations fitting in the frame budget, as one batch.
+		 *\~french
+		 *\brief		Mise à jour de la frame : retire les lots terminés, puis soumet les opérations poussées tenant dans le budget de la frame, en un lot.
+		 */
+		C3D_API void update();
+		/**
+		 *\~english
+		 *\brief		Submits all the pushed operations, regardless of the frame budget, without waiting for them.
+		 *\remarks		For the resources consumed by commands submitted right after, on the graphics queue.
+		 *				<br />Only waits when the staging ring is full.
+		 *\~french
+		 *\brief		Soumet toutes les opérations poussées, sans tenir compte du budget de la frame, sans les attendre.
+		 *\remarks		Pour les ressources consommées par des commandes soumises juste après, sur la file graphique.
+		 *				<br />N'attend que lorsque l'anneau de transit est plein.
+		 */
+		C3D_API void flush();
+		/**
+		 *\~english
+		 *\brief		Waits for an operation to be complete.
+		 *\param[in]	ticket	The operation ticket.
+		 *\~french
+		 *\brief		Attend qu'une opération soit terminée.
+		 *\param[in]	ticket	Le ticket de l'opération.
+		 */
+		C3D_API void wait( uint64_t ticket );
+		/**
+		 *\~english
+		 *\brief		Waits for all the pushed operations to be complete.
+		 *\~french
+		 *\brief		Attend que toutes les opérations poussées soient terminées.
+		 */
+		C3D_API void waitIdle();
+		/**
+		 *\~english
+		 *\param[in]	ticket	An operation ticket.
+		 *\return		\p true if the operation is complete.
+		 *\~french
+		 *\param[in]	ticket	Un ticket d'opération.
+		 *\return		\p true si l'opération est terminée.
+		 */
+		bool isReady( uint64_t ticket )const
+		{
+			return ticket <= m_completed;
+		}
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		uint32_t getSubmitCount()const
+		{
+			return m_submitCount;
+		}
+
+		uint32_t getWaitCount()const
+		{
+			return m_waitCount;
+		}
+
+		size_t getPendingCount()const
+		{
+			return m_pending.size();
+		}
+
+		UploadRing const & getRing()const
+		{
+			return m_ring;
+		}
+		/**@}*/
+
+	private:
+		struct Operation
+		{
+			uint64_t ticket;
+			ashes::Image const * image;
+			VkImageSubresourceRange range;
+			ashes::VkBufferImageCopyArray regions;
+			castor::ByteArray data;
+			VkImageLayout srcLayout;
+			RecordFunc record;
+			OnReady onReady;
+		};
+
+		struct Batch
+		{
+			ashes::CommandBufferPtr commandBuffer;
+			ashes::FencePtr fence;
+			uint64_t value{ 0u };
+			uint64_t ticket{ 0u };
+			std::vector< OnReady > callbacks;
+			std::vector< ashes::BufferBasePtr > dedicated;
+		};
+		using BatchPtr = std::unique_ptr< Batch >;
+
+	private:
+		bool doProcess( Operation & operation
+			, uint8_t const * data
+			, VkDeviceSize size );
+		void doPostpone( Operation operation
+			, castor::ArrayView< uint8_t const > data );
+		void doFlush( std::vector< OnReady > & callbacks
+			, uint64_t ticket );
+		Batch & doGetOpenBatch();
+		void doSubmit();
+		void doRetire( std::vector< OnReady > & callbacks );
+		void doWaitOldest( std::vector< OnReady > & callbacks );
+
+	private:
+		RenderDevice const & m_device;
+		std::mutex m_mutex;
+		UploadRing m_ring;
+		ashes::BufferBasePtr m_buffer;
+		BatchPtr m_open;
+		std::deque< BatchPtr > m_inFlight;
+		std::vector< BatchPtr > m_free;
+		std::deque< Operation > m_pending;
+		uint64_t m_lastTicket{ 0u };
+		std::atomic< uint64_t > m_completed{ 0u };
+		uint32_t m_submitCount{ 0u };
+		uint32_t m_waitCount{ 0u };
+	};
+}
+
+#endif
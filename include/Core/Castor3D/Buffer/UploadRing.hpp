@@ -0,0 +1,156 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_UploadRing_H___
+#define ___C3D_UploadRing_H___
+
+#include "BufferModule.hpp"
+
+#include <deque>
+
+namespace castor3d
+{
+	class UploadRing
+	{
+	public:
+		//!\~english	The offset returned when an allocation fails.
+		//!\~french		Le décalage retourné quand une allocation échoue.
+		static VkDeviceSize constexpr InvalidOffset = ~VkDeviceSize( 0u );
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	capacity	The ring capacity, in bytes.
+		 *\param[in]	frameBudget	The maximum bytes count allocated per frame.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	capacity	La capacité de l'anneau, en octets.
+		 *\param[in]	frameBudget	Le nombre maximal d'octets alloués par frame.
+		 */
+		C3D_API UploadRing( VkDeviceSize capacity
+			, VkDeviceSize frameBudget );
+		/**
+		 *\~english
+		 *\brief		Allocates a range in the open batch.
+		 *\remarks		The first allocation of a frame may exceed the frame budget, as long as it fits in the ring.
+		 *\param[in]	size		The range size.
+		 *\param[in]	alignment	The range offset alignment.
+		 *\return		The range offset, castor3d::UploadRing::InvalidOffset if the ring is full or the frame budget is consumed.
+		 *\~french
+		 *\brief		Alloue un intervalle dans le lot ouvert.
+		 *\remarks		La première allocation d'une frame peut dépasser le budget de la frame, tant qu'elle tient dans l'anneau.
+		 *\param[in]	size		La taille de l'intervalle.
+		 *\param[in]	alignment	L'alignement du décalage de l'intervalle.
+		 *\return		Le décalage de l'intervalle, castor3d::UploadRing::InvalidOffset si l'anneau est plein ou si le budget de la frame est consommé.
+		 */
+		C3D_API VkDeviceSize allocate( VkDeviceSize size
+			, VkDeviceSize alignment );
+		/**
+		 *\~english
+		 *\brief		Closes the open batch.
+		 *\return		The batch value, greater than the previous ones, or the last closed batch value if the open batch is empty.
+		 *\~french
+		 *\brief		Ferme le lot ouvert.
+		 *\return		La valeur du lot, supérieure aux précédentes, ou la valeur du dernier lot fermé si le lot ouvert est vide.
+		 */
+		C3D_API uint64_t closeBatch();
+		/**
+		 *\~english
+		 *\brief		Releases the ranges of the batches up to given value.
+		 *\param[in]	value	The value of the last completed batch.
+		 *\~french
+		 *\brief		Libère les intervalles des lots jusqu'à la valeur donnée.
+		 *\param[in]	value	La valeur du dernier lot terminé.
+		 */
+		C3D_API void retire( uint64_t value );
+		/**
+		 *\~english
+		 *\brief		Starts a new frame, restoring the frame budget.
+		 *\~french
+		 *\brief		Démarre une nouvelle frame, restaurant le budget de la frame.
+		 */
+		C3D_API void nextFrame();
+		/**
+		 *\~english
+		 *\param[in]	size	A range size.
+		 *\return		\p true if the range can never fit in the ring.
+		 *\~french
+		 *\param[in]	size	Une taille d'intervalle.
+		 *\return		\p true si l'intervalle ne pourra jamais tenir dans l'anneau.
+		 */
+		bool isOversized( VkDeviceSize size )const
+		{
+			return size > m_capacity;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the open batch contains allocations.
+		 *\~french
+		 *\return		\p true si le lot ouvert contient des allocations.
+		 */
+		bool hasOpenBatch()const
+		{
+			return m_openBytes != 0u;
+		}
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		VkDeviceSize getCapacity()const
+		{
+			return m_capacity;
+		}
+
+		VkDeviceSize getFrameBudget()const
+		{
+			return m_frameBudget;
+		}
+
+		VkDeviceSize getUsed()const
+		{
+			return m_used;
+		}
+
+		VkDeviceSize getFrameBytes()const
+		{
+			return m_frameBytes;
+		}
+
+		uint64_t getClosedValue()const
+		{
+			return m_closedValue;
+		}
+
+		uint64_t getRetiredValue()const
+		{
+			return m_retiredValue;
+		}
+		/**@}*/
+
+	private:
+		struct Batch
+		{
+			uint64_t value;
+			VkDeviceSize end;
+			VkDeviceSize bytes;
+		};
+
+	private:
+		VkDeviceSize m_capacity;
+		VkDeviceSize m_frameBudget;
+		VkDeviceSize m_head{ 0u };
+		VkDeviceSize m_tail{ 0u };
+		VkDeviceSize m_used{ 0u };
+		VkDeviceSize m_openBytes{ 0u };
+		VkDeviceSize m_frameBytes{ 0u };
+		uint64_t m_closedValue{ 0u };
+		uint64_t m_retiredValue{ 0u };
+		std::deque< Batch > m_batches;
+	};
+}
+
+#endif
@@ -115,6 +115,13 @@ namespace castor3d
 		 *\brief		Met ç jour la collection.
 		 */
 		C3D_API void update( CpuUpdater & updater );
+		/**
+		 *\~english
+		 *\brief		Updates the billboards vertex buffers, sorted by distance to the camera.
+		 *\~french
+		 *\brief		Met à jour les tampons de sommets des billboards, triés par distance à la caméra.
+		 */
+		C3D_API void update( GpuUpdater & updater );
 		/**
 		 *\~english
 		 *\brief		Creates a new object and adds it to the collection.
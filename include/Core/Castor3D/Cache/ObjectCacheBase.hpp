@@ -10,6 +10,9 @@ See LICENSE file in root folder
 #include "Castor3D/Miscellaneous/Logger.hpp"
 
 #include <CastorUtils/Design/Collection.hpp>
+#include <CastorUtils/Design/SlotMap.hpp>
+
+#include <map>
 
 namespace castor3d
 {
@@ -34,6 +37,9 @@ namespace castor3d
 	public:
 		using OnChangedFunction = std::function< void() >;
 		using OnChanged = castor::Signal < OnChangedFunction >;
+		using Handle = castor::SlotHandle;
+		using ElementSlotMap = castor::SlotMap< Element >;
+		using ElementView = typename ElementSlotMap::SnapshotPtr;
 
 	public:
 		/**
@@ -124,7 +130,10 @@ namespace castor3d
 		 */
 		inline void clear()
 		{
+			LockType lock{ castor::makeUniqueLock( m_elements ) };
 			m_elements.clear();
+			m_handles.clear();
+			m_slots.clear();
 		}
 		/**
 		 *\~english
@@ -165,6 +174,7 @@ namespace castor3d
 				else
 				{
 					m_elements.insert( name, element );
+					doInsertHandle( name, element );
 					onChanged();
 				}
 			}
@@ -202,6 +212,7 @@ namespace castor3d
 				result = m_produce( name, parent, std::forward< Parameters >( parameters )... );
 				m_initialise( result );
 				m_elements.insert( name, result );
+				doInsertHandle( name, result );
 				m_attach( result, parent, m_rootNode.lock(), m_rootCameraNode.lock(), m_rootObjectNode.lock() );
 				doReportCreation( name );
 				onChanged();
@@ -231,6 +242,7 @@ namespace castor3d
 				auto element = m_elements.find( name );
 				m_detach( element );
 				m_elements.erase( name );
+				doEraseHandle( name );
 				onChanged();
 			}
 		}
@@ -256,6 +268,15 @@ namespace castor3d
 					, destination.m_rootObjectNode.lock() );
 			}
 
+			// The merger inserts directly in the destination collection.
+			for ( auto it : destination.m_elements )
+			{
+				if ( destination.m_handles.find( it.first ) == destination.m_handles.end() )
+				{
+					destination.doInsertHandle( it.first, it.second );
+				}
+			}
+
 			clear();
 			onChanged();
 		}
@@ -361,6 +382,66 @@ namespace castor3d
 		{
 			return m_elements.find( name );
 		}
+		/**
+		 *\~english
+		 *\param[in]	name	The object name.
+		 *\return		The handle of the element with given name, an invalid handle if not found.
+		 *\~french
+		 *\param[in]	name	Le nom d'objet.
+		 *\return		Le handle de l'élément avec le nom donné, un handle invalide si non trouvé.
+		 */
+		inline Handle getHandle( Key const & name )const
+		{
+			LockType lock{ castor::makeUniqueLock( m_elements ) };
+			auto it = m_handles.find( name );
+			return it == m_handles.end()
+				? Handle{}
+				: it->second;
+		}
+		/**
+		 *\~english
+		 *\brief		Looks for an element, without locking.
+		 *\remarks		Elements added since last flush are not found.
+		 *\param[in]	handle	The element handle.
+		 *\return		The found element, nullptr if not found or stale.
+		 *\~french
+		 *\brief		Cherche un élément, sans verrou.
+		 *\remarks		Les éléments ajoutés depuis le dernier flush ne sont pas trouvés.
+		 *\param[in]	handle	Le handle de l'élément.
+		 *\return		L'élément trouvé, nullptr si non trouvé ou périmé.
+		 */
+		inline ElementPtr find( Handle const & handle )const
+		{
+			return m_slots.acquire()->get( handle );
+		}
+		/**
+		 *\~english
+		 *\brief		Retrieves the elements, as of last flush.
+		 *\remarks		The view can be iterated without locking the cache, and is not modified by later additions or removals.
+		 *\return		The elements view, to hold during the whole iteration.
+		 *\~french
+		 *\brief		Récupère les éléments, au moment du dernier flush.
+		 *\remarks		La vue peut être parcourue sans verrouiller le cache, et n'est pas modifiée par les ajouts ou suppressions ultérieurs.
+		 *\return		La vue sur les éléments, à conserver durant tout le parcours.
+		 */
+		inline ElementView getView()const
+		{
+			return m_slots.acquire();
+		}
+		/**
+		 *\~english
+		 *\brief		Applies the additions and removals done since last call to the elements view.
+		 *\remarks		Called once per frame, before the elements are read.
+		 *\return		\p true if the view has changed.
+		 *\~french
+		 *\brief		Applique les ajouts et suppressions effectués depuis le dernier appel à la vue sur les éléments.
+		 *\remarks		Appelée une fois par frame, avant la lecture des éléments.
+		 *\return		\p true si la vue a changé.
+		 */
+		inline bool flush()
+		{
+			return m_slots.flush();
+		}
 		/**
 		 *\~english
 		 *\brief		Locks the collection mutex
@@ -431,6 +512,23 @@ namespace castor3d
 		}
 
 	protected:
+		inline void doInsertHandle( Key const & name
+			, ElementPtr element )
+		{
+			m_handles[name] = m_slots.insert( std::move( element ) );
+		}
+
+		inline void doEraseHandle( Key const & name )
+		{
+			auto it = m_handles.find( name );
+
+			if ( it != m_handles.end() )
+			{
+				m_slots.erase( it->second );
+				m_handles.erase( it );
+			}
+		}
+
 		inline void doReportCreation( castor::String const & name )
 		{
 			log::trace << InfoCacheCreatedObject
@@ -477,6 +575,12 @@ namespace castor3d
 		//!\~english	The elements collection.
 		//!\~french		La collection d'éléments.
 		mutable Collection m_elements;
+		//!\~english	The elements handles, by name, guarded by the collection lock.
+		//!\~french		Les handles des éléments, par nom, protégés par le verrou de la collection.
+		std::map< Key, Handle > m_handles;
+		//!\~english	The elements slots, addressed by handle.
+		//!\~french		Les slots des éléments, adressés par handle.
+		ElementSlotMap m_slots;
 		//!\~english	The element producer.
 		//!\~french		Le créateur d'éléments.
 		Producer m_produce;
@@ -27,6 +27,7 @@ See LICENSE file in root folder
 #include <CastorUtils/Graphics/ImageCache.hpp>
 #include <CastorUtils/Graphics/ImageLoader.hpp>
 #include <CastorUtils/Graphics/ImageWriter.hpp>
+#include <CastorUtils/Graphics/PixelBufferCache.hpp>
 #include <CastorUtils/Graphics/RgbaColour.hpp>
 #include <CastorUtils/Log/LoggerInstance.hpp>
 #include <CastorUtils/Miscellaneous/CpuInformations.hpp>
@@ -309,6 +310,11 @@ namespace castor3d
 			return m_imageCache;
 		}
 
+		inline castor::PxBufferCache const & getTextureCache()const
+		{
+			return m_textureCache;
+		}
+
 		inline castor::FontCache const & getFontCache()const
 		{
 			return m_fontCache;
@@ -512,6 +518,7 @@ namespace castor3d
 		DECLARE_CACHE_MEMBER( window, RenderWindow );
 		castor::FontCache m_fontCache;
 		castor::ImageCache m_imageCache;
+		castor::PxBufferCache m_textureCache;
 		std::map< castor::String, castor::AttributeParsersBySection > m_additionalParsers;
 		std::map< castor::String, castor::StrUInt32Map > m_additionalSections;
 		MeshFactorySPtr m_meshFactory;
@@ -67,6 +67,26 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Move only callable, stored inline when small enough.
+	*\~french
+	*\brief
+	*	Appelable uniquement déplaçable, stocké en ligne s'il est assez petit.
+	*/
+	template< typename ... ParamsT >
+	class FrameEventFunctorT;
+	/**
+	*\~english
+	*\brief
+	*	Lock free events queue, with one queue per posting thread, backed by pooled chunks.
+	*\~french
+	*\brief
+	*	File d'évènements sans verrou, avec une file par thread ajoutant des évènements, utilisant un pool de blocs.
+	*/
+	template< typename ... ParamsT >
+	class FrameEventQueueT;
+	/**
+	*\~english
+	*\brief
 	*	User event synchronisation class.
 	*\remarks
 	*	The handler of the frame events. It can add frame events and applies them at the wanted times.
@@ -0,0 +1,233 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_FrameEventQueue_H___
+#define ___C3D_FrameEventQueue_H___
+
+#include "FrameEventModule.hpp"
+#include "Castor3D/Render/RenderModule.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace castor3d
+{
+	template< typename ... ParamsT >
+	class FrameEventFunctorT
+	{
+	public:
+		//!\~english	The size of the callables stored inline, bigger ones are allocated.
+		//!\~french		La taille des appelables stockés en ligne, les plus gros sont alloués.
+		static size_t constexpr InlineSize = 6u * sizeof( void * );
+
+	public:
+		FrameEventFunctorT( FrameEventFunctorT const & ) = delete;
+		FrameEventFunctorT & operator=( FrameEventFunctorT const & ) = delete;
+		FrameEventFunctorT() = default;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	functor	The callable, may be move only.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	functor	L'appelable, peut n'être que déplaçable.
+		 */
+		template< typename FunctorT
+			, typename = std::enable_if_t< !std::is_same_v< std::decay_t< FunctorT >, FrameEventFunctorT > > >
+		FrameEventFunctorT( FunctorT && functor );
+		FrameEventFunctorT( FrameEventFunctorT && rhs )noexcept;
+		FrameEventFunctorT & operator=( FrameEventFunctorT && rhs )noexcept;
+		~FrameEventFunctorT()noexcept;
+		/**
+		 *\~english
+		 *\brief		Calls the stored callable.
+		 *\~french
+		 *\brief		Appelle l'appelable stocké.
+		 */
+		void operator()( ParamsT ... params )
+		{
+			m_ops->invoke( m_storage.data(), params... );
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the callable is stored inline.
+		 *\~french
+		 *\return		\p true si l'appelable est stocké en ligne.
+		 */
+		bool isInline()const
+		{
+			return m_ops && m_ops->isInline;
+		}
+
+		explicit operator bool()const
+		{
+			return m_ops != nullptr;
+		}
+
+	private:
+		struct Operations
+		{
+			void( *invoke )( void * storage, ParamsT ... params );
+			void( *move )( void * src, void * dst )noexcept;
+			void( *destroy )( void * storage )noexcept;
+			bool isInline;
+		};
+
+		template< typename FunctorT >
+		struct InlineOperations;
+		template< typename FunctorT >
+		struct HeapOperations;
+
+		void doReset()noexcept;
+
+	private:
+		alignas( std::max_align_t ) std::array< uint8_t, InlineSize > m_storage;
+		Operations const * m_ops{ nullptr };
+	};
+
+	template< typename ... ParamsT >
+	class FrameEventQueueT
+	{
+	public:
+		using Functor = FrameEventFunctorT< ParamsT... >;
+		using Clock = std::chrono::steady_clock;
+		//!\~english	The events count per pooled chunk.
+		//!\~french		Le nombre d'évènements par bloc du pool.
+		static uint32_t constexpr ChunkSize = 256u;
+
+	public:
+		FrameEventQueueT( FrameEventQueueT const & ) = delete;
+		FrameEventQueueT & operator=( FrameEventQueueT const & ) = delete;
+		FrameEventQueueT( FrameEventQueueT && ) = delete;
+		FrameEventQueueT & operator=( FrameEventQueueT && ) = delete;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\~french
+		 *\brief		Constructeur.
+		 */
+		FrameEventQueueT();
+		/**
+		 *\~english
+		 *\brief		Destructor, destroys the remaining events without calling them.
+		 *\~french
+		 *\brief		Destructeur, détruit les évènements restants sans les appeler.
+		 */
+		~FrameEventQueueT();
+		/**
+		 *\~english
+		 *\brief		Adds an event, from any thread, without locking.
+		 *\remarks		Each thread writes in its own queue, whose chunks are recycled once processed.
+		 *\param[in]	functor	The event.
+		 *\~french
+		 *\brief		Ajoute un évènement, depuis n'importe quel thread, sans verrou.
+		 *\remarks		Chaque thread écrit dans sa propre file, dont les blocs sont recyclés une fois traités.
+		 *\param[in]	functor	L'évènement.
+		 */
+		void push( Functor functor );
+		/**
+		 *\~english
+		 *\brief		Processes the events, in their posting order.
+		 *\remarks		The posting order is the sequences order. An event whose sequence is taken, but which is still being written, is waited for.
+		 *				<br />The queue accesses must be serialised between the draining threads. \p process may run outside of that serialisation.
+		 *				<br />The event is removed from the queue before being given to \p process, which can then post or drain.
+		 *\param[in]	limit		The events posted from this sequence are left for a next drain.
+		 *\param[in]	deadline	Once reached, the remaining events are left for a next drain.
+		 *\param[in]	process		Receives each event.
+		 *\return		The processed events count.
+		 *\~french
+		 *\brief		Traite les évènements, dans leur ordre d'ajout.
+		 *\remarks		L'ordre d'ajout est celui des séquences. Un évènement dont la séquence est prise, mais qui est toujours en cours d'écriture, est attendu.
+		 *				<br />Les accès à la file doivent être sérialisés entre les threads qui la vident. \p process peut être exécuté hors de cette sérialisation.
+		 *				<br />L'évènement est retiré de la file avant d'être donné à \p process, qui peut donc ajouter des évènements ou vider la file.
+		 *\param[in]	limit		Les évènements ajoutés à partir de cette séquence sont laissés pour un traitement suivant.
+		 *\param[in]	deadline	Une fois atteinte, les évènements restants sont laissés pour un traitement suivant.
+		 *\param[in]	process		Reçoit chaque évènement.
+		 *\return		Le nombre d'évènements traités.
+		 */
+		template< typename ProcessT >
+		size_t drain( uint64_t limit
+			, Clock::time_point deadline
+			, ProcessT process );
+		/**
+		 *\~english
+		 *\return		The sequence of the next posted event.
+		 *\~french
+		 *\return		La séquence du prochain évènement ajouté.
+		 */
+		uint64_t getSequence()const
+		{
+			return m_sequence.load( std::memory_order_acquire );
+		}
+		/**
+		 *\~english
+		 *\return		The posted events count, not yet processed.
+		 *\~french
+		 *\return		Le nombre d'évènements ajoutés, pas encore traités.
+		 */
+		size_t getPendingCount()const
+		{
+			return size_t( getSequence() - m_processed.load( std::memory_order_acquire ) );
+		}
+
+	private:
+		struct Event
+		{
+			uint64_t sequence;
+			Functor functor;
+		};
+
+		struct Chunk
+		{
+			Event & get( uint32_t index )
+			{
+				return *reinterpret_cast< Event * >( &events[index] );
+			}
+
+			std::array< std::aligned_storage_t< sizeof( Event ), alignof( Event ) >, ChunkSize > events;
+			std::atomic< uint32_t > written{ 0u };
+			std::atomic< Chunk * > next{ nullptr };
+			uint32_t writeIndex{ 0u };
+			uint32_t readIndex{ 0u };
+			Chunk * nextFree{ nullptr };
+		};
+
+		struct Producer
+		{
+			// Producer thread side.
+			Chunk * tail{ nullptr };
+			Chunk * cache{ nullptr };
+			std::vector< std::unique_ptr< Chunk > > chunks;
+			// Shared, the consumer gives the processed chunks back.
+			std::atomic< Chunk * > recycled{ nullptr };
+			// Consumer side.
+			Chunk * head{ nullptr };
+			Producer * next{ nullptr };
+		};
+
+	private:
+		Producer & doGetProducer();
+		Chunk * doAcquireChunk( Producer & producer );
+		Event * doPeek( Producer & producer );
+		void doPop( Producer & producer );
+		static uint64_t doGetNextId();
+
+	private:
+		uint64_t m_id;
+		std::atomic< Producer * > m_producers{ nullptr };
+		std::atomic< uint64_t > m_sequence{ 0u };
+		std::atomic< uint64_t > m_processed{ 0u };
+	};
+
+	using CpuFrameEventQueue = FrameEventQueueT<>;
+	using GpuFrameEventQueue = FrameEventQueueT< RenderDevice const & >;
+}
+
+#include "FrameEventQueue.inl"
+
+#endif
@@ -0,0 +1,346 @@
+#include <algorithm>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace castor3d
+{
+	//*********************************************************************************************
+
+	template< typename ... ParamsT >
+	template< typename FunctorT >
+	struct FrameEventFunctorT< ParamsT... >::InlineOperations
+	{
+		static void invoke( void * storage, ParamsT ... params )
+		{
+			( *static_cast< FunctorT * >( storage ) )( params... );
+		}
+
+		static void move( void * src, void * dst )noexcept
+		{
+			new( dst ) FunctorT{ std::move( *static_cast< FunctorT * >( src ) ) };
+			static_cast< FunctorT * >( src )->~FunctorT();
+		}
+
+		static void destroy( void * storage )noexcept
+		{
+			static_cast< FunctorT * >( storage )->~FunctorT();
+		}
+
+		static Operations constexpr operations{ &invoke, &move, &destroy, true };
+	};
+
+	template< typename ... ParamsT >
+	template< typename FunctorT >
+	struct FrameEventFunctorT< ParamsT... >::HeapOperations
+	{
+		static FunctorT *& get( void * storage )
+		{
+			return *static_cast< FunctorT ** >( storage );
+		}
+
+		static void invoke( void * storage, ParamsT ... params )
+		{
+			( *get( storage ) )( params... );
+		}
+
+		static void move( void * src, void * dst )noexcept
+		{
+			new( dst ) FunctorT *{ get( src ) };
+		}
+
+		static void destroy( void * storage )noexcept
+		{
+			delete get( storage );
+		}
+
+		static Operations constexpr operations{ &invoke, &move, &destroy, false };
+	};
+
+	template< typename ... ParamsT >
+	template< typename FunctorT, typename >
+	FrameEventFunctorT< ParamsT... >::FrameEventFunctorT( FunctorT && functor )
+	{
+		using FuncT = std::decay_t< FunctorT >;
+
+		if constexpr ( sizeof( FuncT ) <= InlineSize
+			&& alignof( FuncT ) <= alignof( std::max_align_t )
+			&& std::is_nothrow_move_constructible_v< FuncT > )
+		{
+			new( m_storage.data() ) FuncT{ std::forward< FunctorT >( functor ) };
+			m_ops = &InlineOperations< FuncT >::operations;
+		}
+		else
+		{
+			new( m_storage.data() ) FuncT *{ new FuncT{ std::forward< FunctorT >( functor ) } };
+			m_ops = &HeapOperations< FuncT >::operations;
+		}
+	}
+
+	template< typename ... ParamsT >
+	FrameEventFunctorT< ParamsT... >::FrameEventFunctorT( FrameEventFunctorT && rhs )noexcept
+		: m_ops{ rhs.m_ops }
+	{
+		if ( m_ops )
+		{
+			m_ops->move( rhs.m_storage.data(), m_storage.data() );
+			rhs.m_ops = nullptr;
+		}
+	}
+
+	template< typename ... ParamsT >
+	FrameEventFunctorT< ParamsT... > & FrameEventFunctorT< ParamsT... >::operator=( FrameEventFunctorT && rhs )noexcept
+	{
+		if ( this != &rhs )
+		{
+			doReset();
+			m_ops = rhs.m_ops;
+
+			if ( m_ops )
+			{
+				m_ops->move( rhs.m_storage.data(), m_storage.data() );
+				rhs.m_ops = nullptr;
+			}
+		}
+
+		return *this;
+	}
+
+	template< typename ... ParamsT >
+	FrameEventFunctorT< ParamsT... >::~FrameEventFunctorT()noexcept
+	{
+		doReset();
+	}
+
+	template< typename ... ParamsT >
+	void FrameEventFunctorT< ParamsT... >::doReset()noexcept
+	{
+		if ( m_ops )
+		{
+			m_ops->destroy( m_storage.data() );
+			m_ops = nullptr;
+		}
+	}
+
+	//*********************************************************************************************
+
+	template< typename ... ParamsT >
+	FrameEventQueueT< ParamsT... >::FrameEventQueueT()
+		: m_id{ doGetNextId() }
+	{
+	}
+
+	template< typename ... ParamsT >
+	FrameEventQueueT< ParamsT... >::~FrameEventQueueT()
+	{
+		auto producer = m_producers.load( std::memory_order_acquire );
+
+		while ( producer )
+		{
+			auto chunk = producer->head;
+
+			while ( chunk )
+			{
+				auto written = chunk->written.load( std::memory_order_acquire );
+
+				for ( auto index = chunk->readIndex; index < written; ++index )
+				{
+					chunk->get( index ).~Event();
+				}
+
+				chunk = chunk->next.load( std::memory_order_acquire );
+			}
+
+			auto next = producer->next;
+			delete producer;
+			producer = next;
+		}
+	}
+
+	template< typename ... ParamsT >
+	void FrameEventQueueT< ParamsT... >::push( Functor functor )
+	{
+		auto & producer = doGetProducer();
+
+		if ( producer.tail->writeIndex == ChunkSize )
+		{
+			auto chunk = doAcquireChunk( producer );
+			producer.tail->next.store( chunk, std::memory_order_release );
+			producer.tail = chunk;
+		}
+
+		auto & chunk = *producer.tail;
+		auto index = chunk.writeIndex++;
+		new( &chunk.events[index] ) Event{ m_sequence.fetch_add( 1u, std::memory_order_acq_rel )
+			, std::move( functor ) };
+		chunk.written.store( index + 1u, std::memory_order_release );
+	}
+
+	template< typename ... ParamsT >
+	template< typename ProcessT >
+	size_t FrameEventQueueT< ParamsT... >::drain( uint64_t limit
+		, Clock::time_point deadline
+		, ProcessT process )
+	{
+		size_t result = 0u;
+		bool hasDeadline = deadline != Clock::time_point::max();
+
+		while ( true )
+		{
+			// The events are processed in sequence order, so the next one is the processed events count.
+			auto sequence = m_processed.load( std::memory_order_acquire );
+
+			if ( sequence >= limit )
+			{
+				break;
+			}
+
+			// Each thread's queue is ordered, the next event is at the front of one of them.
+			Producer * current{ nullptr };
+			Event * event{ nullptr };
+
+			for ( auto producer = m_producers.load( std::memory_order_acquire ); producer && !event; producer = producer->next )
+			{
+				auto front = doPeek( *producer );
+
+				if ( front
+					&& front->sequence == sequence )
+				{
+					current = producer;
+					event = front;
+				}
+			}
+
+			if ( !event )
+			{
+				// Its sequence is taken, but its producer is still writing it.
+				std::this_thread::yield();
+				continue;
+			}
+
+			Functor functor{ std::move( event->functor ) };
+			doPop( *current );
+			++result;
+			process( functor );
+
+			if ( hasDeadline
+				&& Clock::now() >= deadline )
+			{
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	template< typename ... ParamsT >
+	typename FrameEventQueueT< ParamsT... >::Producer & FrameEventQueueT< ParamsT... >::doGetProducer()
+	{
+		thread_local std::vector< std::pair< uint64_t, Producer * > > threadProducers;
+		auto it = std::find_if( threadProducers.begin()
+			, threadProducers.end()
+			, [this]( std::pair< uint64_t, Producer * > const & lookup )
+			{
+				return lookup.first == m_id;
+			} );
+
+		if ( it != threadProducers.end() )
+		{
+			return *it->second;
+		}
+
+		// First event posted from this thread, its queue is registered once for all.
+		auto producer = new Producer{};
+		producer->tail = doAcquireChunk( *producer );
+		producer->head = producer->tail;
+		producer->next = m_producers.load( std::memory_order_relaxed );
+
+		while ( !m_producers.compare_exchange_weak( producer->next
+			, producer
+			, std::memory_order_release
+			, std::memory_order_relaxed ) )
+		{
+		}
+
+		threadProducers.emplace_back( m_id, producer );
+		return *producer;
+	}
+
+	template< typename ... ParamsT >
+	typename FrameEventQueueT< ParamsT... >::Chunk * FrameEventQueueT< ParamsT... >::doAcquireChunk( Producer & producer )
+	{
+		if ( !producer.cache )
+		{
+			producer.cache = producer.recycled.exchange( nullptr, std::memory_order_acquire );
+		}
+
+		if ( !producer.cache )
+		{
+			producer.chunks.push_back( std::make_unique< Chunk >() );
+			return producer.chunks.back().get();
+		}
+
+		auto result = producer.cache;
+		producer.cache = result->nextFree;
+		result->written.store( 0u, std::memory_order_relaxed );
+		result->next.store( nullptr, std::memory_order_relaxed );
+		result->writeIndex = 0u;
+		result->readIndex = 0u;
+		result->nextFree = nullptr;
+		return result;
+	}
+
+	template< typename ... ParamsT >
+	typename FrameEventQueueT< ParamsT... >::Event * FrameEventQueueT< ParamsT... >::doPeek( Producer & producer )
+	{
+		auto chunk = producer.head;
+
+		if ( chunk->readIndex == ChunkSize )
+		{
+			auto next = chunk->next.load( std::memory_order_acquire );
+
+			if ( !next )
+			{
+				return nullptr;
+			}
+
+			// The producer has moved to the next chunk, this one can be given back.
+			producer.head = next;
+			chunk->nextFree = producer.recycled.load( std::memory_order_relaxed );
+
+			while ( !producer.recycled.compare_exchange_weak( chunk->nextFree
+				, chunk
+				, std::memory_order_release
+				, std::memory_order_relaxed ) )
+			{
+			}
+
+			chunk = next;
+		}
+
+		if ( chunk->readIndex == chunk->written.load( std::memory_order_acquire ) )
+		{
+			return nullptr;
+		}
+
+		return &chunk->get( chunk->readIndex );
+	}
+
+	template< typename ... ParamsT >
+	void FrameEventQueueT< ParamsT... >::doPop( Producer & producer )
+	{
+		auto & chunk = *producer.head;
+		chunk.get( chunk.readIndex ).~Event();
+		++chunk.readIndex;
+		m_processed.fetch_add( 1u, std::memory_order_release );
+	}
+
+	template< typename ... ParamsT >
+	uint64_t FrameEventQueueT< ParamsT... >::doGetNextId()
+	{
+		static std::atomic< uint64_t > id{ 0u };
+		return ++id;
+	}
+
+	//*********************************************************************************************
+}
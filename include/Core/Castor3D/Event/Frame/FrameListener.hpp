@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___C3D_FrameListener_H___
 
 #include "FrameEventModule.hpp"
+#include "FrameEventQueue.hpp"
 #include "Castor3D/Render/RenderModule.hpp"
 
 #include <CastorUtils/Design/Named.hpp>
@@ -58,11 +59,38 @@ namespace castor3d
 		C3D_API void postEvent( GpuFrameEventUPtr event );
 		/**
 		 *\~english
-		 *\brief		Applies all events of a given type, then discards them.
+		 *\brief		Puts an event in the corresponding queue, without allocating the event.
+		 *\remarks		Callables taking a castor3d::RenderDevice are GPU events, the other ones are CPU events.
+		 *\param[in]	type	The event type.
+		 *\param[in]	functor	The event callable.
+		 *\~french
+		 *\brief		Ajoute un évènement à la file correspondante, sans allouer l'évènement.
+		 *\remarks		Les appelables prenant un castor3d::RenderDevice sont des évènements GPU, les autres sont des évènements CPU.
+		 *\param[in]	type	Le type de l'évènement.
+		 *\param[in]	functor	L'appelable de l'évènement.
+		 */
+		template< typename FunctorT >
+		void postEvent( EventType type
+			, FunctorT && functor )
+		{
+			if constexpr ( std::is_invocable_v< FunctorT, RenderDevice const & > )
+			{
+				m_gpuEvents[size_t( type )].push( std::forward< FunctorT >( functor ) );
+			}
+			else
+			{
+				m_cpuEvents[size_t( type )].push( std::forward< FunctorT >( functor ) );
+			}
+		}
+		/**
+		 *\~english
+		 *\brief		Applies the events of a given type, within the events budget, then discards them.
+		 *\remarks		The events posted while firing are left for the next call.
 		 *\param[in]	type	The type of events to fire.
 		 *\return		\p true si tous les évènements se sont exécutés sans erreur.
 		 *\~french
-		 *\brief		Traite tous les évènements d'un type donné.
+		 *\brief		Traite les évènements d'un type donné, dans la limite du budget d'évènements.
+		 *\remarks		Les évènements ajoutés pendant le traitement sont laissés pour l'appel suivant.
 		 *\param[in]	type	Le type des évènements à traiter.
 		 *\return		\p true if all events were processed successfully.
 		 */
@@ -70,15 +98,40 @@ namespace castor3d
 			, RenderDevice const & device );
 		/**
 		 *\~english
-		 *\brief		Applies all events of a given type, then discards them.
+		 *\brief		Applies the events of a given type, within the events budget, then discards them.
+		 *\remarks		The events posted while firing are left for the next call.
 		 *\param[in]	type	The type of events to fire.
 		 *\return		\p true si tous les évènements se sont exécutés sans erreur.
 		 *\~french
-		 *\brief		Traite tous les évènements d'un type donné.
+		 *\brief		Traite les évènements d'un type donné, dans la limite du budget d'évènements.
+		 *\remarks		Les évènements ajoutés pendant le traitement sont laissés pour l'appel suivant.
 		 *\param[in]	type	Le type des évènements à traiter.
 		 *\return		\p true if all events were processed successfully.
 		 */
 		C3D_API bool fireEvents( EventType type );
+		/**
+		 *\~english
+		 *\brief		Applies all events of a given type, regardless of the events budget, then discards them.
+		 *\param[in]	type	The type of events to fire.
+		 *\return		\p true si tous les évènements se sont exécutés sans erreur.
+		 *\~french
+		 *\brief		Traite tous les évènements d'un type donné, sans tenir compte du budget d'évènements.
+		 *\param[in]	type	Le type des évènements à traiter.
+		 *\return		\p true if all events were processed successfully.
+		 */
+		C3D_API bool fireAllEvents( EventType type
+			, RenderDevice const & device );
+		/**
+		 *\~english
+		 *\brief		Applies all events of a given type, regardless of the events budget, then discards them.
+		 *\param[in]	type	The type of events to fire.
+		 *\return		\p true si tous les évènements se sont exécutés sans erreur.
+		 *\~french
+		 *\brief		Traite tous les évènements d'un type donné, sans tenir compte du budget d'évènements.
+		 *\param[in]	type	Le type des évènements à traiter.
+		 *\return		\p true if all events were processed successfully.
+		 */
+		C3D_API bool fireAllEvents( EventType type );
 		/**
 		 *\~english
 		 *\brief		Discards all events of a given type.
@@ -88,6 +141,38 @@ namespace castor3d
 		 *\param[in]	type	Le type des évènements à traiter.
 		 */
 		C3D_API void flushEvents( EventType type );
+		/**
+		 *\~english
+		 *\brief		Sets the time given to each fireEvents call, the remaining events being fired by the next calls.
+		 *\remarks		Spreads the bursts of events (at scene loading, for example) over several frames.
+		 *\param[in]	value	The budget, zero for no limit.
+		 *\~french
+		 *\brief		Définit le temps donné à chaque appel à fireEvents, les évènements restants étant traités par les appels suivants.
+		 *\remarks		Répartit les salves d'évènements (au chargement d'une scène, par exemple) sur plusieurs frames.
+		 *\param[in]	value	Le budget, zéro pour aucune limite.
+		 */
+		void setEventsBudget( castor::Microseconds value )
+		{
+			m_eventsBudget = value;
+		}
+
+		castor::Microseconds getEventsBudget()const
+		{
+			return m_eventsBudget;
+		}
+		/**
+		 *\~english
+		 *\param[in]	type	The events type.
+		 *\return		The posted events count, not yet fired.
+		 *\~french
+		 *\param[in]	type	Le type des évènements.
+		 *\return		Le nombre d'évènements ajoutés, pas encore traités.
+		 */
+		size_t getPendingCount( EventType type )const
+		{
+			return m_cpuEvents[size_t( type )].getPendingCount()
+				+ m_gpuEvents[size_t( type )].getPendingCount();
+		}
 
 	protected:
 		/**
@@ -99,14 +184,17 @@ namespace castor3d
 		C3D_API virtual void doFlush() {}
 
 	protected:
-		//!\~english	The CPU events arrays.
-		//!\~french		Les tableaux d'évènements CPU.
-		std::array< CpuFrameEventPtrArray,	size_t( EventType::eCount ) > m_cpuEvents;
-		//!\~english	The GPU events arrays.
-		//!\~french		Les tableaux d'évènements GPU.
-		std::array< GpuFrameEventPtrArray,	size_t( EventType::eCount ) > m_gpuEvents;
-		//!\~english	Mutex to make this class thread safe.
-		//!\~french		Mutex pour rendre cette classe thread safe.
+		//!\~english	The CPU events queues.
+		//!\~french		Les files d'évènements CPU.
+		std::array< CpuFrameEventQueue, size_t( EventType::eCount ) > m_cpuEvents;
+		//!\~english	The GPU events queues.
+		//!\~french		Les files d'évènements GPU.
+		std::array< GpuFrameEventQueue, size_t( EventType::eCount ) > m_gpuEvents;
+		//!\~english	The time given to each fireEvents call, zero for no limit.
+		//!\~french		Le temps donné à chaque appel à fireEvents, zéro pour aucune limite.
+		castor::Microseconds m_eventsBudget{ 0u };
+		//!\~english	Mutex serialising the events queues reads, the posting being lock free and the events running without it.
+		//!\~french		Mutex sérialisant la lecture des files d'évènements, l'ajout étant sans verrou et les évènements s'exécutant sans lui.
 		std::recursive_mutex m_mutex;
 	};
 }
@@ -158,6 +158,50 @@ namespace castor3d
 	C3D_API bool operator!=( TextureConfiguration const & lhs, TextureConfiguration const & rhs );
 	/**@}*/
 	C3D_API TextureFlags getFlags( TextureConfiguration const & config );
+	/**
+	*\~english
+	*\brief
+	*	A block compressed format, and the texture configuration matching the compressed image components.
+	*\~french
+	*\brief
+	*	Un format compressé par blocs, et la configuration de texture correspondant aux composantes de l'image compressée.
+	*/
+	struct BlockCompressedFormat
+	{
+		//!\~english	The compressed format, castor::PixelFormat::eUNDEFINED if no image component is used.
+		//!\~french		Le format compressé, castor::PixelFormat::eUNDEFINED si aucune composante de l'image n'est utilisée.
+		castor::PixelFormat format{ castor::PixelFormat::eUNDEFINED };
+		//!\~english	The image component to compress, for single component formats.
+		//!\~french		La composante de l'image à compresser, pour les formats à composante unique.
+		castor::PixelComponent component{ castor::PixelComponent::eRed };
+		//!\~english	The configuration to use once the image is compressed.
+		//!\~french		La configuration à utiliser une fois l'image compressée.
+		TextureConfiguration configuration;
+	};
+	/**
+	 *\~english
+	 *\brief		Selects the block compressed format fitting the given configuration.
+	 *\remarks		The returned configuration masks match the compressed image components:
+	 *				<br />A normal only configuration gives BC5, with the normal mask reduced to RG (Z is then reconstructed in shaders).
+	 *				<br />A single component configuration gives BC4, with the mask moved to the red component.
+	 *				<br />Other configurations give BC7 (BC3 in fast mode) when alpha is used, BC1 otherwise.
+	 *				<br />The given configuration stays valid for the uncompressed image, in case the device doesn't support the format.
+	 *\param[in]	config	The texture configuration.
+	 *\param[in]	quality	The compression quality.
+	 *\return		The compressed format, and its configuration.
+	 *\~french
+	 *\brief		Sélectionne le format compressé par blocs correspondant à la configuration donnée.
+	 *\remarks		Les masques de la configuration retournée correspondent aux composantes de l'image compressée :
+	 *				<br />Une configuration de normales uniquement donne du BC5, avec le masque de normales réduit à RG (Z est alors reconstruit dans les shaders).
+	 *				<br />Une configuration à composante unique donne du BC4, avec le masque déplacé vers la composante rouge.
+	 *				<br />Les autres configurations donnent du BC7 (BC3 en mode rapide) si l'alpha est utilisé, du BC1 sinon.
+	 *				<br />La configuration donnée reste valide pour l'image non compressée, au cas où le device ne supporte pas le format.
+	 *\param[in]	config	La configuration de texture.
+	 *\param[in]	quality	La qualité de compression.
+	 *\return		Le format compressé, et sa configuration.
+	 */
+	C3D_API BlockCompressedFormat getBlockCompressedFormat( TextureConfiguration const & config
+		, castor::BlockCompressionQuality quality );
 }
 
 #endif
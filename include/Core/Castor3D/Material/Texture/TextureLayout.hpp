@@ -10,6 +10,7 @@ See LICENSE file in root folder
 #include "Castor3D/Miscellaneous/DebugName.hpp"
 #include "Castor3D/Render/RenderDevice.hpp"
 
+#include <CastorUtils/Graphics/BlockCompression.hpp>
 #include <CastorUtils/Graphics/Image.hpp>
 
 #include <ashespp/Image/Image.hpp>
@@ -209,12 +210,19 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Initialises the texture and all its views.
+		 *\param[in]	device			The GPU device.
+		 *\param[in]	deferUploads	\p true to let the device upload queue submit the data upload with the next frame's batch.
+		 *								<br />\p false to submit it right away, for textures consumed during their owner's initialisation.
 		 *\return		\p true if OK.
 		 *\~french
 		 *\brief		Initialise la texture et toutes ses vues.
+		 *\param[in]	device			Le device GPU.
+		 *\param[in]	deferUploads	\p true pour laisser la file de mise en ligne du device soumettre les données avec le lot de la prochaine frame.
+		 *								<br />\p false pour les soumettre immédiatement, pour les textures consommées pendant l'initialisation de leur propriétaire.
 		 *\return		\p true si tout s'est bien passé.
 		 */
-		C3D_API bool initialise( RenderDevice const & device );
+		C3D_API bool initialise( RenderDevice const & device
+			, bool deferUploads = false );
 		/**
 		 *\~english
 		 *\brief		Cleans up the texture and all its views.
@@ -225,10 +233,15 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Generate texture mipmaps
+		 *\param[in]	device			The GPU device.
+		 *\param[in]	deferUploads	\p true to let the device upload queue submit the generation with the next frame's batch.
 		 *\~french
 		 *\brief		Génère les mipmaps de la texture
+		 *\param[in]	device			Le device GPU.
+		 *\param[in]	deferUploads	\p true pour laisser la file de mise en ligne du device soumettre la génération avec le lot de la prochaine frame.
 		 */
-		C3D_API void generateMipmaps( RenderDevice const & device )const;
+		C3D_API void generateMipmaps( RenderDevice const & device
+			, bool deferUploads = false )const;
 		/**
 		 *\~english
 		 *\brief		Generate texture mipmaps
@@ -236,6 +249,27 @@ namespace castor3d
 		 *\brief		Génère les mipmaps de la texture
 		 */
 		C3D_API void generateMipmaps( ashes::CommandBuffer & cmd )const;
+		/**
+		 *\~english
+		 *\brief		Requests a CPU block compression of the texture, at initialisation.
+		 *\remarks		Only static 2D single layer textures are compressed, and only if the device can sample the compressed format.
+		 *				<br />Mipmaps are then generated on CPU, since compressed images can't be blit destinations.
+		 *				<br />Must be called before setSource for the compressed image to be cached on disk.
+		 *\param[in]	format		The block compressed format (castor::PixelFormat::eUNDEFINED to disable compression).
+		 *\param[in]	options		The encoder options.
+		 *\param[in]	component	The source image component, for single component formats.
+		 *\~french
+		 *\brief		Demande une compression par blocs de la texture sur CPU, lors de l'initialisation.
+		 *\remarks		Seules les textures statiques 2D à une couche sont compressées, et seulement si le device peut échantillonner le format compressé.
+		 *				<br />Les mipmaps sont alors générés sur CPU, les images compressées ne pouvant être destination d'un blit.
+		 *				<br />Doit être appelée avant setSource pour que l'image compressée soit mise en cache sur disque.
+		 *\param[in]	format		Le format compressé par blocs (castor::PixelFormat::eUNDEFINED pour désactiver la compression).
+		 *\param[in]	options		Les options de l'encodeur.
+		 *\param[in]	component	La composante de l'image source, pour les formats à composante unique.
+		 */
+		C3D_API void setCompression( castor::PixelFormat format
+			, castor::BlockCompressionOptions const & options
+			, castor::PixelComponent component = castor::PixelComponent::eRed );
 		/**
 		 *\name Whole texture access.
 		 **/
@@ -251,8 +285,25 @@ namespace castor3d
 			, bool isStatic = false );
 		C3D_API void setSource( castor::PxBufferBaseSPtr buffer
 			, bool isStatic = false );
+		/**
+		 *\~english
+		 *\brief		Sets the whole layout source from an image file.
+		 *\remarks		Missing mip levels are generated on CPU, and the result is stored in the engine's texture cache.
+		 *				<br />Later loads of the same file, with the same settings, read the cached result without decoding the file.
+		 *\param[in]	folder			The image folder.
+		 *\param[in]	relative		The image path, relative to \p folder.
+		 *\param[in]	gammaCorrection	Tells if the image colours are sRGB encoded, mipmaps are then filtered in linear space.
+		 *\~french
+		 *\brief		Définit la source de tout le layout depuis un fichier image.
+		 *\remarks		Les niveaux de mip manquants sont générés sur CPU, et le résultat est stocké dans le cache de textures du moteur.
+		 *				<br />Les chargements suivants du même fichier, avec les mêmes paramètres, lisent le résultat en cache sans décoder le fichier.
+		 *\param[in]	folder			Le dossier de l'image.
+		 *\param[in]	relative		Le chemin de l'image, relatif à \p folder.
+		 *\param[in]	gammaCorrection	Dit si les couleurs de l'image sont encodées en sRGB, les mipmaps sont alors filtrés dans l'espace linéaire.
+		 */
 		C3D_API void setSource( castor::Path const & folder
-			, castor::Path const & relative );
+			, castor::Path const & relative
+			, bool gammaCorrection = false );
 		C3D_API void setSource( VkExtent3D const & extent
 			, VkFormat format );
 		inline void setSource( VkExtent2D const & extent
@@ -604,6 +655,16 @@ namespace castor3d
 		{
 			return m_static;
 		}
+		/**
+		 *\~english
+		 *\return		\p true if the image components were laid out for the requested compression (see setCompression), whether the device supports it or not.
+		 *\~french
+		 *\return		\p true si les composantes de l'image ont été disposées pour la compression demandée (cf. setCompression), que le device la supporte ou non.
+		 */
+		inline bool isCompressionApplied()const
+		{
+			return m_compressionApplied;
+		}
 
 		inline VkImageType getType()const
 		{
@@ -730,10 +791,18 @@ namespace castor3d
 		void doUpdateMips( bool genNeeded, uint32_t mipLevels );
 		void doUpdateLayerMip( bool genNeeded, uint32_t layer, uint32_t level );
 		void doUpdateLayerMips( bool genNeeded, uint32_t layer, uint32_t mipLevels );
+		void doCompress( RenderDevice const & device );
+		void doDecompress( RenderDevice const & device );
 
 	private:
 		bool m_initialised{ false };
 		bool m_static{ false };
+		castor::PixelFormat m_compressedFormat{ castor::PixelFormat::eUNDEFINED };
+		castor::BlockCompressionOptions m_compressionOptions;
+		castor::PixelComponent m_compressedComponent{ castor::PixelComponent::eRed };
+		bool m_compressionApplied{ false };
+		bool m_gammaCorrection{ false };
+		uint64_t m_cacheKey{ 0u };
 		ashes::ImageCreateInfo m_info;
 		VkMemoryPropertyFlags m_properties;
 		castor::Image m_image;
@@ -742,6 +811,7 @@ namespace castor3d
 		ArrayView< CubeView > m_cubeView;
 		SliceView< MipView > m_sliceView;
 		ashes::ImagePtr m_texture;
+		mutable uint64_t m_uploadTicket{ 0u };
 	};
 
 	inline ashes::ImagePtr makeImage( RenderDevice const & device
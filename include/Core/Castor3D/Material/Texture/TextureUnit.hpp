@@ -216,6 +216,17 @@ namespace castor3d
 		*/
 		/**@{*/
 		C3D_API void setConfiguration( TextureConfiguration value );
+		/**
+		 *\~english
+		 *\brief		Sets the configuration matching the compressed image components.
+		 *\remarks		It replaces the configuration at initialisation, only if the texture is compressed (see TextureLayout::isCompressionApplied).
+		 *\param[in]	value	The configuration, from getBlockCompressedFormat.
+		 *\~french
+		 *\brief		Définit la configuration correspondant aux composantes de l'image compressée.
+		 *\remarks		Elle remplace la configuration lors de l'initialisation, seulement si la texture est compressée (cf. TextureLayout::isCompressionApplied).
+		 *\param[in]	value	La configuration, venant de getBlockCompressedFormat.
+		 */
+		C3D_API void setCompressedConfiguration( TextureConfiguration value );
 
 		inline void setRenderTarget( RenderTargetSPtr value )
 		{
@@ -240,6 +251,7 @@ namespace castor3d
 		friend class TextureRenderer;
 		RenderDevice const * m_device{ nullptr };
 		TextureConfiguration m_configuration;
+		std::unique_ptr< TextureConfiguration > m_compressedConfiguration;
 		castor::Matrix4x4f m_transformations;
 		TextureLayoutSPtr m_texture;
 		RenderTargetWPtr m_renderTarget;
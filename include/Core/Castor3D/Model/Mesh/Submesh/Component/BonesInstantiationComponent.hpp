@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Castor3D/Model/Mesh/Submesh/Component/BonesComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/InstantiationComponent.hpp"
+#include "Castor3D/Model/Skeleton/BonePaletteAllocator.hpp"
 
 #include "Castor3D/Shader/ShaderBuffer.hpp"
 
@@ -78,6 +79,16 @@ namespace castor3d
 		{
 			return *m_instancedBonesBuffer;
 		}
+		/**
+		 *\~english
+		 *\return		The allocator of the bone palettes, inside the bone instantiation buffer.
+		 *\~french
+		 *\return		L'allocateur des palettes d'os, dans le tampon d'instanciation des os.
+		 */
+		inline BonePaletteAllocator & getBonePalettes()
+		{
+			return m_palettes;
+		}
 		/**
 		 *\~english
 		 *\return		The shader program flags.
@@ -102,6 +113,7 @@ namespace castor3d
 		InstantiationComponent const & m_instantiation;
 		BonesComponent const & m_bones;
 		ShaderBufferUPtr m_instancedBonesBuffer;
+		BonePaletteAllocator m_palettes;
 	};
 }
 
@@ -17,6 +17,7 @@ See LICENSE file in root folder
 
 #include <CastorUtils/Graphics/BoundingBox.hpp>
 #include <CastorUtils/Graphics/BoundingSphere.hpp>
+#include <CastorUtils/Graphics/Meshlet.hpp>
 
 #include <ashespp/Buffer/VertexBuffer.hpp>
 
@@ -193,6 +194,54 @@ namespace castor3d
 		 *\param[in]	cameraPosition	La position de la caméra, relative au sous-maillage
 		 */
 		C3D_API void sortByDistance( castor::Point3f const & cameraPosition );
+		/**
+		 *\~english
+		 *\brief		Generates levels of detail, by successive simplifications of the triangles.
+		 *\remarks		The vertices are shared by all the levels, only the indices differ.
+		 *				<br />Must be called before the submesh is initialised.
+		 *\param[in]	count	The maximal levels count, the full detail one excluded.
+		 *\param[in]	ratio	The indices count ratio from a level to the next one.
+		 *\~french
+		 *\brief		Génère des niveaux de détail, par simplifications successives des triangles.
+		 *\remarks		Les sommets sont partagés par tous les niveaux, seuls les indices diffèrent.
+		 *				<br />Doit être appelé avant l'initialisation du sous-maillage.
+		 *\param[in]	count	Le nombre maximal de niveaux, celui de détail complet exclu.
+		 *\param[in]	ratio	Le ratio du nombre d'indices d'un niveau au suivant.
+		 */
+		C3D_API void generateLods( uint32_t count
+			, float ratio = 0.5f );
+		/**
+		 *\~english
+		 *\brief		Adds a level of detail, after the existing ones.
+		 *\param[in]	indices	The triangles indices.
+		 *\param[in]	error	The maximal geometric error, in the submesh space units.
+		 *\~french
+		 *\brief		Ajoute un niveau de détail, après ceux existants.
+		 *\param[in]	indices	Les indices des triangles.
+		 *\param[in]	error	L'erreur géométrique maximale, dans l'unité de l'espace du sous-maillage.
+		 */
+		C3D_API void addLod( castor::UInt32Array const & indices
+			, float error );
+		/**
+		 *\~english
+		 *\param[in]	lod	The level of detail, 0 being the full detail one.
+		 *\return		The indices range for given level of detail.
+		 *\~french
+		 *\param[in]	lod	Le niveau de détail, 0 étant celui de détail complet.
+		 *\return		L'intervalle d'indices pour le niveau de détail donné.
+		 */
+		C3D_API SubmeshLod getLod( uint32_t lod )const;
+		/**
+		 *\~english
+		 *\brief		Groups the triangles into meshlets, reordering the faces so that each meshlet is a contiguous indices range.
+		 *\remarks		Opt-in, through the mesh "meshlets" scene directive, since the faces order changes.
+		 *				<br />Must be called before the submesh is initialised.
+		 *\~french
+		 *\brief		Groupe les triangles en meshlets, en réordonnant les faces afin que chaque meshlet soit un intervalle d'indices contigu.
+		 *\remarks		Optionnel, via la directive de scène "meshlets" du maillage, l'ordre des faces étant modifié.
+		 *				<br />Doit être appelé avant l'initialisation du sous-maillage.
+		 */
+		C3D_API void generateMeshlets();
 		/**
 		 *\~english
 		 *\return		The shader program flags.
@@ -350,9 +399,14 @@ namespace castor3d
 		inline BonesInstantiationComponent const & getInstantiatedBones()const;
 		inline SubmeshComponentStrMap const & getComponents()const;
 		inline VkPrimitiveTopology getTopology()const;
+		inline uint32_t getLodsCount()const;
+		inline SubmeshLodArray const & getLods()const;
+		inline castor::UInt32Array const & getLodIndices()const;
+		inline castor::MeshletArray const & getMeshlets()const;
 
 	private:
 		void doGenerateVertexBuffer( RenderDevice const & device );
+		void doUploadLods();
 
 	public:
 		static uint32_t constexpr Position = 0u;
@@ -382,6 +436,9 @@ namespace castor3d
 		ashes::BufferPtr< uint32_t > m_indexBuffer;
 		mutable std::map< MaterialSPtr, GeometryBuffers > m_geometryBuffers;
 		bool m_needsNormalsCompute{ false };
+		SubmeshLodArray m_lods;
+		castor::UInt32Array m_lodIndices;
+		castor::MeshletArray m_meshlets;
 
 		friend class BinaryWriter< Submesh >;
 		friend class BinaryParser< Submesh >;
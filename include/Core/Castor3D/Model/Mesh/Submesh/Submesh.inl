@@ -337,5 +337,25 @@ namespace castor3d
 		m_topology = value;
 	}
 
+	inline uint32_t Submesh::getLodsCount()const
+	{
+		return uint32_t( m_lods.size() + 1u );
+	}
+
+	inline SubmeshLodArray const & Submesh::getLods()const
+	{
+		return m_lods;
+	}
+
+	inline castor::UInt32Array const & Submesh::getLodIndices()const
+	{
+		return m_lodIndices;
+	}
+
+	inline castor::MeshletArray const & Submesh::getMeshlets()const
+	{
+		return m_meshlets;
+	}
+
 	//*********************************************************************************************
 }
@@ -43,6 +43,26 @@ namespace castor3d
 		castor::BoundingBox m_boundingBox;
 	};
 	using SubmeshAnimationBuffer = SubmeshAnimationBufferT< float >;
+	/**
+	*\~english
+	*\brief
+	*	A submesh level of detail, as a range in the submesh index buffer.
+	*\~french
+	*\brief
+	*	Un niveau de détail de sous-maillage, en tant qu'intervalle dans le tampon d'indices du sous-maillage.
+	*/
+	struct SubmeshLod
+	{
+		//!\~english	The first index.
+		//!\~french		Le premier indice.
+		uint32_t firstIndex;
+		//!\~english	The indices count.
+		//!\~french		Le nombre d'indices.
+		uint32_t indexCount;
+		//!\~english	The maximal geometric error, in the submesh space units.
+		//!\~french		L'erreur géométrique maximale, dans l'unité de l'espace du sous-maillage.
+		float error;
+	};
 
 	CU_DeclareSmartPtr( Submesh );
 
@@ -52,6 +72,7 @@ namespace castor3d
 	CU_DeclareMap( Submesh const *, castor::BoundingBox, SubmeshBoundingBox );
 	CU_DeclareMap( Submesh const *, castor::BoundingSphere, SubmeshBoundingSphere );
 	CU_DeclareMap( uint32_t, SubmeshAnimationBuffer, SubmeshAnimationBuffer );
+	CU_DeclareVector( SubmeshLod, SubmeshLod );
 	using SubmeshBoundingBoxList = std::vector< std::pair< Submesh const *, castor::BoundingBox > >;
 	
 	//@}
@@ -18,6 +18,42 @@ namespace castor3d
 	*/
 	class SubmeshUtils
 	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	The faces contributions weighting, for the vertices normals.
+		*\~french
+		*\brief
+		*	La pondération des contributions des faces, pour les normales des sommets.
+		*/
+		enum class NormalWeighting
+		{
+			//!\~english	Weighted by the face area.
+			//!\~french		Pondérée par l'aire de la face.
+			eArea,
+			//!\~english	Weighted by the face angle at the vertex.
+			//!\~french		Pondérée par l'angle de la face au sommet.
+			eAngle,
+		};
+		/**
+		*\~english
+		*\brief
+		*	The tangents computation mode.
+		*\~french
+		*\brief
+		*	Le mode de calcul des tangentes.
+		*/
+		enum class TangentsMode
+		{
+			//!\~english	Area weighted faces texture gradients, orthogonalised against the normal.
+			//!\~french		Gradients de texture des faces pondérés par l'aire, orthogonalisés par rapport à la normale.
+			eFaceGradient,
+			//!\~english	MikkTSpace weighting: the faces gradients are projected on the vertex normal, then weighted by the face angle.
+			//!\~french		Pondération MikkTSpace : les gradients des faces sont projetés sur la normale du sommet, puis pondérés par l'angle de la face.
+			eMikkTSpace,
+		};
+
 	public:
 		/**
 		 *\~english
@@ -39,15 +75,41 @@ namespace castor3d
 		 *\param[in]		submesh		The submesh.
 		 *\param[in]		reverted	Tells if the normals must be inverted.
 		 *\param[in,out]	triFace		The component that will receive the computed triangles.
+		 *\param[in]		weighting	The faces contributions weighting.
 		 *\~french
 		 *\brief			Génère les normales et les tangentes.
 		 *\param[in]		submesh		Le sous-maillage.
 		 *\param[in]		reverted	Dit si les normales doivent être inversées.
 		 *\param[in,out]	triFace		Le composant qui va recevoir les faces calculées.
+		 *\param[in]		weighting	La pondération des contributions des faces.
 		 */
 		C3D_API static void computeNormals( Submesh & submesh
 			, TriFaceMapping & triFace
-			, bool reverted = false );
+			, bool reverted = false
+			, NormalWeighting weighting = NormalWeighting::eArea );
+		/**
+		 *\~english
+		 *\brief			Generates normals and tangents.
+		 *\remarks			The faces are split in parts, accumulated in parallel.
+		 *\param[in,out]	points			The vertices.
+		 *\param[in]		faces			The faces.
+		 *\param[in]		reverted		Tells if the normals must be inverted.
+		 *\param[in]		weighting		The faces contributions weighting.
+		 *\param[in]		threadsCount	The threads count, 0 to use the hardware concurrency.
+		 *\~french
+		 *\brief			Génère les normales et les tangentes.
+		 *\remarks			Les faces sont découpées en parties, accumulées en parallèle.
+		 *\param[in,out]	points			Les sommets.
+		 *\param[in]		faces			Les faces.
+		 *\param[in]		reverted		Dit si les normales doivent être inversées.
+		 *\param[in]		weighting		La pondération des contributions des faces.
+		 *\param[in]		threadsCount	Le nombre de threads, 0 pour utiliser la concurrence matérielle.
+		 */
+		C3D_API static void computeNormals( InterleavedVertexArray & points
+			, FaceArray const & faces
+			, bool reverted = false
+			, NormalWeighting weighting = NormalWeighting::eArea
+			, uint32_t threadsCount = 0u );
 		/**
 		 *\~english
 		 *\brief		Computes normal and tangent for each vertex of the given face.
@@ -78,14 +140,39 @@ namespace castor3d
 		 *\remarks			This function supposes the normals are defined.
 		 *\param[in]		submesh	The submesh.
 		 *\param[in,out]	triFace	The component that will receive the computed triangles.
+		 *\param[in]		mode	The tangents computation mode.
 		 *\~french
 		 *\brief			Calcule la tangente pour chaque vertex du sous-maillage.
 		 *\remarks			Cette fonction suppose que les normales sont définies.
 		 *\param[in]		submesh	Le sous-maillage.
 		 *\param[in,out]	triFace	Le composant qui va recevoir les faces calculées.
+		 *\param[in]		mode	Le mode de calcul des tangentes.
 		 */
 		C3D_API static void computeTangentsFromNormals( Submesh & submesh
-			, TriFaceMapping & triFace );
+			, TriFaceMapping & triFace
+			, TangentsMode mode = TangentsMode::eFaceGradient );
+		/**
+		 *\~english
+		 *\brief			Computes tangent for each vertex.
+		 *\remarks			This function supposes the normals are defined.
+		 *				<br />The faces are split in parts, accumulated in parallel.
+		 *\param[in,out]	points			The vertices.
+		 *\param[in]		faces			The faces.
+		 *\param[in]		mode			The tangents computation mode.
+		 *\param[in]		threadsCount	The threads count, 0 to use the hardware concurrency.
+		 *\~french
+		 *\brief			Calcule la tangente pour chaque sommet.
+		 *\remarks			Cette fonction suppose que les normales sont définies.
+		 *				<br />Les faces sont découpées en parties, accumulées en parallèle.
+		 *\param[in,out]	points			Les sommets.
+		 *\param[in]		faces			Les faces.
+		 *\param[in]		mode			Le mode de calcul des tangentes.
+		 *\param[in]		threadsCount	Le nombre de threads, 0 pour utiliser la concurrence matérielle.
+		 */
+		C3D_API static void computeTangentsFromNormals( InterleavedVertexArray & points
+			, FaceArray const & faces
+			, TangentsMode mode = TangentsMode::eFaceGradient
+			, uint32_t threadsCount = 0u );
 	};
 }
 
@@ -0,0 +1,114 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_BonePaletteAllocator_H___
+#define ___C3D_BonePaletteAllocator_H___
+
+#include "SkeletonModule.hpp"
+
+namespace castor3d
+{
+	class BonePaletteAllocator
+	{
+	public:
+		//!\~english	The size of one bone matrix, in bytes.
+		//!\~french		La taille d'une matrice d'os, en octets.
+		static uint32_t constexpr MatrixSize = uint32_t( 16u * sizeof( float ) );
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	capacity	The palettes storage capacity, in matrices.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	capacity	La capacité du stockage des palettes, en matrices.
+		 */
+		C3D_API explicit BonePaletteAllocator( uint32_t capacity = 0u );
+		/**
+		 *\~english
+		 *\brief		Sets the palettes storage capacity.
+		 *\remarks		Resets the current allocations.
+		 *\param[in]	capacity	The new capacity, in matrices.
+		 *\~french
+		 *\brief		Définit la capacité du stockage des palettes.
+		 *\remarks		Réinitialise les allocations courantes.
+		 *\param[in]	capacity	La nouvelle capacité, en matrices.
+		 */
+		C3D_API void setCapacity( uint32_t capacity );
+		/**
+		 *\~english
+		 *\brief		Releases all the palettes, to start a new fill of the storage.
+		 *\~french
+		 *\brief		Libère toutes les palettes, pour commencer un nouveau remplissage du stockage.
+		 */
+		C3D_API void reset();
+		/**
+		 *\~english
+		 *\brief		Allocates a palette, right after the previous one.
+		 *\param[in]	count	The palette bones count.
+		 *\return		The palette offset, in matrices, castor3d::InvalidIndex if the storage is full.
+		 *\~french
+		 *\brief		Alloue une palette, juste après la précédente.
+		 *\param[in]	count	Le nombre d'os de la palette.
+		 *\return		Le décalage de la palette, en matrices, castor3d::InvalidIndex si le stockage est plein.
+		 */
+		C3D_API uint32_t allocate( uint32_t count );
+		/**
+		 *\~english
+		 *\return		The palettes storage capacity, in matrices.
+		 *\~french
+		 *\return		La capacité du stockage des palettes, en matrices.
+		 */
+		uint32_t getCapacity()const
+		{
+			return m_capacity;
+		}
+		/**
+		 *\~english
+		 *\return		The matrices count allocated since the last reset.
+		 *\~french
+		 *\return		Le nombre de matrices allouées depuis la dernière réinitialisation.
+		 */
+		uint32_t getAllocated()const
+		{
+			return m_allocated;
+		}
+		/**
+		 *\~english
+		 *\return		The palettes count allocated since the last reset.
+		 *\~french
+		 *\return		Le nombre de palettes allouées depuis la dernière réinitialisation.
+		 */
+		uint32_t getPalettesCount()const
+		{
+			return m_palettes;
+		}
+		/**
+		 *\~english
+		 *\return		The bytes count to upload for the palettes allocated since the last reset.
+		 *\~french
+		 *\return		Le nombre d'octets à mettre en ligne pour les palettes allouées depuis la dernière réinitialisation.
+		 */
+		uint64_t getAllocatedBytes()const
+		{
+			return uint64_t( m_allocated ) * MatrixSize;
+		}
+		/**
+		 *\~english
+		 *\return		The bytes count allocated since the creation, through all the resets.
+		 *\~french
+		 *\return		Le nombre d'octets alloués depuis la création, à travers toutes les réinitialisations.
+		 */
+		uint64_t getTotalBytes()const
+		{
+			return m_totalBytes;
+		}
+
+	private:
+		uint32_t m_capacity;
+		uint32_t m_allocated{ 0u };
+		uint32_t m_palettes{ 0u };
+		uint64_t m_totalBytes{ 0u };
+	};
+}
+
+#endif
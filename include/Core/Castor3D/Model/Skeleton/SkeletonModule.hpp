@@ -30,6 +30,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Packs variable size bone palettes contiguously in a storage.
+	*\~french
+	*\brief
+	*	Range des palettes d'os de tailles variables de manière contiguë dans un stockage.
+	*/
+	class BonePaletteAllocator;
+	/**
+	*\~english
+	*\brief
 	*	The skeleton, holds each bone
 	*\~french
 	*\brief
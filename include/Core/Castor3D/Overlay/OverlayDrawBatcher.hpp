@@ -0,0 +1,109 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_OverlayDrawBatcher_H___
+#define ___C3D_OverlayDrawBatcher_H___
+
+#include "OverlayModule.hpp"
+
+#include <CastorUtils/Graphics/Rectangle.hpp>
+
+#include <vector>
+
+namespace castor3d
+{
+	class OverlayDrawBatcher
+	{
+	public:
+		struct Draw
+		{
+			//!\~english	The draw key, overlays with the same key can be drawn together.
+			//!\~french		La clé du dessin, les incrustations ayant la même clé peuvent être dessinées ensemble.
+			size_t key;
+			//!\~english	The union of the draw overlays bounds, in pixels.
+			//!\~french		L'union des limites des incrustations du dessin, en pixels.
+			castor::Rectangle bounds;
+			//!\~english	The draw overlays, in drawing order.
+			//!\~french		Les incrustations du dessin, dans l'ordre de dessin.
+			std::vector< uint32_t > items;
+		};
+		using DrawArray = std::vector< Draw >;
+
+	public:
+		//!\~english	The default count of previous draws an overlay can be merged into.
+		//!\~french		Le nombre par défaut de dessins précédents dans lesquels une incrustation peut être fusionnée.
+		static uint32_t constexpr DefaultLookback = 16u;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	lookback	The count of previous draws an overlay can be merged into.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	lookback	Le nombre de dessins précédents dans lesquels une incrustation peut être fusionnée.
+		 */
+		C3D_API explicit OverlayDrawBatcher( uint32_t lookback = DefaultLookback );
+		/**
+		 *\~english
+		 *\brief		Removes all draws, keeping their memory for the next frame.
+		 *\~french
+		 *\brief		Supprime tous les dessins, en gardant leur mémoire pour la prochaine frame.
+		 */
+		C3D_API void clear();
+		/**
+		 *\~english
+		 *\brief		Adds an overlay, after all the previously added ones.
+		 *\remarks		The overlay joins the last draw with the same key, if no draw added since then overlaps it.
+		 *\param[in]	key		The overlay draw key.
+		 *\param[in]	bounds	The overlay bounds, in pixels.
+		 *\param[in]	item	The overlay index.
+		 *\return		The index of the draw holding the overlay.
+		 *\~french
+		 *\brief		Ajoute une incrustation, après toutes celles ajoutées précédemment.
+		 *\remarks		L'incrustation rejoint le dernier dessin ayant la même clé, si aucun dessin ajouté depuis ne la chevauche.
+		 *\param[in]	key		La clé de dessin de l'incrustation.
+		 *\param[in]	bounds	Les limites de l'incrustation, en pixels.
+		 *\param[in]	item	L'indice de l'incrustation.
+		 *\return		L'indice du dessin contenant l'incrustation.
+		 */
+		C3D_API uint32_t add( size_t key
+			, castor::Rectangle const & bounds
+			, uint32_t item );
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		inline DrawArray::const_iterator begin()const
+		{
+			return m_draws.begin();
+		}
+
+		inline DrawArray::const_iterator end()const
+		{
+			return m_draws.begin() + m_count;
+		}
+
+		inline uint32_t getDrawsCount()const
+		{
+			return m_count;
+		}
+
+		inline uint32_t getItemsCount()const
+		{
+			return m_itemsCount;
+		}
+		/**@}*/
+
+	private:
+		uint32_t m_lookback;
+		DrawArray m_draws;
+		uint32_t m_count{ 0u };
+		uint32_t m_itemsCount{ 0u };
+	};
+}
+
+#endif
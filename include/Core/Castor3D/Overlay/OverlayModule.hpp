@@ -219,6 +219,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Merges the overlays sharing the same material into as few draws as possible, keeping their visual order.
+	*\~french
+	*\brief
+	*	Fusionne les incrustations partageant le même matériau en aussi peu de dessins que possible, en gardant leur ordre visuel.
+	*/
+	class OverlayDrawBatcher;
+	/**
+	*\~english
+	*\brief
 	*	The mesh factory.
 	*\~french
 	*\brief
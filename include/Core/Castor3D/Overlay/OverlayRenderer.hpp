@@ -4,6 +4,7 @@ See LICENSE file in root folder
 #ifndef ___C3D_OverlayRenderer_H___
 #define ___C3D_OverlayRenderer_H___
 
+#include "Castor3D/Overlay/OverlayDrawBatcher.hpp"
 #include "Castor3D/Overlay/TextOverlay.hpp"
 
 #include "Castor3D/Buffer/GeometryBuffers.hpp"
@@ -43,13 +44,12 @@ namespace castor3d
 			void visit( TextOverlay const & overlay )override;
 
 		private:
-			template< typename QuadT, typename OverlayT, typename BufferIndexT, typename BufferPoolT, typename VertexT >
+			template< typename VertexT >
 			void doPrepareOverlay( RenderDevice const & device
-				, OverlayT const & overlay
+				, OverlayCategory const & overlay
 				, Pass const & pass
-				, std::map< size_t, BufferIndexT > & overlays
-				, std::vector< BufferPoolT > & vertexBuffers
-				, std::vector < VertexT > const & vertices
+				, std::vector< VertexT > const & vertices
+				, castor::Rectangle const & borders
 				, FontTextureSPtr fontTexture );
 
 		private:
@@ -116,12 +116,17 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Ends the overlays preparation.
+		 *\remarks		Uploads the merged vertices, and records one draw per batch.
+		 *\param[in]	device	The GPU device.
 		 *\param[in]	timer	The render pass timer.
 		 *\~french
 		 *\brief		Termine la préparation des incrustations.
+		 *\remarks		Met en ligne les sommets fusionnés, et enregistre un dessin par lot.
+		 *\param[in]	device	Le device GPU.
 		 *\param[in]	timer	Le timer de la passe de rendu.
 		 */
-		C3D_API void endPrepare( RenderPassTimer const & timer );
+		C3D_API void endPrepare( RenderDevice const & device
+			, RenderPassTimer const & timer );
 		/**
 		 *\~english
 		 *\brief		Ends the overlays preparation.
@@ -166,6 +171,16 @@ namespace castor3d
 		{
 			return *m_finished;
 		}
+
+		uint32_t getPreparedOverlaysCount()const
+		{
+			return m_batcher.getItemsCount();
+		}
+
+		uint32_t getDrawCallsCount()const
+		{
+			return m_batcher.getDrawsCount();
+		}
 		/**@}*/
 
 	private:
@@ -191,70 +206,43 @@ namespace castor3d
 		};
 
 	private:
-		struct OverlayGeometryBuffers
+		struct OverlayBatch
 		{
-			GeometryBuffers noTexture;
-			GeometryBuffers textured;
+			OverlayRenderNode & node;
+			UniformBufferOffsetT< Configuration > overlayUbo;
+			UniformBufferOffsetT< TexturesUbo::Configuration > texturesUbo;
+			ashes::DescriptorSetPtr descriptorSet;
+			FontTexture::OnChanged::connection connection;
+			bool text;
 		};
 
-		template< typename VertexT, uint32_t CountT >
-		struct VertexBufferIndex;
-
-		template< typename VertexT, uint32_t CountT >
-		struct VertexBufferPool
+		struct PreparedOverlay
 		{
-			using MyBufferIndex = VertexBufferIndex< VertexT, CountT >;
-			using Quad = std::array< VertexT, CountT >;
-
-			VertexBufferPool( Engine & engine
-				, UniformBufferPools & uboPools
-				, RenderDevice const & device
-				, ashes::PipelineVertexInputStateCreateInfo const & declaration
-				, uint32_t count );
-			VertexBufferIndex< VertexT, CountT > allocate( OverlayRenderNode & node );
-			void deallocate( VertexBufferIndex< VertexT, CountT > const & index );
-			void upload();
-
-			Engine & engine;
-			UniformBufferPools & uboPools;
-			uint32_t const maxCount;
-			std::vector< Quad > data;
-			ashes::PipelineVertexInputStateCreateInfo const & declaration;
-			ashes::VertexBufferPtr< Quad > buffer;
-			std::set< uint32_t > free;
+			std::vector< OverlayCategory::Vertex > const * panelVertices;
+			std::vector< TextOverlay::Vertex > const * textVertices;
+			castor::Point2f offset;
+			castor::Point2f scale;
 		};
 
-		template< typename VertexT, uint32_t CountT >
-		struct VertexBufferIndex
+		template< typename VertexT >
+		struct VertexStream
 		{
-			operator bool()const
-			{
-				return index != InvalidIndex;
-			}
+			void upload( RenderDevice const & device );
 
-			VertexBufferPool< VertexT, CountT > & pool;
-			OverlayRenderNode & node;
-			uint32_t index;
-			UniformBufferOffsetT< Configuration > overlayUbo;
-			UniformBufferOffsetT< TexturesUbo::Configuration > texturesUbo;
-			OverlayGeometryBuffers geometryBuffers;
-			ashes::DescriptorSetPtr descriptorSet;
-			FontTexture::OnChanged::connection connection;
+			std::vector< VertexT > data;
+			ashes::VertexBufferPtr< VertexT > buffer;
 		};
 
-		using PanelVertexBufferPool = VertexBufferPool< OverlayCategory::Vertex, 6u >;
-		using PanelVertexBufferIndex = PanelVertexBufferPool::MyBufferIndex;
-		using BorderPanelVertexBufferPool = VertexBufferPool< OverlayCategory::Vertex, 8u * 6u >;
-		using BorderPanelVertexBufferIndex = BorderPanelVertexBufferPool::MyBufferIndex;
-		using TextVertexBufferPool = VertexBufferPool< TextOverlay::Vertex, 600u >;
-		using TextVertexBufferIndex = TextVertexBufferPool::MyBufferIndex;
-
 		OverlayRenderNode & doGetPanelNode( RenderDevice const & device
 			, Pass const & pass );
 		OverlayRenderNode & doGetTextNode( RenderDevice const & device
 			, Pass const & pass
 			, TextureLayout const & texture
 			, Sampler const & sampler );
+		OverlayBatch & doGetBatch( RenderDevice const & device
+			, Pass const & pass
+			, FontTextureSPtr fontTexture
+			, size_t key );
 		Pipeline doCreatePipeline( RenderDevice const & device
 			, Pass const & pass
 			, ashes::PipelineShaderStageCreateInfoArray program
@@ -287,12 +275,11 @@ namespace castor3d
 		UniformBufferPools & m_uboPools;
 		ashes::ImageView const & m_target;
 		ashes::CommandBufferPtr m_commandBuffer;
-		std::vector< std::unique_ptr< PanelVertexBufferPool > > m_panelVertexBuffers;
-		std::vector< std::unique_ptr< BorderPanelVertexBufferPool > > m_borderVertexBuffers;
-		std::vector< std::unique_ptr< TextVertexBufferPool > > m_textVertexBuffers;
-		std::map< size_t, PanelVertexBufferIndex > m_panelOverlays;
-		std::map< size_t, BorderPanelVertexBufferIndex > m_borderPanelOverlays;
-		std::map< size_t, TextVertexBufferIndex > m_textOverlays;
+		std::map< size_t, OverlayBatch > m_batches;
+		OverlayDrawBatcher m_batcher;
+		std::vector< PreparedOverlay > m_prepared;
+		VertexStream< OverlayCategory::Vertex > m_panelVertices;
+		VertexStream< TextOverlay::Vertex > m_textVertices;
 		ashes::PipelineVertexInputStateCreateInfo m_declaration;
 		ashes::PipelineVertexInputStateCreateInfo m_textDeclaration;
 		castor::Size m_size;
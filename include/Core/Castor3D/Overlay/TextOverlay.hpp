@@ -197,8 +197,8 @@ namespace castor3d
 		 */
 		inline void setCaption( castor::String const & value )
 		{
+			m_textChanged = m_textChanged || ( m_currentCaption != value );
 			m_currentCaption = value;
-			m_textChanged = true;
 		}
 		/**
 		 *\~english
@@ -0,0 +1,125 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_CpuFrameTimings_H___
+#define ___C3D_CpuFrameTimings_H___
+
+#include "Castor3D/Render/RenderModule.hpp"
+
+#include <array>
+#include <chrono>
+
+namespace castor3d
+{
+	struct CpuFrameTimings
+	{
+		using Clock = std::chrono::high_resolution_clock;
+		/**
+		 *\~english
+		 *\brief		Resets the timings, for a new frame.
+		 *\~french
+		 *\brief		Réinitialise les temps, pour une nouvelle frame.
+		 */
+		void reset()
+		{
+			phases.fill( castor::Nanoseconds{} );
+			total = castor::Nanoseconds{};
+			current = CpuFramePhase::eCount;
+		}
+		/**
+		 *\~english
+		 *\brief		Accumulates the time spent in the current phase, and makes the given one current.
+		 *\param[in]	phase	The new current phase (CpuFramePhase::eCount for none).
+		 *\return		The previous current phase.
+		 *\~french
+		 *\brief		Accumule le temps passé dans la phase courante, et rend la phase donnée courante.
+		 *\param[in]	phase	La nouvelle phase courante (CpuFramePhase::eCount pour aucune).
+		 *\return		La phase courante précédente.
+		 */
+		CpuFramePhase switchTo( CpuFramePhase phase )
+		{
+			auto now = Clock::now();
+
+			if ( current != CpuFramePhase::eCount )
+			{
+				phases[size_t( current )] += std::chrono::duration_cast< castor::Nanoseconds >( now - start );
+			}
+
+			start = now;
+			std::swap( current, phase );
+			return phase;
+		}
+		/**
+		 *\~english
+		 *\param[in]	phase	The phase.
+		 *\return		The time spent in given phase.
+		 *\~french
+		 *\param[in]	phase	La phase.
+		 *\return		Le temps passé dans la phase donnée.
+		 */
+		castor::Nanoseconds get( CpuFramePhase phase )const
+		{
+			return phases[size_t( phase )];
+		}
+
+		//!\~english	The time spent in each phase, nested phases are excluded from their parent.
+		//!\~french		Le temps passé dans chaque phase, les phases imbriquées sont exclues de leur parent.
+		std::array< castor::Nanoseconds, size_t( CpuFramePhase::eCount ) > phases{};
+		//!\~english	The whole frame CPU time.
+		//!\~french		Le temps CPU de la frame complète.
+		castor::Nanoseconds total{};
+
+	private:
+		CpuFramePhase current{ CpuFramePhase::eCount };
+		Clock::time_point start;
+	};
+	/**
+	*\~english
+	*\brief
+	*	Measures the time spent in a phase, until its destruction.
+	*\remarks
+	*	Must be used from the render thread only, phases can be nested.
+	*\~french
+	*\brief
+	*	Mesure le temps passé dans une phase, jusqu'à sa destruction.
+	*\remarks
+	*	Ne doit être utilisé que depuis le thread de rendu, les phases peuvent être imbriquées.
+	*/
+	class CpuPhaseTimer
+	{
+	public:
+		CpuPhaseTimer( CpuPhaseTimer const & ) = delete;
+		CpuPhaseTimer & operator=( CpuPhaseTimer const & ) = delete;
+		/**
+		 *\~english
+		 *\param[in]	timings	The timings receiving the measure, can be null.
+		 *\param[in]	phase	The measured phase.
+		 *\~french
+		 *\param[in]	timings	Les temps recevant la mesure, peut être nul.
+		 *\param[in]	phase	La phase mesurée.
+		 */
+		CpuPhaseTimer( CpuFrameTimings * timings
+			, CpuFramePhase phase )
+			: m_timings{ timings }
+		{
+			if ( m_timings )
+			{
+				m_previous = m_timings->switchTo( phase );
+			}
+		}
+
+		~CpuPhaseTimer()
+		{
+			if ( m_timings )
+			{
+				m_timings->switchTo( m_previous );
+			}
+		}
+
+	private:
+		CpuFrameTimings * m_timings;
+		CpuFramePhase m_previous{ CpuFramePhase::eCount };
+	};
+}
+
+#endif
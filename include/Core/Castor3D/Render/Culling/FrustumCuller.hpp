@@ -6,18 +6,84 @@ See LICENSE file in root folder
 
 #include "Castor3D/Render/Culling/SceneCuller.hpp"
 
+#include <CastorUtils/Graphics/OcclusionBuffer.hpp>
+#include <CastorUtils/Miscellaneous/PreciseTimer.hpp>
+
+#include <unordered_map>
+
 namespace castor3d
 {
 	class FrustumCuller
 		: public SceneCuller
 	{
 	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	scene			The scene.
+		 *\param[in]	camera			The camera.
+		 *\param[in]	cullBackFaces	Tells if the back facing meshlets are culled (only for passes viewing the scene from the camera).
+		 *\param[in]	cullOccluded	Tells if the geometries hidden by the occluders are culled (only for passes viewing the scene from the camera).
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	scene			La scène.
+		 *\param[in]	camera			La caméra.
+		 *\param[in]	cullBackFaces	Dit si les meshlets tournant le dos à la caméra sont éliminés (uniquement pour les passes voyant la scène depuis la caméra).
+		 *\param[in]	cullOccluded	Dit si les géométries cachées par les occulteurs sont éliminées (uniquement pour les passes voyant la scène depuis la caméra).
+		 */
 		C3D_API FrustumCuller( Scene & scene
-			, Camera & camera );
+			, Camera & camera
+			, bool cullBackFaces = false
+			, bool cullOccluded = false );
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		inline bool isOcclusionCullingEnabled()const
+		{
+			return m_occlusionBuffer != nullptr;
+		}
+
+		inline uint32_t getOccludersCount()const
+		{
+			return m_occludersCount;
+		}
+
+		inline uint32_t getOccludedCount()const
+		{
+			return m_occludedCount;
+		}
+
+		inline castor::Nanoseconds getOcclusionTime()const
+		{
+			return m_occlusionTime;
+		}
+		/**@}*/
 
 	private:
 		void doCullGeometries()override;
 		void doCullBillboards()override;
+		void doCullOccluded();
+
+	private:
+		struct Occluder
+		{
+			std::vector< castor::Point3f > positions;
+			castor::UInt32Array indices;
+		};
+
+		bool m_cullBackFaces;
+		std::unique_ptr< castor::OcclusionBuffer > m_occlusionBuffer;
+		std::unordered_map< Submesh const *, Occluder > m_occluders;
+		castor::PreciseTimer m_timer;
+		castor::Nanoseconds m_occlusionTime{ 0u };
+		uint32_t m_occludersCount{ 0u };
+		uint32_t m_occludedCount{ 0u };
 	};
 }
 
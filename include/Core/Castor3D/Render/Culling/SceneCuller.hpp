@@ -8,6 +8,10 @@ See LICENSE file in root folder
 
 #include "Castor3D/Model/Mesh/Submesh/SubmeshModule.hpp"
 
+#include <CastorUtils/Graphics/Meshlet.hpp>
+
+#include <unordered_map>
+
 namespace castor3d
 {
 	struct CulledSubmesh
@@ -16,6 +20,8 @@ namespace castor3d
 		Submesh & data;
 		PassSPtr pass;
 		SceneNode & sceneNode;
+		uint32_t lod{ 0u };
+		castor::MeshletRangeArray meshletRanges;
 	};
 	size_t hash( CulledSubmesh const & culled );
 	size_t hash( CulledSubmesh const & culled
@@ -24,6 +30,44 @@ namespace castor3d
 		, CulledSubmesh const & node );
 	bool isVisible( Frustum const & frustum
 		, CulledSubmesh const & node );
+	/**
+	 *\~english
+	 *\brief		Selects the coarsest level of detail which geometric error, projected on screen, stays under a pixel.
+	 *\remarks		A coarser level than the current one needs a lower projected error, to avoid flickering between two levels.
+	 *\param[in]	camera	The camera.
+	 *\param[in]	node	The culled node.
+	 *\param[in]	current	The level of detail currently used for the node geometry and submesh.
+	 *\return		The level of detail.
+	 *\~french
+	 *\brief		Sélectionne le niveau de détail le plus grossier dont l'erreur géométrique, projetée à l'écran, reste sous un pixel.
+	 *\remarks		Un niveau plus grossier que le niveau courant nécessite une erreur projetée plus faible, pour éviter l'alternance entre deux niveaux.
+	 *\param[in]	camera	La caméra.
+	 *\param[in]	node	Le noeud culled.
+	 *\param[in]	current	Le niveau de détail actuellement utilisé pour la géométrie et le sous-maillage du noeud.
+	 *\return		Le niveau de détail.
+	 */
+	uint32_t selectLod( Camera const & camera
+		, CulledSubmesh const & node
+		, uint32_t current );
+	/**
+	 *\~english
+	 *\brief		Culls the submesh meshlets, and stores the visible indices ranges in the node.
+	 *\remarks		The ranges stay empty when the whole submesh is drawn (no meshlets, coarser level of detail, instantiation or sorted faces).
+	 *\param[in]	camera			The camera.
+	 *\param[in]	node			The culled node.
+	 *\param[in]	cullBackFaces	Tells if the back facing meshlets of single sided passes can be culled.
+	 *\return		\p false if no meshlet is visible.
+	 *\~french
+	 *\brief		Elimine les meshlets du sous-maillage, et stocke les intervalles d'indices visibles dans le noeud.
+	 *\remarks		Les intervalles restent vides quand le sous-maillage est dessiné en entier (pas de meshlets, niveau de détail plus grossier, instanciation ou faces triées).
+	 *\param[in]	camera			La caméra.
+	 *\param[in]	node			Le noeud culled.
+	 *\param[in]	cullBackFaces	Dit si les meshlets tournant le dos à la caméra peuvent être éliminés, pour les passes non double face.
+	 *\return		\p false si aucun meshlet n'est visible.
+	 */
+	bool cullMeshlets( Camera const & camera
+		, CulledSubmesh & node
+		, bool cullBackFaces );
 
 	struct CulledBillboard
 	{
@@ -93,6 +137,19 @@ namespace castor3d
 			, uint32_t instancesCount );
 		C3D_API virtual ~SceneCuller() = default;
 		C3D_API void compute();
+		/**
+		 *\~english
+		 *\brief		Selects the level of detail of a culled node, and keeps it for its geometry and submesh.
+		 *\remarks		The kept level survives the culled lists rebuilds, so that the hysteresis still applies.
+		 *\param[in]	node	The culled node.
+		 *\return		The level of detail.
+		 *\~french
+		 *\brief		Sélectionne le niveau de détail d'un noeud culled, et le conserve pour sa géométrie et son sous-maillage.
+		 *\remarks		Le niveau conservé survit aux reconstructions des listes culled, afin que l'hystérésis s'applique toujours.
+		 *\param[in]	node	Le noeud culled.
+		 *\return		Le niveau de détail.
+		 */
+		C3D_API uint32_t selectLod( CulledSubmesh const & node );
 
 		inline float getMinCastersZ()
 		{
@@ -183,6 +240,9 @@ namespace castor3d
 		CulledInstanceArrayT< CulledBillboard > m_allBillboards;
 		CulledInstancePtrArrayT< CulledSubmesh > m_culledSubmeshes;
 		CulledInstancePtrArrayT< CulledBillboard > m_culledBillboards;
+		//!\~english	The level of detail selected for each geometry and submesh.
+		//!\~french		Le niveau de détail sélectionné pour chaque géométrie et sous-maillage.
+		std::unordered_map< size_t, uint32_t > m_selectedLods;
 		OnSceneChangedConnection m_sceneChanged;
 		OnCameraChangedConnection m_cameraChanged;
 	};
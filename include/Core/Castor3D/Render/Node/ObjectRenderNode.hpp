@@ -11,6 +11,8 @@ See LICENSE file in root folder
 #include "Castor3D/Render/Node/SceneRenderNode.hpp"
 #include "Castor3D/Shader/Ubos/UbosModule.hpp"
 
+#include <CastorUtils/Graphics/Meshlet.hpp>
+
 #include <ashespp/Descriptor/DescriptorSet.hpp>
 
 namespace castor3d
@@ -51,6 +53,8 @@ namespace castor3d
 		InstanceType & instance;
 		ashes::DescriptorSetPtr uboDescriptorSet;
 		ashes::DescriptorSetPtr texDescriptorSet;
+		uint32_t lod{ 0u };
+		castor::MeshletRangeArray meshletRanges;
 	};
 }
 
@@ -20,19 +20,25 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Constructor.
-		 *\param[in]	scene	The scene.
-		 *\param[in]	source	The source environment map.
-		 *\param[in]	sampler	The sampler used for the environment map.
+		 *\param[in]	scene			The scene.
+		 *\param[in]	source			The source environment map.
+		 *\param[in]	sampler			The sampler used for the environment map.
+		 *\param[in]	sourceHash		The source environment hash, used to store the results in the engine's texture cache (0 to disable caching).
+		 *\param[in]	shIrradiance	Tells if the irradiance map is computed on CPU, from the spherical harmonics of the source.
 		 *\~french
 		 *\brief		Constructeur.
-		 *\param[in]	scene	La scène.
-		 *\param[in]	source	La texture d'environnement source.
-		 *\param[in]	sampler	Le sampler utilisé pour la texture d'environnement.
+		 *\param[in]	scene			La scène.
+		 *\param[in]	source			La texture d'environnement source.
+		 *\param[in]	sampler			Le sampler utilisé pour la texture d'environnement.
+		 *\param[in]	sourceHash		Le hash de l'environnement source, utilisé pour stocker les résultats dans le cache de textures du moteur (0 pour désactiver le cache).
+		 *\param[in]	shIrradiance	Dit si la texture d'irradiance est calculée sur CPU, à partir des harmoniques sphériques de la source.
 		 */
 		C3D_API explicit IblTextures( Scene & scene
 			, RenderDevice const & device
 			, ashes::Image const & source
-			, SamplerSPtr sampler );
+			, SamplerSPtr sampler
+			, uint64_t sourceHash = 0u
+			, bool shIrradiance = false );
 		/**
 		 *\~english
 		 *\brief		Destructor.
@@ -43,8 +49,10 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Updates the environment maps.
+		 *\remarks		If the source hash is known, the maps are read from the cache when available, and written to it otherwise.
 		 *\~french
 		 *\brief		Met à jour les textures d'environnement.
+		 *\remarks		Si le hash de la source est connu, les textures sont lues depuis le cache si elles y sont, et y sont écrites sinon.
 		 */
 		C3D_API void update();
 		/**
@@ -97,6 +105,15 @@ namespace castor3d
 		/**@}*/
 
 	private:
+		bool doLoadCache();
+		void doSaveCache();
+		bool doComputeShIrradiance();
+
+	private:
+		RenderDevice const & m_device;
+		ashes::Image const & m_source;
+		uint64_t m_sourceHash;
+		bool m_shIrradiance;
 		ashes::ImagePtr m_prefilteredBrdf;
 		ashes::ImageView m_prefilteredBrdfView;
 		SamplerSPtr m_sampler;
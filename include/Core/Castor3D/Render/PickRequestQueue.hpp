@@ -0,0 +1,105 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_PickRequestQueue_H___
+#define ___C3D_PickRequestQueue_H___
+
+#include <CastorUtils/Config/MultiThreadConfig.hpp>
+
+#include <deque>
+#include <mutex>
+
+namespace castor3d
+{
+	/**
+	 *\~english
+	 *\brief		Thread safe FIFO of asynchronous pick requests.
+	 *\remarks		RequestT must have a uint32_t id member, set by push.
+	 *\~french
+	 *\brief		File FIFO thread safe de requêtes de sélection asynchrones.
+	 *\remarks		RequestT doit avoir un membre uint32_t id, défini par push.
+	 */
+	template< typename RequestT >
+	class PickRequestQueueT
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Gives an ID to a request, and queues it.
+		 *\param[in]	request	The request.
+		 *\return		The request ID, the IDs increase in the queue order.
+		 *\~french
+		 *\brief		Donne un ID à une requête, et la met en file.
+		 *\param[in]	request	La requête.
+		 *\return		L'ID de la requête, les IDs croissent dans l'ordre de la file.
+		 */
+		uint32_t push( RequestT request )
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			auto id = m_nextId++;
+			request.id = id;
+			m_requests.push_back( std::move( request ) );
+			return id;
+		}
+		/**
+		 *\~english
+		 *\brief		Removes the oldest request.
+		 *\param[out]	request	Receives the request.
+		 *\return		\p false if the queue was empty.
+		 *\~french
+		 *\brief		Retire la requête la plus ancienne.
+		 *\param[out]	request	Reçoit la requête.
+		 *\return		\p false si la file était vide.
+		 */
+		bool pop( RequestT & request )
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+
+			if ( m_requests.empty() )
+			{
+				return false;
+			}
+
+			request = std::move( m_requests.front() );
+			m_requests.pop_front();
+			return true;
+		}
+		/**
+		 *\~english
+		 *\brief		Removes all the queued requests, then calls the given function on each of them, in the queue order.
+		 *\remarks		The function is called unlocked, so it may push new requests, which stay queued.
+		 *\param[in]	func	The function.
+		 *\~french
+		 *\brief		Retire toutes les requêtes en file, puis appelle la fonction donnée sur chacune d'elles, dans l'ordre de la file.
+		 *\remarks		La fonction est appelée sans verrou, elle peut donc pousser de nouvelles requêtes, qui restent en file.
+		 *\param[in]	func	La fonction.
+		 */
+		template< typename FuncT >
+		void cancel( FuncT func )
+		{
+			std::deque< RequestT > requests;
+			{
+				auto lock( castor::makeUniqueLock( m_mutex ) );
+				std::swap( requests, m_requests );
+			}
+
+			for ( auto & request : requests )
+			{
+				func( request );
+			}
+		}
+
+		size_t size()const
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			return m_requests.size();
+		}
+
+	private:
+		mutable std::mutex m_mutex;
+		std::deque< RequestT > m_requests;
+		uint32_t m_nextId{ 1u };
+	};
+}
+
+#endif
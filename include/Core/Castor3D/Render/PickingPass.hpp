@@ -4,19 +4,61 @@ See LICENSE file in root folder
 #ifndef ___C3D_PickingPass_H___
 #define ___C3D_PickingPass_H___
 
+#include "Castor3D/Render/PickRequestQueue.hpp"
 #include "Castor3D/Render/RenderPass.hpp"
 #include "Castor3D/Render/Passes/CommandsSemaphore.hpp"
 #include "Castor3D/Shader/Ubos/UbosModule.hpp"
 
+#include <CastorUtils/Graphics/Rectangle.hpp>
+
 #include <ashespp/Image/ImageView.hpp>
 
 #include <atomic>
+#include <functional>
+#include <future>
 
 namespace castor3d
 {
 	class PickingPass
 		: public RenderPass
 	{
+	public:
+		/**
+		 *\~english
+		 *\brief		The result of a point pick.
+		 *\~french
+		 *\brief		Le résultat d'une sélection ponctuelle.
+		 */
+		struct PickResult
+		{
+			//!\~english	The request ID, as returned by pickAsync.
+			//!\~french		L'ID de la requête, tel que retourné par pickAsync.
+			uint32_t id{ 0u };
+			//!\~english	The picked node type, PickNodeType::eNone if nothing was picked.
+			//!\~french		Le type du noeud sélectionné, PickNodeType::eNone si rien n'a été sélectionné.
+			PickNodeType type{ PickNodeType::eNone };
+			GeometrySPtr geometry;
+			SubmeshSPtr submesh;
+			BillboardBaseSPtr billboard;
+			//!\~english	The picked face index (from GPU picks only).
+			//!\~french		L'indice de la face sélectionnée (sélections GPU uniquement).
+			uint32_t face{ 0u };
+		};
+		/**
+		 *\~english
+		 *\brief		The result of an area pick: the distinct objects visible in the area.
+		 *\~french
+		 *\brief		Le résultat d'une sélection de zone : les objets distincts visibles dans la zone.
+		 */
+		struct AreaPickResult
+		{
+			uint32_t id{ 0u };
+			std::vector< GeometrySPtr > geometries;
+			std::vector< BillboardBaseSPtr > billboards;
+		};
+		using PickCallback = std::function< void( PickResult const & ) >;
+		using AreaPickCallback = std::function< void( AreaPickResult const & ) >;
+
 	public:
 		/**
 		 *\~english
@@ -67,6 +109,74 @@ namespace castor3d
 		C3D_API PickNodeType pick( RenderDevice const & device
 			, castor::Position position
 			, Camera const & camera );
+		/**
+		 *\~english
+		 *\brief		Queues a pick request at given mouse position.
+		 *\remarks		The request is resolved by processRequests, once the GPU has rendered it, without waiting for it.
+		 *\param[in]	position	The position in the pass.
+		 *\param[in]	callback	The callback receiving the result, from the render thread.
+		 *\return		The request ID.
+		 *\~french
+		 *\brief		Met en file une requête de sélection à la position de souris donnée.
+		 *\remarks		La requête est résolue par processRequests, une fois que le GPU l'a dessinée, sans l'attendre.
+		 *\param[in]	position	La position dans la passe.
+		 *\param[in]	callback	Le callback recevant le résultat, depuis le thread de rendu.
+		 *\return		L'ID de la requête.
+		 */
+		C3D_API uint32_t pickAsync( castor::Position const & position
+			, PickCallback callback );
+		/**
+		 *\~english
+		 *\brief		Queues a pick request at given mouse position.
+		 *\param[in]	position	The position in the pass.
+		 *\return		The future result.
+		 *\~french
+		 *\brief		Met en file une requête de sélection à la position de souris donnée.
+		 *\param[in]	position	La position dans la passe.
+		 *\return		Le résultat futur.
+		 */
+		C3D_API std::future< PickResult > pickAsync( castor::Position const & position );
+		/**
+		 *\~english
+		 *\brief		Queues a pick request for all the objects visible in given area.
+		 *\param[in]	area		The area in the pass.
+		 *\param[in]	callback	The callback receiving the result, from the render thread.
+		 *\return		The request ID.
+		 *\~french
+		 *\brief		Met en file une requête de sélection de tous les objets visibles dans la zone donnée.
+		 *\param[in]	area		La zone dans la passe.
+		 *\param[in]	callback	Le callback recevant le résultat, depuis le thread de rendu.
+		 *\return		L'ID de la requête.
+		 */
+		C3D_API uint32_t pickAsync( castor::Rectangle const & area
+			, AreaPickCallback callback );
+		/**
+		 *\~english
+		 *\brief		Resolves the pick request rendered by the GPU, if it is done, and starts the next queued one.
+		 *\remarks		To call once per frame, never waits for the GPU.
+		 *\param[in]	device	The GPU device.
+		 *\~french
+		 *\brief		Résout la requête de sélection dessinée par le GPU, si elle est terminée, et démarre la suivante.
+		 *\remarks		A appeler une fois par frame, n'attend jamais le GPU.
+		 *\param[in]	device	Le device GPU.
+		 */
+		C3D_API void processRequests( RenderDevice const & device );
+		/**
+		 *\~english
+		 *\brief		Picks a geometry at given mouse position, ray testing the scene on CPU.
+		 *\remarks		Immediate, but ignores the animations and the billboards.
+		 *\param[in]	position	The position in the pass.
+		 *\param[in]	camera		The viewing camera.
+		 *\return		The result.
+		 *\~french
+		 *\brief		Sélectionne la géométrie à la position de souris donnée, en testant la scène par lancer de rayon sur le CPU.
+		 *\remarks		Immédiat, mais ignore les animations et les billboards.
+		 *\param[in]	position	La position dans la passe.
+		 *\param[in]	camera		La caméra regardant la scène.
+		 *\return		Le résultat.
+		 */
+		C3D_API PickResult pickCpu( castor::Position const & position
+			, Camera const & camera )const;
 		/**
 		*\~english
 		*name
@@ -121,7 +231,13 @@ namespace castor3d
 			, Camera const & camera
 			, ashes::CommandBuffer const & commandBuffer );
 		PickNodeType doPick( castor::Point4f const & pixel
-			, SceneCulledRenderNodes & nodes );
+			, SceneCulledRenderNodes & nodes
+			, GeometryWPtr & geometry
+			, BillboardBaseWPtr & billboard
+			, SubmeshWPtr & submesh
+			, uint32_t & face );
+		void doStartRequest( RenderDevice const & device );
+		void doResolveRequest();
 		/**
 		 *\copydoc		castor3d::RenderPass::doRender
 		 */
@@ -239,6 +355,14 @@ namespace castor3d
 		using CameraQueueMap = std::map< Camera const *, RenderQueue >;
 		C3D_API static uint32_t const UboBindingPoint;
 
+		struct PickRequest
+		{
+			uint32_t id{ 0u };
+			castor::Rectangle area;
+			PickCallback callback;
+			AreaPickCallback areaCallback;
+		};
+
 	private:
 		std::map< castor::String, GeometryWPtr > m_pickable;
 		ashes::ImagePtr m_colourTexture;
@@ -260,6 +384,12 @@ namespace castor3d
 		ashes::FencePtr m_transferFence;
 		PickNodeType m_pickNodeType{ PickNodeType::eNone };
 		std::atomic_bool m_picking{ false };
+		PickRequestQueueT< PickRequest > m_requests;
+		std::unique_ptr< PickRequest > m_pendingRequest;
+		VkRect2D m_pendingArea{};
+		ashes::CommandBufferPtr m_asyncCommandBuffer;
+		ashes::BufferPtr< castor::Point4f > m_asyncStagingBuffer;
+		ashes::FencePtr m_asyncFence;
 	};
 }
 
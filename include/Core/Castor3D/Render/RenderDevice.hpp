@@ -88,6 +88,7 @@ namespace castor3d
 		ashes::QueuePtr transferQueue{ nullptr };
 		GpuBufferPoolSPtr bufferPool;
 		UniformBufferPoolsSPtr uboPools;
+		UploadQueueSPtr uploadQueue;
 
 		static constexpr size_t GraphicsIdx = 0u;
 		static constexpr size_t PresentIdx = 1u;
@@ -8,6 +8,7 @@ See LICENSE file in root folder
 #include "Castor3D/Render/ShadowMap/ShadowMapModule.hpp"
 
 #include "Castor3D/Overlay/OverlayModule.hpp"
+#include "Castor3D/Render/CpuFrameTimings.hpp"
 #include "Castor3D/Render/Passes/CommandsSemaphore.hpp"
 
 #include <CastorUtils/Multithreading/ThreadPool.hpp>
@@ -15,6 +16,7 @@ See LICENSE file in root folder
 #include <ashespp/Core/WindowHandle.hpp>
 
 #include <chrono>
+#include <mutex>
 
 namespace castor3d
 {
@@ -119,6 +121,13 @@ namespace castor3d
 		 *\return		Le statut d'affichage des incrustations de débogage.
 		 */
 		C3D_API bool hasDebugOverlays()const;
+		/**
+		 *\~english
+		 *\return		The CPU time spent in each phase of the last rendered frame.
+		 *\~french
+		 *\return		Le temps CPU passé dans chaque phase de la dernière frame rendue.
+		 */
+		C3D_API CpuFrameTimings getLastCpuTimings()const;
 		/**
 		 *\~english
 		 *\brief		Starts threaded render loop.
@@ -255,6 +264,11 @@ namespace castor3d
 		//!\~english	The pool used to update the render queues.
 		//!\~french		Le pool de mise à jour des files de rendu.
 		castor::ThreadPool m_queueUpdater;
+		//!\~english	The CPU timings of the frame being rendered, and of the last rendered one.
+		//!\~french		Les temps CPU de la frame en cours de rendu, et de la dernière rendue.
+		CpuFrameTimings m_cpuTimings;
+		CpuFrameTimings m_lastCpuTimings;
+		mutable std::mutex m_cpuTimingsMutex;
 		struct UploadResources
 		{
 			//!\~english	The command buffer and semaphore used for UBO uploads.
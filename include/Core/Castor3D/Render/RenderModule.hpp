@@ -210,6 +210,53 @@ namespace castor3d
 		CU_ScopedEnumBounds( eOpaqueOnly )
 	};
 	C3D_API castor::String getName( RenderMode value );
+	/**
+	*\~english
+	*\brief
+	*	The CPU phases of a frame, measured by the render loop.
+	*\~french
+	*\brief
+	*	Les phases CPU d'une frame, mesurées par la boucle de rendu.
+	*/
+	enum class CpuFramePhase
+		: uint8_t
+	{
+		//!\~english	Frame events processing.
+		//!\~french		Traitement des évènements de frame.
+		eEvents,
+		//!\~english	GPU updaters (UBOs and pass buffers).
+		//!\~french		Mise à jour GPU (UBOs et buffers de passe).
+		eGpuUpdate,
+		//!\~english	UBO pools upload.
+		//!\~french		Upload des pools d'UBO.
+		eUpload,
+		//!\~english	Render targets and windows rendering.
+		//!\~french		Rendu des cibles de rendu et fenêtres.
+		eRender,
+		//!\~english	CPU material update.
+		//!\~french		Mise à jour CPU des matériaux.
+		eMaterials,
+		//!\~english	Scene::update, animations excluded.
+		//!\~french		Scene::update, animations exclues.
+		eScene,
+		//!\~english	Animated object groups update.
+		//!\~french		Mise à jour des groupes d'objets animés.
+		eAnimations,
+		//!\~english	Render targets CPU update, culling excluded.
+		//!\~french		Mise à jour CPU des cibles de rendu, culling exclu.
+		eTargets,
+		//!\~english	Scene culling.
+		//!\~french		Culling de la scène.
+		eCulling,
+		//!\~english	Render techniques CPU update.
+		//!\~french		Mise à jour CPU des techniques de rendu.
+		eTechniques,
+		//!\~english	RenderQueue::update.
+		//!\~french		RenderQueue::update.
+		eQueues,
+		CU_ScopedEnumBounds( eEvents )
+	};
+	C3D_API castor::String getName( CpuFramePhase value );
 	C3D_API bool isValidNodeForPass( PassFlags const & passFlags, RenderMode value );
 
 	C3D_API TextureFlagsArray::const_iterator checkFlags( TextureFlagsArray const & flags, TextureFlag flag );
@@ -276,6 +323,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	The CPU time spent in each phase of a frame.
+	*\~french
+	*\brief
+	*	Le temps CPU passé dans chaque phase d'une frame.
+	*/
+	struct CpuFrameTimings;
+	/**
+	*\~english
+	*\brief
 	*	Implements a frustum and the checks related to frustum culling.
 	*\~french
 	*\brief
@@ -500,6 +556,7 @@ namespace castor3d
 		}
 
 		RenderQueueArray * queues{ nullptr };
+		CpuFrameTimings * timings{ nullptr };
 		CameraSPtr camera;
 		SceneNode const * node{ nullptr };
 		LightSPtr light;
@@ -621,6 +621,13 @@ namespace castor3d
 		*/
 		/**@{*/
 		C3D_API virtual TextureFlags getTexturesMask()const;
+		/**
+		 *\~english
+		 *\return		\p false if the pass must draw the whole submeshes, ignoring their culled meshlets.
+		 *\~french
+		 *\return		\p false si la passe doit dessiner les sous-maillages entiers, en ignorant leurs meshlets culled.
+		 */
+		C3D_API virtual bool usesMeshlets()const;
 
 		inline bool isOrderIndependent()const
 		{
@@ -792,32 +799,40 @@ namespace castor3d
 			, RenderInfo & info )const;
 		/**
 		 *\~english
-		 *\brief		Copies the instanced skinned nodes model matrices into given matrix buffer.
-		 *\param[in]	renderNodes	The instanced nodes.
-		 *\param[in]	bonesBuffer	The bones matrix buffer.
+		 *\brief			Copies the instanced skinned nodes bone palettes into the given bones component buffer.
+		 *\remarks			The palettes are packed contiguously, their offsets are written in the instances data.
+		 *\param[in]		renderNodes		The instanced nodes.
+		 *\param[in]		bones			The bones instantiation component.
+		 *\param[in,out]	matrixBuffer	The instances data, receiving the palettes offsets.
 		 *\~french
-		 *\brief		Copie les matrices de noeuds skinnés instanciés dans le tampon de matrices donné.
-		 *\param[in]	renderNodes	Les noeuds instanciés.
-		 *\param[in]	bonesBuffer	Le tampon de matrices des os.
+		 *\brief			Copie les palettes d'os des noeuds skinnés instanciés dans le tampon du composant d'os donné.
+		 *\remarks			Les palettes sont rangées de manière contiguë, leurs décalages sont écrits dans les données d'instances.
+		 *\param[in]		renderNodes		Les noeuds instanciés.
+		 *\param[in]		bones			Le composant d'instanciation des os.
+		 *\param[in,out]	matrixBuffer	Les données d'instances, recevant les décalages des palettes.
 		 */
 		C3D_API uint32_t doCopyNodesBones( SkinningRenderNodePtrArray const & renderNodes
-			, ShaderBuffer & bonesBuffer )const;
+			, BonesInstantiationComponent & bones
+			, std::vector< InstantiationData > & matrixBuffer )const;
 		/**
 		 *\~english
-		 *\brief			Copies the instanced skinned nodes model matrices into given matrix buffer.
+		 *\brief			Copies the instanced skinned nodes bone palettes into the given bones component buffer.
 		 *\remarks			The nodes which are copied will be registered in the rendered nodes list.
-		 *\param[in]		renderNodes	The instanced nodes.
-		 *\param[in]		bonesBuffer	The bones matrix buffer.
-		 *\param[in, out]	info		Receives the render informations.
+		 *\param[in]		renderNodes		The instanced nodes.
+		 *\param[in]		bones			The bones instantiation component.
+		 *\param[in,out]	matrixBuffer	The instances data, receiving the palettes offsets.
+		 *\param[in, out]	info			Receives the render informations.
 		 *\~french
-		 *\brief			Copie les matrices de noeuds skinnés instanciés dans le tampon de matrices donné.
+		 *\brief			Copie les palettes d'os des noeuds skinnés instanciés dans le tampon du composant d'os donné.
 		 *\remarks			Les noeuds pour lesquels les matrices sont copiées seront enregistrés dans la liste des noeuds dessinés.
-		 *\param[in]		renderNodes	Les noeuds instanciés.
-		 *\param[in]		bonesBuffer	Le tampon de matrices des os.
-		 *\param[in,out]	info		Reçoit les informations de rendu.
+		 *\param[in]		renderNodes		Les noeuds instanciés.
+		 *\param[in]		bones			Le composant d'instanciation des os.
+		 *\param[in,out]	matrixBuffer	Les données d'instances, recevant les décalages des palettes.
+		 *\param[in,out]	info			Reçoit les informations de rendu.
 		 */
 		C3D_API uint32_t doCopyNodesBones( SkinningRenderNodePtrArray const & renderNodes
-			, ShaderBuffer & bonesBuffer
+			, BonesInstantiationComponent & bones
+			, std::vector< InstantiationData > & matrixBuffer
 			, RenderInfo & info )const;
 		/**
 		 *\~english
@@ -1244,6 +1259,7 @@ namespace castor3d
 			// Instantiation inputs (overlaps morphing inputs)
 			static uint32_t constexpr TransformLocation = 8u; // 4 components since it is a matrix
 			static uint32_t constexpr MaterialLocation = 12u;
+			static uint32_t constexpr BonesOffsetLocation = 13u;
 		};
 		struct VertexOutputs
 		{
@@ -349,6 +349,11 @@ namespace castor3d
 		{
 			return m_intermediates;
 		}
+
+		inline bool isOcclusionCullingEnabled()const
+		{
+			return m_occlusionCulling;
+		}
 		/**@}*/
 		/**
 		*\~english
@@ -388,6 +393,18 @@ namespace castor3d
 		{
 			m_hdrConfig.gamma = value;
 		}
+		/**
+		*\~english
+		*\brief		Enables or disables the CPU occlusion culling.
+		*\remarks		Taken into account when the culler is created, at initialisation or camera change.
+		*\~french
+		*\brief		Active ou désactive l'occlusion culling CPU.
+		*\remarks		Pris en compte lors de la création du culler, à l'initialisation ou au changement de caméra.
+		*/
+		inline void setOcclusionCulling( bool value )
+		{
+			m_occlusionCulling = value;
+		}
 
 		inline HdrConfigUbo const & getHdrConfigUbo()const
 		{
@@ -473,6 +490,7 @@ namespace castor3d
 		ashes::Semaphore const * m_signalFinished{ nullptr };
 		castor::PreciseTimer m_timer;
 		SceneCullerUPtr m_culler;
+		bool m_occlusionCulling{ false };
 		IntermediateViewArray m_intermediates;
 	};
 }
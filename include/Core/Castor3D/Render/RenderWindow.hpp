@@ -398,6 +398,12 @@ namespace castor3d
 			m_enablePickingDebug = v;
 		}
 
+		inline PickingPass & getPickingPass()const
+		{
+			CU_Require( m_pickingPass );
+			return *m_pickingPass;
+		}
+
 		C3D_API GeometrySPtr getPickedGeometry()const;
 		C3D_API BillboardBaseSPtr getPickedBillboard()const;
 		C3D_API SubmeshSPtr getPickedSubmesh()const;
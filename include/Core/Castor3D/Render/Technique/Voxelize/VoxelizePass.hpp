@@ -56,6 +56,11 @@ namespace castor3d
 		 */
 		ashes::Semaphore const & render( RenderDevice const & device
 			, ashes::Semaphore const & toWait );
+		/**
+		 *\copydoc		castor3d::RenderPass::usesMeshlets
+		 *\remarks		The voxelization projects the triangles on their dominant axis, the meshlets culled from the camera point of view don't apply.
+		 */
+		C3D_API bool usesMeshlets()const override;
 		/**
 		*\~english
 		*name
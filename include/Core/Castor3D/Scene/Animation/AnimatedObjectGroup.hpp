@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___C3D_ANIMATED_OBJECT_GROUP_H___
 
 #include "AnimationModule.hpp"
+#include "Castor3D/Scene/Animation/AnimationThrottle.hpp"
 #include "Castor3D/Model/Skeleton/SkeletonModule.hpp"
 
 #include <CastorUtils/Data/TextWriter.hpp>
@@ -193,6 +194,23 @@ namespace castor3d
 		 *\brief		Met à jour toutes les animations
 		 */
 		C3D_API void update();
+		/**
+		 *\~english
+		 *\brief		Updates all animated objects, the skeletons being updated at a rate depending on the group visibility.
+		 *\remarks		Between two updates, the skeletons poses are interpolated.
+		 *\param[in]	throttle		The scene animation throttling.
+		 *\param[in]	projectedSize	The group projected size, in pixels.
+		 *\param[in]	visible			Tells if the group is visible from a camera.
+		 *\~french
+		 *\brief		Met à jour toutes les animations, les squelettes étant mis à jour à une fréquence dépendant de la visibilité du groupe.
+		 *\remarks		Entre deux mises à jour, les poses des squelettes sont interpolées.
+		 *\param[in]	throttle		La limitation des animations de la scène.
+		 *\param[in]	projectedSize	La taille projetée du groupe, en pixels.
+		 *\param[in]	visible			Dit si le groupe est visible depuis une caméra.
+		 */
+		C3D_API void update( AnimationThrottle const & throttle
+			, float projectedSize
+			, bool visible );
 		/**
 		 *\~english
 		 *\brief		Starts the animation identified by the given name
@@ -261,6 +279,16 @@ namespace castor3d
 		{
 			return m_objects;
 		}
+		/**
+		 *\~english
+		 *\return		The animation throttling state.
+		 *\~french
+		 *\return		L'état de limitation des animations.
+		 */
+		inline AnimationThrottle::State const & getThrottleState()const
+		{
+			return m_throttleState;
+		}
 
 	public:
 		OnAnimatedSkeletonChange onSkeletonAdded;
@@ -268,10 +296,16 @@ namespace castor3d
 		OnAnimatedMeshChange onMeshAdded;
 		OnAnimatedMeshChange onMeshRemoved;
 
+	private:
+		castor::Milliseconds doGetElapsed();
+		void doUpdate( castor::Milliseconds const & elapsed
+			, bool updateSkeletons );
+
 	private:
 		GroupAnimationMap m_animations;
 		AnimatedObjectPtrStrMap m_objects;
 		castor::PreciseTimer m_timer;
+		AnimationThrottle::State m_throttleState;
 	};
 }
 
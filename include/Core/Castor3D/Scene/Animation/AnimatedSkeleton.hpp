@@ -81,6 +81,20 @@ namespace castor3d
 		{
 			return !m_playingAnimations.empty();
 		}
+		/**
+		 *\~english
+		 *\brief		Defines the interpolation factor from the previous pose to the last computed one.
+		 *\remarks		Used when the animation isn't updated every frame, for the pose to move smoothly.
+		 *\param[in]	value	The new value, 1 to use the last computed pose.
+		 *\~french
+		 *\brief		Définit le facteur d'interpolation de la pose précédente vers la dernière calculée.
+		 *\remarks		Utilisé quand l'animation n'est pas mise à jour à chaque frame, pour que la pose se déplace sans à-coups.
+		 *\param[in]	value	La nouvelle valeur, 1 pour utiliser la dernière pose calculée.
+		 */
+		inline void setPoseBlend( float value )
+		{
+			m_poseBlend = value;
+		}
 		/**
 		 *\~english
 		 *\return		The skeleton.
@@ -149,6 +163,10 @@ namespace castor3d
 		 *\copydoc		castor3d::AnimatedObject::doAddAnimation
 		 */
 		void doClearAnimations()override;
+		castor::Matrix4x4f doGetBoneTransform( Bone const & bone
+			, size_t index )const;
+		void doComputePose( std::vector< castor::Matrix4x4f > & pose )const;
+		castor::Matrix4x4f doComputeBoneTransform( Bone const & bone )const;
 
 	protected:
 		//!\~english	The skeleton affected by the animations.
@@ -163,6 +181,15 @@ namespace castor3d
 		//!\~english	Currently playing animations.
 		//!\~french		Les animations en cours de lecture.
 		SkeletonAnimationInstanceArray m_playingAnimations;
+		//!\~english	The bones transforms of the pose computed before the last one.
+		//!\~french		Les transformations des os de la pose calculée avant la dernière.
+		std::vector< castor::Matrix4x4f > m_previousPose;
+		//!\~english	The bones transforms of the last computed pose.
+		//!\~french		Les transformations des os de la dernière pose calculée.
+		std::vector< castor::Matrix4x4f > m_currentPose;
+		//!\~english	The interpolation factor from the previous pose to the last computed one.
+		//!\~french		Le facteur d'interpolation de la pose précédente vers la dernière calculée.
+		float m_poseBlend{ 1.0f };
 	};
 }
 
@@ -68,6 +68,15 @@ namespace castor3d
 	*	Utilisée pour jouer une animation sur un objet particulier.
 	*/
 	class AnimationInstance;
+	/**
+	*\~english
+	*\brief
+	*	Reduces the animation update rate of the small or hidden animated object groups.
+	*\~french
+	*\brief
+	*	Réduit la fréquence de mise à jour des animations des groupes d'objets animés petits ou cachés.
+	*/
+	class AnimationThrottle;
 
 	struct GroupAnimation
 	{
@@ -0,0 +1,193 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_AnimationThrottle_H___
+#define ___C3D_AnimationThrottle_H___
+
+#include "AnimationModule.hpp"
+
+namespace castor3d
+{
+	class AnimationThrottle
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		The throttling state of one animated object group.
+		 *\~french
+		 *\brief		L'état de limitation d'un groupe d'objets animés.
+		 */
+		struct State
+		{
+			//!\~english	The frame offset, spreading the groups updates over the frames.
+			//!\~french		Le décalage en frames, répartissant les mises à jour des groupes sur les frames.
+			uint32_t phase{ 0u };
+			//!\~english	The current frames count between two updates.
+			//!\~french		Le nombre actuel de frames entre deux mises à jour.
+			uint32_t interval{ 1u };
+			//!\~english	The frames count since the last update.
+			//!\~french		Le nombre de frames depuis la dernière mise à jour.
+			uint32_t skipped{ 0u };
+			//!\~english	The time elapsed since the last update.
+			//!\~french		Le temps écoulé depuis la dernière mise à jour.
+			castor::Milliseconds accumulated{ 0u };
+			//!\~english	The time to apply to the animations, when an update is due.
+			//!\~french		Le temps à appliquer aux animations, quand une mise à jour est due.
+			castor::Milliseconds elapsed{ 0u };
+			//!\~english	The interpolation factor from the previous pose to the last computed one.
+			//!\~french		Le facteur d'interpolation de la pose précédente vers la dernière calculée.
+			float blend{ 1.0f };
+		};
+
+	public:
+		//!\~english	The default projected size, in pixels, above which the animations are updated every frame.
+		//!\~french		La taille projetée par défaut, en pixels, au-dessus de laquelle les animations sont mises à jour à chaque frame.
+		static float constexpr DefaultFullRateSize = 256.0f;
+		//!\~english	The default maximum frames count between two updates of a visible group.
+		//!\~french		Le nombre maximal par défaut de frames entre deux mises à jour d'un groupe visible.
+		static uint32_t constexpr DefaultMaxInterval = 8u;
+		//!\~english	The default frames count between two updates of a hidden group.
+		//!\~french		Le nombre par défaut de frames entre deux mises à jour d'un groupe caché.
+		static uint32_t constexpr DefaultHiddenInterval = 16u;
+		//!\~english	The default bounds enlargement, covering the poses not reflected in the rest pose bounds.
+		//!\~french		L'agrandissement par défaut des volumes englobants, couvrant les poses non représentées par les volumes de la pose de repos.
+		static float constexpr DefaultBoundsMargin = 0.5f;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	fullRateSize	The projected size, in pixels, above which the animations are updated every frame.
+		 *\param[in]	maxInterval		The maximum frames count between two updates of a visible group.
+		 *\param[in]	hiddenInterval	The frames count between two updates of a hidden group.
+		 *\param[in]	boundsMargin	The bounds enlargement, relative to their radius.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	fullRateSize	La taille projetée, en pixels, au-dessus de laquelle les animations sont mises à jour à chaque frame.
+		 *\param[in]	maxInterval		Le nombre maximal de frames entre deux mises à jour d'un groupe visible.
+		 *\param[in]	hiddenInterval	Le nombre de frames entre deux mises à jour d'un groupe caché.
+		 *\param[in]	boundsMargin	L'agrandissement des volumes englobants, relatif à leur rayon.
+		 */
+		C3D_API explicit AnimationThrottle( float fullRateSize = DefaultFullRateSize
+			, uint32_t maxInterval = DefaultMaxInterval
+			, uint32_t hiddenInterval = DefaultHiddenInterval
+			, float boundsMargin = DefaultBoundsMargin );
+		/**
+		 *\~english
+		 *\brief		Computes the projected size of a bounding sphere.
+		 *\param[in]	radius			The sphere radius.
+		 *\param[in]	distance		The distance from the camera to the sphere center.
+		 *\param[in]	projectionScale	The camera projection scale, in pixels per unit at a distance of 1.
+		 *\return		The sphere diameter, in pixels.
+		 *\~french
+		 *\brief		Calcule la taille projetée d'une sphère englobante.
+		 *\param[in]	radius			Le rayon de la sphère.
+		 *\param[in]	distance		La distance de la caméra au centre de la sphère.
+		 *\param[in]	projectionScale	L'échelle de projection de la caméra, en pixels par unité à une distance de 1.
+		 *\return		Le diamètre de la sphère, en pixels.
+		 */
+		C3D_API static float getProjectedSize( float radius
+			, float distance
+			, float projectionScale );
+		/**
+		 *\~english
+		 *\param[in]	state	The group throttling state.
+		 *\return		The radius enlargement factor to apply to the group bounds when testing their visibility.
+		 *\remarks		The bounds grow with the frames count since the last update, since the pose may have moved meanwhile.
+		 *\~french
+		 *\param[in]	state	L'état de limitation du groupe.
+		 *\return		Le facteur d'agrandissement du rayon à appliquer aux volumes englobants du groupe lors du test de leur visibilité.
+		 *\remarks		Les volumes grandissent avec le nombre de frames depuis la dernière mise à jour, la pose ayant pu bouger entre temps.
+		 */
+		C3D_API float getBoundsScale( State const & state )const;
+		/**
+		 *\~english
+		 *\param[in]	projectedSize	The group projected size, in pixels.
+		 *\param[in]	visible			Tells if the group is visible from a camera.
+		 *\return		The frames count between two updates.
+		 *\~french
+		 *\param[in]	projectedSize	La taille projetée du groupe, en pixels.
+		 *\param[in]	visible			Dit si le groupe est visible depuis une caméra.
+		 *\return		Le nombre de frames entre deux mises à jour.
+		 */
+		C3D_API uint32_t getInterval( float projectedSize
+			, bool visible )const;
+		/**
+		 *\~english
+		 *\brief			Advances a group of one frame.
+		 *\param[in,out]	state			The group throttling state.
+		 *\param[in]		elapsed			The time elapsed since the previous frame.
+		 *\param[in]		projectedSize	The group projected size, in pixels.
+		 *\param[in]		visible			Tells if the group is visible from a camera.
+		 *\return			\p true if the group animations must be updated, of \p state.elapsed.
+		 *\~french
+		 *\brief			Avance un groupe d'une frame.
+		 *\param[in,out]	state			L'état de limitation du groupe.
+		 *\param[in]		elapsed			Le temps écoulé depuis la frame précédente.
+		 *\param[in]		projectedSize	La taille projetée du groupe, en pixels.
+		 *\param[in]		visible			Dit si le groupe est visible depuis une caméra.
+		 *\return			\p true si les animations du groupe doivent être mises à jour, de \p state.elapsed.
+		 */
+		C3D_API bool step( State & state
+			, castor::Milliseconds const & elapsed
+			, float projectedSize
+			, bool visible )const;
+		/**
+		 *\~english
+		 *\brief		Goes to the next frame, to be called once all groups have been stepped.
+		 *\~french
+		 *\brief		Passe à la frame suivante, à appeler une fois que tous les groupes ont avancé.
+		 */
+		inline void nextFrame()
+		{
+			++m_frame;
+		}
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		inline bool isEnabled()const
+		{
+			return m_enabled;
+		}
+
+		inline uint32_t getFrame()const
+		{
+			return m_frame;
+		}
+		/**@}*/
+		/**
+		*\~english
+		*name
+		*	Mutators.
+		*\~french
+		*name
+		*	Mutateurs.
+		*/
+		/**@{*/
+		/**
+		 *\~english
+		 *\brief		Enables or disables the throttling (disabled by default, the animations then run at full rate).
+		 *\~french
+		 *\brief		Active ou désactive la limitation (désactivée par défaut, les animations tournent alors à pleine fréquence).
+		 */
+		inline void setEnabled( bool value )
+		{
+			m_enabled = value;
+		}
+		/**@}*/
+
+	private:
+		float m_fullRateSize;
+		uint32_t m_maxInterval;
+		uint32_t m_hiddenInterval;
+		float m_boundsMargin;
+		bool m_enabled{ false };
+		uint32_t m_frame{ 0u };
+	};
+}
+
+#endif
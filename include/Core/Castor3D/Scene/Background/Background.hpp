@@ -275,6 +275,27 @@ namespace castor3d
 		C3D_API virtual void accept( BackgroundVisitor & visitor ) = 0;
 		/**
 		*\~english
+		*\brief
+		*	Sets the diffuse IBL to be computed from the spherical harmonics of the skybox.
+		*\remarks
+		*	Faster than the convolution pass, for the low frequency environments.
+		*\param value
+		*	\p true to use the spherical harmonics.
+		*\~french
+		*\brief
+		*	Définit si l'IBL diffuse est calculée à partir des harmoniques sphériques de la skybox.
+		*\remarks
+		*	Plus rapide que la passe de convolution, pour les environnements basse fréquence.
+		*\param value
+		*	\p true pour utiliser les harmoniques sphériques.
+		*/
+		inline void setShIrradiance( bool value )
+		{
+			m_shIrradiance = value;
+			notifyChanged();
+		}
+		/**
+		*\~english
 		*name
 		*	Getters.
 		*\~french
@@ -327,6 +348,11 @@ namespace castor3d
 			return m_texture->getDefaultView().getSampledView();
 		}
 
+		inline bool isShIrradiance()const
+		{
+			return m_shIrradiance;
+		}
+
 		inline bool hasIbl()const
 		{
 			return m_ibl != nullptr;
@@ -506,6 +532,8 @@ namespace castor3d
 		TextureLayoutSPtr m_texture;
 		SamplerWPtr m_sampler;
 		std::unique_ptr< IblTextures > m_ibl;
+		uint64_t m_iblSourceHash{ 0u };
+		bool m_shIrradiance{ false };
 
 		C3D_API static uint32_t constexpr UboSetIdx = 0u;
 		C3D_API static uint32_t constexpr MtxUboIdx = 0u;
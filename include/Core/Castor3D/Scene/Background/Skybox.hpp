@@ -368,6 +368,7 @@ namespace castor3d
 		bool doInitialiseTexture( RenderDevice const & device );
 		void doInitialiseEquiTexture( RenderDevice const & device );
 		void doInitialiseCrossTexture( RenderDevice const & device );
+		uint64_t doGetIblSourceHash()const;
 
 	private:
 		TextureLayoutSPtr m_equiTexture;
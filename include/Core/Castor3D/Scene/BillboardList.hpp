@@ -13,6 +13,8 @@ See LICENSE file in root folder
 #include "Castor3D/Scene/MovableObject.hpp"
 #include "Castor3D/Scene/RenderedObject.hpp"
 
+#include <CastorUtils/Miscellaneous/RadixSort.hpp>
+
 #include <ashespp/Buffer/VertexBuffer.hpp>
 #include <ashespp/Pipeline/PipelineVertexInputStateCreateInfo.hpp>
 
@@ -78,9 +80,23 @@ namespace castor3d
 		C3D_API void sortByDistance( castor::Point3f const & cameraPosition );
 		/**
 		 *\~english
-		 *\brief		Updates the vertex buffer.
+		 *\brief		Sets the CPU side copy of the vertices, from which the sorted vertex buffer is written.
+		 *\remarks		Without it, the vertex buffer is supposed to be filled externally, and is read back to be sorted.
+		 *\param[in]	data	The vertices data, \p m_vertexStride bytes per vertex.
+		 *\param[in]	count	The vertices count.
+		 *\~french
+		 *\brief		Définit la copie CPU des sommets, à partir de laquelle le tampon de sommets trié est écrit.
+		 *\remarks		Sans elle, le tampon de sommets est supposé être rempli de manière externe, et est relu pour être trié.
+		 *\param[in]	data	Les données des sommets, \p m_vertexStride octets par sommet.
+		 *\param[in]	count	Le nombre de sommets.
+		 */
+		C3D_API void setVertices( uint8_t const * data
+			, uint32_t count );
+		/**
+		 *\~english
+		 *\brief		Updates the vertex buffer, if the camera has moved since last sort.
 		 *\~french
-		 *\brief		Met à jour le tampon de sommets.
+		 *\brief		Met à jour le tampon de sommets, si la caméra a bougé depuis le dernier tri.
 		 */
 		C3D_API void update( GpuUpdater & updater );
 		/**
@@ -198,6 +214,8 @@ namespace castor3d
 		void doGatherBuffers( ashes::BufferCRefArray & buffers
 			, std::vector< uint64_t > & offsets
 			, ashes::PipelineVertexInputStateCreateInfoCRefArray & layouts );
+		void doSortVertices( uint32_t count
+			, bool previousOrder );
 
 	public:
 		struct Vertex
@@ -225,6 +243,11 @@ namespace castor3d
 		uint32_t m_centerOffset{ 0u };
 		BillboardType m_billboardType{ BillboardType::eCylindrical };
 		BillboardSize m_billboardSize{ BillboardSize::eDynamic };
+		castor::ByteArray m_vertices;
+		bool m_hasVertices{ false };
+		std::vector< uint32_t > m_sortKeys;
+		std::vector< uint32_t > m_sortedIndices;
+		castor::RadixSorter m_sorter;
 	};
 
 	class BillboardList
@@ -114,11 +114,34 @@ namespace castor3d
 		{
 			m_receivesShadows = value;
 		}
+		/**
+		 *\~english
+		 *\return		The occluder status, the occluders hide the objects behind them, in the camera occlusion culling.
+		 *\~french
+		 *\return		Le statut d'occulteur, les occulteurs cachent les objets situés derrière eux, dans l'occlusion culling de la caméra.
+		 */
+		inline bool isOccluder()const
+		{
+			return m_occluder;
+		}
+		/**
+		 *\~english
+		 *\brief		Defines the occluder status.
+		 *\param[in]	value	The new value.
+		 *\~french
+		 *\brief		Définit le statut d'occulteur.
+		 *\param[in]	value	La nouvelle valeur.
+		 */
+		inline void setOccluder( bool value )
+		{
+			m_occluder = value;
+		}
 
 	private:
 		bool m_visible{ true };
 		bool m_castsShadows{ true };
 		bool m_receivesShadows{ true };
+		bool m_occluder{ false };
 	};
 }
 
@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "Castor3D/Render/GlobalIllumination/GlobalIlluminationModule.hpp"
 #include "Castor3D/Scene/SceneModule.hpp"
 #include "Castor3D/Scene/Animation/AnimationModule.hpp"
+#include "Castor3D/Scene/Animation/AnimationThrottle.hpp"
 #include "Castor3D/Scene/Background/BackgroundModule.hpp"
 #include "Castor3D/Scene/Light/LightModule.hpp"
 #include "Castor3D/Render/EnvironmentMap/EnvironmentMapModule.hpp"
@@ -48,11 +49,18 @@ namespace castor3d
 			/**
 			 *\~english
 			 *\brief		Constructor
+			 *\param[in]	tabs			The current indentation level.
+			 *\param[in]	materialsFile	The materials file to include, if any.
+			 *\param[in]	binaryFile		The binary scene file to include, if any (object nodes, lights, geometries and meshes are then not written).
 			 *\~french
 			 *\brief		Constructeur
+			 *\param[in]	tabs			Le niveau d'indentation actuel.
+			 *\param[in]	materialsFile	Le fichier de matériaux à inclure, s'il y en a un.
+			 *\param[in]	binaryFile		Le fichier de scène binaire à inclure, s'il y en a un (les noeuds d'objets, sources lumineuses, géométries et maillages ne sont alors pas écrits).
 			 */
 			C3D_API explicit TextWriter( castor::String const & tabs
-				, castor::Path const & materialsFile = castor::Path{} );
+				, castor::Path const & materialsFile = castor::Path{}
+				, castor::Path binaryFile = castor::Path{} );
 			/**
 			 *\~english
 			 *\brief		Writes a scene into a text file
@@ -67,6 +75,7 @@ namespace castor3d
 
 		private:
 			castor::Path const & m_materialsFile;
+			castor::Path m_binaryFile;
 		};
 
 	public:
@@ -353,6 +362,16 @@ namespace castor3d
 			return m_lpvIndirectAttenuation;
 		}
 
+		inline AnimationThrottle const & getAnimationThrottle()const
+		{
+			return m_animationThrottle;
+		}
+
+		inline AnimationThrottle & getAnimationThrottle()
+		{
+			return m_animationThrottle;
+		}
+
 		C3D_API ashes::SemaphoreCRefArray getRenderTargetsSemaphores()const;
 		/**@}*/
 		/**
@@ -431,6 +450,7 @@ namespace castor3d
 		std::map< SceneNode const *, std::unique_ptr< EnvironmentMap > > m_reflectionMaps;
 		std::vector< std::reference_wrapper< EnvironmentMap > > m_reflectionMapsArray;
 		castor::ThreadPool m_animationUpdater;
+		AnimationThrottle m_animationThrottle;
 		bool m_needsSubsurfaceScattering{ false };
 		bool m_hasOpaqueObjects{ false };
 		bool m_hasTransparentObjects{ false };
@@ -169,6 +169,8 @@ namespace castor3d
 		SubsurfaceScatteringUPtr subsurfaceScattering;
 		std::shared_ptr< SkyboxBackground > skybox;
 		TextureConfiguration textureConfiguration;
+		bool compressTexture{};
+		castor::BlockCompressionQuality textureCompression{ castor::BlockCompressionQuality::eNormal };
 	};
 
 	class SceneFileParser
@@ -224,6 +226,20 @@ namespace castor3d
 		 */
 		C3D_API bool parseFile( castor::Path const & path
 			, SceneFileContextSPtr context );
+		/**
+		 *\~english
+		 *\brief		Sets the way the ZIP scenes are read.
+		 *\remarks		By default, they are read in memory, without any extraction.
+		 *\param[in]	value	\p true to extract them in a cache folder, named from their content hash.
+		 *\~french
+		 *\brief		Définit la manière dont les scènes ZIP sont lues.
+		 *\remarks		Par défaut, elles sont lues en mémoire, sans aucune extraction.
+		 *\param[in]	value	\p true pour les extraire dans un dossier de cache, nommé d'après le hash de leur contenu.
+		 */
+		inline void setExtractArchives( bool value )
+		{
+			m_extractArchives = value;
+		}
 
 		inline ScenePtrStrMap::iterator scenesBegin()
 		{
@@ -239,6 +255,7 @@ namespace castor3d
 		}
 
 	private:
+		bool doParseArchive( castor::Path const & path );
 		C3D_API void doInitialiseParser( castor::Path const & path )override;
 		C3D_API void doCleanupParser()override;
 		C3D_API bool doDelegateParser( castor::String const & CU_UnusedParam( line ) )override
@@ -253,6 +270,7 @@ namespace castor3d
 		castor::String m_strSceneFilePath;
 		ScenePtrStrMap m_mapScenes;
 		RenderWindowSPtr m_renderWindow;
+		bool m_extractArchives{ false };
 
 		UInt32StrMap m_mapBlendFactors;
 		UInt32StrMap m_mapTypes;
@@ -289,6 +307,7 @@ namespace castor3d
 		UInt32StrMap m_mapMaterialTypes;
 		UInt32StrMap m_mapShadowFilters;
 		UInt32StrMap m_mapGlobalIlluminations;
+		UInt32StrMap m_mapTextureCompressions;
 	};
 }
 
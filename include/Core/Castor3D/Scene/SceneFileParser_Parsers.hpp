@@ -37,6 +37,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserRenderTargetToneMapping )
 	CU_DeclareAttributeParser( parserRenderTargetSsao )
 	CU_DeclareAttributeParser( parserRenderTargetHdrConfig )
+	CU_DeclareAttributeParser( parserRenderTargetOcclusionCulling )
 	CU_DeclareAttributeParser( parserRenderTargetEnd )
 
 	// Sampler parsers
@@ -57,6 +58,7 @@ namespace castor3d
 
 	// Scene parsers
 	CU_DeclareAttributeParser( parserSceneInclude )
+	CU_DeclareAttributeParser( parserSceneIncludeBinary )
 	CU_DeclareAttributeParser( parserSceneBkColour )
 	CU_DeclareAttributeParser( parserSceneBkImage )
 	CU_DeclareAttributeParser( parserSceneFont )
@@ -81,6 +83,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserMesh )
 	CU_DeclareAttributeParser( parserDirectionalShadowCascades )
 	CU_DeclareAttributeParser( parserLpvIndirectAttenuation )
+	CU_DeclareAttributeParser( parserSceneAnimationThrottle )
 
 	// ParticleSystem parsers
 	CU_DeclareAttributeParser( parserParticleSystemParent )
@@ -138,6 +141,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserObjectMaterials )
 	CU_DeclareAttributeParser( parserObjectCastShadows )
 	CU_DeclareAttributeParser( parserObjectReceivesShadows )
+	CU_DeclareAttributeParser( parserObjectOccluder )
 	CU_DeclareAttributeParser( parserObjectEnd )
 
 	// Object Materials Parsers
@@ -150,6 +154,8 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserMeshImport )
 	CU_DeclareAttributeParser( parserMeshMorphImport )
 	CU_DeclareAttributeParser( parserMeshDivide )
+	CU_DeclareAttributeParser( parserMeshLods )
+	CU_DeclareAttributeParser( parserMeshMeshlets )
 	CU_DeclareAttributeParser( parserMeshDefaultMaterial )
 	CU_DeclareAttributeParser( parserMeshDefaultMaterials )
 	CU_DeclareAttributeParser( parserMeshEnd )
@@ -227,6 +233,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserUnitRefraction )
 	CU_DeclareAttributeParser( parserUnitSampler )
 	CU_DeclareAttributeParser( parserUnitInvertY )
+	CU_DeclareAttributeParser( parserUnitCompression )
 	CU_DeclareAttributeParser( parserUnitEnd )
 
 	// Shader Parsers
@@ -12,6 +12,28 @@ See LICENSE file in root folder
 
 namespace castor
 {
+	/**
+	\~english
+	\brief		A mutex that doesn't lock, for the single threaded variants of thread safe classes.
+	\~french
+	\brief		Un mutex qui ne verrouille pas, pour les variantes mono-thread des classes thread-safe.
+	*/
+	struct DummyMutex
+	{
+		void lock()noexcept
+		{
+		}
+
+		void unlock()noexcept
+		{
+		}
+
+		bool try_lock()noexcept
+		{
+			return true;
+		}
+	};
+
 	template< typename Lockable >
 	std::unique_lock< Lockable > makeUniqueLock( Lockable & lockable )
 	{
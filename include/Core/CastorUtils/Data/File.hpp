@@ -381,6 +381,16 @@ namespace castor
 		 */
 		CU_API static bool copyFileName( Path const & srcFileName
 			, Path const & dstFileName );
+		/**
+		 *\~english
+		 *\brief		Renames a file, replacing the destination file if it exists
+		 *\return		\p true if file has been correctly renamed
+		 *\~french
+		 *\brief		Renomme un fichier, en remplaçant le fichier de destination s'il existe
+		 *\return		\p true si le fichier a été renommé correctement
+		 */
+		CU_API static bool moveFileName( Path const & srcFileName
+			, Path const & dstFileName );
 		/**
 		 *\~english
 		 *\brief		Retrieves the file size
@@ -9,6 +9,9 @@ See LICENSE file in root folder
 #include "CastorUtils/Data/File.hpp"
 
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 
 namespace castor
 {
@@ -32,6 +35,20 @@ namespace castor
 		};
 
 
+		struct Entry
+		{
+			//!\~english	The entry path, in the archive.
+			//!\~french		Le chemin de l'entrée, dans l'archive.
+			Path name;
+			uint64_t compressedSize;
+			uint64_t uncompressedSize;
+			uint32_t crc;
+			//!\~english	The entry position in the central directory.
+			//!\~french		La position de l'entrée dans le répertoire central.
+			uint64_t dirOffset;
+			uint64_t fileIndex;
+		};
+
 		struct ZipImpl
 		{
 			virtual ~ZipImpl() = default;
@@ -39,8 +56,8 @@ namespace castor
 			virtual void close() = 0;
 			virtual void deflate( Folder const & files ) = 0;
 			virtual StringArray inflate( Path const & outFolder, Folder & folder ) = 0;
-			virtual bool findFolder( String const & folder ) = 0;
-			virtual bool findFile( String const & file ) = 0;
+			virtual std::vector< Entry > index() = 0;
+			virtual ByteArray read( Entry const & entry ) = 0;
 		};
 
 	public:
@@ -114,11 +131,156 @@ namespace castor
 		 *\param[in]	file	Le nom du fichier
 		 */
 		CU_API bool findFile( String const & file );
+		/**
+		 *\~english
+		 *\return		The archive files, from its central directory.
+		 *\~french
+		 *\return		Les fichiers de l'archive, depuis son répertoire central.
+		 */
+		CU_API PathArray listFiles()const;
+		/**
+		 *\~english
+		 *\return		The uncompressed size of a file, 0 if it isn't in the archive.
+		 *\~french
+		 *\return		La taille décompressée d'un fichier, 0 s'il n'est pas dans l'archive.
+		 */
+		CU_API uint64_t getFileSize( Path const & file )const;
+		/**
+		 *\~english
+		 *\brief		Reads a file from the archive, in memory.
+		 *\remarks		Uses the prefetched content, if any.
+		 *\param[in]	file	The file path, in the archive.
+		 *\param[out]	data	Receives the file content.
+		 *\return		\p false if the file couldn't be read.
+		 *\~french
+		 *\brief		Lit un fichier de l'archive, en mémoire.
+		 *\remarks		Utilise le contenu préchargé, s'il y en a un.
+		 *\param[in]	file	Le chemin du fichier, dans l'archive.
+		 *\param[out]	data	Reçoit le contenu du fichier.
+		 *\return		\p false si le fichier n'a pas pu être lu.
+		 */
+		CU_API bool readFile( Path const & file
+			, ByteArray & data );
+		/**
+		 *\~english
+		 *\brief		Decompresses files in memory, in parallel, for later reads.
+		 *\remarks		Each thread reads the archive through its own handle.
+		 *				<br />A prefetched content is released once read.
+		 *\param[in]	files			The files paths, in the archive.
+		 *\param[in]	threadsCount	The threads count, 0 to use the hardware concurrency.
+		 *\~french
+		 *\brief		Décompresse des fichiers en mémoire, en parallèle, pour des lectures ultérieures.
+		 *\remarks		Chaque thread lit l'archive via son propre handle.
+		 *				<br />Un contenu préchargé est libéré une fois lu.
+		 *\param[in]	files			Les chemins des fichiers, dans l'archive.
+		 *\param[in]	threadsCount	Le nombre de threads, 0 pour utiliser la concurrence matérielle.
+		 */
+		CU_API void prefetch( PathArray const & files
+			, uint32_t threadsCount = 0u );
+		/**
+		 *\~english
+		 *\brief		Extracts the archive in a folder named from its content hash.
+		 *\remarks		An existing complete extraction, with the same content hash, is reused.
+		 *\param[in]	cacheFolder	The cache root folder.
+		 *\param[out]	folder		Receives the extraction folder.
+		 *\~french
+		 *\brief		Extrait l'archive dans un dossier nommé d'après le hash de son contenu.
+		 *\remarks		Une extraction complète existante, avec le même hash de contenu, est réutilisée.
+		 *\param[in]	cacheFolder	Le dossier racine du cache.
+		 *\param[out]	folder		Reçoit le dossier d'extraction.
+		 */
+		CU_API bool extract( Path const & cacheFolder
+			, Path & folder );
+		/**
+		 *\~english
+		 *\return		The hash of the entries names, sizes and CRCs.
+		 *\~french
+		 *\return		Le hash des noms, tailles et CRC des entrées.
+		 */
+		CU_API uint64_t getContentHash()const;
+		/**
+		 *\~english
+		 *\brief		Mounts an archive, its files are then read through \p root.
+		 *\param[in]	root	The virtual folder.
+		 *\param[in]	archive	The archive.
+		 *\~french
+		 *\brief		Monte une archive, ses fichiers sont alors lus via \p root.
+		 *\param[in]	root	Le dossier virtuel.
+		 *\param[in]	archive	L'archive.
+		 */
+		CU_API static void mount( Path const & root
+			, std::shared_ptr< ZipArchive > archive );
+		/**
+		 *\~english
+		 *\brief		Unmounts the archive mounted at given virtual folder.
+		 *\~french
+		 *\brief		Démonte l'archive montée au dossier virtuel donné.
+		 */
+		CU_API static void unmount( Path const & root );
+		/**
+		 *\~english
+		 *\return		\p true if the file is in a mounted archive.
+		 *\~french
+		 *\return		\p true si le fichier est dans une archive montée.
+		 */
+		CU_API static bool findMountedFile( Path const & file );
+		/**
+		 *\~english
+		 *\brief		Reads a file from a mounted archive.
+		 *\param[in]	file	The file path, in its virtual folder.
+		 *\param[out]	data	Receives the file content.
+		 *\return		\p false if the file isn't in a mounted archive.
+		 *\~french
+		 *\brief		Lit un fichier depuis une archive montée.
+		 *\param[in]	file	Le chemin du fichier, dans son dossier virtuel.
+		 *\param[out]	data	Reçoit le contenu du fichier.
+		 *\return		\p false si le fichier n'est pas dans une archive montée.
+		 */
+		CU_API static bool readMountedFile( Path const & file
+			, ByteArray & data );
+		/**
+		 *\~english
+		 *\return		The files of a mounted archive, directly in the given folder.
+		 *\~french
+		 *\return		Les fichiers d'une archive montée, directement dans le dossier donné.
+		 */
+		CU_API static PathArray listMountedFiles( Path const & folder );
+		/**
+		 *\~english
+		 *\brief		Mounts an archive for the lifetime of the guard.
+		 *\~french
+		 *\brief		Monte une archive pour la durée de vie du garde.
+		 */
+		class MountGuard
+		{
+		public:
+			MountGuard( Path root
+				, std::shared_ptr< ZipArchive > archive )
+				: m_root{ std::move( root ) }
+			{
+				mount( m_root, std::move( archive ) );
+			}
+
+			~MountGuard()
+			{
+				unmount( m_root );
+			}
+
+			MountGuard( MountGuard const & ) = delete;
+			MountGuard & operator=( MountGuard const & ) = delete;
+
+		private:
+			Path m_root;
+		};
 
 	private:
 		std::unique_ptr< ZipImpl > m_impl;
 		Folder m_uncompressed;
 		Path m_rootFolder;
+		Path m_path;
+		std::map< Path, Entry > m_entries;
+		std::map< Path, ByteArray > m_prefetched;
+		std::mutex m_mutex;
 	};
 }
 
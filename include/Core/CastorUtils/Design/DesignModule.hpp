@@ -72,10 +72,18 @@ namespace castor
 	\~french
 	*\brief		Classe basique de signal
 	*/
-	template< typename Function >
+	template< typename Function, typename MutexT = DummyMutex >
 	class Signal;
 	/**
 	\~english
+	*\brief		Thread safe signal.
+	\~french
+	*\brief		Signal thread-safe.
+	*/
+	template< typename Function >
+	using MtSignal = Signal< Function, std::recursive_mutex >;
+	/**
+	\~english
 	\brief		Class used to execute code at scope exit.
 	\~french
 	\brief		Classe utilisée pour exécuter du code à la sortie d'un scope.
@@ -196,6 +204,23 @@ namespace castor
 	class Collection;
 	/**
 	\~english
+	\brief		Generational handle, to an element of a SlotMap.
+	\~french
+	\brief		Handle générationnel, vers un élément d'une SlotMap.
+	*/
+	struct SlotHandle;
+	/**
+	\~english
+	\brief		Dense storage of shared elements, addressed through generational handles.
+	\remark		Mutations are deferred until next flush, reads are done on immutable snapshots, without locking.
+	\~french
+	\brief		Stockage dense d'éléments partagés, adressés via des handles générationnels.
+	\remark		Les modifications sont différées jusqu'au prochain flush, les lectures se font sur des instantanés immuables, sans verrou.
+	*/
+	template< typename ObjectT >
+	class SlotMap;
+	/**
+	\~english
 	\brief		Used to delay initialisation of an object to next use of it.
 	\~french
 	\brief		Utilisé pour délayer l'initialisation d'un objet à sa prochaine utilisation.
@@ -8,15 +8,19 @@ See LICENSE file in root folder
 
 #include "CastorUtils/Exception/Assertion.hpp"
 
+#include <algorithm>
 #include <functional>
-#include <map>
-#include <set>
+#include <iterator>
+#include <tuple>
+#include <vector>
 
 namespace castor
 {
 	template< typename SignalT >
 	class Connection
 	{
+		friend SignalT;
+
 	private:
 		using my_signal = SignalT;
 		using my_signal_ptr = my_signal *;
@@ -137,7 +141,6 @@ namespace castor
 			if ( m_signal && m_connection )
 			{
 				m_signal->disconnect( m_connection );
-				m_signal->removeConnection( *this );
 				m_signal = nullptr;
 				m_connection = 0u;
 				result = true;
@@ -185,12 +188,62 @@ namespace castor
 #endif
 	};
 
-	template< typename Function >
+	/**
+	\~english
+	*\brief		Retrieves the parameters of a signal's function, to store deferred emissions.
+	\~french
+	*\brief		Récupère les paramètres de la fonction d'un signal, pour stocker les émissions différées.
+	*/
+	template< typename FunctionT >
+	struct SignalTraitsT
+	{
+		using Params = std::tuple<>;
+	};
+
+	template< typename ResultT, typename ... ParamsT >
+	struct SignalTraitsT< std::function< ResultT( ParamsT... ) > >
+	{
+		using Params = std::tuple< ParamsT... >;
+	};
+
+	template< typename Function, typename MutexT >
 	class Signal
 	{
-		friend class Connection< Signal< Function > >;
-		using my_connection = Connection< Signal< Function > >;
+		friend class Connection< Signal< Function, MutexT > >;
+		using my_connection = Connection< Signal< Function, MutexT > >;
 		using my_connection_ptr = my_connection *;
+		using my_params = typename SignalTraitsT< Function >::Params;
+
+		struct Slot
+		{
+			uint32_t index;
+			Function function;
+			my_connection_ptr connection;
+			bool alive;
+		};
+
+		class EmitGuard
+		{
+		public:
+			explicit EmitGuard( Signal const & signal )
+				: m_signal{ signal }
+				, m_lock{ makeUniqueLock( signal.m_mutex ) }
+			{
+				++m_signal.m_emitting;
+			}
+
+			~EmitGuard()
+			{
+				if ( !--m_signal.m_emitting )
+				{
+					m_signal.doCompact();
+				}
+			}
+
+		private:
+			Signal const & m_signal;
+			std::unique_lock< MutexT > m_lock;
+		};
 
 	public:
 		using connection = my_connection;
@@ -206,39 +259,55 @@ namespace castor
 		 */
 		~Signal()
 		{
-			// Connection::disconnect appelle Signal::remConnection, qui
-			// supprime la connection de m_connections, invalidant ainsi
-			// l'itérateur, donc on ne peut pas utiliser un for_each, ni
-			// un range for loop.
-			auto it = m_connections.begin();
+			// Connection::disconnect appelle Signal::disconnect, qui
+			// supprime l'emplacement de m_slots, donc on récupère
+			// d'abord les connexions.
+			std::vector< my_connection_ptr > connections;
+			{
+				auto lock( makeUniqueLock( m_mutex ) );
+
+				for ( auto slots : { &m_slots, &m_added } )
+				{
+					for ( auto & slot : *slots )
+					{
+						if ( slot.alive && slot.connection )
+						{
+							connections.push_back( slot.connection );
+						}
+					}
+				}
+			}
 
-			while ( it != m_connections.end() )
+			for ( auto connection : connections )
 			{
-				auto disco = ( *it )->disconnect();
+				auto disco = connection->disconnect();
 				CU_Require( disco );
-				it = m_connections.begin();
 			}
 		}
 		/**
 		 *\~english
 		 *\brief		Connects a new function that will be called if the signal is emitted.
+		 *\remarks		A function connected during an emission is called from the next one.
 		 *\param[in]	function	The function.
 		 *\return		The function index, in order to be able to disconnect it.
 		 *\~french
 		 *\brief		Connecte une nouvelle fonction, qui sera appelée lorsque le signal est émis.
+		 *\remarks		Une fonction connectée pendant une émission est appelée à partir de la suivante.
 		 *\param[in]	function	La fonction.
 		 *\return		L'indice de la fonction, afin de pouvoir la déconnecter.
 		 */
 		my_connection connect( Function function )
 		{
-			uint32_t index = 1u;
-
-			if ( !m_slots.empty() )
+			uint32_t index{};
 			{
-				index = m_slots.rbegin()->first + 1u;
+				auto lock( makeUniqueLock( m_mutex ) );
+				index = ++m_lastIndex;
+				// During an emission, the new slots are kept aside, so the emitted ones don't move.
+				auto & slots = m_emitting
+					? m_added
+					: m_slots;
+				slots.push_back( { index, std::move( function ), nullptr, true } );
 			}
-
-			m_slots.emplace( index, function );
 			return my_connection{ index, *this };
 		}
 		/**
@@ -249,10 +318,7 @@ namespace castor
 		 */
 		void operator()()const
 		{
-			for ( auto it : m_slots )
-			{
-				it.second();
-			}
+			doEmit();
 		}
 		/**
 		 *\~english
@@ -265,28 +331,154 @@ namespace castor
 		template< typename ... Params >
 		void operator()( Params && ... params )const
 		{
-			for ( auto it : m_slots )
+			doEmit( params... );
+		}
+		/**
+		 *\~english
+		 *\brief		Stores an emission, to be done with the next call to flush.
+		 *\remarks		The parameters are stored as the function takes them: referenced objects must outlive the flush.
+		 *\param[in]	params	The functions parameters.
+		 *\~french
+		 *\brief		Stocke une émission, à effectuer lors du prochain appel à flush.
+		 *\remarks		Les paramètres sont stockés tels que la fonction les prend : les objets référencés doivent survivre au flush.
+		 *\param[in]	params	Les paramètres des fonctions.
+		 */
+		template< typename ... Params >
+		void defer( Params && ... params )
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			m_deferred.emplace_back( std::forward< Params >( params )... );
+		}
+		/**
+		 *\~english
+		 *\brief		Does the deferred emissions, in order.
+		 *\remarks		Emissions deferred by the called functions are done with the next flush.
+		 *\~french
+		 *\brief		Effectue les émissions différées, dans l'ordre.
+		 *\remarks		Les émissions différées par les fonctions appelées sont effectuées lors du flush suivant.
+		 */
+		void flush()
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			std::swap( m_deferred, m_flushing );
+
+			for ( auto & params : m_flushing )
 			{
-				it.second( std::forward< Params >( params )... );
+				std::apply( [this]( auto & ... args )
+					{
+						doEmit( args... );
+					}
+					, params );
 			}
+
+			m_flushing.clear();
+		}
+		/**
+		 *\~english
+		 *\return		The deferred emissions count.
+		 *\~french
+		 *\return		Le nombre d'émissions différées.
+		 */
+		size_t getDeferredCount()const
+		{
+			return m_deferred.size();
 		}
 
 	private:
+		template< typename ... Params >
+		void doEmit( Params & ... params )const
+		{
+			EmitGuard guard{ *this };
+			// Slots connected or disconnected meanwhile don't alter the array.
+			auto count = m_slots.size();
+
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				auto & slot = m_slots[i];
+
+				if ( slot.alive )
+				{
+					slot.function( params... );
+				}
+			}
+		}
+
+		void doCompact()const
+		{
+			if ( !m_added.empty() )
+			{
+				std::move( m_added.begin(), m_added.end(), std::back_inserter( m_slots ) );
+				m_added.clear();
+			}
+
+			if ( m_dead )
+			{
+				m_slots.erase( std::remove_if( m_slots.begin()
+						, m_slots.end()
+						, []( Slot const & slot )
+						{
+							return !slot.alive;
+						} )
+					, m_slots.end() );
+				m_dead = 0u;
+			}
+		}
+
+		Slot * doFind( uint32_t index )const
+		{
+			// The slots are sorted by index, since the indices only grow.
+			auto it = std::lower_bound( m_slots.begin()
+				, m_slots.end()
+				, index
+				, []( Slot const & slot, uint32_t lookup )
+				{
+					return slot.index < lookup;
+				} );
+
+			if ( it != m_slots.end() && it->index == index )
+			{
+				return &( *it );
+			}
+
+			auto ait = std::find_if( m_added.begin()
+				, m_added.end()
+				, [index]( Slot const & slot )
+				{
+					return slot.index == index;
+				} );
+			return ait != m_added.end()
+				? &( *ait )
+				: nullptr;
+		}
 		/**
 		 *\~english
 		 *\brief		Disconnects a function.
+		 *\remarks		During an emission, the function is only marked as disconnected, and removed once the emission ends.
 		 *\param[in]	index	The function index.
 		 *\~french
 		 *\brief		Déconnecte une fonction.
+		 *\remarks		Pendant une émission, la fonction est seulement marquée comme déconnectée, et enlevée une fois l'émission terminée.
 		 *\param[in]	index	L'indice de la fonction.
 		 */
 		void disconnect( uint32_t index )
 		{
-			auto it = m_slots.find( index );
+			auto lock( makeUniqueLock( m_mutex ) );
+			auto slot = doFind( index );
 
-			if ( it != m_slots.end() )
+			if ( !slot || !slot->alive )
 			{
-				m_slots.erase( it );
+				return;
+			}
+
+			if ( m_emitting )
+			{
+				slot->alive = false;
+				slot->connection = nullptr;
+				++m_dead;
+			}
+			else
+			{
+				m_slots.erase( m_slots.begin() + ( slot - m_slots.data() ) );
 			}
 		}
 		/**
@@ -299,46 +491,55 @@ namespace castor
 		 */
 		void addConnection( my_connection & connection )
 		{
-			assert( m_connections.find( &connection ) == m_connections.end() );
-			m_connections.insert( &connection );
-		}
-		/**
-		 *\~english
-		 *\brief		Removes a connection from the list.
-		 *\param[in]	connection	The connection to remove.
-		 *\~french
-		 *\brief		Enlève une connexion de la liste.
-		 *\param[in]	connection	La connexion à enlever.
-		 */
-		void removeConnection( my_connection & connection )
-		{
-			assert( m_connections.find( &connection ) != m_connections.end() );
-			m_connections.erase( &connection );
+			auto lock( makeUniqueLock( m_mutex ) );
+			auto slot = doFind( connection.m_connection );
+			CU_Require( slot && !slot->connection );
+			slot->connection = &connection;
 		}
 		/**
 		 *\~english
-		 *\brief		Removes a connection from the list.
+		 *\brief		Replaces a connection in the list.
 		 *\param[in]	oldConnection	The connection to remove.
 		 *\param[in]	newConnection	The connection to add.
 		 *\~french
-		 *\brief		Enlève une connexion de la liste.
+		 *\brief		Remplace une connexion dans la liste.
 		 *\param[in]	oldConnection	La connexion à enlever.
 		 *\param[in]	newConnection	La connexion à ajouter.
 		 */
 		void replaceConnection( my_connection & oldConnection
 			, my_connection & newConnection )
 		{
-			removeConnection( oldConnection );
-			addConnection( newConnection );
+			auto lock( makeUniqueLock( m_mutex ) );
+			auto slot = doFind( newConnection.m_connection );
+			CU_Require( slot && slot->connection == &oldConnection );
+			slot->connection = &newConnection;
 		}
 
 	private:
-		//!\~english	The connected functions list.
-		//!\~french		La liste des fonctions connectées.
-		std::map< uint32_t, Function > m_slots;
-		//!\~english	The connections list.
-		//!\~french		La liste des connections à ce signal.
-		std::set< my_connection_ptr > m_connections;
+		//!\~english	The mutex protecting the slots, for thread safe signals.
+		//!\~french		Le mutex protégeant les emplacements, pour les signaux thread-safe.
+		mutable MutexT m_mutex;
+		//!\~english	The connected functions, sorted by index.
+		//!\~french		Les fonctions connectées, triées par indice.
+		mutable std::vector< Slot > m_slots;
+		//!\~english	The functions connected during the current emission.
+		//!\~french		Les fonctions connectées pendant l'émission courante.
+		mutable std::vector< Slot > m_added;
+		//!\~english	The nested emissions count.
+		//!\~french		Le nombre d'émissions imbriquées.
+		mutable uint32_t m_emitting{ 0u };
+		//!\~english	The functions disconnected during the current emission.
+		//!\~french		Le nombre de fonctions déconnectées pendant l'émission courante.
+		mutable uint32_t m_dead{ 0u };
+		//!\~english	The last given function index.
+		//!\~french		Le dernier indice de fonction donné.
+		uint32_t m_lastIndex{ 0u };
+		//!\~english	The deferred emissions.
+		//!\~french		Les émissions différées.
+		std::vector< my_params > m_deferred;
+		//!\~english	The emissions being flushed.
+		//!\~french		Les émissions en cours de flush.
+		std::vector< my_params > m_flushing;
 	};
 }
 
@@ -0,0 +1,230 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_SlotMap_H___
+#define ___CU_SlotMap_H___
+
+#include "CastorUtils/Design/DesignModule.hpp"
+
+#include "CastorUtils/Design/NonCopyable.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace castor
+{
+	struct SlotHandle
+	{
+		static uint32_t constexpr InvalidIndex = ~0u;
+		/**
+		 *\~english
+		 *\return		\p true if the handle has been given by a SlotMap (it may have been erased since).
+		 *\~french
+		 *\return		\p true si le handle a été donné par une SlotMap (il peut avoir été supprimé depuis).
+		 */
+		bool isValid()const
+		{
+			return index != InvalidIndex;
+		}
+		/**
+		 *\~english
+		 *\return		The handle packed in a 64 bits value.
+		 *\~french
+		 *\return		Le handle empaqueté dans une valeur 64 bits.
+		 */
+		uint64_t getValue()const
+		{
+			return ( uint64_t( generation ) << 32u ) | uint64_t( index );
+		}
+		/**
+		 *\~english
+		 *\param[in]	value	A value retrieved through getValue.
+		 *\return		The handle.
+		 *\~french
+		 *\param[in]	value	Une valeur récupérée via getValue.
+		 *\return		Le handle.
+		 */
+		static SlotHandle fromValue( uint64_t value )
+		{
+			return SlotHandle{ uint32_t( value & 0xFFFFFFFFull )
+				, uint32_t( value >> 32u ) };
+		}
+
+		//!\~english	The slot index.
+		//!\~french		L'indice du slot.
+		uint32_t index{ InvalidIndex };
+		//!\~english	The slot generation, incremented each time the slot is freed.
+		//!\~french		La génération du slot, incrémentée à chaque fois que le slot est libéré.
+		uint32_t generation{ 0u };
+	};
+
+	inline bool operator==( SlotHandle const & lhs, SlotHandle const & rhs )
+	{
+		return lhs.index == rhs.index
+			&& lhs.generation == rhs.generation;
+	}
+
+	inline bool operator!=( SlotHandle const & lhs, SlotHandle const & rhs )
+	{
+		return !( lhs == rhs );
+	}
+
+	template< typename ObjectT >
+	class SlotMap
+		: public NonCopyable
+	{
+	public:
+		using ObjectPtr = std::shared_ptr< ObjectT >;
+		using ObjectPtrArray = std::vector< ObjectPtr >;
+		/**
+		\~english
+		\brief		The content of the SlotMap, as of its last flush.
+		\remark		A snapshot is never modified once published, so it can be read from any thread without locking.
+		\~french
+		\brief		Le contenu de la SlotMap, au moment de son dernier flush.
+		\remark		Un instantané n'est jamais modifié une fois publié, il peut donc être lu depuis n'importe quel thread sans verrou.
+		*/
+		class Snapshot
+		{
+			friend class SlotMap;
+
+		public:
+			/**
+			 *\~english
+			 *\param[in]	handle	The element handle.
+			 *\return		The element, \p nullptr if the handle is stale or not flushed yet.
+			 *\~french
+			 *\param[in]	handle	Le handle de l'élément.
+			 *\return		L'élément, \p nullptr si le handle est périmé ou pas encore flushé.
+			 */
+			inline ObjectPtr get( SlotHandle handle )const;
+			/**
+			 *\~english
+			 *\return		The elements, densely packed, in no particular order.
+			 *\~french
+			 *\return		Les éléments, contigus, sans ordre particulier.
+			 */
+			inline ObjectPtrArray const & getElements()const
+			{
+				return m_dense;
+			}
+
+			inline auto begin()const
+			{
+				return m_dense.begin();
+			}
+
+			inline auto end()const
+			{
+				return m_dense.end();
+			}
+
+			inline size_t size()const
+			{
+				return m_dense.size();
+			}
+
+			inline bool empty()const
+			{
+				return m_dense.empty();
+			}
+
+		private:
+			struct Slot
+			{
+				ObjectPtr object;
+				uint32_t generation{ 0u };
+				uint32_t dense{ SlotHandle::InvalidIndex };
+			};
+
+			std::vector< Slot > m_slots;
+			ObjectPtrArray m_dense;
+			// The slot index of each dense element.
+			std::vector< uint32_t > m_denseSlots;
+		};
+		using SnapshotPtr = std::shared_ptr< Snapshot const >;
+
+	public:
+		inline SlotMap();
+		/**
+		 *\~english
+		 *\brief		Reserves a slot for given element.
+		 *\remarks		The element is visible in the snapshots after next flush.
+		 *\param[in]	object	The element.
+		 *\return		The element handle.
+		 *\~french
+		 *\brief		Réserve un slot pour l'élément donné.
+		 *\remarks		L'élément est visible dans les instantanés après le prochain flush.
+		 *\param[in]	object	L'élément.
+		 *\return		Le handle de l'élément.
+		 */
+		inline SlotHandle insert( ObjectPtr object );
+		/**
+		 *\~english
+		 *\brief		Frees the slot of given handle.
+		 *\remarks		The handle is invalidated immediately, the element is removed from the snapshots after next flush.
+		 *\param[in]	handle	The element handle.
+		 *\return		\p false if the handle was stale.
+		 *\~french
+		 *\brief		Libère le slot du handle donné.
+		 *\remarks		Le handle est invalidé immédiatement, l'élément est enlevé des instantanés après le prochain flush.
+		 *\param[in]	handle	Le handle de l'élément.
+		 *\return		\p false si le handle était périmé.
+		 */
+		inline bool erase( SlotHandle handle );
+		/**
+		 *\~english
+		 *\brief		Frees all the slots, the snapshots are emptied after next flush.
+		 *\~french
+		 *\brief		Libère tous les slots, les instantanés sont vidés après le prochain flush.
+		 */
+		inline void clear();
+		/**
+		 *\~english
+		 *\param[in]	handle	The element handle.
+		 *\return		\p true if the handle has not been erased (it may not be flushed yet).
+		 *\~french
+		 *\param[in]	handle	Le handle de l'élément.
+		 *\return		\p true si le handle n'a pas été supprimé (il peut ne pas encore être flushé).
+		 */
+		inline bool isAlive( SlotHandle handle )const;
+		/**
+		 *\~english
+		 *\brief		Applies the pending mutations, and publishes a new snapshot.
+		 *\remarks		Meant to be called at frame boundaries, readers still holding the previous snapshot are unaffected.
+		 *\return		\p true if a new snapshot has been published.
+		 *\~french
+		 *\brief		Applique les modifications en attente, et publie un nouvel instantané.
+		 *\remarks		Destinée à être appelée entre deux frames, les lecteurs tenant toujours l'instantané précédent ne sont pas affectés.
+		 *\return		\p true si un nouvel instantané a été publié.
+		 */
+		inline bool flush();
+		/**
+		 *\~english
+		 *\return		The last published snapshot, to hold during the whole read.
+		 *\~french
+		 *\return		Le dernier instantané publié, à conserver durant toute la lecture.
+		 */
+		inline SnapshotPtr acquire()const;
+
+	private:
+		struct Mutation
+		{
+			// Invalid handle means clear.
+			SlotHandle handle;
+			// Null object means erase.
+			ObjectPtr object;
+		};
+
+		mutable std::mutex m_mutex;
+		std::vector< uint32_t > m_generations;
+		std::vector< uint8_t > m_used;
+		std::vector< uint32_t > m_freeIndices;
+		std::vector< Mutation > m_pending;
+		SnapshotPtr m_snapshot;
+	};
+}
+
+#include "SlotMap.inl"
+
+#endif
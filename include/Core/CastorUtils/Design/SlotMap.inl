@@ -0,0 +1,175 @@
+#include "CastorUtils/Exception/Assertion.hpp"
+
+#include <atomic>
+
+namespace castor
+{
+	template< typename ObjectT >
+	inline typename SlotMap< ObjectT >::ObjectPtr SlotMap< ObjectT >::Snapshot::get( SlotHandle handle )const
+	{
+		if ( handle.index < m_slots.size() )
+		{
+			auto & slot = m_slots[handle.index];
+
+			if ( slot.generation == handle.generation )
+			{
+				return slot.object;
+			}
+		}
+
+		return nullptr;
+	}
+
+	//*********************************************************************************************
+
+	template< typename ObjectT >
+	inline SlotMap< ObjectT >::SlotMap()
+		: m_snapshot{ std::make_shared< Snapshot >() }
+	{
+	}
+
+	template< typename ObjectT >
+	inline SlotHandle SlotMap< ObjectT >::insert( ObjectPtr object )
+	{
+		CU_Require( object );
+		auto lock( makeUniqueLock( m_mutex ) );
+		SlotHandle result;
+
+		if ( m_freeIndices.empty() )
+		{
+			result.index = uint32_t( m_generations.size() );
+			m_generations.push_back( 1u );
+			m_used.push_back( 0u );
+		}
+		else
+		{
+			result.index = m_freeIndices.back();
+			m_freeIndices.pop_back();
+		}
+
+		result.generation = m_generations[result.index];
+		m_used[result.index] = 1u;
+		m_pending.push_back( { result, std::move( object ) } );
+		return result;
+	}
+
+	template< typename ObjectT >
+	inline bool SlotMap< ObjectT >::erase( SlotHandle handle )
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		if ( handle.index >= m_generations.size()
+			|| !m_used[handle.index]
+			|| m_generations[handle.index] != handle.generation )
+		{
+			return false;
+		}
+
+		// Generation 0 is never given, to keep default handles invalid.
+		auto & generation = m_generations[handle.index];
+		generation = ( generation == ~0u ) ? 1u : generation + 1u;
+		m_used[handle.index] = 0u;
+		m_freeIndices.push_back( handle.index );
+		m_pending.push_back( { handle, nullptr } );
+		return true;
+	}
+
+	template< typename ObjectT >
+	inline void SlotMap< ObjectT >::clear()
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		for ( uint32_t index = 0u; index < m_generations.size(); ++index )
+		{
+			if ( m_used[index] )
+			{
+				auto & generation = m_generations[index];
+				generation = ( generation == ~0u ) ? 1u : generation + 1u;
+				m_used[index] = 0u;
+				m_freeIndices.push_back( index );
+			}
+		}
+
+		m_pending.push_back( { SlotHandle{}, nullptr } );
+	}
+
+	template< typename ObjectT >
+	inline bool SlotMap< ObjectT >::isAlive( SlotHandle handle )const
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+		return handle.index < m_generations.size()
+			&& m_used[handle.index]
+			&& m_generations[handle.index] == handle.generation;
+	}
+
+	template< typename ObjectT >
+	inline bool SlotMap< ObjectT >::flush()
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		if ( m_pending.empty() )
+		{
+			return false;
+		}
+
+		// Copy on write, the published snapshot may still be read.
+		auto next = std::make_shared< Snapshot >( *m_snapshot );
+
+		for ( auto & mutation : m_pending )
+		{
+			if ( !mutation.handle.isValid() )
+			{
+				next->m_slots.clear();
+				next->m_dense.clear();
+				next->m_denseSlots.clear();
+			}
+			else if ( mutation.object )
+			{
+				if ( next->m_slots.size() <= mutation.handle.index )
+				{
+					next->m_slots.resize( mutation.handle.index + 1u );
+				}
+
+				auto & slot = next->m_slots[mutation.handle.index];
+				slot.object = std::move( mutation.object );
+				slot.generation = mutation.handle.generation;
+				slot.dense = uint32_t( next->m_dense.size() );
+				next->m_dense.push_back( slot.object );
+				next->m_denseSlots.push_back( mutation.handle.index );
+			}
+			else if ( mutation.handle.index < next->m_slots.size() )
+			{
+				auto & slot = next->m_slots[mutation.handle.index];
+
+				if ( slot.object
+					&& slot.generation == mutation.handle.generation )
+				{
+					// Swap with the last dense element, to keep the array packed.
+					auto last = uint32_t( next->m_dense.size() - 1u );
+
+					if ( slot.dense != last )
+					{
+						next->m_dense[slot.dense] = std::move( next->m_dense[last] );
+						next->m_denseSlots[slot.dense] = next->m_denseSlots[last];
+						next->m_slots[next->m_denseSlots[slot.dense]].dense = slot.dense;
+					}
+
+					next->m_dense.pop_back();
+					next->m_denseSlots.pop_back();
+					slot.object.reset();
+					slot.dense = SlotHandle::InvalidIndex;
+				}
+			}
+		}
+
+		m_pending.clear();
+		std::atomic_store( &m_snapshot, SnapshotPtr{ std::move( next ) } );
+		return true;
+	}
+
+	template< typename ObjectT >
+	inline typename SlotMap< ObjectT >::SnapshotPtr SlotMap< ObjectT >::acquire()const
+	{
+		return std::atomic_load( &m_snapshot );
+	}
+}
@@ -5,10 +5,13 @@ See LICENSE file in root folder
 #define ___CU_FileParser_H___
 
 #include "CastorUtils/FileParser/AttributeParsersBySection.hpp"
+#include "CastorUtils/FileParser/ParserKeywordTable.hpp"
 #include "CastorUtils/FileParser/ParserParameterTypeException.hpp"
 
 #include "CastorUtils/Log/LogModule.hpp"
 
+#include <unordered_map>
+
 namespace castor
 {
 #define DO_WRITE_PARSER_NAME( funcname )\
@@ -276,7 +279,8 @@ namespace castor
 	private:
 		bool doParseScriptLine( String & line );
 		bool doParseScriptBlockEnd();
-		bool doInvokeParser( String & line, AttributeParserMap const & parsers );
+		bool doInvokeParser( String & line, uint32_t section );
+		ParserKeywordTable const & doGetKeywords( uint32_t section );
 		void doEnterBlock();
 		void doLeaveBlock();
 		bool doIsInIgnoredBlock();
@@ -287,6 +291,9 @@ namespace castor
 	private:
 		uint32_t m_rootSectionId;
 		int m_ignoreLevel;
+		//!\~english	The parsers lookup tables, built on first use, per section.
+		//!\~french		Les tables de recherche des analyseurs, construites à la première utilisation, par section.
+		std::unordered_map< uint32_t, ParserKeywordTable > m_keywords;
 
 	protected:
 		LoggerInstance & m_logger;
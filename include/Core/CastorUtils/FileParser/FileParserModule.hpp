@@ -102,6 +102,13 @@ namespace castor
 	class FileParserContext;
 	/**
 	\~english
+	\brief		The parsers of a section, looked up through a minimal perfect hash of their names.
+	\~french
+	\brief		Les analyseurs d'une section, recherchés via un hachage parfait minimal de leurs noms.
+	*/
+	class ParserKeywordTable;
+	/**
+	\~english
 	\brief		Template structure holding parameter specific data.
 	\~french
 	\brief		Structure template contenant les données spécifiques du paramètre.
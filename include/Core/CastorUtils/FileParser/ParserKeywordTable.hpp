@@ -0,0 +1,66 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_ParserKeywordTable_H___
+#define ___CU_ParserKeywordTable_H___
+
+#include "CastorUtils/FileParser/AttributeParsersBySection.hpp"
+
+namespace castor
+{
+	class ParserKeywordTable
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Builds the minimal perfect hash of a section's parsers names.
+		 *\remarks		The table points to the map's elements, it must be rebuilt when the map changes.
+		 *\param[in]	parsers	The section's parsers.
+		 *\~french
+		 *\brief		Construit le hachage parfait minimal des noms des analyseurs d'une section.
+		 *\remarks		La table pointe sur les éléments de la map, elle doit être reconstruite lorsque la map change.
+		 *\param[in]	parsers	Les analyseurs de la section.
+		 */
+		CU_API explicit ParserKeywordTable( AttributeParserMap const & parsers );
+		/**
+		 *\~english
+		 *\brief		Looks for a parser, with one hash and one name comparison.
+		 *\param[in]	name	The parser name.
+		 *\return		The parser, \p nullptr if not found.
+		 *\~french
+		 *\brief		Recherche un analyseur, avec un hachage et une comparaison de nom.
+		 *\param[in]	name	Le nom de l'analyseur.
+		 *\return		L'analyseur, \p nullptr s'il n'a pas été trouvé.
+		 */
+		CU_API ParserFunctionAndParams const * find( StringView name )const;
+		/**
+		 *\~english
+		 *\brief		Hashes a parser name.
+		 *\param[in]	seed	The hash seed, 0 for the first level.
+		 *\param[in]	name	The parser name.
+		 *\return		The hash.
+		 *\~french
+		 *\brief		Calcule le hachage d'un nom d'analyseur.
+		 *\param[in]	seed	La graine du hachage, 0 pour le premier niveau.
+		 *\param[in]	name	Le nom de l'analyseur.
+		 *\return		Le hachage.
+		 */
+		CU_API static uint32_t hash( uint32_t seed
+			, StringView name );
+
+	private:
+		struct Slot
+		{
+			StringView name;
+			ParserFunctionAndParams const * parser{ nullptr };
+		};
+
+		uint32_t m_mask{ 0u };
+		//!\~english	Per first level bucket, the second level seed if positive, else the slot index, negated minus one.
+		//!\~french		Par case du premier niveau, la graine du second niveau si positif, sinon l'indice de l'emplacement, négativé moins un.
+		std::vector< int32_t > m_seeds;
+		std::vector< Slot > m_slots;
+	};
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "CastorUtils/FileParser/ParserParameterTypeException.hpp"
 #include "CastorUtils/Design/ArrayView.hpp"
 
+#include <charconv>
+
 namespace castor
 {
 	//*************************************************************************************************
@@ -13,6 +15,123 @@ namespace castor
 	{
 		static xchar const * const VALUE_SEPARATOR = cuT( "[ \\t]*[ \\t,;][ \\t]*" );
 		static xchar const * const IGNORED_END = cuT( "([^\\r\\n]*)" );
+
+		inline xchar const * skipBlanks( xchar const * it
+			, xchar const * end )
+		{
+			while ( it != end && ( *it == cuT( ' ' ) || *it == cuT( '\t' ) ) )
+			{
+				++it;
+			}
+
+			return it;
+		}
+		/**
+		 *\~english
+		 *\brief		Parses a number, without allocation nor locale.
+		 *\remarks		The unsigned integers also accept a 0x prefixed hexadecimal value.
+		 *\param[in,out]	it	The text start, receives the end of the number.
+		 *\param[in]		end	The text end.
+		 *\param[out]		value	Receives the number.
+		 *\return		\p false if the text doesn't start with a number.
+		 *\~french
+		 *\brief		Extrait un nombre, sans allocation ni locale.
+		 *\remarks		Les entiers non signés acceptent aussi une valeur hexadécimale préfixée par 0x.
+		 *\param[in,out]	it	Le début du texte, reçoit la fin du nombre.
+		 *\param[in]		end	La fin du texte.
+		 *\param[out]		value	Reçoit le nombre.
+		 *\return		\p false si le texte ne commence pas par un nombre.
+		 */
+		template< typename T >
+		inline bool parseNumber( xchar const *& it
+			, xchar const * end
+			, T & value )
+		{
+			std::from_chars_result result{};
+
+			if constexpr ( std::is_integral_v< T > )
+			{
+				if ( std::is_unsigned_v< T >
+					&& end - it > 2
+					&& it[0] == cuT( '0' )
+					&& ( it[1] == cuT( 'x' ) || it[1] == cuT( 'X' ) ) )
+				{
+					result = std::from_chars( it + 2, end, value, 16 );
+				}
+				else
+				{
+					result = std::from_chars( it, end, value );
+				}
+			}
+			else
+			{
+#if defined( __cpp_lib_to_chars )
+				result = std::from_chars( it, end, value );
+#else
+				// Floating point from_chars is missing, the regex path is used instead.
+				return false;
+#endif
+			}
+
+			if ( result.ec != std::errc{} )
+			{
+				return false;
+			}
+
+			it = result.ptr;
+			return true;
+		}
+		/**
+		 *\~english
+		 *\brief		Parses numbers separated by blanks, a comma or a semicolon.
+		 *\param[in,out]	params	The line, receives the text following the numbers.
+		 *\param[in]		count	The numbers count.
+		 *\param[out]		values	Receives the numbers.
+		 *\return		\p false if the line doesn't start with the numbers.
+		 *\~french
+		 *\brief		Extrait des nombres séparés par des blancs, une virgule ou un point-virgule.
+		 *\param[in,out]	params	La ligne, reçoit le texte suivant les nombres.
+		 *\param[in]		count	Le nombre de nombres.
+		 *\param[out]		values	Reçoit les nombres.
+		 *\return		\p false si la ligne ne commence pas par les nombres.
+		 */
+		template< typename T >
+		inline bool parseNumbers( String & params
+			, size_t count
+			, T * values )
+		{
+			auto end = params.data() + params.size();
+			auto it = skipBlanks( params.data(), end );
+
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				if ( i > 0u )
+				{
+					auto separator = it;
+					it = skipBlanks( it, end );
+
+					if ( it != end && ( *it == cuT( ',' ) || *it == cuT( ';' ) ) )
+					{
+						++it;
+					}
+
+					it = skipBlanks( it, end );
+
+					if ( it == separator )
+					{
+						return false;
+					}
+				}
+
+				if ( !parseNumber( it, end, values[i] ) )
+				{
+					return false;
+				}
+			}
+
+			params.erase( 0u, size_t( it - params.data() ) );
+			return true;
+		}
 	}
 
 	//*************************************************************************************************
@@ -37,6 +156,11 @@ namespace castor
 		, size_t count
 		, T * value )
 	{
+		if ( details::parseNumbers( params, count, value ) )
+		{
+			return true;
+		}
+
 		bool result = false;
 
 		try
@@ -1006,16 +1130,17 @@ namespace castor
 	inline bool ParserParameter< ParameterType::eName >::parse( LoggerInstance & logger
 		, String & params )
 	{
-		Regex regex{ cuT( "[^\"]*\"([^\"]*)\"" ) + String{ details::IGNORED_END } };
-		auto begin = std::begin( params );
-		auto end = std::end( params );
-		RegexIterator it( begin, end, regex );
-		RegexIterator endit;
+		auto begin = params.find( cuT( '"' ) );
 
-		if ( it != endit && it->size() > 2 )
+		if ( begin != String::npos )
 		{
-			m_value = ( *it )[1];
-			params = ( *it )[2];
+			auto end = params.find( cuT( '"' ), begin + 1u );
+
+			if ( end != String::npos )
+			{
+				m_value = params.substr( begin + 1u, end - begin - 1u );
+				params.erase( 0u, end + 1u );
+			}
 		}
 
 		return !m_value.empty();
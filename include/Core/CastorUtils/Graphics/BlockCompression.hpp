@@ -0,0 +1,115 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_BlockCompression___
+#define ___CU_BlockCompression___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Graphics/Size.hpp"
+
+namespace castor
+{
+	struct BlockCompressionOptions
+	{
+		//!\~english	The encoder quality preset.
+		//!\~french		Le préréglage de qualité de l'encodeur.
+		BlockCompressionQuality quality{ BlockCompressionQuality::eNormal };
+		//!\~english	The number of threads used to encode a level (0 means CPU cores count).
+		//!\~french		Le nombre de threads utilisés pour encoder un niveau (0 signifie le nombre de coeurs du CPU).
+		uint32_t threadsCount{ 0u };
+	};
+
+	namespace PF
+	{
+		/**
+		 *\~english
+		 *\param[in]	format	The pixel format.
+		 *\return		\p true if the block encoder can produce the given format.
+		 *\~french
+		 *\param[in]	format	Le format de pixels.
+		 *\return		\p true si l'encodeur par blocs peut produire le format donné.
+		 */
+		CU_API bool isBlockCompressionSupported( PixelFormat format );
+		/**
+		 *\~english
+		 *\brief		Encodes a 4x4 RGBA8 pixels block.
+		 *\param[in]	quality	The encoder quality.
+		 *\param[in]	pixels	The 16 RGBA8 pixels, row major.
+		 *\param[in]	format	The compressed format.
+		 *\param[out]	block	Receives the compressed block (8 or 16 bytes).
+		 *\~french
+		 *\brief		Encode un bloc de 4x4 pixels RGBA8.
+		 *\param[in]	quality	La qualité de l'encodeur.
+		 *\param[in]	pixels	Les 16 pixels RGBA8, ligne par ligne.
+		 *\param[in]	format	Le format compressé.
+		 *\param[out]	block	Reçoit le bloc compressé (8 ou 16 octets).
+		 */
+		CU_API void compressBlock( BlockCompressionQuality quality
+			, uint8_t const * pixels
+			, PixelFormat format
+			, uint8_t * block );
+		/**
+		 *\~english
+		 *\brief		Decodes a compressed block to 4x4 RGBA8 pixels.
+		 *\param[in]	format	The compressed format.
+		 *\param[in]	block	The compressed block.
+		 *\param[out]	pixels	Receives the 16 RGBA8 pixels, row major.
+		 *\return		\p false if the format or the block is not supported.
+		 *\~french
+		 *\brief		Décode un bloc compressé en 4x4 pixels RGBA8.
+		 *\param[in]	format	Le format compressé.
+		 *\param[in]	block	Le bloc compressé.
+		 *\param[out]	pixels	Reçoit les 16 pixels RGBA8, ligne par ligne.
+		 *\return		\p false si le format ou le bloc n'est pas supporté.
+		 */
+		CU_API bool decompressBlock( PixelFormat format
+			, uint8_t const * block
+			, uint8_t * pixels );
+		/**
+		 *\~english
+		 *\brief		Compresses one image level.
+		 *\remarks		Block rows are dispatched to several threads.
+		 *\param[in]	options		The encoder options.
+		 *\param[in]	dimensions	The level dimensions.
+		 *\param[in]	srcFormat	The source pixel format (converted to RGBA8 if needed).
+		 *\param[in]	srcBuffer	The source pixels.
+		 *\param[in]	dstFormat	The compressed format.
+		 *\param[out]	dstBuffer	Receives the compressed blocks.
+		 *\~french
+		 *\brief		Compresse un niveau d'image.
+		 *\remarks		Les lignes de blocs sont réparties sur plusieurs threads.
+		 *\param[in]	options		Les options de l'encodeur.
+		 *\param[in]	dimensions	Les dimensions du niveau.
+		 *\param[in]	srcFormat	Le format des pixels source (converti en RGBA8 si nécessaire).
+		 *\param[in]	srcBuffer	Les pixels source.
+		 *\param[in]	dstFormat	Le format compressé.
+		 *\param[out]	dstBuffer	Reçoit les blocs compressés.
+		 */
+		CU_API void compressBuffer( BlockCompressionOptions const & options
+			, Size const & dimensions
+			, PixelFormat srcFormat
+			, uint8_t const * srcBuffer
+			, PixelFormat dstFormat
+			, uint8_t * dstBuffer );
+		/**
+		 *\~english
+		 *\brief		Compresses all layers and levels of the given pixel buffer.
+		 *\param[in]	src		The source pixel buffer.
+		 *\param[in]	format	The compressed format.
+		 *\param[in]	options	The encoder options.
+		 *\return		The compressed pixel buffer.
+		 *\~french
+		 *\brief		Compresse toutes les couches et tous les niveaux du tampon de pixels donné.
+		 *\param[in]	src		Le tampon de pixels source.
+		 *\param[in]	format	Le format compressé.
+		 *\param[in]	options	Les options de l'encodeur.
+		 *\return		Le tampon de pixels compressé.
+		 */
+		CU_API PxBufferBaseSPtr compressBuffer( PxBufferBaseSPtr src
+			, PixelFormat format
+			, BlockCompressionOptions const & options = BlockCompressionOptions{} );
+	}
+}
+
+#endif
@@ -416,6 +416,102 @@ namespace castor
 	};
 	/**
 	\~english
+	\brief		Block compression encoder quality presets.
+	\~french
+	\brief		Préréglages de qualité de l'encodeur de compression par blocs.
+	*/
+	enum class BlockCompressionQuality
+		: uint8_t
+	{
+		//!\~english	Bounding box endpoints, fastest encoding.
+		//!\~french		Extrémités calculées depuis la boîte englobante, encodage le plus rapide.
+		eFast,
+		//!\~english	Principal axis endpoints.
+		//!\~french		Extrémités calculées depuis l'axe principal.
+		eNormal,
+		//!\~english	Principal axis endpoints, refined through least squares.
+		//!\~french		Extrémités calculées depuis l'axe principal, affinées par moindres carrés.
+		eHigh,
+		CU_ScopedEnumBounds( eFast )
+	};
+	/**
+	\~english
+	\brief		The SIMD instructions sets used by the fast pixel buffers conversions.
+	\~french
+	\brief		Les jeux d'instructions SIMD utilisés par les conversions rapides de buffers de pixels.
+	*/
+	enum class PixelConversionSimd
+		: uint8_t
+	{
+		//!\~english	Scalar kernels.
+		//!\~french		Kernels scalaires.
+		eNone,
+		//!\~english	SSE2 kernels.
+		//!\~french		Kernels SSE2.
+		eSSE2,
+		//!\~english	AVX2 kernels.
+		//!\~french		Kernels AVX2.
+		eAVX2,
+		CU_ScopedEnumBounds( eNone )
+	};
+	/**
+	\~english
+	\brief		The block compression encoder options.
+	\~french
+	\brief		Les options de l'encodeur de compression par blocs.
+	*/
+	struct BlockCompressionOptions;
+	/**
+	\~english
+	\brief		The CPU mipmaps generation options.
+	\~french
+	\brief		Les options de génération des mipmaps sur CPU.
+	*/
+	struct MipmapGenerationOptions;
+	/**
+	\~english
+	\brief		On-disk cache of processed pixel buffers.
+	\~french
+	\brief		Cache sur disque de tampons de pixels traités.
+	*/
+	class PxBufferCache;
+	/**
+	\~english
+	\brief		Third order (9 coefficients) spherical harmonics of an RGB environment.
+	\~french
+	\brief		Harmoniques sphériques de troisième ordre (9 coefficients) d'un environnement RGB.
+	*/
+	class SphericalHarmonics;
+	/**
+	\~english
+	\brief		Quadric error metrics triangle mesh simplifier, used to generate levels of detail.
+	\~french
+	\brief		Simplificateur de maillages triangulaires par métrique d'erreur quadrique, utilisé pour générer des niveaux de détail.
+	*/
+	class MeshSimplifier;
+	/**
+	\~english
+	\brief		A cluster of triangles, with its bounding sphere and normal cone.
+	\~french
+	\brief		Un groupe de triangles, avec sa sphère englobante et son cône de normales.
+	*/
+	struct Meshlet;
+	/**
+	\~english
+	\brief		A range of indices, resulting from the meshlets culling.
+	\~french
+	\brief		Un intervalle d'indices, résultant du culling des meshlets.
+	*/
+	struct MeshletRange;
+	/**
+	\~english
+	\brief		Low resolution depth buffer, rasterised on the CPU from occluders, used to test objects occlusion.
+	\~french
+	\brief		Tampon de profondeur basse résolution, rastérisé sur le CPU à partir d'occulteurs, utilisé pour tester l'occultation d'objets.
+	*/
+	class OcclusionBuffer;
+	/**
+	\~english
 	\brief		The memory layout for an image.
 	\~french
 	\brief		Le layout mémoire d'une image.
@@ -519,6 +615,13 @@ namespace castor
 	class Grid;
 	/**
 	\~english
+	\brief		Square heightmap, generated with the diamond-square algorithm or loaded from a raw file.
+	\~french
+	\brief		Heightmap carrée, générée avec l'algorithme diamond-square ou chargée depuis un fichier brut.
+	*/
+	class Heightmap;
+	/**
+	\~english
 	\brief		Image resource
 	\~french
 	\brief		Ressource Image
@@ -775,6 +878,9 @@ namespace castor
 	CU_DeclareSmartPtr( Font );
 	CU_DeclareSmartPtr( PxBufferBase );
 
+	using MeshletArray = std::vector< Meshlet >;
+	using MeshletRangeArray = std::vector< MeshletRange >;
+
 	using RgbColour = RgbColourT< ColourComponent >;
 	using RgbaColour = RgbaColourT< ColourComponent >;
 	using HdrRgbColour = RgbColourT< HdrColourComponent >;
@@ -0,0 +1,109 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_Heightmap_H___
+#define ___CU_Heightmap_H___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Math/Point.hpp"
+
+#include <vector>
+
+namespace castor
+{
+	class Heightmap
+	{
+	public:
+		Heightmap() = default;
+		/**
+		 *\~english
+		 *\brief		Constructor, the heights are set to 0.
+		 *\param[in]	size	The samples count, per side.
+		 *\~french
+		 *\brief		Constructeur, les hauteurs sont mises à 0.
+		 *\param[in]	size	Le nombre d'échantillons, par côté.
+		 */
+		CU_API explicit Heightmap( uint32_t size );
+		/**
+		 *\~english
+		 *\brief		Generates a heightmap with the diamond-square algorithm.
+		 *\remarks		Each step's cells are independent, their rows are split across threads.
+		 *				<br />The random offsets only depend on the seed and the cell, so the result doesn't depend on the threads count.
+		 *\param[in]	detail			The heightmap has 2^detail + 1 samples per side.
+		 *\param[in]	roughness		The random offsets scale.
+		 *\param[in]	seed			The random seed.
+		 *\param[in]	threadsCount	The threads count, 0 to use the hardware concurrency.
+		 *\~french
+		 *\brief		Génère une heightmap avec l'algorithme diamond-square.
+		 *\remarks		Les cellules de chaque étape sont indépendantes, leurs lignes sont réparties entre les threads.
+		 *				<br />Les décalages aléatoires ne dépendent que de la graine et de la cellule, le résultat ne dépend donc pas du nombre de threads.
+		 *\param[in]	detail			La heightmap a 2^detail + 1 échantillons par côté.
+		 *\param[in]	roughness		L'échelle des décalages aléatoires.
+		 *\param[in]	seed			La graine aléatoire.
+		 *\param[in]	threadsCount	Le nombre de threads, 0 pour utiliser la concurrence matérielle.
+		 */
+		CU_API static Heightmap generate( uint32_t detail
+			, float roughness
+			, uint32_t seed
+			, uint32_t threadsCount );
+		/**
+		 *\~english
+		 *\brief		Loads a raw heightmap: a "C3DH" tag, the size as uint32_t, then size * size floats.
+		 *\param[in]	path	The file path.
+		 *\return		\p false if the file couldn't be read.
+		 *\~french
+		 *\brief		Charge une heightmap brute : une étiquette "C3DH", la taille en uint32_t, puis size * size floats.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\return		\p false si le fichier n'a pas pu être lu.
+		 */
+		CU_API bool load( Path const & path );
+		/**
+		 *\~english
+		 *\brief		Saves the heightmap, in the format read by load.
+		 *\param[in]	path	The file path.
+		 *\return		\p false if the file couldn't be written.
+		 *\~french
+		 *\brief		Sauvegarde la heightmap, dans le format lu par load.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\return		\p false si le fichier n'a pas pu être écrit.
+		 */
+		CU_API bool save( Path const & path )const;
+		/**
+		 *\~english
+		 *\return		The normal at given sample, from the central differences.
+		 *\~french
+		 *\return		La normale à l'échantillon donné, à partir des différences centrées.
+		 */
+		CU_API Point3f getNormal( uint32_t x, uint32_t y )const;
+		/**
+		 *\~english
+		 *\return		The tangent at given sample, along X.
+		 *\~french
+		 *\return		La tangente à l'échantillon donné, selon X.
+		 */
+		CU_API Point3f getTangent( uint32_t x, uint32_t y )const;
+
+		float & operator()( uint32_t x, uint32_t y )
+		{
+			return m_heights[size_t( y ) * m_size + x];
+		}
+
+		float operator()( uint32_t x, uint32_t y )const
+		{
+			return m_heights[size_t( y ) * m_size + x];
+		}
+
+		uint32_t getSize()const
+		{
+			return m_size;
+		}
+
+	private:
+		uint32_t m_size{ 0u };
+		std::vector< float > m_heights;
+	};
+}
+
+#endif
@@ -0,0 +1,118 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_MeshSimplifier_H___
+#define ___CU_MeshSimplifier_H___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Math/Point.hpp"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace castor
+{
+	class MeshSimplifier
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, computes the vertices quadrics.
+		 *\remarks		Vertices sharing their position with another one (attributes seams) are locked,
+		 *				and the open borders are weighted so that they keep their shape.
+		 *\param[in]	positions	The vertices positions.
+		 *\param[in]	indices		The triangles indices.
+		 *\~french
+		 *\brief		Constructeur, calcule les quadriques des sommets.
+		 *\remarks		Les sommets partageant leur position avec un autre (coutures d'attributs) sont verrouillés,
+		 *				et les bords ouverts sont pondérés afin qu'ils gardent leur forme.
+		 *\param[in]	positions	Les positions des sommets.
+		 *\param[in]	indices		Les indices des triangles.
+		 */
+		CU_API MeshSimplifier( std::vector< Point3f > const & positions
+			, std::vector< uint32_t > const & indices );
+		/**
+		 *\~english
+		 *\brief		Collapses edges, cheapest first, until the target is reached.
+		 *\remarks		The simplification starts from the current state, so successive calls produce successive levels of detail.
+		 *				The vertices are never moved, an edge collapse merges one of its vertices into the other one.
+		 *\param[in]	targetIndexCount	The wanted indices count.
+		 *\param[in]	maxError			The maximal error, as a distance in positions units.
+		 *\return		The resulting indices count.
+		 *\~french
+		 *\brief		Fusionne des arêtes, les moins coûteuses d'abord, jusqu'à atteindre la cible.
+		 *\remarks		La simplification part de l'état courant, des appels successifs produisent donc des niveaux de détail successifs.
+		 *				Les sommets ne sont jamais déplacés, une fusion d'arête fusionne l'un de ses sommets dans l'autre.
+		 *\param[in]	targetIndexCount	Le nombre d'indices voulu.
+		 *\param[in]	maxError			L'erreur maximale, en tant que distance dans l'unité des positions.
+		 *\return		Le nombre d'indices résultant.
+		 */
+		CU_API uint32_t simplify( uint32_t targetIndexCount
+			, float maxError = std::numeric_limits< float >::max() );
+		/**
+		 *\~english
+		 *\return		The remaining triangles indices, in their original order.
+		 *\~french
+		 *\return		Les indices des triangles restants, dans leur ordre d'origine.
+		 */
+		CU_API std::vector< uint32_t > getIndices()const;
+		/**
+		 *\~english
+		 *\return		The remaining indices count.
+		 *\~french
+		 *\return		Le nombre d'indices restants.
+		 */
+		inline uint32_t getIndexCount()const
+		{
+			return m_triangleCount * 3u;
+		}
+		/**
+		 *\~english
+		 *\return		The maximal error introduced so far, as a distance in positions units.
+		 *\~french
+		 *\return		L'erreur maximale introduite jusqu'ici, en tant que distance dans l'unité des positions.
+		 */
+		inline float getError()const
+		{
+			return m_error;
+		}
+
+	private:
+		using Quadric = std::array< double, 11u >;
+		using Triangle = std::array< uint32_t, 3u >;
+
+		struct Collapse
+		{
+			double cost;
+			uint32_t from;
+			uint32_t to;
+			uint32_t fromStamp;
+			uint32_t toStamp;
+		};
+
+		void doLockSeams();
+		void doComputeQuadrics();
+		void doPushEdge( uint32_t a, uint32_t b );
+		bool doIsValid( uint32_t from, uint32_t to );
+		void doCollapse( Collapse const & collapse );
+		double doGetCost( Quadric const & quadric, uint32_t vertex )const;
+
+	private:
+		std::vector< Point3f > m_positions;
+		std::vector< Triangle > m_triangles;
+		std::vector< uint8_t > m_removed;
+		std::vector< std::vector< uint32_t > > m_vertexTriangles;
+		std::vector< Quadric > m_quadrics;
+		std::vector< uint32_t > m_stamps;
+		std::vector< uint8_t > m_locked;
+		std::vector< uint8_t > m_collapsed;
+		std::vector< Collapse > m_heap;
+		std::vector< uint32_t > m_neighbours;
+		uint32_t m_triangleCount{ 0u };
+		float m_error{ 0.0f };
+	};
+}
+
+#endif
@@ -0,0 +1,111 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_Meshlet_H___
+#define ___CU_Meshlet_H___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Math/PlaneEquation.hpp"
+#include "CastorUtils/Math/Point.hpp"
+#include "CastorUtils/Math/SquareMatrix.hpp"
+
+#include <array>
+#include <vector>
+
+namespace castor
+{
+	struct Meshlet
+	{
+		//!\~english	The first index of the meshlet triangles.
+		//!\~french		Le premier indice des triangles du meshlet.
+		uint32_t firstIndex;
+		//!\~english	The meshlet indices count.
+		//!\~french		Le nombre d'indices du meshlet.
+		uint32_t indexCount;
+		//!\~english	The bounding sphere center.
+		//!\~french		Le centre de la sphère englobante.
+		Point3f center;
+		//!\~english	The bounding sphere radius.
+		//!\~french		Le rayon de la sphère englobante.
+		float radius;
+		//!\~english	The normal cone axis.
+		//!\~french		L'axe du cône de normales.
+		Point3f coneAxis;
+		//!\~english	The sine of the normal cone half angle, 1 or more when the cone can't be used for culling.
+		//!\~french		Le sinus du demi angle du cône de normales, 1 ou plus quand le cône ne peut pas servir au culling.
+		float coneCutoff;
+	};
+
+	struct MeshletRange
+	{
+		uint32_t firstIndex;
+		uint32_t indexCount;
+	};
+
+	namespace meshlet
+	{
+		static uint32_t constexpr MaxVertices = 64u;
+		static uint32_t constexpr MaxTriangles = 124u;
+		/**
+		 *\~english
+		 *\brief			Groups the triangles into meshlets, each meshlet growing through its neighbouring triangles.
+		 *\param[in]		positions		The vertices positions.
+		 *\param[in,out]	indices			The triangles indices, reordered so that each meshlet triangles are contiguous.
+		 *\param[in]		maxVertices		The maximal vertices count for a meshlet.
+		 *\param[in]		maxTriangles	The maximal triangles count for a meshlet.
+		 *\return			The meshlets, in indices order.
+		 *\~french
+		 *\brief			Groupe les triangles en meshlets, chaque meshlet grandissant via ses triangles voisins.
+		 *\param[in]		positions		Les positions des sommets.
+		 *\param[in,out]	indices			Les indices des triangles, réordonnés pour que les triangles de chaque meshlet soient contigus.
+		 *\param[in]		maxVertices		Le nombre maximal de sommets d'un meshlet.
+		 *\param[in]		maxTriangles	Le nombre maximal de triangles d'un meshlet.
+		 *\return			Les meshlets, dans l'ordre des indices.
+		 */
+		CU_API MeshletArray build( std::vector< Point3f > const & positions
+			, std::vector< uint32_t > & indices
+			, uint32_t maxVertices = MaxVertices
+			, uint32_t maxTriangles = MaxTriangles );
+		/**
+		 *\~english
+		 *\brief		Culls the meshlets against a frustum and removes the back facing ones.
+		 *\remarks		Consecutive visible meshlets are merged into one range.
+		 *				<br />The normal cones are ignored when the scale isn't uniform.
+		 *				<br />Large meshlets arrays are dispatched to several threads.
+		 *\param[in]	meshlets		The meshlets.
+		 *\param[in]	planes			The frustum planes, in world space.
+		 *\param[in]	transform		The object to world transformation matrix.
+		 *\param[in]	scale			The object to world scale.
+		 *\param[in]	viewPosition	The camera position, in world space.
+		 *\param[in]	cullBackFaces	Tells if the back facing meshlets are culled, using their normal cone.
+		 *\param[out]	ranges			Receives the visible indices ranges.
+		 *\param[in]	threadsCount	The maximum number of threads (0 means CPU cores count).
+		 *\return		The visible indices count.
+		 *\~french
+		 *\brief		Elimine les meshlets hors d'un frustum et ceux qui tournent le dos à la caméra.
+		 *\remarks		Les meshlets visibles consécutifs sont fusionnés en un seul intervalle.
+		 *				<br />Les cônes de normales sont ignorés quand l'échelle n'est pas uniforme.
+		 *				<br />Les grands tableaux de meshlets sont répartis sur plusieurs threads.
+		 *\param[in]	meshlets		Les meshlets.
+		 *\param[in]	planes			Les plans du frustum, dans l'espace monde.
+		 *\param[in]	transform		La matrice de transformation objet vers monde.
+		 *\param[in]	scale			L'échelle objet vers monde.
+		 *\param[in]	viewPosition	La position de la caméra, dans l'espace monde.
+		 *\param[in]	cullBackFaces	Dit si les meshlets tournant le dos à la caméra sont éliminés, via leur cône de normales.
+		 *\param[out]	ranges			Reçoit les intervalles d'indices visibles.
+		 *\param[in]	threadsCount	Le nombre maximal de threads (0 signifie le nombre de coeurs du CPU).
+		 *\return		Le nombre d'indices visibles.
+		 */
+		CU_API uint32_t cull( MeshletArray const & meshlets
+			, std::array< PlaneEquation, 6u > const & planes
+			, Matrix4x4f const & transform
+			, Point3f const & scale
+			, Point3f const & viewPosition
+			, bool cullBackFaces
+			, MeshletRangeArray & ranges
+			, uint32_t threadsCount = 0u );
+	}
+}
+
+#endif
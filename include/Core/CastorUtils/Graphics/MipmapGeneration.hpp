@@ -0,0 +1,53 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_MipmapGeneration___
+#define ___CU_MipmapGeneration___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+namespace castor
+{
+	struct MipmapGenerationOptions
+	{
+		//!\~english	Tells if the colour components are sRGB encoded, and must be filtered in linear space.
+		//!\~french		Dit si les composantes couleur sont encodées en sRGB, et doivent être filtrées dans l'espace linéaire.
+		bool gammaCorrect{ false };
+		//!\~english	The number of threads used to filter a level (0 means CPU cores count).
+		//!\~french		Le nombre de threads utilisés pour filtrer un niveau (0 signifie le nombre de coeurs du CPU).
+		uint32_t threadsCount{ 0u };
+	};
+
+	namespace PF
+	{
+		/**
+		 *\~english
+		 *\param[in]	format	The pixel format.
+		 *\return		\p true if generateMipmaps can process the given format.
+		 *\~french
+		 *\param[in]	format	Le format de pixels.
+		 *\return		\p true si generateMipmaps peut traiter le format donné.
+		 */
+		CU_API bool isMipmapGenerationSupported( PixelFormat format );
+		/**
+		 *\~english
+		 *\brief		Generates the mip levels of the given pixel buffer, from its first level, for each of its layers.
+		 *\remarks		Each level is a 2x2 box filter of the previous one, sRGB formats are always filtered in linear space.
+		 *				<br />Rows are dispatched to several threads.
+		 *\param[in,out]	buffer	The pixel buffer, its levels count defines the generated levels.
+		 *\param[in]		options	The generation options.
+		 *\return		\p false if the buffer format is not supported.
+		 *\~french
+		 *\brief		Génère les niveaux de mip du tampon de pixels donné, depuis son premier niveau, pour chacune de ses couches.
+		 *\remarks		Chaque niveau est un filtre boîte 2x2 du précédent, les formats sRGB sont toujours filtrés dans l'espace linéaire.
+		 *				<br />Les lignes sont réparties sur plusieurs threads.
+		 *\param[in,out]	buffer	Le tampon de pixels, son nombre de niveaux définit les niveaux générés.
+		 *\param[in]		options	Les options de génération.
+		 *\return		\p false si le format du tampon n'est pas supporté.
+		 */
+		CU_API bool generateMipmaps( PxBufferBase & buffer
+			, MipmapGenerationOptions const & options = MipmapGenerationOptions{} );
+	}
+}
+
+#endif
@@ -0,0 +1,170 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_OcclusionBuffer_H___
+#define ___CU_OcclusionBuffer_H___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Graphics/BoundingBox.hpp"
+#include "CastorUtils/Math/SquareMatrix.hpp"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace castor
+{
+	class OcclusionBuffer
+	{
+	private:
+		struct Triangle
+		{
+			std::array< float, 3u > x;
+			std::array< float, 3u > y;
+			std::array< float, 3u > z;
+			int32_t minX;
+			int32_t minY;
+			int32_t maxX;
+			int32_t maxY;
+			// Bit i is set when the edge opposite to vertex i is shared with another triangle of the occluder, on its other side.
+			uint32_t innerEdges;
+		};
+
+	public:
+		//!\~english	The size of the square tiles dispatched to the rasterisation threads.
+		//!\~french		La taille des tuiles carrées réparties sur les threads de rastérisation.
+		static uint32_t constexpr TileSize = 32u;
+		//!\~english	The depth of the pixels covered by no occluder.
+		//!\~french		La profondeur des pixels couverts par aucun occulteur.
+		static float constexpr FarDepth = std::numeric_limits< float >::max();
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	width, height	The depth buffer dimensions, in pixels.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	width, height	Les dimensions du tampon de profondeur, en pixels.
+		 */
+		CU_API OcclusionBuffer( uint32_t width
+			, uint32_t height );
+		/**
+		 *\~english
+		 *\brief		Clears the depth buffer and the occluders, and starts a new frame.
+		 *\remarks		The projection must produce a depth increasing with the distance to the camera.
+		 *\param[in]	viewProjection	The camera view projection matrix.
+		 *\~french
+		 *\brief		Vide le tampon de profondeur et les occulteurs, et commence une nouvelle frame.
+		 *\remarks		La projection doit produire une profondeur croissant avec la distance à la caméra.
+		 *\param[in]	viewProjection	La matrice vue projection de la caméra.
+		 */
+		CU_API void clear( Matrix4x4f const & viewProjection );
+		/**
+		 *\~english
+		 *\brief		Projects the triangles of an occluder, they will be rasterised by the next call to rasterise().
+		 *\remarks		The triangles crossing the camera near plane are ignored.
+		 *				<br />The coverage is conservative: along the occluder silhouette, only the pixels it entirely covers are written.
+		 *\param[in]	positions	The vertices positions.
+		 *\param[in]	indices		The triangles indices.
+		 *\param[in]	transform	The occluder to world transformation matrix.
+		 *\~french
+		 *\brief		Projette les triangles d'un occulteur, ils seront rastérisés lors du prochain appel à rasterise().
+		 *\remarks		Les triangles traversant le plan proche de la caméra sont ignorés.
+		 *				<br />La couverture est conservative : le long de la silhouette de l'occulteur, seuls les pixels qu'il couvre entièrement sont écrits.
+		 *\param[in]	positions	Les positions des sommets.
+		 *\param[in]	indices		Les indices des triangles.
+		 *\param[in]	transform	La matrice de transformation occulteur vers monde.
+		 */
+		CU_API void addOccluder( std::vector< Point3f > const & positions
+			, std::vector< uint32_t > const & indices
+			, Matrix4x4f const & transform );
+		/**
+		 *\~english
+		 *\brief		Rasterises the occluders triangles, then builds the depth hierarchy.
+		 *\remarks		A pixel is written when the triangle covers its center, with the farthest depth of the triangle over that pixel.
+		 *				<br />The tiles are dispatched to several threads when there are enough triangles.
+		 *\param[in]	threadsCount	The maximum number of threads (0 means CPU cores count).
+		 *\~french
+		 *\brief		Rastérise les triangles des occulteurs, puis construit la hiérarchie de profondeurs.
+		 *\remarks		Un pixel est écrit lorsque le triangle couvre son centre, avec la profondeur la plus lointaine du triangle sur ce pixel.
+		 *				<br />Les tuiles sont réparties sur plusieurs threads quand il y a assez de triangles.
+		 *\param[in]	threadsCount	Le nombre maximal de threads (0 signifie le nombre de coeurs du CPU).
+		 */
+		CU_API void rasterise( uint32_t threadsCount = 0u );
+		/**
+		 *\~english
+		 *\brief		Tests a bounding box against the depth hierarchy.
+		 *\remarks		The test is conservative: boxes crossing the camera near plane, or outside of the screen, are visible.
+		 *\param[in]	box			The bounding box.
+		 *\param[in]	transform	The box to world transformation matrix.
+		 *\return		\p false if the box is completely hidden by the occluders.
+		 *\~french
+		 *\brief		Teste une bounding box contre la hiérarchie de profondeurs.
+		 *\remarks		Le test est conservatif : les boîtes traversant le plan proche de la caméra, ou hors de l'écran, sont visibles.
+		 *\param[in]	box			La bounding box.
+		 *\param[in]	transform	La matrice de transformation boîte vers monde.
+		 *\return		\p false si la boîte est complètement cachée par les occulteurs.
+		 */
+		CU_API bool isVisible( BoundingBox const & box
+			, Matrix4x4f const & transform )const;
+		/**
+		 *\~english
+		 *\param[in]	x, y	The pixel position, (0, 0) being at NDC (-1, -1).
+		 *\param[in]	level	The hierarchy level.
+		 *\return		The farthest depth over the given texel of the given hierarchy level.
+		 *\~french
+		 *\param[in]	x, y	La position du pixel, (0, 0) étant en NDC (-1, -1).
+		 *\param[in]	level	Le niveau de la hiérarchie.
+		 *\return		La profondeur la plus lointaine sur le texel donné du niveau de hiérarchie donné.
+		 */
+		CU_API float getDepth( uint32_t x
+			, uint32_t y
+			, uint32_t level = 0u )const;
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		inline uint32_t getWidth()const
+		{
+			return m_width;
+		}
+
+		inline uint32_t getHeight()const
+		{
+			return m_height;
+		}
+
+		inline uint32_t getLevelsCount()const
+		{
+			return uint32_t( m_levels.size() );
+		}
+
+		inline uint32_t getTrianglesCount()const
+		{
+			return uint32_t( m_triangles.size() );
+		}
+		/**@}*/
+
+	private:
+		void doRasteriseTile( uint32_t tile );
+		void doBuildHierarchy();
+
+	private:
+		uint32_t m_width;
+		uint32_t m_height;
+		uint32_t m_tilesX;
+		uint32_t m_tilesY;
+		Matrix4x4f m_viewProjection;
+		std::vector< Triangle > m_triangles;
+		std::vector< std::vector< uint32_t > > m_bins;
+		std::vector< std::vector< float > > m_levels;
+		std::vector< std::pair< uint32_t, uint32_t > > m_sizes;
+	};
+}
+
+#endif
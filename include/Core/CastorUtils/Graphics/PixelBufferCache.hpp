@@ -0,0 +1,138 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_PixelBufferCache_H___
+#define ___CU_PixelBufferCache_H___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Log/LogModule.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace castor
+{
+	class PxBufferCache
+	{
+	public:
+		//!\~english	The default maximum size of the cache files, in bytes.
+		//!\~french		La taille maximale par défaut des fichiers du cache, en octets.
+		static uint64_t constexpr DefaultMaxSize = 1024ull * 1024ull * 1024ull;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	logger		The logger instance.
+		 *\param[in]	directory	The folder holding the cache files, created on first save.
+		 *\param[in]	maxSize		The maximum size of the cache files, the least recently used entries being removed above it.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	logger		L'instance de logger.
+		 *\param[in]	directory	Le dossier contenant les fichiers du cache, créé lors de la première sauvegarde.
+		 *\param[in]	maxSize		La taille maximale des fichiers du cache, les entrées les moins récemment utilisées étant supprimées au-delà.
+		 */
+		CU_API PxBufferCache( LoggerInstance & logger
+			, Path directory
+			, uint64_t maxSize = DefaultMaxSize );
+		/**
+		 *\~english
+		 *\brief		Loads a pixel buffer from the cache.
+		 *\param[in]	key	The entry key.
+		 *\return		The pixel buffer, \p nullptr if the entry doesn't exist or is invalid.
+		 *\~french
+		 *\brief		Charge un tampon de pixels depuis le cache.
+		 *\param[in]	key	La clé de l'entrée.
+		 *\return		Le tampon de pixels, \p nullptr si l'entrée n'existe pas ou est invalide.
+		 */
+		CU_API PxBufferBaseSPtr load( uint64_t key )const;
+		/**
+		 *\~english
+		 *\brief		Writes a pixel buffer (all layers and levels) to the cache.
+		 *\remarks		The entry is written to a temporary file, then renamed, so that a reader never sees a partial entry.
+		 *\param[in]	key		The entry key.
+		 *\param[in]	buffer	The pixel buffer.
+		 *\return		\p false if the entry couldn't be written.
+		 *\~french
+		 *\brief		Ecrit un tampon de pixels (toutes les couches et niveaux) dans le cache.
+		 *\remarks		L'entrée est écrite dans un fichier temporaire, puis renommée, afin qu'un lecteur ne voie jamais une entrée partielle.
+		 *\param[in]	key		La clé de l'entrée.
+		 *\param[in]	buffer	Le tampon de pixels.
+		 *\return		\p false si l'entrée n'a pas pu être écrite.
+		 */
+		CU_API bool save( uint64_t key
+			, PxBufferBase const & buffer )const;
+		/**
+		 *\~english
+		 *\brief		Removes all the cache files.
+		 *\~french
+		 *\brief		Supprime tous les fichiers du cache.
+		 */
+		CU_API void clear()const;
+		/**
+		 *\~english
+		 *\param[in]	key	The entry key.
+		 *\return		The file path for given entry.
+		 *\~french
+		 *\param[in]	key	La clé de l'entrée.
+		 *\return		Le chemin du fichier pour l'entrée donnée.
+		 */
+		CU_API Path getFilePath( uint64_t key )const;
+		/**
+		 *\~english
+		 *\return		The cache folder.
+		 *\~french
+		 *\return		Le dossier du cache.
+		 */
+		inline Path const & getDirectory()const
+		{
+			return m_directory;
+		}
+		/**
+		 *\~english
+		 *\return		The maximum size of the cache files.
+		 *\~french
+		 *\return		La taille maximale des fichiers du cache.
+		 */
+		inline uint64_t getMaxSize()const
+		{
+			return m_maxSize;
+		}
+		/**
+		 *\~english
+		 *\return		The current size of the cache files.
+		 *\~french
+		 *\return		La taille actuelle des fichiers du cache.
+		 */
+		CU_API uint64_t getSize()const;
+
+	private:
+		struct Entry
+		{
+			uint64_t size;
+			std::list< uint64_t >::iterator used;
+		};
+
+	private:
+		void doListEntries()const;
+		void doUseEntry( uint64_t key
+			, uint64_t size )const;
+		void doRemoveEntry( uint64_t key )const;
+		void doEvictEntries()const;
+
+	private:
+		LoggerInstance & m_logger;
+		Path m_directory;
+		uint64_t m_maxSize;
+		// The entries index, listed from the folder on first use.
+		mutable std::mutex m_mutex;
+		mutable bool m_listed{ false };
+		mutable std::unordered_map< uint64_t, Entry > m_entries;
+		// The entries keys, from the least recently used one.
+		mutable std::list< uint64_t > m_used;
+		mutable uint64_t m_size{ 0u };
+	};
+}
+
+#endif
@@ -765,6 +765,49 @@ namespace castor
 			, PixelFormat dstFormat
 			, uint8_t * dstBuffer
 			, uint32_t dstSize );
+		/**
+		 *\~english
+		 *\return		The best SIMD instructions set supported by the CPU, for the fast buffer conversions.
+		 *\~french
+		 *\return		Le meilleur jeu d'instructions SIMD supporté par le CPU, pour les conversions rapides de buffers.
+		 */
+		CU_API PixelConversionSimd getConversionSimd();
+		/**
+		 *\~english
+		 *\brief		Converts a buffer through vectorised kernels, for the most common formats pairs.
+		 *\remarks		The results are the same as the scalar conversion's, bit for bit.
+		 *				<br />Large buffers are split across threads.
+		 *\param[in]	simd			The SIMD instructions set, at most getConversionSimd().
+		 *\param[in]	srcFormat		The source format
+		 *\param[in]	srcBuffer		The source buffer
+		 *\param[in]	srcSize			The source size
+		 *\param[in]	dstFormat		The destination format
+		 *\param[in]	dstBuffer		The destination buffer
+		 *\param[in]	dstSize			The destination size
+		 *\param[in]	threadsCount	The threads count, 0 to use the cores count.
+		 *\return		\p false if the formats pair has no fast path, or if the instructions set isn't supported.
+		 *\~french
+		 *\brief		Convertit un buffer via des kernels vectorisés, pour les paires de formats les plus courantes.
+		 *\remarks		Les résultats sont les mêmes que ceux de la conversion scalaire, bit à bit.
+		 *				<br />Les gros buffers sont répartis entre des threads.
+		 *\param[in]	simd			Le jeu d'instructions SIMD, au plus getConversionSimd().
+		 *\param[in]	srcFormat		Le format de la source
+		 *\param[in]	srcBuffer		Le buffer source
+		 *\param[in]	srcSize			La taille de la source
+		 *\param[in]	dstFormat		Le format de la destination
+		 *\param[in]	dstBuffer		Le buffer destination
+		 *\param[in]	dstSize			La taille de la destination
+		 *\param[in]	threadsCount	Le nombre de threads, 0 pour utiliser le nombre de coeurs.
+		 *\return		\p false si la paire de formats n'a pas de chemin rapide, ou si le jeu d'instructions n'est pas supporté.
+		 */
+		CU_API bool convertBufferFast( PixelConversionSimd simd
+			, PixelFormat srcFormat
+			, uint8_t const * srcBuffer
+			, uint32_t srcSize
+			, PixelFormat dstFormat
+			, uint8_t * dstBuffer
+			, uint32_t dstSize
+			, uint32_t threadsCount );
 		/**
 		 *\~english
 		 *\param[in]	format		The pixel format.
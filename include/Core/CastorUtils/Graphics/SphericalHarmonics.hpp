@@ -0,0 +1,112 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_SphericalHarmonics_H___
+#define ___CU_SphericalHarmonics_H___
+
+#include "CastorUtils/Graphics/GraphicsModule.hpp"
+
+#include "CastorUtils/Math/Point.hpp"
+
+#include <array>
+
+namespace castor
+{
+	class SphericalHarmonics
+	{
+	public:
+		static uint32_t constexpr CoefficientsCount = 9u;
+		using Coefficients = std::array< Point3f, CoefficientsCount >;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, all coefficients set to 0.
+		 *\~french
+		 *\brief		Constructeur, tous les coefficients à 0.
+		 */
+		CU_API SphericalHarmonics();
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	coefficients	The coefficients, by band (L0, L1 then L2).
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	coefficients	Les coefficients, par bande (L0, L1 puis L2).
+		 */
+		CU_API explicit SphericalHarmonics( Coefficients const & coefficients );
+		/**
+		 *\~english
+		 *\brief		Projects a cube map on the spherical harmonics basis.
+		 *\remarks		Each texel is weighted by its solid angle, the faces are dispatched to several threads.
+		 *\param[in]	cube			The cube map, 6 layers in Vulkan faces order (+X, -X, +Y, -Y, +Z, -Z), linear colours.
+		 *							<br />Only the first level is used, formats other than R32G32B32A32_SFLOAT are converted first.
+		 *\param[in]	threadsCount	The maximum number of threads (0 means CPU cores count).
+		 *\return		The spherical harmonics.
+		 *\~french
+		 *\brief		Projette une cube map sur la base des harmoniques sphériques.
+		 *\remarks		Chaque texel est pondéré par son angle solide, les faces sont réparties sur plusieurs threads.
+		 *\param[in]	cube			La cube map, 6 couches dans l'ordre des faces Vulkan (+X, -X, +Y, -Y, +Z, -Z), couleurs linéaires.
+		 *							<br />Seul le premier niveau est utilisé, les formats autres que R32G32B32A32_SFLOAT sont d'abord convertis.
+		 *\param[in]	threadsCount	Le nombre maximal de threads (0 signifie le nombre de coeurs du CPU).
+		 *\return		Les harmoniques sphériques.
+		 */
+		CU_API static SphericalHarmonics fromCube( PxBufferBase const & cube
+			, uint32_t threadsCount = 0u );
+		/**
+		 *\~english
+		 *\param[in]	direction	The normalised direction.
+		 *\return		The radiance reconstructed in the given direction.
+		 *\~french
+		 *\param[in]	direction	La direction normalisée.
+		 *\return		La radiance reconstruite dans la direction donnée.
+		 */
+		CU_API Point3f evaluate( Point3f const & direction )const;
+		/**
+		 *\~english
+		 *\param[in]	normal	The normalised surface normal.
+		 *\return		The irradiance divided by Pi, i.e. the radiance reflected by a white lambertian surface.
+		 *\~french
+		 *\param[in]	normal	La normale normalisée de la surface.
+		 *\return		L'irradiance divisée par Pi, i.e. la radiance réfléchie par une surface lambertienne blanche.
+		 */
+		CU_API Point3f evaluateIrradiance( Point3f const & normal )const;
+		/**
+		 *\~english
+		 *\brief		Fills a cube map with the irradiance (divided by Pi) for each texel direction.
+		 *\param[in]	size			The cube faces size.
+		 *\param[in]	threadsCount	The maximum number of threads (0 means CPU cores count).
+		 *\return		The R32G32B32A32_SFLOAT cube map, 6 layers.
+		 *\~french
+		 *\brief		Remplit une cube map avec l'irradiance (divisée par Pi) pour la direction de chaque texel.
+		 *\param[in]	size			La taille des faces du cube.
+		 *\param[in]	threadsCount	Le nombre maximal de threads (0 signifie le nombre de coeurs du CPU).
+		 *\return		La cube map R32G32B32A32_SFLOAT, 6 couches.
+		 */
+		CU_API PxBufferBaseSPtr toIrradianceCube( uint32_t size
+			, uint32_t threadsCount = 0u )const;
+		/**
+		 *\~english
+		 *\param[in]	face	The cube face index, in Vulkan order.
+		 *\param[in]	u, v	The face coordinates, in [-1, 1].
+		 *\return		The normalised direction of the given point on a cube face.
+		 *\~french
+		 *\param[in]	face	L'indice de la face du cube, dans l'ordre Vulkan.
+		 *\param[in]	u, v	Les coordonnées sur la face, dans [-1, 1].
+		 *\return		La direction normalisée du point donné sur une face du cube.
+		 */
+		CU_API static Point3f getCubeDirection( uint32_t face
+			, float u
+			, float v );
+
+		inline Coefficients const & getCoefficients()const
+		{
+			return m_coefficients;
+		}
+
+	private:
+		Coefficients m_coefficients;
+	};
+}
+
+#endif
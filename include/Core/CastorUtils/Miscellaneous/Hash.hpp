@@ -27,6 +27,26 @@ namespace castor
 		hash = static_cast< std::size_t >( b * kMul );
 		return hash;
 	}
+	/**
+	 *\~english
+	 *\brief		Computes a FNV-1a hash of the given memory, chained with the given one.
+	 *\~french
+	 *\brief		Calcule un hash FNV-1a de la mémoire donnée, chaîné avec celui donné.
+	 */
+	inline uint64_t hashBytes( void const * data
+		, size_t size
+		, uint64_t hash = 0xcbf29ce484222325ULL )
+	{
+		auto bytes = static_cast< uint8_t const * >( data );
+
+		for ( size_t i = 0u; i < size; ++i )
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001b3ULL;
+		}
+
+		return hash;
+	}
 }
 
 #endif
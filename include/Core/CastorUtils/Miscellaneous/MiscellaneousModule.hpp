@@ -54,6 +54,29 @@ namespace castor
 	class PreciseTimer;
 	/**
 	\~english
+	\brief		CPU zones profiler, with per thread ring buffers and Chrome trace export.
+	\remark		Call the macro CU_ProfileScope() at the beginning of a block to record its duration while capturing
+	\~french
+	\brief		Profileur CPU de zones, avec des tampons circulaires par thread et un export en Chrome trace.
+	\remark		Appelez la macro CU_ProfileScope() au début d'un bloc pour enregistrer sa durée pendant la capture
+	*/
+	class Profiler;
+	/**
+	\~english
+	\brief		Records a profiler zone scope.
+	\~french
+	\brief		Enregistre la portée d'une zone du profileur.
+	*/
+	class ProfilerScope;
+	/**
+	\~english
+	\brief		Stable LSD radix sort of indices, by 32 bits keys.
+	\~french
+	\brief		Tri par base LSD stable d'indices, selon des clés 32 bits.
+	*/
+	class RadixSorter;
+	/**
+	\~english
 	\brief 		String functions namespace
 	\~french
 	\brief 		Espace de nom regroupant des fonctions sur les chaînes de caractères
@@ -0,0 +1,254 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_PROFILER_H___
+#define ___CASTOR_PROFILER_H___
+
+#include "CastorUtils/Miscellaneous/MiscellaneousModule.hpp"
+
+#include "CastorUtils/Data/Path.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace castor
+{
+	/**
+	\~english
+	\brief		A profiled zone description, declared as a constant, once per call site.
+	\remarks	Its address identifies the zone, nothing is registered at run time.
+	\~french
+	\brief		La description d'une zone profilée, déclarée comme une constante, une fois par site d'appel.
+	\remarks	Son adresse identifie la zone, rien n'est enregistré à l'exécution.
+	*/
+	struct ProfilerZone
+	{
+		enum class Kind
+		{
+			//!\~english	A timed scope.
+			//!\~french		Une portée chronométrée.
+			eScope,
+			//!\~english	A counter value.
+			//!\~french		La valeur d'un compteur.
+			eCounter,
+			//!\~english	A frame boundary.
+			//!\~french		Une limite de frame.
+			eFrame,
+		};
+
+		char const * name;
+		char const * file;
+		uint32_t line;
+		Kind kind;
+	};
+	/**
+	\~english
+	\brief		The statistics of a zone, over one frame.
+	\~french
+	\brief		Les statistiques d'une zone, sur une frame.
+	*/
+	struct ProfilerZoneSummary
+	{
+		ProfilerZone const * zone;
+		//!\~english	The scopes count, or the counter values count.
+		//!\~french		Le nombre de portées, ou de valeurs du compteur.
+		uint64_t count;
+		//!\~english	The scopes cumulated duration in nanoseconds, or the counter values sum.
+		//!\~french		La durée cumulée des portées en nanosecondes, ou la somme des valeurs du compteur.
+		int64_t total;
+		//!\~english	The longest scope duration in nanoseconds, or the counter maximal value.
+		//!\~french		La durée de la plus longue portée en nanosecondes, ou la valeur maximale du compteur.
+		int64_t max;
+	};
+	using ProfilerFrameSummary = std::vector< ProfilerZoneSummary >;
+
+	class Profiler
+	{
+	public:
+		//!\~english	The default events count kept per thread.
+		//!\~french		Le nombre d'évènements conservés par thread, par défaut.
+		static uint32_t constexpr DefaultThreadCapacity = 64u * 1024u;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Starts recording the zones, sets the trace origin if nothing is recorded.
+		 *\~french
+		 *\brief		Démarre l'enregistrement des zones, définit l'origine de la trace si rien n'est enregistré.
+		 */
+		CU_API static void startCapture();
+		/**
+		 *\~english
+		 *\brief		Stops recording the zones, the recorded events are kept.
+		 *\~french
+		 *\brief		Arrête l'enregistrement des zones, les évènements enregistrés sont conservés.
+		 */
+		CU_API static void stopCapture();
+		/**
+		 *\~english
+		 *\return		\p true if the zones are recorded.
+		 *\~french
+		 *\return		\p true si les zones sont enregistrées.
+		 */
+		CU_API static bool isCapturing()noexcept;
+		/**
+		 *\~english
+		 *\brief		Removes the recorded events, and the buffers of the ended threads.
+		 *\~french
+		 *\brief		Supprime les évènements enregistrés, et les tampons des threads terminés.
+		 */
+		CU_API static void clear();
+		/**
+		 *\~english
+		 *\brief		Sets the events count kept by the threads recording their first event from now on.
+		 *\remarks		Each thread allocates its ring buffer once, the oldest events are then overwritten.
+		 *\param[in]	capacity	The events count.
+		 *\~french
+		 *\brief		Définit le nombre d'évènements conservés par les threads enregistrant leur premier évènement à partir de maintenant.
+		 *\remarks		Chaque thread alloue son tampon circulaire une fois, les évènements les plus anciens sont ensuite écrasés.
+		 *\param[in]	capacity	Le nombre d'évènements.
+		 */
+		CU_API static void setThreadCapacity( uint32_t capacity );
+		/**
+		 *\~english
+		 *\brief		Names the calling thread, in the exported traces.
+		 *\param[in]	name	The thread name.
+		 *\~french
+		 *\brief		Nomme le thread appelant, dans les traces exportées.
+		 *\param[in]	name	Le nom du thread.
+		 */
+		CU_API static void setThreadName( String const & name );
+		/**
+		 *\~english
+		 *\return		The current time, in nanoseconds.
+		 *\~french
+		 *\return		Le temps actuel, en nanosecondes.
+		 */
+		CU_API static uint64_t now()noexcept;
+		/**
+		 *\~english
+		 *\brief		Records a scope, in the calling thread's buffer.
+		 *\param[in]	zone	The zone.
+		 *\param[in]	begin	The scope begin time, in nanoseconds.
+		 *\param[in]	end		The scope end time, in nanoseconds.
+		 *\~french
+		 *\brief		Enregistre une portée, dans le tampon du thread appelant.
+		 *\param[in]	zone	La zone.
+		 *\param[in]	begin	Le temps de début de la portée, en nanosecondes.
+		 *\param[in]	end		Le temps de fin de la portée, en nanosecondes.
+		 */
+		CU_API static void record( ProfilerZone const & zone
+			, uint64_t begin
+			, uint64_t end )noexcept;
+		/**
+		 *\~english
+		 *\brief		Records a counter value, if capturing.
+		 *\param[in]	zone	The counter zone.
+		 *\param[in]	value	The value.
+		 *\~french
+		 *\brief		Enregistre la valeur d'un compteur, si l'enregistrement est actif.
+		 *\param[in]	zone	La zone du compteur.
+		 *\param[in]	value	La valeur.
+		 */
+		CU_API static void count( ProfilerZone const & zone
+			, int64_t value )noexcept;
+		/**
+		 *\~english
+		 *\brief		Marks a frame boundary, if capturing, and summarises the events recorded since the previous one.
+		 *\~french
+		 *\brief		Marque une limite de frame, si l'enregistrement est actif, et résume les évènements enregistrés depuis la précédente.
+		 */
+		CU_API static void nextFrame();
+		/**
+		 *\~english
+		 *\return		The summary of the last frame, sorted by decreasing total.
+		 *\~french
+		 *\return		Le résumé de la dernière frame, trié par total décroissant.
+		 */
+		CU_API static ProfilerFrameSummary getFrameSummary();
+		/**
+		 *\~english
+		 *\brief		Writes the recorded events in Chrome trace event format, readable by Perfetto and chrome://tracing.
+		 *\param[out]	stream	Receives the JSON.
+		 *\~french
+		 *\brief		Ecrit les évènements enregistrés au format Chrome trace event, lisible par Perfetto et chrome://tracing.
+		 *\param[out]	stream	Reçoit le JSON.
+		 */
+		CU_API static void writeChromeTrace( std::ostream & stream );
+		/**
+		 *\~english
+		 *\brief		Writes the recorded events in Chrome trace event format, in a file.
+		 *\param[in]	path	The file path.
+		 *\return		\p false if the file couldn't be written.
+		 *\~french
+		 *\brief		Ecrit les évènements enregistrés au format Chrome trace event, dans un fichier.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\return		\p false si le fichier n'a pas pu être écrit.
+		 */
+		CU_API static bool exportChromeTrace( Path const & path );
+	};
+	/**
+	\~english
+	\brief		Records its lifetime as a zone scope, when the capture is active at its construction.
+	\~french
+	\brief		Enregistre sa durée de vie comme portée d'une zone, lorsque l'enregistrement est actif à sa construction.
+	*/
+	class ProfilerScope
+	{
+	public:
+		ProfilerScope( ProfilerScope const & ) = delete;
+		ProfilerScope & operator=( ProfilerScope const & ) = delete;
+
+		explicit ProfilerScope( ProfilerZone const & zone )noexcept
+			: m_zone{ Profiler::isCapturing() ? &zone : nullptr }
+			, m_begin{ m_zone ? Profiler::now() : 0u }
+		{
+		}
+
+		~ProfilerScope()noexcept
+		{
+			if ( m_zone )
+			{
+				Profiler::record( *m_zone, m_begin, Profiler::now() );
+			}
+		}
+
+	private:
+		ProfilerZone const * m_zone;
+		uint64_t m_begin;
+	};
+}
+
+#define CU_ProfileConcatImpl( x, y ) x##y
+#define CU_ProfileConcat( x, y ) CU_ProfileConcatImpl( x, y )
+
+#if CU_UseProfiler
+//!\~english	Profiles the enclosing scope, under the given name (a string literal).
+//!\~french		Profile la portée englobante, sous le nom donné (un littéral de chaîne).
+#	define CU_ProfileScope( name )\
+	static constexpr castor::ProfilerZone CU_ProfileConcat( cuProfilerZone, __LINE__ ){ name, __FILE__, uint32_t( __LINE__ ), castor::ProfilerZone::Kind::eScope };\
+	castor::ProfilerScope CU_ProfileConcat( cuProfilerScope, __LINE__ ){ CU_ProfileConcat( cuProfilerZone, __LINE__ ) }
+//!\~english	Profiles the enclosing function.
+//!\~french		Profile la fonction englobante.
+#	define CU_ProfileFunction() CU_ProfileScope( __func__ )
+//!\~english	Records a counter value, under the given name (a string literal).
+//!\~french		Enregistre la valeur d'un compteur, sous le nom donné (un littéral de chaîne).
+#	define CU_ProfileCounter( name, value )\
+	static constexpr castor::ProfilerZone CU_ProfileConcat( cuProfilerCounter, __LINE__ ){ name, __FILE__, uint32_t( __LINE__ ), castor::ProfilerZone::Kind::eCounter };\
+	castor::Profiler::count( CU_ProfileConcat( cuProfilerCounter, __LINE__ ), int64_t( value ) )
+//!\~english	Marks a frame boundary.
+//!\~french		Marque une limite de frame.
+#	define CU_ProfileFrame() castor::Profiler::nextFrame()
+//!\~english	Names the calling thread.
+//!\~french		Nomme le thread appelant.
+#	define CU_ProfileThread( name ) castor::Profiler::setThreadName( name )
+#else
+#	define CU_ProfileScope( name )
+#	define CU_ProfileFunction()
+#	define CU_ProfileCounter( name, value )
+#	define CU_ProfileFrame()
+#	define CU_ProfileThread( name )
+#endif
+
+#endif
@@ -0,0 +1,92 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_RadixSort_H___
+#define ___CU_RadixSort_H___
+
+#include "CastorUtils/Miscellaneous/MiscellaneousModule.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace castor
+{
+	/**
+	 *\~english
+	 *\brief		Converts a float to an unsigned key, which preserves the floats order.
+	 *\param[in]	value	The float value.
+	 *\return		The key.
+	 *\~french
+	 *\brief		Convertit un float en une clé non signée, qui préserve l'ordre des floats.
+	 *\param[in]	value	La valeur flottante.
+	 *\return		La clé.
+	 */
+	inline uint32_t floatToRadixKey( float value )
+	{
+		uint32_t bits;
+		std::memcpy( &bits, &value, sizeof( bits ) );
+		// Negative values have all their bits flipped, positive ones only their sign bit.
+		return bits ^ ( ( bits & 0x80000000u ) ? 0xFFFFFFFFu : 0x80000000u );
+	}
+
+	class RadixSorter
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	threadsCount	The maximum number of threads used by a sort (0 means CPU cores count).
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	threadsCount	Le nombre maximal de threads utilisés par un tri (0 signifie le nombre de coeurs du CPU).
+		 */
+		CU_API explicit RadixSorter( uint32_t threadsCount = 0u );
+		/**
+		 *\~english
+		 *\brief		Sorts the given indices, by ascending keys.
+		 *\remarks		The sort is stable, the passes are dispatched to several threads for big arrays.
+		 *\param[in]		keys	The keys, indexed by the values of \p indices.
+		 *\param[in,out]	indices	The indices to sort.
+		 *\param[in]		count	The indices count.
+		 *\~french
+		 *\brief		Trie les indices donnés, par clés croissantes.
+		 *\remarks		Le tri est stable, les passes sont réparties sur plusieurs threads pour les grands tableaux.
+		 *\param[in]		keys	Les clés, indexées par les valeurs de \p indices.
+		 *\param[in,out]	indices	Les indices à trier.
+		 *\param[in]		count	Le nombre d'indices.
+		 */
+		CU_API void sort( uint32_t const * keys
+			, uint32_t * indices
+			, uint32_t count );
+		/**
+		 *\~english
+		 *\brief		Sorts the given indices, by ascending keys, expecting them to be almost sorted already.
+		 *\remarks		An insertion sort is tried first, and the radix sort is used if it moves too many elements.
+		 *\param[in]		keys	The keys, indexed by the values of \p indices.
+		 *\param[in,out]	indices	The indices to sort, usually in the previous sort order.
+		 *\param[in]		count	The indices count.
+		 *\return		\p true if the insertion sort was enough.
+		 *\~french
+		 *\brief		Trie les indices donnés, par clés croissantes, en s'attendant à ce qu'ils soient déjà presque triés.
+		 *\remarks		Un tri par insertion est d'abord tenté, et le tri par base est utilisé s'il déplace trop d'éléments.
+		 *\param[in]		keys	Les clés, indexées par les valeurs de \p indices.
+		 *\param[in,out]	indices	Les indices à trier, généralement dans l'ordre du tri précédent.
+		 *\param[in]		count	Le nombre d'indices.
+		 *\return		\p true si le tri par insertion a suffi.
+		 */
+		CU_API bool sortCoherent( uint32_t const * keys
+			, uint32_t * indices
+			, uint32_t count );
+
+	private:
+		uint32_t doGetThreadsCount( uint32_t count )const;
+
+	private:
+		uint32_t m_threadsCount;
+		std::vector< uint64_t > m_items;
+		std::vector< uint64_t > m_scratch;
+		std::vector< uint32_t > m_histograms;
+	};
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_ParallelFor_H___
+#define ___CU_ParallelFor_H___
+
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
+
+#include <functional>
+
+namespace castor
+{
+	/**
+	 *\~english
+	 *\brief		The function processing a part of a parallelFor range.
+	 *\param[in]	part	The part index.
+	 *\param[in]	begin	The first index of the part.
+	 *\param[in]	end		The index after the last one of the part.
+	 *\~french
+	 *\brief		La fonction traitant une partie d'un intervalle de parallelFor.
+	 *\param[in]	part	L'indice de la partie.
+	 *\param[in]	begin	Le premier indice de la partie.
+	 *\param[in]	end		L'indice suivant le dernier de la partie.
+	 */
+	using ParallelForFunc = std::function< void( uint32_t part, size_t begin, size_t end ) >;
+	/**
+	 *\~english
+	 *\brief		Retrieves the hardware threads count, computed once.
+	 *\~french
+	 *\brief		Récupère le nombre de threads matériels, calculé une seule fois.
+	 */
+	CU_API uint32_t getParallelThreadsCount();
+	/**
+	 *\~english
+	 *\brief		Splits [0, count) in contiguous parts, and processes them on the shared worker threads and on the calling thread.
+	 *\remarks		The function is called once per part, the last parts may be empty.
+	 *\n			Returns once all the parts are processed, rethrowing the first exception thrown by a part.
+	 *\n			The worker threads are created at first use, and live until the program ends.
+	 *\param[in]	count		The range size.
+	 *\param[in]	partsCount	The parts count, 0 for getParallelThreadsCount().
+	 *\param[in]	func		The function processing a part.
+	 *\~french
+	 *\brief		Découpe [0, count) en parties contiguës, et les traite sur les threads de travail partagés et sur le thread appelant.
+	 *\remarks		La fonction est appelée une fois par partie, les dernières parties peuvent être vides.
+	 *\n			Retourne une fois toutes les parties traitées, en relançant la première exception lancée par une partie.
+	 *\n			Les threads de travail sont créés à la première utilisation, et vivent jusqu'à la fin du programme.
+	 *\param[in]	count		La taille de l'intervalle.
+	 *\param[in]	partsCount	Le nombre de parties, 0 pour getParallelThreadsCount().
+	 *\param[in]	func		La fonction traitant une partie.
+	 */
+	CU_API void parallelFor( size_t count
+		, uint32_t partsCount
+		, ParallelForFunc const & func );
+}
+
+#endif
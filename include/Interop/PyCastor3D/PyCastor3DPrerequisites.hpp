@@ -826,5 +826,6 @@ namespace cpy
 
 extern void ExportCastorUtils();
 extern void ExportCastor3D();
+extern void ExportCastor3DBulk();
 
 #endif
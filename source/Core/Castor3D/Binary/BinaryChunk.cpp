@@ -4,6 +4,7 @@
 
 #include <CastorUtils/Data/BinaryFile.hpp>
 
+#include <cstring>
 #include <numeric>
 
 using namespace castor;
@@ -151,6 +152,30 @@ namespace castor3d
 		return result;
 	}
 
+	bool BinaryChunk::read( castor::ByteArray const & data )
+	{
+		uint32_t size = 0;
+		size_t offset = sizeof( ChunkType ) + sizeof( uint32_t );
+		bool result = data.size() >= offset;
+
+		if ( result )
+		{
+			std::memcpy( &m_type, data.data(), sizeof( ChunkType ) );
+			bigEndianToSystemEndian( m_type );
+			std::memcpy( &size, data.data() + sizeof( ChunkType ), sizeof( uint32_t ) );
+			bigEndianToSystemEndian( size );
+			result = data.size() - offset >= size;
+		}
+
+		if ( result )
+		{
+			m_data.assign( data.begin() + ptrdiff_t( offset )
+				, data.begin() + ptrdiff_t( offset + size ) );
+		}
+
+		return result;
+	}
+
 	void BinaryChunk::binaryError( std::string_view view )
 	{
 		log::error << view;
@@ -0,0 +1,903 @@
+#include "Castor3D/Binary/BinaryScene.hpp"
+
+#include "Castor3D/Engine.hpp"
+#include "Castor3D/Binary/CmshImporter.hpp"
+#include "Castor3D/Cache/GeometryCache.hpp"
+#include "Castor3D/Cache/LightCache.hpp"
+#include "Castor3D/Cache/MaterialCache.hpp"
+#include "Castor3D/Cache/MeshCache.hpp"
+#include "Castor3D/Cache/SceneNodeCache.hpp"
+#include "Castor3D/Material/Material.hpp"
+#include "Castor3D/Miscellaneous/Parameter.hpp"
+#include "Castor3D/Model/Mesh/Mesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Render/GlobalIllumination/LightPropagationVolumes/LpvConfig.hpp"
+#include "Castor3D/Render/Technique/Opaque/ReflectiveShadowMapGI/RsmConfig.hpp"
+#include "Castor3D/Scene/Geometry.hpp"
+#include "Castor3D/Scene/Scene.hpp"
+#include "Castor3D/Scene/SceneNode.hpp"
+#include "Castor3D/Scene/Light/Light.hpp"
+#include "Castor3D/Scene/Light/PointLight.hpp"
+#include "Castor3D/Scene/Light/SpotLight.hpp"
+
+#include <unordered_map>
+
+using namespace castor;
+
+namespace castor3d
+{
+	namespace
+	{
+		static uint32_t constexpr NoIndex = ~0u;
+		// The node isn't created by the file, it is looked up by name (root nodes, camera nodes...).
+		static uint32_t constexpr NodeExternal = 0x01u;
+		static uint32_t constexpr GeometryShadowCaster = 0x01u;
+		static uint32_t constexpr GeometryShadowReceiver = 0x02u;
+		static uint32_t constexpr GeometryOccluder = 0x04u;
+		static uint32_t constexpr LightShadowProducer = 0x01u;
+
+		// All the records only hold 32 bits values, so they don't have any padding.
+		struct NodeRecord
+		{
+			uint32_t name;
+			// Index in the nodes table, parents always come before their children.
+			uint32_t parent;
+			uint32_t flags;
+			float position[3];
+			float orientation[4];
+			float scale[3];
+		};
+
+		struct MeshRecord
+		{
+			uint32_t name;
+			uint32_t path;
+			// Range in the submesh materials table, for the default materials.
+			uint32_t firstMaterial;
+			uint32_t materialsCount;
+		};
+
+		struct GeometryRecord
+		{
+			uint32_t name;
+			uint32_t node;
+			uint32_t mesh;
+			// Range in the submesh materials table, NoIndex entries use the submesh default material.
+			uint32_t firstMaterial;
+			uint32_t materialsCount;
+			uint32_t flags;
+		};
+
+		struct LightRecord
+		{
+			uint32_t name;
+			uint32_t node;
+			uint32_t type;
+			uint32_t shadowType;
+			uint32_t globalIllumination;
+			uint32_t flags;
+			uint32_t volumetricSteps;
+			uint32_t rsmSampleCount;
+			float colour[3];
+			float intensity[2];
+			float attenuation[3];
+			float exponent;
+			float cutOff;
+			float volumetricScattering;
+			float shadowOffsets[2];
+			float shadowVariance[2];
+			float rsmIntensity;
+			float rsmMaxRadius;
+			float lpvIndirectAttenuation;
+			float lpvTexelAreaModifier;
+		};
+
+		struct SceneTables
+		{
+			StringArray strings;
+			std::vector< NodeRecord > nodes;
+			std::vector< MeshRecord > meshes;
+			std::vector< uint32_t > submeshMaterials;
+			std::vector< GeometryRecord > geometries;
+			std::vector< LightRecord > lights;
+		};
+
+		template< typename T, size_t Count >
+		void switchArrayEndianness( T( &values )[Count] )
+		{
+			for ( auto & value : values )
+			{
+				castor::switchEndianness( value );
+			}
+		}
+
+		void prepareChunkData( NodeRecord & value )
+		{
+			if ( !castor::isBigEndian() )
+			{
+				castor::switchEndianness( value.name );
+				castor::switchEndianness( value.parent );
+				castor::switchEndianness( value.flags );
+				switchArrayEndianness( value.position );
+				switchArrayEndianness( value.orientation );
+				switchArrayEndianness( value.scale );
+			}
+		}
+
+		void prepareChunkData( MeshRecord & value )
+		{
+			if ( !castor::isBigEndian() )
+			{
+				castor::switchEndianness( value.name );
+				castor::switchEndianness( value.path );
+				castor::switchEndianness( value.firstMaterial );
+				castor::switchEndianness( value.materialsCount );
+			}
+		}
+
+		void prepareChunkData( GeometryRecord & value )
+		{
+			if ( !castor::isBigEndian() )
+			{
+				castor::switchEndianness( value.name );
+				castor::switchEndianness( value.node );
+				castor::switchEndianness( value.mesh );
+				castor::switchEndianness( value.firstMaterial );
+				castor::switchEndianness( value.materialsCount );
+				castor::switchEndianness( value.flags );
+			}
+		}
+
+		void prepareChunkData( LightRecord & value )
+		{
+			if ( !castor::isBigEndian() )
+			{
+				castor::switchEndianness( value.name );
+				castor::switchEndianness( value.node );
+				castor::switchEndianness( value.type );
+				castor::switchEndianness( value.shadowType );
+				castor::switchEndianness( value.globalIllumination );
+				castor::switchEndianness( value.flags );
+				castor::switchEndianness( value.volumetricSteps );
+				castor::switchEndianness( value.rsmSampleCount );
+				switchArrayEndianness( value.colour );
+				switchArrayEndianness( value.intensity );
+				switchArrayEndianness( value.attenuation );
+				castor::switchEndianness( value.exponent );
+				castor::switchEndianness( value.cutOff );
+				castor::switchEndianness( value.volumetricScattering );
+				switchArrayEndianness( value.shadowOffsets );
+				switchArrayEndianness( value.shadowVariance );
+				castor::switchEndianness( value.rsmIntensity );
+				castor::switchEndianness( value.rsmMaxRadius );
+				castor::switchEndianness( value.lpvIndirectAttenuation );
+				castor::switchEndianness( value.lpvTexelAreaModifier );
+			}
+		}
+
+		//*********************************************************************************************
+
+		class SceneTablesBuilder
+		{
+		public:
+			explicit SceneTablesBuilder( Scene const & scene )
+				: m_scene{ scene }
+			{
+			}
+
+			void addNodes()
+			{
+				for ( auto const & it : m_scene.getObjectRootNode()->getChildren() )
+				{
+					auto node = it.second.lock();
+
+					if ( node )
+					{
+						doAddNode( *node, NoIndex );
+					}
+				}
+			}
+
+			void addMeshes()
+			{
+				using LockType = std::unique_lock< MeshCache const >;
+				LockType lock{ castor::makeUniqueLock( m_scene.getMeshCache() ) };
+
+				for ( auto const & it : m_scene.getMeshCache() )
+				{
+					auto & mesh = *it.second;
+
+					if ( mesh.isSerialisable() )
+					{
+						m_meshes.emplace( &mesh, uint32_t( m_tables.meshes.size() ) );
+						MeshRecord record{ doAddString( mesh.getName() )
+							, doAddString( cuT( "Meshes/" ) + mesh.getName() + cuT( ".cmsh" ) )
+							, uint32_t( m_tables.submeshMaterials.size() )
+							, mesh.getSubmeshCount() };
+
+						for ( auto & submesh : mesh )
+						{
+							auto material = submesh->getDefaultMaterial();
+							m_tables.submeshMaterials.push_back( material
+								? doAddString( material->getName() )
+								: NoIndex );
+						}
+
+						m_tables.meshes.push_back( record );
+					}
+				}
+			}
+
+			void addGeometries()
+			{
+				using LockType = std::unique_lock< GeometryCache const >;
+				LockType lock{ castor::makeUniqueLock( m_scene.getGeometryCache() ) };
+
+				for ( auto const & it : m_scene.getGeometryCache() )
+				{
+					auto & geometry = *it.second;
+					auto mesh = geometry.getMesh();
+					auto meshIt = mesh
+						? m_meshes.find( mesh.get() )
+						: m_meshes.end();
+
+					if ( meshIt != m_meshes.end() )
+					{
+						GeometryRecord record{ doAddString( geometry.getName() )
+							, doGetNodeIndex( geometry.getParent() )
+							, meshIt->second
+							, uint32_t( m_tables.submeshMaterials.size() )
+							, mesh->getSubmeshCount()
+							, ( geometry.isShadowCaster() ? GeometryShadowCaster : 0u )
+								| ( geometry.isShadowReceiver() ? GeometryShadowReceiver : 0u )
+								| ( geometry.isOccluder() ? GeometryOccluder : 0u ) };
+
+						for ( auto & submesh : *mesh )
+						{
+							auto material = geometry.getMaterial( *submesh );
+							m_tables.submeshMaterials.push_back( ( material && material != submesh->getDefaultMaterial() )
+								? doAddString( material->getName() )
+								: NoIndex );
+						}
+
+						m_tables.geometries.push_back( record );
+					}
+				}
+			}
+
+			void addLights()
+			{
+				using LockType = std::unique_lock< LightCache const >;
+				LockType lock{ castor::makeUniqueLock( m_scene.getLightCache() ) };
+
+				for ( auto const & it : m_scene.getLightCache() )
+				{
+					auto & light = *it.second;
+					auto & category = *light.getCategory();
+					LightRecord record{};
+					record.name = doAddString( light.getName() );
+					record.node = doGetNodeIndex( light.getParent() );
+					record.type = uint32_t( light.getLightType() );
+					record.shadowType = uint32_t( light.getShadowType() );
+					record.globalIllumination = uint32_t( light.getGlobalIlluminationType() );
+					record.flags = light.isShadowProducer() ? LightShadowProducer : 0u;
+					record.volumetricSteps = light.getVolumetricSteps();
+					record.rsmSampleCount = light.getRsmConfig().sampleCount.value().value();
+					doCopy( light.getColour(), record.colour );
+					doCopy( light.getIntensity(), record.intensity );
+					record.volumetricScattering = light.getVolumetricScatteringFactor();
+					doCopy( category.getShadowOffsets(), record.shadowOffsets );
+					doCopy( category.getShadowVariance(), record.shadowVariance );
+					record.rsmIntensity = light.getRsmConfig().intensity.value();
+					record.rsmMaxRadius = light.getRsmConfig().maxRadius.value();
+					record.lpvIndirectAttenuation = light.getLpvConfig().indirectAttenuation.value();
+					record.lpvTexelAreaModifier = light.getLpvConfig().texelAreaModifier.value();
+
+					switch ( light.getLightType() )
+					{
+					case LightType::ePoint:
+						doCopy( light.getPointLight()->getAttenuation(), record.attenuation );
+						break;
+
+					case LightType::eSpot:
+						doCopy( light.getSpotLight()->getAttenuation(), record.attenuation );
+						record.exponent = light.getSpotLight()->getExponent();
+						record.cutOff = light.getSpotLight()->getCutOff().degrees();
+						break;
+
+					default:
+						break;
+					}
+
+					m_tables.lights.push_back( record );
+				}
+			}
+
+			SceneTables const & getTables()
+			{
+				return m_tables;
+			}
+
+		private:
+			template< typename PointT, size_t Count >
+			void doCopy( PointT const & src
+				, float( &dst )[Count] )
+			{
+				for ( size_t i = 0u; i < Count; ++i )
+				{
+					dst[i] = src[i];
+				}
+			}
+
+			uint32_t doAddString( String const & value )
+			{
+				auto ires = m_strings.emplace( value, uint32_t( m_tables.strings.size() ) );
+
+				if ( ires.second )
+				{
+					m_tables.strings.push_back( value );
+				}
+
+				return ires.first->second;
+			}
+
+			void doAddNode( SceneNode const & node
+				, uint32_t parent )
+			{
+				auto index = uint32_t( m_tables.nodes.size() );
+				m_nodes.emplace( &node, index );
+				NodeRecord record{ doAddString( node.getName() ), parent, 0u };
+				doCopy( node.getPosition(), record.position );
+				doCopy( node.getOrientation(), record.orientation );
+				doCopy( node.getScale(), record.scale );
+				m_tables.nodes.push_back( record );
+
+				for ( auto const & it : node.getChildren() )
+				{
+					auto child = it.second.lock();
+
+					if ( child )
+					{
+						doAddNode( *child, index );
+					}
+				}
+			}
+
+			uint32_t doGetNodeIndex( SceneNode const * node )
+			{
+				if ( !node )
+				{
+					return NoIndex;
+				}
+
+				auto it = m_nodes.find( node );
+
+				if ( it == m_nodes.end() )
+				{
+					// Node outside of the objects hierarchy, looked up by name at load time.
+					it = m_nodes.emplace( node, uint32_t( m_tables.nodes.size() ) ).first;
+					NodeRecord record{ doAddString( node->getName() ), NoIndex, NodeExternal };
+					m_tables.nodes.push_back( record );
+				}
+
+				return it->second;
+			}
+
+		private:
+			Scene const & m_scene;
+			SceneTables m_tables;
+			std::unordered_map< String, uint32_t > m_strings;
+			std::unordered_map< SceneNode const *, uint32_t > m_nodes;
+			std::unordered_map< Mesh const *, uint32_t > m_meshes;
+		};
+
+		//*********************************************************************************************
+
+		std::vector< uint8_t > joinStrings( StringArray const & strings )
+		{
+			std::vector< uint8_t > result;
+
+			for ( auto & value : strings )
+			{
+				auto svalue = string::stringCast< char >( value );
+				result.insert( result.end(), svalue.begin(), svalue.end() );
+				result.push_back( 0u );
+			}
+
+			return result;
+		}
+
+		StringArray splitStrings( std::vector< uint8_t > const & pool )
+		{
+			StringArray result;
+			auto begin = pool.begin();
+
+			while ( begin != pool.end() )
+			{
+				auto end = std::find( begin, pool.end(), uint8_t( 0u ) );
+				result.push_back( string::stringCast< xchar >( std::string{ begin, end } ) );
+				begin = ( end == pool.end() )
+					? end
+					: end + 1;
+			}
+
+			return result;
+		}
+
+		template< typename T >
+		bool parseTable( std::vector< T > & values
+			, BinaryChunk & chunk )
+		{
+			if ( chunk.getDataSize() % sizeof( T ) )
+			{
+				return false;
+			}
+
+			values.resize( chunk.getDataSize() / sizeof( T ) );
+			return values.empty()
+				|| ChunkParser< T >::parse( values.data(), values.size(), chunk );
+		}
+
+		//*********************************************************************************************
+
+		class SceneTablesLoader
+		{
+		public:
+			SceneTablesLoader( SceneTables const & tables
+				, Scene & scene
+				, Path const & folder )
+				: m_tables{ tables }
+				, m_scene{ scene }
+				, m_folder{ folder }
+				, m_materials( tables.strings.size() )
+			{
+			}
+
+			bool loadNodes()
+			{
+				auto & cache = m_scene.getSceneNodeCache();
+				m_nodes.reserve( m_tables.nodes.size() );
+
+				for ( auto & record : m_tables.nodes )
+				{
+					if ( !doCheckString( record.name ) )
+					{
+						return false;
+					}
+
+					auto & name = m_tables.strings[record.name];
+					SceneNodeSPtr node;
+
+					if ( record.flags & NodeExternal )
+					{
+						node = doFindNode( name );
+					}
+					else
+					{
+						auto parent = doGetNode( record.parent );
+
+						if ( !parent )
+						{
+							log::error << cuT( "BinaryScene: Invalid parent for node " ) << name << std::endl;
+							return false;
+						}
+
+						node = cache.add( name, *parent );
+						node->setPosition( Point3f{ record.position[0], record.position[1], record.position[2] } );
+						node->setOrientation( Quaternion{ record.orientation } );
+						node->setScale( Point3f{ record.scale[0], record.scale[1], record.scale[2] } );
+					}
+
+					// Null external nodes are reported when used.
+					m_nodes.push_back( node );
+				}
+
+				return true;
+			}
+
+			bool loadMeshes()
+			{
+				auto & cache = m_scene.getMeshCache();
+				CmshImporter importer{ *m_scene.getEngine() };
+				m_meshes.reserve( m_tables.meshes.size() );
+
+				for ( auto & record : m_tables.meshes )
+				{
+					if ( !doCheckString( record.name )
+						|| !doCheckString( record.path )
+						|| !doCheckMaterials( record.firstMaterial, record.materialsCount ) )
+					{
+						return false;
+					}
+
+					auto & name = m_tables.strings[record.name];
+					MeshSPtr mesh;
+
+					if ( cache.has( name ) )
+					{
+						mesh = cache.find( name );
+					}
+					else
+					{
+						mesh = cache.add( name );
+
+						if ( !importer.import( *mesh
+							, m_folder / m_tables.strings[record.path]
+							, Parameters{}
+							, true ) )
+						{
+							log::error << cuT( "BinaryScene: Couldn't import mesh " ) << name << std::endl;
+							cache.remove( name );
+							mesh.reset();
+						}
+					}
+
+					if ( mesh )
+					{
+						auto count = std::min( record.materialsCount, mesh->getSubmeshCount() );
+
+						for ( uint32_t i = 0u; i < count; ++i )
+						{
+							if ( auto material = doGetMaterial( m_tables.submeshMaterials[record.firstMaterial + i] ) )
+							{
+								mesh->getSubmesh( i )->setDefaultMaterial( material );
+							}
+						}
+					}
+
+					// Geometries using a mesh that failed to load are skipped.
+					m_meshes.push_back( mesh );
+				}
+
+				return true;
+			}
+
+			bool loadGeometries()
+			{
+				auto & cache = m_scene.getGeometryCache();
+
+				for ( auto & record : m_tables.geometries )
+				{
+					if ( !doCheckString( record.name )
+						|| record.mesh >= m_meshes.size()
+						|| !doCheckMaterials( record.firstMaterial, record.materialsCount ) )
+					{
+						log::error << cuT( "BinaryScene: Invalid geometry record." ) << std::endl;
+						return false;
+					}
+
+					auto & name = m_tables.strings[record.name];
+					auto node = doGetNode( record.node );
+					auto mesh = m_meshes[record.mesh];
+
+					if ( !node || !mesh )
+					{
+						log::warn << cuT( "BinaryScene: Skipping geometry " ) << name << cuT( ", its node or mesh is missing." ) << std::endl;
+						continue;
+					}
+
+					auto geometry = std::make_shared< Geometry >( name
+						, m_scene
+						, nullptr );
+					node->attachObject( *geometry );
+					geometry->setMesh( mesh );
+					auto count = std::min( record.materialsCount, mesh->getSubmeshCount() );
+
+					for ( uint32_t i = 0u; i < count; ++i )
+					{
+						if ( auto material = doGetMaterial( m_tables.submeshMaterials[record.firstMaterial + i] ) )
+						{
+							geometry->setMaterial( *mesh->getSubmesh( i ), material );
+						}
+					}
+
+					geometry->setShadowCaster( ( record.flags & GeometryShadowCaster ) != 0u );
+					geometry->setShadowReceiver( ( record.flags & GeometryShadowReceiver ) != 0u );
+					geometry->setOccluder( ( record.flags & GeometryOccluder ) != 0u );
+					cache.add( geometry );
+				}
+
+				return true;
+			}
+
+			bool loadLights()
+			{
+				auto & cache = m_scene.getLightCache();
+
+				for ( auto & record : m_tables.lights )
+				{
+					if ( !doCheckString( record.name )
+						|| record.type > uint32_t( LightType::eMax )
+						|| record.shadowType > uint32_t( ShadowType::eMax )
+						|| record.globalIllumination > uint32_t( GlobalIlluminationType::eMax ) )
+					{
+						log::error << cuT( "BinaryScene: Invalid light record." ) << std::endl;
+						return false;
+					}
+
+					auto & name = m_tables.strings[record.name];
+					auto node = doGetNode( record.node );
+
+					if ( !node )
+					{
+						log::warn << cuT( "BinaryScene: Skipping light " ) << name << cuT( ", its node is missing." ) << std::endl;
+						continue;
+					}
+
+					auto light = cache.add( name, *node, LightType( record.type ) );
+					light->setColour( Point3f{ record.colour[0], record.colour[1], record.colour[2] } );
+					light->setIntensity( record.intensity[0], record.intensity[1] );
+					light->setShadowProducer( ( record.flags & LightShadowProducer ) != 0u );
+					light->setShadowType( ShadowType( record.shadowType ) );
+					light->setGlobalIlluminationType( GlobalIlluminationType( record.globalIllumination ) );
+					light->setVolumetricSteps( record.volumetricSteps );
+					light->setVolumetricScatteringFactor( record.volumetricScattering );
+					light->setShadowMinOffset( record.shadowOffsets[0] );
+					light->setShadowMaxSlopeOffset( record.shadowOffsets[1] );
+					light->setShadowMaxVariance( record.shadowVariance[0] );
+					light->setShadowVarianceBias( record.shadowVariance[1] );
+					light->getRsmConfig().intensity = record.rsmIntensity;
+					light->getRsmConfig().maxRadius = record.rsmMaxRadius;
+					auto range = light->getRsmConfig().sampleCount.value();
+					range = record.rsmSampleCount;
+					light->getRsmConfig().sampleCount = range;
+					light->getLpvConfig().indirectAttenuation = record.lpvIndirectAttenuation;
+					light->getLpvConfig().texelAreaModifier = record.lpvTexelAreaModifier;
+					Point3f attenuation{ record.attenuation[0], record.attenuation[1], record.attenuation[2] };
+
+					switch ( light->getLightType() )
+					{
+					case LightType::ePoint:
+						light->getPointLight()->setAttenuation( attenuation );
+						break;
+
+					case LightType::eSpot:
+						light->getSpotLight()->setAttenuation( attenuation );
+						light->getSpotLight()->setExponent( record.exponent );
+						light->getSpotLight()->setCutOff( Angle::fromDegrees( record.cutOff ) );
+						break;
+
+					default:
+						break;
+					}
+				}
+
+				return true;
+			}
+
+		private:
+			bool doCheckString( uint32_t index )const
+			{
+				bool result = index < m_tables.strings.size();
+
+				if ( !result )
+				{
+					log::error << cuT( "BinaryScene: Invalid string index " ) << index << std::endl;
+				}
+
+				return result;
+			}
+
+			bool doCheckMaterials( uint32_t first
+				, uint32_t count )const
+			{
+				bool result = uint64_t( first ) + count <= m_tables.submeshMaterials.size();
+
+				if ( !result )
+				{
+					log::error << cuT( "BinaryScene: Invalid submesh materials range." ) << std::endl;
+				}
+
+				return result;
+			}
+
+			SceneNodeSPtr doFindNode( String const & name )const
+			{
+				if ( name == Scene::ObjectRootNode )
+				{
+					return m_scene.getObjectRootNode();
+				}
+
+				if ( name == Scene::CameraRootNode )
+				{
+					return m_scene.getCameraRootNode();
+				}
+
+				if ( name == Scene::RootNode )
+				{
+					return m_scene.getRootNode();
+				}
+
+				return m_scene.getSceneNodeCache().find( name );
+			}
+
+			SceneNodeSPtr doGetNode( uint32_t index )const
+			{
+				if ( index == NoIndex )
+				{
+					return m_scene.getObjectRootNode();
+				}
+
+				return index < m_nodes.size()
+					? m_nodes[index]
+					: nullptr;
+			}
+
+			MaterialSPtr doGetMaterial( uint32_t index )
+			{
+				if ( index == NoIndex
+					|| !doCheckString( index ) )
+				{
+					return nullptr;
+				}
+
+				auto & result = m_materials[index];
+
+				if ( !result )
+				{
+					auto & cache = m_scene.getEngine()->getMaterialCache();
+					auto & name = m_tables.strings[index];
+
+					if ( cache.has( name ) )
+					{
+						result = cache.find( name );
+					}
+					else
+					{
+						log::warn << cuT( "BinaryScene: Material " ) << name << cuT( " does not exist" ) << std::endl;
+					}
+				}
+
+				return result;
+			}
+
+		private:
+			SceneTables const & m_tables;
+			Scene & m_scene;
+			Path const & m_folder;
+			std::vector< SceneNodeSPtr > m_nodes;
+			std::vector< MeshSPtr > m_meshes;
+			// Indexed by string index, to look each material up only once.
+			std::vector< MaterialSPtr > m_materials;
+		};
+	}
+
+	//*************************************************************************************************
+
+	bool BinaryWriter< Scene >::doWrite( Scene const & obj )
+	{
+		SceneTablesBuilder builder{ obj };
+		builder.addNodes();
+		builder.addMeshes();
+		builder.addGeometries();
+		builder.addLights();
+		auto & tables = builder.getTables();
+		bool result = doWriteChunk( CurrentSceneBinaryVersion, ChunkType::eSceneVersion, m_chunk );
+
+		if ( result )
+		{
+			result = doWriteChunk( joinStrings( tables.strings ), ChunkType::eSceneStrings, m_chunk );
+		}
+
+		if ( result && !tables.nodes.empty() )
+		{
+			result = doWriteChunk( tables.nodes, ChunkType::eSceneNodes, m_chunk );
+		}
+
+		if ( result && !tables.meshes.empty() )
+		{
+			result = doWriteChunk( tables.meshes, ChunkType::eSceneMeshes, m_chunk );
+		}
+
+		if ( result && !tables.submeshMaterials.empty() )
+		{
+			result = doWriteChunk( tables.submeshMaterials, ChunkType::eSceneSubmeshMaterials, m_chunk );
+		}
+
+		if ( result && !tables.geometries.empty() )
+		{
+			result = doWriteChunk( tables.geometries, ChunkType::eSceneGeometries, m_chunk );
+		}
+
+		if ( result && !tables.lights.empty() )
+		{
+			result = doWriteChunk( tables.lights, ChunkType::eSceneLights, m_chunk );
+		}
+
+		return result;
+	}
+
+	//*************************************************************************************************
+
+	template<>
+	castor::String BinaryParserBase< Scene >::Name = cuT( "Scene" );
+
+	bool BinaryParser< Scene >::doParse( Scene & obj )
+	{
+		bool result = true;
+		uint32_t version{ 0u };
+		std::vector< uint8_t > strings;
+		SceneTables tables;
+		BinaryChunk chunk;
+
+		while ( result && doGetSubChunk( chunk ) )
+		{
+			switch ( chunk.getChunkType() )
+			{
+			case ChunkType::eSceneVersion:
+				result = doParseChunk( version, chunk );
+				checkError( result, "Couldn't parse scene version." );
+
+				if ( result
+					&& getCmshMajor( version ) > getCmshMajor( CurrentSceneBinaryVersion ) )
+				{
+					result = false;
+					checkError( result, "Unsupported scene version." );
+				}
+
+				break;
+
+			case ChunkType::eSceneStrings:
+				result = parseTable( strings, chunk );
+				checkError( result, "Couldn't parse strings." );
+
+				if ( result )
+				{
+					tables.strings = splitStrings( strings );
+				}
+
+				break;
+
+			case ChunkType::eSceneNodes:
+				result = parseTable( tables.nodes, chunk );
+				checkError( result, "Couldn't parse nodes." );
+				break;
+
+			case ChunkType::eSceneMeshes:
+				result = parseTable( tables.meshes, chunk );
+				checkError( result, "Couldn't parse meshes." );
+				break;
+
+			case ChunkType::eSceneSubmeshMaterials:
+				result = parseTable( tables.submeshMaterials, chunk );
+				checkError( result, "Couldn't parse submesh materials." );
+				break;
+
+			case ChunkType::eSceneGeometries:
+				result = parseTable( tables.geometries, chunk );
+				checkError( result, "Couldn't parse geometries." );
+				break;
+
+			case ChunkType::eSceneLights:
+				result = parseTable( tables.lights, chunk );
+				checkError( result, "Couldn't parse lights." );
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		if ( result && !version )
+		{
+			result = false;
+			checkError( result, "Missing scene version." );
+		}
+
+		if ( result )
+		{
+			// Tables reference each other, so they are only loaded once they all have been read.
+			SceneTablesLoader loader{ tables, obj, m_folder };
+			result = loader.loadNodes();
+			checkError( result, "Couldn't load nodes." );
+			result = result && loader.loadMeshes();
+			checkError( result, "Couldn't load meshes." );
+			result = result && loader.loadGeometries();
+			checkError( result, "Couldn't load geometries." );
+			result = result && loader.loadLights();
+			checkError( result, "Couldn't load lights." );
+		}
+
+		return result;
+	}
+}
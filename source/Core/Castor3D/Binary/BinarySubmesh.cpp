@@ -112,6 +112,38 @@ namespace castor3d
 			}
 		}
 
+		for ( auto & lod : obj.getLods() )
+		{
+			if ( result )
+			{
+				result = doWriteChunk( lod.error, ChunkType::eSubmeshLodError, m_chunk );
+			}
+
+			if ( result )
+			{
+				result = doWriteChunk( lod.indexCount, ChunkType::eSubmeshLodIndexCount, m_chunk );
+			}
+
+			if ( result )
+			{
+				result = doWriteChunk( obj.getLodIndices().data() + lod.firstIndex
+					, lod.indexCount
+					, ChunkType::eSubmeshLodIndices
+					, m_chunk );
+			}
+		}
+
+		if ( result
+			&& !obj.getMeshlets().empty() )
+		{
+			result = doWriteChunk( uint32_t( obj.getMeshlets().size() ), ChunkType::eSubmeshMeshletCount, m_chunk );
+
+			if ( result )
+			{
+				result = doWriteChunk( obj.getMeshlets(), ChunkType::eSubmeshMeshlets, m_chunk );
+			}
+		}
+
 		if ( result )
 		{
 			auto it = obj.m_components.find( BonesComponent::Name );
@@ -142,6 +174,9 @@ namespace castor3d
 		uint32_t components{ 0u };
 		uint32_t faceCount{ 0u };
 		uint32_t boneCount{ 0u };
+		UInt32Array lodIndices;
+		float lodError{ 0.0f };
+		castor::MeshletArray meshlets;
 		BinaryChunk chunk;
 		std::shared_ptr< BonesComponent > bonesComponent;
 
@@ -275,6 +310,63 @@ namespace castor3d
 				faceCount = 0u;
 				break;
 
+			case ChunkType::eSubmeshLodError:
+				result = doParseChunk( lodError, chunk );
+				checkError( result, "Couldn't parse LOD error." );
+				break;
+
+			case ChunkType::eSubmeshLodIndexCount:
+				result = doParseChunk( count, chunk );
+				checkError( result, "Couldn't parse LOD index count." );
+
+				if ( result )
+				{
+					lodIndices.resize( count );
+				}
+
+				break;
+
+			case ChunkType::eSubmeshLodIndices:
+				if ( !lodIndices.empty() )
+				{
+					result = doParseChunk( lodIndices, chunk );
+					checkError( result, "Couldn't parse LOD index data." );
+
+					if ( result )
+					{
+						obj.addLod( lodIndices, lodError );
+					}
+				}
+
+				lodIndices.clear();
+				break;
+
+			case ChunkType::eSubmeshMeshletCount:
+				result = doParseChunk( count, chunk );
+				checkError( result, "Couldn't parse meshlet count." );
+
+				if ( result )
+				{
+					meshlets.resize( count );
+				}
+
+				break;
+
+			case ChunkType::eSubmeshMeshlets:
+				if ( !meshlets.empty() )
+				{
+					result = doParseChunk( meshlets, chunk );
+					checkError( result, "Couldn't parse meshlet data." );
+
+					if ( result )
+					{
+						obj.m_meshlets = std::move( meshlets );
+					}
+				}
+
+				meshlets.clear();
+				break;
+
 			default:
 				break;
 			}
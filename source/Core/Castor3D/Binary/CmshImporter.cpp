@@ -10,6 +10,7 @@
 #include "Castor3D/Model/Skeleton/Animation/SkeletonAnimation.hpp"
 
 #include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/ZipArchive.hpp>
 
 using namespace castor;
 
@@ -35,6 +36,38 @@ namespace castor3d
 
 			return name;
 		}
+
+		template< typename ParsedT >
+		bool parseFile( ParsedT & obj
+			, Path const & path )
+		{
+			if ( File::fileExists( path ) )
+			{
+				BinaryFile file{ path, File::OpenMode::eRead };
+				return BinaryParser< ParsedT >{}.parse( obj, file );
+			}
+
+			// The file may come from an archive being read in memory.
+			ByteArray data;
+			return ZipArchive::readMountedFile( path, data )
+				&& BinaryParser< ParsedT >{}.parse( obj, data );
+		}
+
+		PathArray listFiles( Path const & folder )
+		{
+			PathArray result;
+
+			if ( File::directoryExists( folder ) )
+			{
+				File::listDirectoryFiles( folder, result );
+			}
+			else
+			{
+				result = ZipArchive::listMountedFiles( folder );
+			}
+
+			return result;
+		}
 	}
 
 	String const CmshImporter::Type = cuT( "cmsh" );
@@ -51,11 +84,8 @@ namespace castor3d
 
 	bool CmshImporter::doImportMesh( Mesh & mesh )
 	{
-		BinaryFile meshFile{ m_fileName, File::OpenMode::eRead };
-		auto result = BinaryParser< Mesh >{}.parse( mesh, meshFile );
-
-		castor::PathArray files;
-		File::listDirectoryFiles( m_fileName.getPath(), files );
+		auto result = parseFile( mesh, m_fileName );
+		auto files = listFiles( m_fileName.getPath() );
 		auto meshName = m_fileName.getFileName();
 
 		for ( auto & file : files )
@@ -64,9 +94,7 @@ namespace castor3d
 				&& file.getFileName() == meshName )
 			{
 				auto skeleton = std::make_shared< Skeleton >( *mesh.getScene() );
-				BinaryFile skelFile{ m_fileName.getPath() / ( meshName + cuT( ".cskl" ) )
-					, File::OpenMode::eRead };
-				result = BinaryParser< Skeleton >{}.parse( *skeleton, skelFile );
+				result = parseFile( *skeleton, m_fileName.getPath() / ( meshName + cuT( ".cskl" ) ) );
 
 				if ( result )
 				{
@@ -80,8 +108,7 @@ namespace castor3d
 					{
 						auto animName = cleanName( file.getFileName().substr( meshName.size() ) );
 						auto & animation = skeleton->createAnimation( animName );
-						BinaryFile animFile{ file, File::OpenMode::eRead };
-						result = BinaryParser< SkeletonAnimation >{}.parse( animation, animFile );
+						result = parseFile( animation, file );
 
 						if ( !result )
 						{
@@ -96,8 +123,7 @@ namespace castor3d
 			{
 				auto animName = cleanName( file.getFileName().substr( meshName.size() ) );
 				auto & animation = mesh.createAnimation( animName );
-				BinaryFile animFile{ file, File::OpenMode::eRead };
-				result = BinaryParser< MeshAnimation >{}.parse( animation, animFile );
+				result = parseFile( animation, file );
 
 				if ( !result )
 				{
@@ -0,0 +1,390 @@
+#include "Castor3D/Buffer/UploadQueue.hpp"
+
+#include "Castor3D/Buffer/GpuBuffer.hpp"
+#include "Castor3D/Render/RenderDevice.hpp"
+
+#include <CastorUtils/Config/MultiThreadConfig.hpp>
+
+#include <ashes/common/Format.hpp>
+
+#include <cstring>
+#include <numeric>
+
+namespace castor3d
+{
+	namespace
+	{
+		VkImageMemoryBarrier makeImageBarrier( ashes::Image const & image
+			, VkImageSubresourceRange const & range
+			, VkAccessFlags srcAccess
+			, VkAccessFlags dstAccess
+			, VkImageLayout oldLayout
+			, VkImageLayout newLayout )
+		{
+			return VkImageMemoryBarrier
+			{
+				VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+				nullptr,
+				srcAccess,
+				dstAccess,
+				oldLayout,
+				newLayout,
+				VK_QUEUE_FAMILY_IGNORED,
+				VK_QUEUE_FAMILY_IGNORED,
+				image,
+				range,
+			};
+		}
+
+		VkDeviceSize getUploadAlignment( ashes::Image const & image )
+		{
+			// Buffer offsets must be multiples of 4 and of the texel block size.
+			return std::lcm( VkDeviceSize( 4u )
+				, VkDeviceSize( ashes::getMinimalSize( image.getFormat() ) ) );
+		}
+
+		void invoke( std::vector< UploadQueue::OnReady > const & callbacks )
+		{
+			for ( auto & callback : callbacks )
+			{
+				callback();
+			}
+		}
+	}
+
+	UploadQueue::UploadQueue( RenderDevice const & device
+		, VkDeviceSize capacity
+		, VkDeviceSize frameBudget )
+		: m_device{ device }
+		, m_ring{ capacity, frameBudget }
+		, m_buffer{ makeBufferBase( device
+			, capacity
+			, VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+			, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+			, "UploadQueueRing" ) }
+	{
+	}
+
+	UploadQueue::~UploadQueue()
+	{
+		waitIdle();
+	}
+
+	uint64_t UploadQueue::pushUpload( ashes::Image const & image
+		, VkImageSubresourceRange const & range
+		, castor::ArrayView< uint8_t const > data
+		, ashes::VkBufferImageCopyArray regions
+		, OnReady onReady )
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		Operation operation{ ++m_lastTicket
+			, &image
+			, range
+			, std::move( regions )
+			, {}
+			, VK_IMAGE_LAYOUT_UNDEFINED
+			, nullptr
+			, std::move( onReady ) };
+
+		// Operations are processed in order, so once one is postponed, the next ones are too.
+		if ( !m_pending.empty()
+			|| !doProcess( operation, data.data(), VkDeviceSize( data.size() ) ) )
+		{
+			doPostpone( std::move( operation ), data );
+		}
+
+		return m_lastTicket;
+	}
+
+	uint64_t UploadQueue::pushCommands( RecordFunc record
+		, OnReady onReady )
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		Operation operation{ ++m_lastTicket
+			, nullptr
+			, {}
+			, {}
+			, {}
+			, VK_IMAGE_LAYOUT_UNDEFINED
+			, std::move( record )
+			, std::move( onReady ) };
+
+		if ( m_pending.empty() )
+		{
+			doProcess( operation, nullptr, 0u );
+		}
+		else
+		{
+			m_pending.push_back( std::move( operation ) );
+		}
+
+		return m_lastTicket;
+	}
+
+	void UploadQueue::update()
+	{
+		std::vector< OnReady > callbacks;
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			doRetire( callbacks );
+			m_ring.nextFrame();
+
+			while ( !m_pending.empty()
+				&& doProcess( m_pending.front()
+					, m_pending.front().data.data()
+					, VkDeviceSize( m_pending.front().data.size() ) ) )
+			{
+				m_pending.pop_front();
+			}
+
+			doSubmit();
+		}
+		invoke( callbacks );
+	}
+
+	void UploadQueue::flush()
+	{
+		std::vector< OnReady > callbacks;
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			doFlush( callbacks, m_lastTicket );
+		}
+		invoke( callbacks );
+	}
+
+	void UploadQueue::wait( uint64_t ticket )
+	{
+		if ( isReady( ticket ) )
+		{
+			return;
+		}
+
+		std::vector< OnReady > callbacks;
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			doFlush( callbacks, ticket );
+
+			while ( m_completed < ticket
+				&& !m_inFlight.empty() )
+			{
+				doWaitOldest( callbacks );
+			}
+		}
+		invoke( callbacks );
+	}
+
+	void UploadQueue::waitIdle()
+	{
+		wait( m_lastTicket );
+	}
+
+	bool UploadQueue::doProcess( Operation & operation
+		, uint8_t const * data
+		, VkDeviceSize size )
+	{
+		if ( operation.record )
+		{
+			auto & batch = doGetOpenBatch();
+			operation.record( *batch.commandBuffer );
+			batch.ticket = operation.ticket;
+
+			if ( operation.onReady )
+			{
+				batch.callbacks.push_back( std::move( operation.onReady ) );
+			}
+
+			return true;
+		}
+
+		ashes::BufferBase * source{ m_buffer.get() };
+		ashes::BufferBasePtr dedicated;
+		VkDeviceSize offset{};
+
+		if ( m_ring.isOversized( size ) )
+		{
+			// Too big for the ring, it gets its own staging buffer, released with the batch.
+			dedicated = makeBufferBase( m_device
+				, size
+				, VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+				, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				, "UploadQueueDedicated" );
+			source = dedicated.get();
+		}
+		else
+		{
+			offset = m_ring.allocate( size, getUploadAlignment( *operation.image ) );
+
+			if ( offset == UploadRing::InvalidOffset )
+			{
+				return false;
+			}
+		}
+
+		if ( auto buffer = source->lock( offset, size, 0u ) )
+		{
+			std::memcpy( buffer, data, size );
+			source->flush( offset, size );
+			source->unlock();
+		}
+
+		for ( auto & region : operation.regions )
+		{
+			region.bufferOffset += offset;
+		}
+
+		auto & batch = doGetOpenBatch();
+		auto & cmd = *batch.commandBuffer;
+		cmd.memoryBarrier( operation.srcLayout == VK_IMAGE_LAYOUT_UNDEFINED
+				? VkPipelineStageFlags( VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT )
+				: VkPipelineStageFlags( VK_PIPELINE_STAGE_ALL_COMMANDS_BIT )
+			, VK_PIPELINE_STAGE_TRANSFER_BIT
+			, makeImageBarrier( *operation.image
+				, operation.range
+				, 0u
+				, VK_ACCESS_TRANSFER_WRITE_BIT
+				, operation.srcLayout
+				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ) );
+		cmd.copyToImage( operation.regions
+			, *source
+			, *operation.image );
+		cmd.memoryBarrier( VK_PIPELINE_STAGE_TRANSFER_BIT
+			, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+			, makeImageBarrier( *operation.image
+				, operation.range
+				, VK_ACCESS_TRANSFER_WRITE_BIT
+				, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT
+				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+				, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL ) );
+		batch.ticket = operation.ticket;
+
+		if ( dedicated )
+		{
+			batch.dedicated.push_back( std::move( dedicated ) );
+		}
+
+		if ( operation.onReady )
+		{
+			batch.callbacks.push_back( std::move( operation.onReady ) );
+		}
+
+		return true;
+	}
+
+	void UploadQueue::doPostpone( Operation operation
+		, castor::ArrayView< uint8_t const > data )
+	{
+		// Until its upload, the image is moved to its final layout, to remain usable.
+		auto & batch = doGetOpenBatch();
+		batch.commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT
+			, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+			, makeImageBarrier( *operation.image
+				, operation.range
+				, 0u
+				, VK_ACCESS_SHADER_READ_BIT
+				, VK_IMAGE_LAYOUT_UNDEFINED
+				, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL ) );
+		operation.srcLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		operation.data.assign( data.begin(), data.end() );
+		m_pending.push_back( std::move( operation ) );
+	}
+
+	void UploadQueue::doFlush( std::vector< OnReady > & callbacks
+		, uint64_t ticket )
+	{
+		while ( !m_pending.empty()
+			&& m_pending.front().ticket <= ticket )
+		{
+			auto & operation = m_pending.front();
+
+			if ( doProcess( operation
+				, operation.data.data()
+				, VkDeviceSize( operation.data.size() ) ) )
+			{
+				m_pending.pop_front();
+			}
+			else if ( m_ring.getFrameBytes() != 0u )
+			{
+				// The frame budget is ignored when flushing.
+				m_ring.nextFrame();
+			}
+			else
+			{
+				// The ring is full, make room.
+				doSubmit();
+				doWaitOldest( callbacks );
+			}
+		}
+
+		doSubmit();
+	}
+
+	UploadQueue::Batch & UploadQueue::doGetOpenBatch()
+	{
+		if ( !m_open )
+		{
+			if ( m_free.empty() )
+			{
+				m_open = std::make_unique< Batch >();
+				m_open->commandBuffer = m_device.graphicsCommandPool->createCommandBuffer( "UploadQueue" );
+				m_open->fence = m_device->createFence();
+			}
+			else
+			{
+				m_open = std::move( m_free.back() );
+				m_free.pop_back();
+			}
+
+			m_open->commandBuffer->begin( VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT );
+		}
+
+		return *m_open;
+	}
+
+	void UploadQueue::doSubmit()
+	{
+		if ( !m_open )
+		{
+			return;
+		}
+
+		m_open->commandBuffer->end();
+		m_device.graphicsQueue->submit( { *m_open->commandBuffer }
+			, {}
+			, {}
+			, {}
+			, m_open->fence.get() );
+		m_open->value = m_ring.closeBatch();
+		m_inFlight.push_back( std::move( m_open ) );
+		++m_submitCount;
+	}
+
+	void UploadQueue::doRetire( std::vector< OnReady > & callbacks )
+	{
+		while ( !m_inFlight.empty()
+			&& m_inFlight.front()->fence->wait( 0u ) == VK_SUCCESS )
+		{
+			auto batch = std::move( m_inFlight.front() );
+			m_inFlight.pop_front();
+			batch->fence->reset();
+			m_ring.retire( batch->value );
+			m_completed = std::max( m_completed.load(), batch->ticket );
+			callbacks.insert( callbacks.end()
+				, std::make_move_iterator( batch->callbacks.begin() )
+				, std::make_move_iterator( batch->callbacks.end() ) );
+			batch->callbacks.clear();
+			batch->dedicated.clear();
+			batch->ticket = 0u;
+			m_free.push_back( std::move( batch ) );
+		}
+	}
+
+	void UploadQueue::doWaitOldest( std::vector< OnReady > & callbacks )
+	{
+		if ( !m_inFlight.empty() )
+		{
+			m_inFlight.front()->fence->wait( ashes::MaxTimeout );
+			++m_waitCount;
+			doRetire( callbacks );
+		}
+	}
+}
@@ -0,0 +1,107 @@
+#include "Castor3D/Buffer/UploadRing.hpp"
+
+#include <algorithm>
+
+namespace castor3d
+{
+	namespace
+	{
+		VkDeviceSize alignUp( VkDeviceSize offset
+			, VkDeviceSize alignment )
+		{
+			return ( ( offset + alignment - 1u ) / alignment ) * alignment;
+		}
+	}
+
+	UploadRing::UploadRing( VkDeviceSize capacity
+		, VkDeviceSize frameBudget )
+		: m_capacity{ capacity }
+		, m_frameBudget{ frameBudget }
+	{
+	}
+
+	VkDeviceSize UploadRing::allocate( VkDeviceSize size
+		, VkDeviceSize alignment )
+	{
+		if ( m_frameBytes != 0u
+			&& m_frameBytes + size > m_frameBudget )
+		{
+			return InvalidOffset;
+		}
+
+		if ( m_used == 0u )
+		{
+			m_head = 0u;
+			m_tail = 0u;
+		}
+
+		auto offset = alignUp( m_head, std::max( VkDeviceSize( 1u ), alignment ) );
+		VkDeviceSize end{};
+
+		if ( m_used == 0u || m_head > m_tail )
+		{
+			// Free space is [head, capacity) then [0, tail).
+			if ( offset + size <= m_capacity )
+			{
+				end = offset + size;
+			}
+			else if ( size <= m_tail )
+			{
+				offset = 0u;
+				end = size;
+			}
+			else
+			{
+				return InvalidOffset;
+			}
+		}
+		else if ( offset + size <= m_tail )
+		{
+			// Free space is [head, tail).
+			end = offset + size;
+		}
+		else
+		{
+			return InvalidOffset;
+		}
+
+		// The padding, and the end of the ring skipped when wrapping, belong to the open batch.
+		auto consumed = end >= m_head
+			? end - m_head
+			: m_capacity - m_head + end;
+		m_head = end;
+		m_used += consumed;
+		m_openBytes += consumed;
+		m_frameBytes += size;
+		return offset;
+	}
+
+	uint64_t UploadRing::closeBatch()
+	{
+		if ( m_openBytes != 0u )
+		{
+			m_batches.push_back( { ++m_closedValue, m_head, m_openBytes } );
+			m_openBytes = 0u;
+		}
+
+		return m_closedValue;
+	}
+
+	void UploadRing::retire( uint64_t value )
+	{
+		while ( !m_batches.empty()
+			&& m_batches.front().value <= value )
+		{
+			m_used -= m_batches.front().bytes;
+			m_tail = m_batches.front().end;
+			m_batches.pop_front();
+		}
+
+		m_retiredValue = std::max( m_retiredValue, value );
+	}
+
+	void UploadRing::nextFrame()
+	{
+		m_frameBytes = 0u;
+	}
+}
@@ -9,6 +9,8 @@
 #include "Castor3D/Scene/Animation/Mesh/MeshAnimationInstance.hpp"
 #include "Castor3D/Render/RenderPassTimer.hpp"
 
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -43,6 +45,8 @@ namespace castor3d
 
 	void AnimatedObjectGroupCache::update( CpuUpdater & updater )
 	{
+		CU_ProfileScope( "AnimatedObjectGroupCache::update" );
+
 		for ( auto & pair : m_skeletonEntries )
 		{
 			auto & entry = pair.second;
@@ -8,6 +8,8 @@
 #include "Castor3D/Scene/BillboardList.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -100,9 +102,24 @@ namespace castor3d
 
 	void BillboardListCache::update( CpuUpdater & updater )
 	{
+		CU_ProfileScope( "BillboardListCache::cpuUpdate" );
 		m_pools->update();
 	}
 
+	void BillboardListCache::update( GpuUpdater & updater )
+	{
+		CU_ProfileScope( "BillboardListCache::gpuUpdate" );
+		auto view = getView();
+
+		for ( auto & billboard : *view )
+		{
+			if ( billboard->isInitialised() )
+			{
+				billboard->update( updater );
+			}
+		}
+	}
+
 	BillboardListSPtr BillboardListCache::add( Key const & name
 		, SceneNode & parent )
 	{
@@ -135,6 +152,7 @@ namespace castor3d
 			auto element = m_elements.find( name );
 			m_detach( element );
 			m_elements.erase( name );
+			doEraseHandle( name );
 			onChanged();
 			m_pools->unregisterElement( *element );
 		}
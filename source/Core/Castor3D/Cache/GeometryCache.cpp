@@ -18,6 +18,7 @@
 #include "Castor3D/Scene/SceneNode.hpp"
 
 #include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 using namespace castor;
 
@@ -205,6 +206,8 @@ namespace castor3d
 
 	void GeometryCache::update( CpuUpdater & updater )
 	{
+		CU_ProfileScope( "GeometryCache::update" );
+
 		for ( auto & pair : m_baseEntries )
 		{
 			auto & entry = pair.second;
@@ -297,6 +300,7 @@ namespace castor3d
 			auto element = m_elements.find( name );
 			m_detach( element );
 			m_elements.erase( name );
+			doEraseHandle( name );
 			onChanged();
 			doUnregister( *element );
 		}
@@ -13,6 +13,7 @@
 #include "Castor3D/Shader/Shaders/SdwModule.hpp"
 
 #include <CastorUtils/Design/ArrayView.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 #include <ashespp/Core/Device.hpp>
 
@@ -172,6 +173,7 @@ namespace castor3d
 				else
 				{
 					m_elements.insert( name, element );
+					doInsertHandle( name, element );
 					onChanged();
 				}
 			}
@@ -196,6 +198,7 @@ namespace castor3d
 				result = m_produce( name, parent, type );
 				m_initialise( result );
 				m_elements.insert( name, result );
+				doInsertHandle( name, result );
 				m_attach( result, parent, m_rootNode.lock(), m_rootCameraNode.lock(), m_rootObjectNode.lock() );
 				doReportCreation( name );
 				m_dirtyLights.emplace_back( result.get() );
@@ -226,12 +229,15 @@ namespace castor3d
 			m_detach( element );
 			m_connections.erase( element.get() );
 			m_elements.erase( name );
+			doEraseHandle( name );
 			onChanged();
 		}
 	}
 
 	void ObjectCache< Light, castor::String >::update( CpuUpdater & updater )
 	{
+		CU_ProfileScope( "LightCache::cpuUpdate" );
+
 		if ( !m_dirtyLights.empty() )
 		{
 			LightsRefArray dirty;
@@ -247,6 +253,7 @@ namespace castor3d
 
 	void ObjectCache< Light, castor::String >::update( GpuUpdater & updater )
 	{
+		CU_ProfileScope( "LightCache::gpuUpdate" );
 		auto & camera = *updater.camera;
 		uint32_t index = 0;
 		uint32_t lightIndex = 0;
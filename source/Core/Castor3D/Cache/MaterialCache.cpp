@@ -14,6 +14,8 @@
 #include "Castor3D/Shader/Shaders/GlslMaterial.hpp"
 #include "Castor3D/Shader/Shaders/GlslTextureConfiguration.hpp"
 
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -92,6 +94,8 @@ namespace castor3d
 
 	void MaterialCache::update( CpuUpdater & updater )
 	{
+		CU_ProfileScope( "MaterialCache::cpuUpdate" );
+
 		if ( m_passBuffer )
 		{
 			LockType lock{ castor::makeUniqueLock( m_elements ) };
@@ -105,6 +109,8 @@ namespace castor3d
 
 	void MaterialCache::update( GpuUpdater & updater )
 	{
+		CU_ProfileScope( "MaterialCache::gpuUpdate" );
+
 		if ( m_passBuffer )
 		{
 			m_passBuffer->update();
@@ -2,6 +2,8 @@
 
 #include "Castor3D/Render/RenderTarget.hpp"
 
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -42,6 +44,7 @@ namespace castor3d
 
 	void RenderTargetCache::update( CpuUpdater & updater )
 	{
+		CU_ProfileScope( "RenderTargetCache::cpuUpdate" );
 		LockType lock{ castor::makeUniqueLock( *this ) };
 
 		for ( auto target : m_renderTargets[size_t( TargetType::eTexture )] )
@@ -57,6 +60,7 @@ namespace castor3d
 
 	void RenderTargetCache::update( GpuUpdater & updater )
 	{
+		CU_ProfileScope( "RenderTargetCache::gpuUpdate" );
 		LockType lock{ castor::makeUniqueLock( *this ) };
 
 		for ( auto target : m_renderTargets[size_t( TargetType::eTexture )] )
@@ -73,6 +77,7 @@ namespace castor3d
 	void RenderTargetCache::render( RenderDevice const & device
 		, RenderInfo & info )
 	{
+		CU_ProfileScope( "RenderTargetCache::render" );
 		LockType lock{ castor::makeUniqueLock( *this ) };
 
 		for ( auto target : m_renderTargets[size_t( TargetType::eTexture )] )
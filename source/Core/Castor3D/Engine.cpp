@@ -79,6 +79,7 @@ namespace castor3d
 		, m_enableValidation{ enableValidation }
 		, m_fontCache{ *m_logger }
 		, m_imageCache{ *m_logger, m_imageLoader }
+		, m_textureCache{ *m_logger, getEngineDirectory() / cuT( "TextureCache" ) }
 		, m_meshFactory{ std::make_shared< MeshFactory >() }
 		, m_subdividerFactory{ std::make_shared< MeshSubdividerFactory >() }
 		, m_importerFactory{ std::make_shared< MeshImporterFactory >() }
@@ -10,37 +10,58 @@ namespace castor3d
 {
 	namespace
 	{
-		template< typename EventT, typename ... ParamsT >
-		bool doFireEvents( std::vector< std::unique_ptr< EventT > > & arrayEvents
-			, ParamsT & ... params )
+		template< typename LockT, typename ... ParamsT, typename ... ArgsT >
+		bool doFireEvents( FrameEventQueueT< ParamsT... > & queue
+			, castor::Microseconds budget
+			, LockT & lock
+			, ArgsT && ... params )
 		{
+			using Clock = typename FrameEventQueueT< ParamsT... >::Clock;
 			bool result = true;
-
-			try
-			{
-				for ( auto & event : arrayEvents )
+			auto deadline = budget.count() == 0
+				? Clock::time_point::max()
+				: Clock::now() + budget;
+			queue.drain( queue.getSequence()
+				, deadline
+				, [&result, &lock, &params...]( FrameEventFunctorT< ParamsT... > & event )
 				{
-					event->apply( params... );
-				}
-			}
-			catch ( Exception & exc )
-			{
-				log::error << cuT( "Encountered exception while processing events: " ) << string::stringCast< xchar >( exc.getFullDescription() ) << std::endl;
-				result = false;
-			}
-			catch ( std::exception & exc )
-			{
-				log::error << cuT( "Encountered exception while processing events: " ) << string::stringCast< xchar >( exc.what() ) << std::endl;
-				result = false;
-			}
-			catch ( ... )
-			{
-				log::error << cuT( "Encountered exception while processing events" ) << std::endl;
-				result = false;
-			}
-
+					// The lock only guards the queue accesses, the event runs without it.
+					lock.unlock();
+
+					try
+					{
+						event( params... );
+					}
+					catch ( Exception & exc )
+					{
+						log::error << cuT( "Encountered exception while processing events: " ) << string::stringCast< xchar >( exc.getFullDescription() ) << std::endl;
+						result = false;
+					}
+					catch ( std::exception & exc )
+					{
+						log::error << cuT( "Encountered exception while processing events: " ) << string::stringCast< xchar >( exc.what() ) << std::endl;
+						result = false;
+					}
+					catch ( ... )
+					{
+						log::error << cuT( "Encountered exception while processing events" ) << std::endl;
+						result = false;
+					}
+
+					lock.lock();
+				} );
 			return result;
 		}
+
+		template< typename ... ParamsT >
+		void doDiscardEvents( FrameEventQueueT< ParamsT... > & queue )
+		{
+			queue.drain( queue.getSequence()
+				, FrameEventQueueT< ParamsT... >::Clock::time_point::max()
+				, []( FrameEventFunctorT< ParamsT... > & )
+				{
+				} );
+		}
 	}
 
 	FrameListener::FrameListener( String const & name )
@@ -50,27 +71,22 @@ namespace castor3d
 
 	FrameListener::~FrameListener()
 	{
-		for ( auto & list : m_cpuEvents )
-		{
-			list.clear();
-		}
-
-		for ( auto & list : m_gpuEvents )
-		{
-			list.clear();
-		}
 	}
 
 	void FrameListener::flush()
 	{
-		for ( auto & list : m_cpuEvents )
 		{
-			list.clear();
-		}
-		
-		for ( auto & list : m_gpuEvents )
-		{
-			list.clear();
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+
+			for ( auto & queue : m_cpuEvents )
+			{
+				doDiscardEvents( queue );
+			}
+
+			for ( auto & queue : m_gpuEvents )
+			{
+				doDiscardEvents( queue );
+			}
 		}
 
 		doFlush();
@@ -78,44 +94,52 @@ namespace castor3d
 
 	void FrameListener::postEvent( CpuFrameEventUPtr event )
 	{
-		auto lock( castor::makeUniqueLock( m_mutex ) );
-		m_cpuEvents[size_t( event->getType() )].push_back( std::move( event ) );
+		auto type = event->getType();
+		m_cpuEvents[size_t( type )].push( [event = std::move( event )]()
+			{
+				event->apply();
+			} );
 	}
 
 	void FrameListener::postEvent( GpuFrameEventUPtr event )
 	{
-		auto lock( castor::makeUniqueLock( m_mutex ) );
-		m_gpuEvents[size_t( event->getType() )].push_back( std::move( event ) );
+		auto type = event->getType();
+		m_gpuEvents[size_t( type )].push( [event = std::move( event )]( RenderDevice const & device )
+			{
+				event->apply( device );
+			} );
 	}
 
 	bool FrameListener::fireEvents( EventType type )
 	{
-		CpuFrameEventPtrArray arrayEvents;
-		{
-			auto lock( castor::makeUniqueLock( m_mutex ) );
-			std::swap( arrayEvents, m_cpuEvents[size_t( type )] );
-		}
-		return doFireEvents( arrayEvents );
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		return doFireEvents( m_cpuEvents[size_t( type )], m_eventsBudget, lock );
 	}
 
 	bool FrameListener::fireEvents( EventType type
 		, RenderDevice const & device )
 	{
-		GpuFrameEventPtrArray arrayEvents;
-		{
-			auto lock( castor::makeUniqueLock( m_mutex ) );
-			std::swap( arrayEvents, m_gpuEvents[size_t( type )] );
-		}
-		return doFireEvents( arrayEvents, device );
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		return doFireEvents( m_gpuEvents[size_t( type )], m_eventsBudget, lock, device );
 	}
 
-	void FrameListener::flushEvents( EventType type )
+	bool FrameListener::fireAllEvents( EventType type )
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		return doFireEvents( m_cpuEvents[size_t( type )], castor::Microseconds{ 0u }, lock );
+	}
+
+	bool FrameListener::fireAllEvents( EventType type
+		, RenderDevice const & device )
 	{
-		GpuFrameEventPtrArray gpuEvents;
-		CpuFrameEventPtrArray cpuEvents;
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		return doFireEvents( m_gpuEvents[size_t( type )], castor::Microseconds{ 0u }, lock, device );
+	}
 
+	void FrameListener::flushEvents( EventType type )
+	{
 		auto lock( castor::makeUniqueLock( m_mutex ) );
-		std::swap( gpuEvents, m_gpuEvents[size_t( type )] );
-		std::swap( cpuEvents, m_cpuEvents[size_t( type )] );
+		doDiscardEvents( m_gpuEvents[size_t( type )] );
+		doDiscardEvents( m_cpuEvents[size_t( type )] );
 	}
 }
@@ -261,4 +261,80 @@ namespace castor3d
 		mergeMasks( config.transmittanceMask[0], TextureFlag::eTransmittance, result );
 		return result;
 	}
+
+	BlockCompressedFormat getBlockCompressedFormat( TextureConfiguration const & config
+		, castor::BlockCompressionQuality quality )
+	{
+		BlockCompressedFormat result{ castor::PixelFormat::eUNDEFINED
+			, castor::PixelComponent::eRed
+			, config };
+		std::array< castor::Point2ui *, 9u > masks
+		{
+			&result.configuration.colourMask,
+			&result.configuration.specularMask,
+			&result.configuration.glossinessMask,
+			&result.configuration.opacityMask,
+			&result.configuration.emissiveMask,
+			&result.configuration.normalMask,
+			&result.configuration.heightMask,
+			&result.configuration.occlusionMask,
+			&result.configuration.transmittanceMask,
+		};
+		uint32_t used = 0u;
+
+		for ( auto mask : masks )
+		{
+			used |= ( *mask )[0];
+		}
+
+		if ( !used )
+		{
+			return result;
+		}
+
+		if ( used == config.normalMask[0]
+			&& used == TextureConfiguration::RgbMask )
+		{
+			result.configuration.normalMask[0] = TextureConfiguration::RgMask;
+			result.format = castor::PixelFormat::eBC5_UNORM_BLOCK;
+			return result;
+		}
+
+		static std::array< uint32_t, 4u > const singleMasks
+		{
+			TextureConfiguration::RedMask,
+			TextureConfiguration::GreenMask,
+			TextureConfiguration::BlueMask,
+			TextureConfiguration::AlphaMask,
+		};
+		auto it = std::find( singleMasks.begin(), singleMasks.end(), used );
+
+		if ( it != singleMasks.end() )
+		{
+			result.component = castor::PixelComponent( std::distance( singleMasks.begin(), it ) );
+
+			for ( auto mask : masks )
+			{
+				if ( ( *mask )[0] )
+				{
+					( *mask )[0] = TextureConfiguration::RedMask;
+					( *mask )[1] = 0u;
+				}
+			}
+
+			result.format = castor::PixelFormat::eBC4_UNORM_BLOCK;
+			return result;
+		}
+
+		if ( used & TextureConfiguration::AlphaMask )
+		{
+			result.format = quality == castor::BlockCompressionQuality::eFast
+				? castor::PixelFormat::eBC3_UNORM_BLOCK
+				: castor::PixelFormat::eBC7_UNORM_BLOCK;
+			return result;
+		}
+
+		result.format = castor::PixelFormat::eBC1_RGB_UNORM_BLOCK;
+		return result;
+	}
 }
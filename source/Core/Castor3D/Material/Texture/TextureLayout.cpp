@@ -1,18 +1,23 @@
 #include "Castor3D/Material/Texture/TextureLayout.hpp"
 
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/Buffer/UploadQueue.hpp"
 #include "Castor3D/Material/Texture/TextureSource.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/ZipArchive.hpp>
 #include <CastorUtils/Miscellaneous/BitSize.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Graphics/MipmapGeneration.hpp>
 #include <CastorUtils/Graphics/PixelBufferBase.hpp>
 #include <CastorUtils/Graphics/Size.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 #include <ashes/ashes.hpp>
 #include <ashespp/Command/CommandBuffer.hpp>
 #include <ashespp/Image/Image.hpp>
 #include <ashespp/Image/ImageView.hpp>
-#include <ashespp/Image/StagingTexture.hpp>
 
 using namespace castor;
 
@@ -554,24 +559,60 @@ namespace castor3d
 			return buffer;
 		}
 
+		// Bump when the processing changes, to invalidate existing cache entries.
+		static uint32_t constexpr TextureCacheVersion = 1u;
+
+		struct TextureCacheSettings
+		{
+			uint32_t version;
+			uint32_t mipLevels;
+			uint32_t gammaCorrection;
+			uint32_t compressedFormat;
+			uint32_t compressionQuality;
+			uint32_t compressedComponent;
+		};
+
+		castor::ByteArray readFile( castor::Path const & folder
+			, castor::Path const & relative )
+		{
+			auto filePath = folder / relative;
+			castor::ByteArray result;
+
+			if ( !castor::File::fileExists( filePath ) )
+			{
+				if ( !castor::ZipArchive::readMountedFile( filePath, result ) )
+				{
+					CU_Exception( cuT( "TextureView::setSource - Couldn't load image " ) + relative );
+				}
+
+				return result;
+			}
+
+			castor::BinaryFile file{ filePath, castor::File::OpenMode::eRead };
+			result.resize( size_t( file.getLength() ) );
+
+			if ( file.readArray( result.data(), result.size() ) < result.size() )
+			{
+				CU_Exception( cuT( "TextureView::setSource - Couldn't read image " ) + relative );
+			}
+
+			return result;
+		}
+
 		castor::Image getFileImage( Engine & engine
 			, castor::String const & name
 			, castor::Path const & folder
 			, castor::Path const & relative
+			, castor::ByteArray const & data
 			, uint32_t mipLevels
 			, uint32_t & srcMipLevels )
 		{
-			castor::PxBufferBaseSPtr buffer;
-			ImageLayout layout;
-			Path filePath;
-
-			if ( castor::File::fileExists( folder / relative ) )
-			{
-				auto image = engine.getImageLoader().load( name, folder / relative );
-				filePath = image.getPath();
-				layout = image.getLayout();
-				buffer = image.getPixels();
-			}
+			auto image = engine.getImageLoader().load( name
+				, folder / relative
+				, data.data()
+				, uint32_t( data.size() ) );
+			auto layout = image.getLayout();
+			auto buffer = image.getPixels();
 
 			if ( !buffer )
 			{
@@ -580,37 +621,91 @@ namespace castor3d
 
 			srcMipLevels = buffer->getLevels();
 			buffer = adaptBuffer( buffer, mipLevels );
-			return castor::Image{ name, filePath, ImageLayout{ layout.type, *buffer }, buffer };
+			return castor::Image{ name, image.getPath(), ImageLayout{ layout.type, *buffer }, buffer };
 		}
 
-		void processLevels( RenderDevice const & device
+		castor::Image getFileImage( Engine & engine
+			, castor::String const & name
+			, castor::Path const & folder
+			, castor::Path const & relative
+			, uint32_t mipLevels
+			, uint32_t & srcMipLevels )
+		{
+			return getFileImage( engine
+				, name
+				, folder
+				, relative
+				, readFile( folder, relative )
+				, mipLevels
+				, srcMipLevels );
+		}
+
+		castor::Image getFileImage( Engine & engine
+			, castor::String const & name
+			, castor::Path const & folder
+			, castor::Path const & relative
+			, uint32_t mipLevels
+			, TextureCacheSettings const & settings
+			, uint32_t & srcMipLevels
+			, uint64_t & cacheKey
+			, bool & fromCache )
+		{
+			auto data = readFile( folder, relative );
+			cacheKey = castor::hashBytes( &settings
+				, sizeof( settings )
+				, castor::hashBytes( data.data(), data.size() ) );
+			auto buffer = engine.getTextureCache().load( cacheKey );
+			fromCache = buffer != nullptr;
+
+			if ( fromCache )
+			{
+				srcMipLevels = buffer->getLevels();
+				return castor::Image{ name, folder / relative, ImageLayout{ *buffer }, buffer };
+			}
+
+			return getFileImage( engine
+				, name
+				, folder
+				, relative
+				, data
+				, mipLevels
+				, srcMipLevels );
+		}
+
+		uint64_t processLevels( RenderDevice const & device
 			, Image const & image
 			, ashes::Image const & texture
-			, ashes::ImageViewCreateInfo & viewInfo )
+			, VkImageSubresourceRange const & range )
 		{
-			auto buffer = image.getLayout().layerBuffer( image.getPxBuffer()
-				, viewInfo->subresourceRange.baseArrayLayer );
+			auto & layout = image.getLayout();
+			auto buffer = layout.layerBuffer( image.getPxBuffer()
+				, range.baseArrayLayer );
 
 			if ( buffer.empty() )
 			{
-				return;
+				return 0u;
 			}
 
-			auto debugName = image.getName() + "Upload"
-				+ "L(" + string::toString( viewInfo->subresourceRange.baseArrayLayer ) + "x1/" + string::toString( image.getLayout().depthLayers() ) + ")"
-				+ "M(" + string::toString( viewInfo->subresourceRange.baseMipLevel ) + "x" + string::toString( viewInfo->subresourceRange.levelCount ) + "/" + string::toString( image.getLayout().levels ) + ")";
-			auto view = texture.createView( debugName, viewInfo );
-			auto staging = device->createStagingTexture( VkFormat( image.getPixelFormat() )
-				, {
-					ashes::getSubresourceDimension( image.getWidth(), viewInfo->subresourceRange.baseMipLevel ),
-					ashes::getSubresourceDimension( image.getHeight(), viewInfo->subresourceRange.baseMipLevel ),
-				}
-				, viewInfo->subresourceRange.levelCount );
-			staging->uploadTextureData( *device.graphicsQueue
-				, *device.graphicsCommandPool
-				, VkFormat( image.getPixelFormat() )
-				, buffer.data()
-				, view );
+			// One region per level, all the layer's levels are uploaded with the same batch.
+			ashes::VkBufferImageCopyArray regions;
+			auto layerOffset = layout.layerOffset( range.baseArrayLayer );
+
+			for ( auto level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount; ++level )
+			{
+				regions.push_back( VkBufferImageCopy{ layout.layerMipOffset( range.baseArrayLayer, level ) - layerOffset
+					, 0u
+					, 0u
+					, { range.aspectMask, level, range.baseArrayLayer, 1u }
+					, {}
+					, { ashes::getSubresourceDimension( image.getWidth(), level )
+						, ashes::getSubresourceDimension( image.getHeight(), level )
+						, 1u } } );
+			}
+
+			return device.uploadQueue->pushUpload( texture
+				, range
+				, buffer
+				, std::move( regions ) );
 		}
 
 		auto updateMipLevels( bool genNeeded
@@ -629,6 +724,53 @@ namespace castor3d
 				mipView.view->setMipmapsGenerationNeeded( genNeeded );
 			}
 		}
+
+		PixelFormat getCompressedFormat( PixelFormat format
+			, PixelFormat srcFormat )
+		{
+			switch ( srcFormat )
+			{
+			case PixelFormat::eR8G8B8_SRGB:
+			case PixelFormat::eB8G8R8_SRGB:
+			case PixelFormat::eR8G8B8A8_SRGB:
+			case PixelFormat::eB8G8R8A8_SRGB:
+			case PixelFormat::eA8B8G8R8_SRGB:
+				switch ( format )
+				{
+				case PixelFormat::eBC1_RGB_UNORM_BLOCK:
+					return PixelFormat::eBC1_RGB_SRGB_BLOCK;
+				case PixelFormat::eBC1_RGBA_UNORM_BLOCK:
+					return PixelFormat::eBC1_RGBA_SRGB_BLOCK;
+				case PixelFormat::eBC3_UNORM_BLOCK:
+					return PixelFormat::eBC3_SRGB_BLOCK;
+				case PixelFormat::eBC7_UNORM_BLOCK:
+					return PixelFormat::eBC7_SRGB_BLOCK;
+				default:
+					return format;
+				}
+			default:
+				return format;
+			}
+		}
+
+		void moveToRed( PxBufferBase & buffer
+			, PixelComponent component )
+		{
+			CU_Require( buffer.getFormat() == PixelFormat::eR8G8B8A8_UNORM );
+			auto index = uint32_t( component );
+
+			if ( index > 0u && index < 4u )
+			{
+				auto data = buffer.getPtr();
+				auto end = data + buffer.getSize();
+
+				while ( data < end )
+				{
+					data[0] = data[index];
+					data += 4u;
+				}
+			}
+		}
 	}
 
 	//************************************************************************************************
@@ -816,10 +958,12 @@ namespace castor3d
 		m_defaultView.view.reset();
 	}
 
-	bool TextureLayout::initialise( RenderDevice const & device )
+	bool TextureLayout::initialise( RenderDevice const & device
+		, bool deferUploads )
 	{
 		if ( !m_initialised )
 		{
+			doCompress( device );
 			auto props = device->getPhysicalDevice().getFormatProperties( m_info->format );
 
 			if ( checkFlag( props.optimalTilingFeatures, VK_FORMAT_FEATURE_TRANSFER_DST_BIT ) )
@@ -846,26 +990,21 @@ namespace castor3d
 
 			if ( isStatic() )
 			{
-				ashes::ImageViewCreateInfo viewInfo
-				{
-					0u,
-					*m_texture,
-					( ( m_info->extent.height > 1u || m_image.getLayout().type == ImageLayout::e2D )
-						? VK_IMAGE_VIEW_TYPE_2D
-						: VK_IMAGE_VIEW_TYPE_1D ),
-					m_info->format,
-					{},
-					{ ashes::getAspectMask( m_info->format ), 0u, 1u, 0u, 1u },
-				};
-				uint32_t mipLevels = m_defaultView.view->isMipmapsGenerationNeeded()
+				VkImageSubresourceRange range{ ashes::getAspectMask( m_info->format ), 0u, 1u, 0u, 1u };
+				range.levelCount = m_defaultView.view->isMipmapsGenerationNeeded()
 					? 1u
 					: m_image.getLayout().levels;
-				viewInfo->subresourceRange.levelCount = mipLevels;
 
 				for ( auto layer = 0u; layer < m_image.getLayout().depthLayers(); ++layer )
 				{
-					viewInfo->subresourceRange.baseArrayLayer = layer;
-					processLevels( device, m_image, *m_texture, viewInfo );
+					range.baseArrayLayer = layer;
+					m_uploadTicket = std::max( m_uploadTicket
+						, processLevels( device, m_image, *m_texture, range ) );
+				}
+
+				if ( !deferUploads )
+				{
+					device.uploadQueue->flush();
 				}
 			}
 
@@ -911,27 +1050,41 @@ namespace castor3d
 				{
 					view->cleanup();
 				} );
+
+			if ( m_uploadTicket
+				&& getRenderSystem()->hasMainDevice() )
+			{
+				// The image must outlive its pending uploads.
+				getRenderSystem()->getMainRenderDevice()->uploadQueue->wait( m_uploadTicket );
+				m_uploadTicket = 0u;
+			}
+
 			m_texture.reset();
 		}
 
 		m_initialised = false;
 	}
 
-	void TextureLayout::generateMipmaps( RenderDevice const & device )const
+	void TextureLayout::generateMipmaps( RenderDevice const & device
+		, bool deferUploads )const
 	{
 		if ( m_info->mipLevels > 1u
 			&& getDefaultView().isMipmapsGenerationNeeded() )
 		{
 			CU_Require( m_texture );
-			auto commandBuffer = device.transferCommandPool->createCommandBuffer( "TextureGenMipmaps" );
-			commandBuffer->begin();
-			commandBuffer->beginDebugBlock( { getName() + " Mipmaps Generation"
-				, makeFloatArray( getRenderSystem()->getEngine()->getNextRainbowColour() ) } );
-			generateMipmaps( *commandBuffer );
-			commandBuffer->endDebugBlock();
-			commandBuffer->end();
-			device.transferQueue->submit( *commandBuffer, nullptr );
-			device.transferQueue->waitIdle();
+			// Recorded in the upload batch, right after the level 0 upload.
+			m_uploadTicket = device.uploadQueue->pushCommands( [this]( ashes::CommandBuffer & commandBuffer )
+				{
+					commandBuffer.beginDebugBlock( { getName() + " Mipmaps Generation"
+						, makeFloatArray( getRenderSystem()->getEngine()->getNextRainbowColour() ) } );
+					generateMipmaps( commandBuffer );
+					commandBuffer.endDebugBlock();
+				} );
+
+			if ( !deferUploads )
+			{
+				device.uploadQueue->flush();
+			}
 		}
 	}
 
@@ -942,16 +1095,68 @@ namespace castor3d
 			, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL );
 	}
 
+	void TextureLayout::setCompression( castor::PixelFormat format
+		, castor::BlockCompressionOptions const & options
+		, castor::PixelComponent component )
+	{
+		m_compressedFormat = format;
+		m_compressionOptions = options;
+		m_compressedComponent = component;
+		m_compressionApplied = false;
+		// The cache key of an already set source doesn't account for compression.
+		m_cacheKey = 0u;
+	}
+
 	void TextureLayout::setSource( Path const & folder
-		, Path const & relative )
+		, Path const & relative
+		, bool gammaCorrection )
 	{
+		CU_ProfileScope( "TextureLayout::loadSource" );
+		auto & engine = *getRenderSystem()->getEngine();
+		TextureCacheSettings settings{ TextureCacheVersion
+			, m_image.getLevels()
+			, gammaCorrection ? 1u : 0u
+			, uint32_t( m_compressedFormat )
+			, uint32_t( m_compressionOptions.quality )
+			, uint32_t( m_compressedComponent ) };
 		uint32_t srcMips = 1u;
-		m_image = getFileImage( *getRenderSystem()->getEngine()
+		bool fromCache = false;
+		m_gammaCorrection = gammaCorrection;
+		m_image = getFileImage( engine
 			, m_image.getName()
 			, folder
 			, relative
 			, m_image.getLevels()
-			, srcMips );
+			, settings
+			, srcMips
+			, m_cacheKey
+			, fromCache );
+		auto & buffer = *m_image.getPixels();
+		// Only the compressed images are cached when compression is requested.
+		m_compressionApplied = fromCache
+			&& m_compressedFormat != PixelFormat::eUNDEFINED;
+
+		if ( !fromCache )
+		{
+			if ( srcMips < buffer.getLevels()
+				&& m_image.getLayout().depthLayers() == 1u
+				&& PF::generateMipmaps( buffer, { gammaCorrection, 0u } ) )
+			{
+				srcMips = buffer.getLevels();
+			}
+
+			if ( srcMips < buffer.getLevels() )
+			{
+				// Incomplete mip chains are completed on GPU, hence not cached.
+				m_cacheKey = 0u;
+			}
+			else if ( m_compressedFormat == PixelFormat::eUNDEFINED )
+			{
+				engine.getTextureCache().save( m_cacheKey, buffer );
+				m_cacheKey = 0u;
+			}
+		}
+
 		doUpdateCreateInfo( m_image.getLayout() );
 		doUpdateMips( false, srcMips );
 		m_static = true;
@@ -1323,4 +1528,129 @@ namespace castor3d
 	}
 
 	//************************************************************************************************
+
+	void TextureLayout::doCompress( RenderDevice const & device )
+	{
+		if ( !isStatic()
+			|| getDepth() > 1u
+			|| getLayersCount() > 1u )
+		{
+			return;
+		}
+
+		auto source = m_image.getPixels();
+
+		if ( PF::isCompressed( source->getFormat() ) )
+		{
+			doDecompress( device );
+			return;
+		}
+
+		if ( m_compressedFormat == PixelFormat::eUNDEFINED
+			|| !PF::isBlockCompressionSupported( m_compressedFormat ) )
+		{
+			return;
+		}
+
+		auto format = getCompressedFormat( m_compressedFormat, source->getFormat() );
+		auto props = device->getPhysicalDevice().getFormatProperties( VkFormat( format ) );
+		auto supported = checkFlag( props.optimalTilingFeatures, VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT );
+		auto singleComponent = m_compressedFormat == PixelFormat::eBC4_UNORM_BLOCK
+			&& m_compressedComponent != PixelComponent::eRed;
+
+		if ( !supported )
+		{
+			log::warn << "Block compressed format [" << PF::getFormatName( format )
+				<< "] is not supported, [" << getName() << "] won't be compressed." << std::endl;
+
+			if ( !singleComponent )
+			{
+				return;
+			}
+		}
+
+		// Even uncompressed, a single component image is moved to red, like the compressed one.
+		m_compressionApplied = true;
+
+		auto genNeeded = supported
+			&& m_info->mipLevels > 1u
+			&& m_defaultView.view->isMipmapsGenerationNeeded();
+		auto buffer = PxBufferBase::create( source->getDimensions()
+			, 1u
+			, source->getLevels()
+			, PixelFormat::eR8G8B8A8_UNORM
+			, source->getConstPtr()
+			, source->getFormat() );
+
+		if ( genNeeded )
+		{
+			buffer->update( 1u, m_info->mipLevels );
+			PF::generateMipmaps( *buffer, { m_gammaCorrection, 0u } );
+		}
+
+		if ( singleComponent )
+		{
+			// The texture configuration expects the component in red.
+			moveToRed( *buffer, m_compressedComponent );
+		}
+
+		if ( source->isFlipped() )
+		{
+			buffer->flip();
+		}
+
+		if ( supported )
+		{
+			buffer = PF::compressBuffer( buffer
+				, format
+				, m_compressionOptions );
+
+			if ( m_cacheKey )
+			{
+				getRenderSystem()->getEngine()->getTextureCache().save( m_cacheKey, *buffer );
+				m_cacheKey = 0u;
+			}
+		}
+
+		m_image = Image{ m_image.getName()
+			, m_image.getPath()
+			, ImageLayout{ m_image.getLayout().type, *buffer }
+			, buffer };
+		doUpdateCreateInfo( m_image.getLayout() );
+
+		if ( supported )
+		{
+			doUpdateMips( false, buffer->getLevels() );
+		}
+	}
+
+	void TextureLayout::doDecompress( RenderDevice const & device )
+	{
+		auto source = m_image.getPixels();
+		auto props = device->getPhysicalDevice().getFormatProperties( VkFormat( source->getFormat() ) );
+
+		if ( checkFlag( props.optimalTilingFeatures, VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT )
+			|| !PF::isBlockCompressionSupported( source->getFormat() ) )
+		{
+			return;
+		}
+
+		log::warn << "Block compressed format [" << PF::getFormatName( source->getFormat() )
+			<< "] is not supported, [" << getName() << "] is decompressed." << std::endl;
+		auto buffer = PF::decompressBuffer( source );
+		buffer->update( 1u, source->getLevels() );
+		PF::generateMipmaps( *buffer, { m_gammaCorrection, 0u } );
+
+		if ( source->isFlipped() )
+		{
+			buffer->flip();
+		}
+
+		m_image = Image{ m_image.getName()
+			, m_image.getPath()
+			, ImageLayout{ m_image.getLayout().type, *buffer }
+			, buffer };
+		doUpdateCreateInfo( m_image.getLayout() );
+		doUpdateMips( false, buffer->getLevels() );
+	}
 }
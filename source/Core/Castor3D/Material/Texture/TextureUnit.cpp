@@ -298,14 +298,26 @@ namespace castor3d
 		}
 		else if ( m_texture )
 		{
-			result = m_texture->initialise( device );
+			// Material textures are uploaded with the next frame's batch.
+			result = m_texture->initialise( device, true );
+
+			if ( m_compressedConfiguration )
+			{
+				if ( m_texture->isCompressionApplied() )
+				{
+					setConfiguration( *m_compressedConfiguration );
+				}
+
+				m_compressedConfiguration.reset();
+			}
+
 			auto sampler = getSampler();
 			CU_Require( sampler );
 			sampler->initialise( device );
 
 			if ( result && m_texture->getMipmapCount() > 1u )
 			{
-				m_texture->generateMipmaps( device );
+				m_texture->generateMipmaps( device, true );
 			}
 
 			m_descriptor = ashes::WriteDescriptorSet
@@ -409,4 +421,9 @@ namespace castor3d
 		doUpdateShift( m_configuration.transmittanceMask );
 		onChanged( *this );
 	}
+
+	void TextureUnit::setCompressedConfiguration( TextureConfiguration value )
+	{
+		m_compressedConfiguration = std::make_unique< TextureConfiguration >( std::move( value ) );
+	}
 }
@@ -16,6 +16,8 @@
 #include "Castor3D/Scene/Geometry.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -31,6 +33,7 @@ namespace castor3d
 		, Parameters const & parameters
 		, bool initialise )
 	{
+		CU_ProfileScope( "MeshImporter::import" );
 		bool splitSubmeshes = false;
 		m_parameters.get( cuT( "split_mesh" ), splitSubmeshes );
 		m_fileName = fileName;
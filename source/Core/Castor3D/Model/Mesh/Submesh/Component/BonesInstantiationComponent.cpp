@@ -2,6 +2,7 @@
 
 #include "Castor3D/Engine.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Skeleton/Skeleton.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Shader/ShaderBuffer.hpp"
@@ -12,6 +13,20 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		uint32_t getPalettesCapacity( InstantiationComponent const & instantiation
+			, BonesComponent const & bones )
+		{
+			// Each instance only needs its skeleton bones, whatever the instance multiplier.
+			auto skeleton = bones.getSkeleton();
+			auto bonesCount = skeleton
+				? std::max( 1u, uint32_t( skeleton->getBonesCount() ) )
+				: 1u;
+			return instantiation.getMaxRefCount() * bonesCount;
+		}
+	}
+
 	String const BonesInstantiationComponent::Name = cuT( "instantiated_bones" );
 
 	BonesInstantiationComponent::BonesInstantiationComponent( Submesh & submesh
@@ -41,11 +56,10 @@ namespace castor3d
 		{
 			if ( !m_instancedBonesBuffer )
 			{
-				auto stride = uint32_t( sizeof( float ) * 16u * 400u );
-				auto size = count * stride * getOwner()->getOwner()->getScene()->getDirectionalShadowCascades();
+				m_palettes.setCapacity( getPalettesCapacity( m_instantiation, m_bones ) );
 				m_instancedBonesBuffer = std::make_unique< ShaderBuffer >( *getOwner()->getOwner()->getScene()->getEngine()
 					, device
-					, uint32_t( size )
+					, m_palettes.getCapacity() * BonePaletteAllocator::MatrixSize
 					, cuT( "InstancedBonesBuffer" ) );
 			}
 		}
@@ -60,6 +74,7 @@ namespace castor3d
 	void BonesInstantiationComponent::doCleanup()
 	{
 		m_instancedBonesBuffer.reset();
+		m_palettes.setCapacity( 0u );
 	}
 
 	void BonesInstantiationComponent::doFill( RenderDevice const & device )
@@ -67,15 +82,15 @@ namespace castor3d
 		if ( m_instancedBonesBuffer )
 		{
 			auto count = m_instantiation.getMaxRefCount();
-			auto stride = VkDeviceSize( sizeof( float ) * 16u * 400u );
-			auto size = count * stride * getOwner()->getOwner()->getScene()->getDirectionalShadowCascades();
+			auto capacity = getPalettesCapacity( m_instantiation, m_bones );
 
 			if ( count > m_instantiation.getThreshold()
-				&& ( !m_instancedBonesBuffer || m_instancedBonesBuffer->getSize() < size ) )
+				&& ( !m_instancedBonesBuffer || m_palettes.getCapacity() < capacity ) )
 			{
+				m_palettes.setCapacity( capacity );
 				m_instancedBonesBuffer = std::make_unique< ShaderBuffer >( *getOwner()->getOwner()->getScene()->getEngine()
 					, device
-					, uint32_t( size )
+					, m_palettes.getCapacity() * BonePaletteAllocator::MatrixSize
 					, cuT( "InstancedBonesBuffer" ) );
 			}
 			else if ( count <= m_instantiation.getThreshold() )
@@ -212,6 +212,7 @@ namespace castor3d
 					{ RenderPass::VertexInputs::TransformLocation + 2u, BindingPoint, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof( InstantiationData, m_matrix ) + 2u * sizeof( Point4f ) },
 					{ RenderPass::VertexInputs::TransformLocation + 3u, BindingPoint, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof( InstantiationData, m_matrix ) + 3u * sizeof( Point4f ) },
 					{ RenderPass::VertexInputs::MaterialLocation, BindingPoint, VK_FORMAT_R32_SINT, offsetof( InstantiationData, m_material ) },
+					{ RenderPass::VertexInputs::BonesOffsetLocation, BindingPoint, VK_FORMAT_R32_UINT, offsetof( InstantiationData, m_bonesOffset ) },
 					} );
 			}
 
@@ -140,7 +140,8 @@ namespace castor3d
 					auto & vertices = getOwner()->getVertexBuffer();
 
 					m_cameraPosition = cameraPosition;
-					auto indexSize = uint32_t( indices.getCount() );
+					// Only the full detail indices are sorted, the levels of detail ones follow them.
+					auto indexSize = uint32_t( m_faces.size() * 3u );
 
 					if ( uint32_t * index = reinterpret_cast< uint32_t * >( indices.getBuffer().lock( 0
 						, uint32_t( indexSize * sizeof( uint32_t ) )
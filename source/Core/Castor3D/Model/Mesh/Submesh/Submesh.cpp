@@ -4,9 +4,13 @@
 #include "Castor3D/Buffer/GpuBuffer.hpp"
 #include "Castor3D/Cache/MaterialCache.hpp"
 #include "Castor3D/Buffer/GeometryBuffers.hpp"
+#include "Castor3D/Miscellaneous/Logger.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
 #include "Castor3D/Render/RenderPass.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 
+#include <CastorUtils/Graphics/MeshSimplifier.hpp>
+
 namespace castor3d
 {
 	namespace
@@ -76,6 +80,13 @@ namespace castor3d
 			static castor::Point3f const defaultValue{ 0.0f, 0.0f, 0.0f };
 			return fix( value, defaultValue );
 		}
+
+		uint32_t getIndexCount( IndexMapping const * mapping )
+		{
+			return mapping
+				? mapping->getCount() * mapping->getComponentsCount()
+				: 0u;
+		}
 	}
 
 	Submesh::Submesh( Mesh & mesh, uint32_t id )
@@ -97,8 +108,9 @@ namespace castor3d
 		if ( !m_generated )
 		{
 			doGenerateVertexBuffer( device );
+			// The levels of detail indices are stored after the full detail ones.
 			m_indexBuffer = makeBuffer< uint32_t >( device
-				, VkDeviceSize( m_indexMapping->getCount() ) * m_indexMapping->getComponentsCount()
+				, VkDeviceSize( getIndexCount( m_indexMapping.get() ) ) + m_lodIndices.size()
 				, VK_BUFFER_USAGE_INDEX_BUFFER_BIT
 				, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
 				, m_parentMesh.getName() + "Submesh" + castor::string::toString( m_id ) + "IndexBuffer" );
@@ -110,6 +122,8 @@ namespace castor3d
 				component.second->upload();
 			}
 
+			doUploadLods();
+
 			if ( !m_vertexLayout )
 			{
 				m_vertexLayout = std::make_unique< ashes::PipelineVertexInputStateCreateInfo >( 0u
@@ -335,6 +349,133 @@ namespace castor3d
 		if ( m_indexMapping )
 		{
 			m_indexMapping->sortByDistance( cameraPosition );
+			// The sorted faces don't follow the meshlets anymore.
+			m_meshlets.clear();
+		}
+	}
+
+	void Submesh::generateLods( uint32_t count
+		, float ratio )
+	{
+		auto mapping = getComponent< TriFaceMapping >();
+
+		if ( !mapping
+			|| m_topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST )
+		{
+			log::warn << cuT( "Submesh::generateLods - Levels of detail are only generated for triangle lists." ) << std::endl;
+			return;
+		}
+
+		if ( m_generated )
+		{
+			log::warn << cuT( "Submesh::generateLods - The submesh buffers are already generated." ) << std::endl;
+			return;
+		}
+
+		CU_Require( ratio > 0.0f && ratio < 1.0f );
+		m_lods.clear();
+		m_lodIndices.clear();
+		std::vector< castor::Point3f > positions;
+		positions.reserve( m_points.size() );
+
+		for ( auto & point : m_points )
+		{
+			positions.push_back( point.pos );
+		}
+
+		castor::UInt32Array indices;
+		indices.reserve( mapping->getFaces().size() * 3u );
+
+		for ( auto & face : mapping->getFaces() )
+		{
+			indices.insert( indices.end(), { face[0], face[1], face[2] } );
+		}
+
+		// Each level is simplified from the previous one, and the generation stops
+		// when the simplification doesn't bring enough reduction anymore.
+		static float constexpr MinReduction = 0.9f;
+		castor::MeshSimplifier simplifier{ positions, indices };
+
+		for ( uint32_t lod = 0u; lod < count; ++lod )
+		{
+			auto previous = simplifier.getIndexCount();
+			auto target = uint32_t( float( previous ) * ratio ) / 3u * 3u;
+			auto current = simplifier.simplify( target );
+
+			if ( current == 0u
+				|| float( current ) > float( previous ) * MinReduction )
+			{
+				break;
+			}
+
+			addLod( simplifier.getIndices(), simplifier.getError() );
+		}
+	}
+
+	void Submesh::addLod( castor::UInt32Array const & indices
+		, float error )
+	{
+		CU_Require( !m_generated );
+		m_lods.push_back( { uint32_t( m_lodIndices.size() )
+			, uint32_t( indices.size() )
+			, error } );
+		m_lodIndices.insert( m_lodIndices.end(), indices.begin(), indices.end() );
+	}
+
+	SubmeshLod Submesh::getLod( uint32_t lod )const
+	{
+		auto baseCount = getIndexCount( m_indexMapping.get() );
+
+		if ( lod == 0u || lod > m_lods.size() )
+		{
+			return { 0u, baseCount, 0.0f };
+		}
+
+		auto result = m_lods[lod - 1u];
+		result.firstIndex += baseCount;
+		return result;
+	}
+
+	void Submesh::generateMeshlets()
+	{
+		auto mapping = getComponent< TriFaceMapping >();
+
+		if ( !mapping
+			|| m_topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST )
+		{
+			log::warn << cuT( "Submesh::generateMeshlets - Meshlets are only generated for triangle lists." ) << std::endl;
+			return;
+		}
+
+		if ( m_generated )
+		{
+			log::warn << cuT( "Submesh::generateMeshlets - The submesh buffers are already generated." ) << std::endl;
+			return;
+		}
+
+		std::vector< castor::Point3f > positions;
+		positions.reserve( m_points.size() );
+
+		for ( auto & point : m_points )
+		{
+			positions.push_back( point.pos );
+		}
+
+		auto & faces = mapping->getFaces();
+		castor::UInt32Array indices;
+		indices.reserve( faces.size() * 3u );
+
+		for ( auto & face : faces )
+		{
+			indices.insert( indices.end(), { face[0], face[1], face[2] } );
+		}
+
+		m_meshlets = castor::meshlet::build( positions, indices );
+		faces.clear();
+
+		for ( auto it = indices.begin(); it != indices.end(); it += 3 )
+		{
+			faces.emplace_back( it[0], it[1], it[2] );
 		}
 	}
 
@@ -390,7 +531,7 @@ namespace castor3d
 			result.layouts = layouts;
 			result.ibo = &m_indexBuffer->getBuffer();
 			result.iboOffset = 0u;
-			result.idxCount = uint32_t( m_indexBuffer->getCount() );
+			result.idxCount = getIndexCount( m_indexMapping.get() );
 			result.vtxCount = 0u;
 			it = m_geometryBuffers.emplace( material, std::move( result ) ).first;
 		}
@@ -426,4 +567,20 @@ namespace castor3d
 			//m_points.clear();
 		}
 	}
+
+	void Submesh::doUploadLods()
+	{
+		auto baseCount = getIndexCount( m_indexMapping.get() );
+		auto count = uint32_t( m_lodIndices.size() );
+
+		if ( count )
+		{
+			if ( auto buffer = m_indexBuffer->lock( baseCount, count, 0u ) )
+			{
+				std::copy( m_lodIndices.begin(), m_lodIndices.end(), buffer );
+				m_indexBuffer->flush( baseCount, count );
+				m_indexBuffer->unlock();
+			}
+		}
+	}
 }
@@ -4,10 +4,314 @@
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Model/Vertex.hpp"
 
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define C3D_SubmeshUtilsSSE2 1
+#	include <emmintrin.h>
+#else
+#	define C3D_SubmeshUtilsSSE2 0
+#endif
+
 using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		// Below this faces count per thread, the threads cost more than they save.
+		static size_t constexpr MinFacesPerThread = 16384u;
+
+#if C3D_SubmeshUtilsSSE2
+
+		using Vec4 = __m128;
+
+		Vec4 zero()
+		{
+			return _mm_setzero_ps();
+		}
+
+		Vec4 load( castor::Point3f const & value )
+		{
+			return _mm_setr_ps( value[0], value[1], value[2], 0.0f );
+		}
+
+		Vec4 load( std::array< float, 4u > const & value )
+		{
+			return _mm_load_ps( value.data() );
+		}
+
+		void store( Vec4 const & value
+			, std::array< float, 4u > & result )
+		{
+			_mm_store_ps( result.data(), value );
+		}
+
+		Vec4 add( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			return _mm_add_ps( lhs, rhs );
+		}
+
+		Vec4 sub( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			return _mm_sub_ps( lhs, rhs );
+		}
+
+		Vec4 mul( Vec4 const & lhs, float rhs )
+		{
+			return _mm_mul_ps( lhs, _mm_set1_ps( rhs ) );
+		}
+
+		Vec4 cross( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			auto lhsYZX = _mm_shuffle_ps( lhs, lhs, _MM_SHUFFLE( 3, 0, 2, 1 ) );
+			auto rhsYZX = _mm_shuffle_ps( rhs, rhs, _MM_SHUFFLE( 3, 0, 2, 1 ) );
+			auto result = _mm_sub_ps( _mm_mul_ps( lhs, rhsYZX ), _mm_mul_ps( lhsYZX, rhs ) );
+			return _mm_shuffle_ps( result, result, _MM_SHUFFLE( 3, 0, 2, 1 ) );
+		}
+
+		float dot( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			auto products = _mm_mul_ps( lhs, rhs );
+			auto shuffled = _mm_shuffle_ps( products, products, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+			auto sums = _mm_add_ps( products, shuffled );
+			shuffled = _mm_movehl_ps( shuffled, sums );
+			return _mm_cvtss_f32( _mm_add_ss( sums, shuffled ) );
+		}
+
+#else
+
+		using Vec4 = std::array< float, 4u >;
+
+		Vec4 zero()
+		{
+			return Vec4{};
+		}
+
+		Vec4 load( castor::Point3f const & value )
+		{
+			return Vec4{ value[0], value[1], value[2], 0.0f };
+		}
+
+		Vec4 load( std::array< float, 4u > const & value )
+		{
+			return value;
+		}
+
+		void store( Vec4 const & value
+			, std::array< float, 4u > & result )
+		{
+			result = value;
+		}
+
+		Vec4 add( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			return Vec4{ lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], 0.0f };
+		}
+
+		Vec4 sub( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			return Vec4{ lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], 0.0f };
+		}
+
+		Vec4 mul( Vec4 const & lhs, float rhs )
+		{
+			return Vec4{ lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs, 0.0f };
+		}
+
+		Vec4 cross( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			return Vec4{ lhs[1] * rhs[2] - lhs[2] * rhs[1]
+				, lhs[2] * rhs[0] - lhs[0] * rhs[2]
+				, lhs[0] * rhs[1] - lhs[1] * rhs[0]
+				, 0.0f };
+		}
+
+		float dot( Vec4 const & lhs, Vec4 const & rhs )
+		{
+			return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+		}
+
+#endif
+
+		Vec4 normalise( Vec4 const & value )
+		{
+			auto length = std::sqrt( dot( value, value ) );
+			return length == 0.0f
+				? value
+				: mul( value, 1.0f / length );
+		}
+
+		castor::Point3f toPoint( std::array< float, 4u > const & value )
+		{
+			return castor::Point3f{ value[0], value[1], value[2] };
+		}
+
+#if C3D_SubmeshUtilsSSE2
+
+		castor::Point3f toPoint( Vec4 const & value )
+		{
+			alignas( 16 ) std::array< float, 4u > result;
+			store( value, result );
+			return toPoint( result );
+		}
+
+#endif
+
+		castor::Point3f getOrthogonal( castor::Point3f const & normal )
+		{
+			auto axis = std::abs( normal[0] ) < 0.9f
+				? castor::Point3f{ 1.0f, 0.0f, 0.0f }
+				: castor::Point3f{ 0.0f, 1.0f, 0.0f };
+			return point::getNormalised( point::cross( normal, axis ) );
+		}
+
+		std::array< float, 3u > getAngles( InterleavedVertexArray const & points
+			, Face const & face )
+		{
+			std::array< float, 3u > result;
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				auto const position = load( points[face[i]].pos );
+				auto const edge1 = normalise( sub( load( points[face[( i + 1u ) % 3u]].pos ), position ) );
+				auto const edge2 = normalise( sub( load( points[face[( i + 2u ) % 3u]].pos ), position ) );
+				result[i] = std::acos( std::clamp( dot( edge1, edge2 ), -1.0f, 1.0f ) );
+			}
+
+			return result;
+		}
+
+		template< size_t CountT >
+		struct alignas( 16 ) VertexSumsT
+		{
+			std::array< std::array< float, 4u >, CountT > values{};
+		};
+
+		template< size_t CountT >
+		struct ContributionT
+		{
+			Vec4 values[CountT];
+		};
+
+		template< size_t CountT >
+		using VertexSumsArrayT = std::vector< VertexSumsT< CountT > >;
+
+		uint32_t getThreadsCount( size_t facesCount
+			, uint32_t threadsCount )
+		{
+			threadsCount = threadsCount ? threadsCount : getParallelThreadsCount();
+			return uint32_t( std::max( size_t( 1u )
+				, std::min( size_t( threadsCount ), facesCount / MinFacesPerThread ) ) );
+		}
+
+		template< size_t CountT, typename FaceFuncT >
+		void accumulateRange( Face const * begin
+			, Face const * end
+			, uint32_t first
+			, VertexSumsArrayT< CountT > & sums
+			, FaceFuncT const & faceFunc )
+		{
+			std::array< ContributionT< CountT >, 3u > contributions;
+
+			for ( auto face = begin; face != end; ++face )
+			{
+				faceFunc( *face, contributions );
+
+				for ( uint32_t i = 0u; i < 3u; ++i )
+				{
+					auto & vertexSums = sums[( *face )[i] - first];
+
+					for ( size_t value = 0u; value < CountT; ++value )
+					{
+						store( add( load( vertexSums.values[value] ), contributions[i].values[value] )
+							, vertexSums.values[value] );
+					}
+				}
+			}
+		}
+
+		template< size_t CountT, typename FaceFuncT >
+		VertexSumsArrayT< CountT > accumulate( size_t verticesCount
+			, FaceArray const & faces
+			, uint32_t threadsCount
+			, FaceFuncT const & faceFunc )
+		{
+			VertexSumsArrayT< CountT > result( verticesCount );
+
+			if ( threadsCount == 1u )
+			{
+				accumulateRange< CountT >( faces.data()
+					, faces.data() + faces.size()
+					, 0u
+					, result
+					, faceFunc );
+				return result;
+			}
+
+			// Each part accumulates in its own buffer, covering only the vertices used by its faces.
+			std::vector< VertexSumsArrayT< CountT > > parts( threadsCount );
+			std::vector< uint32_t > firsts( threadsCount, 0u );
+			parallelFor( faces.size()
+				, threadsCount
+				, [&faces, &parts, &firsts, &faceFunc]( uint32_t part, size_t begin, size_t end )
+				{
+					if ( begin == end )
+					{
+						return;
+					}
+
+					auto first = std::numeric_limits< uint32_t >::max();
+					auto last = 0u;
+
+					for ( auto index = begin; index < end; ++index )
+					{
+						for ( uint32_t i = 0u; i < 3u; ++i )
+						{
+							first = std::min( first, faces[index][i] );
+							last = std::max( last, faces[index][i] );
+						}
+					}
+
+					firsts[part] = first;
+					parts[part].resize( last - first + 1u );
+					accumulateRange< CountT >( faces.data() + begin
+						, faces.data() + end
+						, first
+						, parts[part]
+						, faceFunc );
+				} );
+			// Then the parts are reduced, each thread summing a vertices range.
+			parallelFor( verticesCount
+				, threadsCount
+				, [&result, &parts, &firsts]( uint32_t, size_t begin, size_t end )
+				{
+					for ( size_t part = 0u; part < parts.size(); ++part )
+					{
+						auto partBegin = std::max( begin, size_t( firsts[part] ) );
+						auto partEnd = std::min( end, size_t( firsts[part] ) + parts[part].size() );
+
+						for ( auto index = partBegin; index < partEnd; ++index )
+						{
+							auto & sums = result[index];
+							auto & partSums = parts[part][index - firsts[part]];
+
+							for ( size_t value = 0u; value < CountT; ++value )
+							{
+								store( add( load( sums.values[value] ), load( partSums.values[value] ) )
+									, sums.values[value] );
+							}
+						}
+					}
+				} );
+			return result;
+		}
+	}
+
 	void SubmeshUtils::computeFacesFromPolygonVertex( Submesh & submesh
 		, TriFaceMapping & triFace )
 	{
@@ -36,71 +340,69 @@ namespace castor3d
 
 	void SubmeshUtils::computeNormals( Submesh & submesh
 		, TriFaceMapping & triFace
-		, bool reverted )
+		, bool reverted
+		, NormalWeighting weighting )
 	{
-		auto & points = submesh.getPoints();
-		auto & faces = triFace.getFaces();
-		castor::Point3f pt0;
-
-		// First we flush normals and tangents
-		for ( auto & pt : points )
-		{
-			pt.nml = pt0;
-			pt.tan = pt0;
-		}
-
-		castor::Coords3f coord;
+		computeNormals( submesh.getPoints()
+			, triFace.getFaces()
+			, reverted
+			, weighting );
+	}
 
-		// Then we compute normals and tangents
-		if ( reverted )
-		{
-			for ( auto const & face : faces )
-			{
-				auto & vtx1 = points[face[0]];
-				auto & vtx2 = points[face[2]];
-				auto & vtx3 = points[face[1]];
-				auto const vec2m1 = vtx2.pos - vtx1.pos;
-				auto const vec3m1 = vtx3.pos - vtx1.pos;
-				auto const tex2m1 = vtx2.tex - vtx1.tex;
-				auto const tex3m1 = vtx3.tex - vtx1.tex;
-				auto const faceNormal = -point::cross( vec3m1, vec2m1 );
-				auto const faceTangent = ( vec3m1 * tex2m1[1] ) - ( vec2m1 * tex3m1[1] );
-				vtx1.nml += faceNormal;
-				vtx2.nml += faceNormal;
-				vtx3.nml += faceNormal;
-				vtx1.tan += faceTangent;
-				vtx2.tan += faceTangent;
-				vtx3.tan += faceTangent;
-			}
-		}
-		else
-		{
-			for ( auto const & face : faces )
+	void SubmeshUtils::computeNormals( InterleavedVertexArray & points
+		, FaceArray const & faces
+		, bool reverted
+		, NormalWeighting weighting
+		, uint32_t threadsCount )
+	{
+		threadsCount = getThreadsCount( faces.size(), threadsCount );
+		auto sums = accumulate< 2u >( points.size()
+			, faces
+			, threadsCount
+			, [&points, reverted, weighting]( Face const & face
+				, std::array< ContributionT< 2u >, 3u > & contributions )
 			{
 				auto & vtx1 = points[face[0]];
-				auto & vtx2 = points[face[1]];
-				auto & vtx3 = points[face[2]];
-				auto const vec2m1 = vtx2.pos - vtx1.pos;
-				auto const vec3m1 = vtx3.pos - vtx1.pos;
-				auto const tex2m1 = vtx2.tex - vtx1.tex;
-				auto const tex3m1 = vtx3.tex - vtx1.tex;
-				auto const faceNormal = -point::cross( vec3m1, vec2m1 );
-				auto const faceTangent = ( vec3m1 * tex2m1[1] ) - ( vec2m1 * tex3m1[1] );
-				vtx1.nml += faceNormal;
-				vtx2.nml += faceNormal;
-				vtx3.nml += faceNormal;
-				vtx1.tan += faceTangent;
-				vtx2.tan += faceTangent;
-				vtx3.tan += faceTangent;
-			}
-		}
+				auto & vtx2 = points[reverted ? face[2] : face[1]];
+				auto & vtx3 = points[reverted ? face[1] : face[2]];
+				auto const vec2m1 = sub( load( vtx2.pos ), load( vtx1.pos ) );
+				auto const vec3m1 = sub( load( vtx3.pos ), load( vtx1.pos ) );
+				auto const tex2m1 = vtx2.tex[1] - vtx1.tex[1];
+				auto const tex3m1 = vtx3.tex[1] - vtx1.tex[1];
+				auto const faceNormal = cross( vec2m1, vec3m1 );
+				auto const faceTangent = sub( mul( vec3m1, tex2m1 ), mul( vec2m1, tex3m1 ) );
 
-		// Eventually we normalize the normals and tangents
-		for ( auto & vtx : points )
-		{
-			point::normalise( vtx.nml );
-			point::normalise( vtx.tan );
-		}
+				if ( weighting == NormalWeighting::eAngle )
+				{
+					auto const angles = getAngles( points, face );
+					auto const normal = normalise( faceNormal );
+
+					for ( uint32_t i = 0u; i < 3u; ++i )
+					{
+						contributions[i].values[0] = mul( normal, angles[i] );
+						contributions[i].values[1] = faceTangent;
+					}
+				}
+				else
+				{
+					for ( auto & contribution : contributions )
+					{
+						contribution.values[0] = faceNormal;
+						contribution.values[1] = faceTangent;
+					}
+				}
+			} );
+		parallelFor( points.size()
+			, threadsCount
+			, [&points, &sums]( uint32_t, size_t begin, size_t end )
+			{
+				for ( auto index = begin; index < end; ++index )
+				{
+					auto & vtx = points[index];
+					vtx.nml = toPoint( normalise( load( sums[index].values[0] ) ) );
+					vtx.tan = toPoint( normalise( load( sums[index].values[1] ) ) );
+				}
+			} );
 	}
 
 	void SubmeshUtils::computeNormals( Submesh & submesh
@@ -137,50 +439,88 @@ namespace castor3d
 	}
 
 	void SubmeshUtils::computeTangentsFromNormals( Submesh & submesh
-		, TriFaceMapping & triFace )
+		, TriFaceMapping & triFace
+		, TangentsMode mode )
 	{
-		auto & points = submesh.getPoints();
-		auto & faces = triFace.getFaces();
-		castor::Point3fArray arrayTangents( points.size() );
+		computeTangentsFromNormals( submesh.getPoints()
+			, triFace.getFaces()
+			, mode );
+	}
 
-		// Pour chaque vertex, on stocke la somme des tangentes qui peuvent lui être affectées
-		for ( auto const & face : faces )
-		{
-			auto & vtx1 = points[face[0]];
-			auto & vtx2 = points[face[1]];
-			auto & vtx3 = points[face[2]];
-			auto const vec2m1 = vtx2.pos - vtx1.pos;
-			auto const vec3m1 = vtx3.pos - vtx1.pos;
-			auto const tex2m1 = vtx2.tex - vtx1.tex;
-			auto const tex3m1 = vtx3.tex - vtx1.tex;
+	void SubmeshUtils::computeTangentsFromNormals( InterleavedVertexArray & points
+		, FaceArray const & faces
+		, TangentsMode mode
+		, uint32_t threadsCount )
+	{
+		threadsCount = getThreadsCount( faces.size(), threadsCount );
+		auto sums = accumulate< 1u >( points.size()
+			, faces
+			, threadsCount
+			, [&points, mode]( Face const & face
+				, std::array< ContributionT< 1u >, 3u > & contributions )
+			{
+				auto & vtx1 = points[face[0]];
+				auto & vtx2 = points[face[1]];
+				auto & vtx3 = points[face[2]];
+				auto const vec2m1 = sub( load( vtx2.pos ), load( vtx1.pos ) );
+				auto const vec3m1 = sub( load( vtx3.pos ), load( vtx1.pos ) );
+				auto const tex2m1 = vtx2.tex - vtx1.tex;
+				auto const tex3m1 = vtx3.tex - vtx1.tex;
+
+				// Calculates the triangle's area.
+				float dirCorrection = tex2m1[0] * tex3m1[1] - tex2m1[1] * tex3m1[0];
+				Vec4 faceTangent = zero();
 
-			// Calculates the triangle's area.
-			float dirCorrection = tex2m1[0] * tex3m1[1] - tex2m1[1] * tex3m1[0];
-			castor::Point3f faceTangent;
+				if ( dirCorrection )
+				{
+					// Calculates the face tangent to the current triangle.
+					faceTangent = mul( sub( mul( vec2m1, tex3m1[1] ), mul( vec3m1, tex2m1[1] ) )
+						, 1.0f / dirCorrection );
+				}
 
-			if ( dirCorrection )
+				if ( mode == TangentsMode::eMikkTSpace )
+				{
+					// The face tangent is projected on each vertex tangent plane, then weighted by the face angle.
+					auto const angles = getAngles( points, face );
+
+					for ( uint32_t i = 0u; i < 3u; ++i )
+					{
+						auto const normal = load( points[face[i]].nml );
+						auto const tangent = sub( faceTangent, mul( normal, dot( normal, faceTangent ) ) );
+						contributions[i].values[0] = mul( normalise( tangent ), angles[i] );
+					}
+				}
+				else
+				{
+					for ( auto & contribution : contributions )
+					{
+						contribution.values[0] = faceTangent;
+					}
+				}
+			} );
+		parallelFor( points.size()
+			, threadsCount
+			, [&points, &sums, mode]( uint32_t, size_t begin, size_t end )
 			{
-				dirCorrection = 1 / dirCorrection;
-				// Calculates the face tangent to the current triangle.
-				faceTangent[0] = dirCorrection * ( ( vec2m1[0] * tex3m1[1] ) + ( vec3m1[0] * -tex2m1[1] ) );
-				faceTangent[1] = dirCorrection * ( ( vec2m1[1] * tex3m1[1] ) + ( vec3m1[1] * -tex2m1[1] ) );
-				faceTangent[2] = dirCorrection * ( ( vec2m1[2] * tex3m1[1] ) + ( vec3m1[2] * -tex2m1[1] ) );
-			}
+				for ( auto index = begin; index < end; ++index )
+				{
+					auto & vtx = points[index];
+					castor::Point3f tangent = point::getNormalised( toPoint( sums[index].values[0] ) );
+					tangent -= vtx.nml * castor::point::dot( tangent, vtx.nml );
 
-			arrayTangents[face[0]] += faceTangent;
-			arrayTangents[face[1]] += faceTangent;
-			arrayTangents[face[2]] += faceTangent;
-		}
+					if ( mode == TangentsMode::eMikkTSpace )
+					{
+						point::normalise( tangent );
 
-		uint32_t i = 0;
-		// Average tangents
-		for ( auto & value : arrayTangents )
-		{
-			auto & point = points[i];
-			castor::Point3f tangent = point::getNormalised( value );
-			tangent -= point.nml * castor::point::dot( tangent, point.nml );
-			point.tan = tangent;
-			i++;
-		}
+						if ( point::length( tangent ) == 0.0 )
+						{
+							// No texture gradient, any vector in the tangent plane will do.
+							tangent = getOrthogonal( vtx.nml );
+						}
+					}
+
+					vtx.tan = tangent;
+				}
+			} );
 	}
 }
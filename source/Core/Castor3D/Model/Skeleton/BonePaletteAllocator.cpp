@@ -0,0 +1,35 @@
+#include "Castor3D/Model/Skeleton/BonePaletteAllocator.hpp"
+
+namespace castor3d
+{
+	BonePaletteAllocator::BonePaletteAllocator( uint32_t capacity )
+		: m_capacity{ capacity }
+	{
+	}
+
+	void BonePaletteAllocator::setCapacity( uint32_t capacity )
+	{
+		m_capacity = capacity;
+		reset();
+	}
+
+	void BonePaletteAllocator::reset()
+	{
+		m_allocated = 0u;
+		m_palettes = 0u;
+	}
+
+	uint32_t BonePaletteAllocator::allocate( uint32_t count )
+	{
+		if ( count > m_capacity - m_allocated )
+		{
+			return InvalidIndex;
+		}
+
+		auto result = m_allocated;
+		m_allocated += count;
+		m_totalBytes += uint64_t( count ) * MatrixSize;
+		++m_palettes;
+		return result;
+	}
+}
@@ -0,0 +1,80 @@
+#include "Castor3D/Overlay/OverlayDrawBatcher.hpp"
+
+#include <algorithm>
+
+namespace castor3d
+{
+	namespace
+	{
+		bool overlaps( castor::Rectangle const & lhs
+			, castor::Rectangle const & rhs )
+		{
+			return lhs.left() < rhs.right()
+				&& rhs.left() < lhs.right()
+				&& lhs.top() < rhs.bottom()
+				&& rhs.top() < lhs.bottom();
+		}
+	}
+
+	OverlayDrawBatcher::OverlayDrawBatcher( uint32_t lookback )
+		: m_lookback{ lookback }
+	{
+	}
+
+	void OverlayDrawBatcher::clear()
+	{
+		for ( auto it = m_draws.begin(); it != m_draws.begin() + m_count; ++it )
+		{
+			it->items.clear();
+		}
+
+		m_count = 0u;
+		m_itemsCount = 0u;
+	}
+
+	uint32_t OverlayDrawBatcher::add( size_t key
+		, castor::Rectangle const & bounds
+		, uint32_t item )
+	{
+		++m_itemsCount;
+		auto first = m_count > m_lookback
+			? m_count - m_lookback
+			: 0u;
+		auto index = m_count;
+
+		// Walk back through the draws, until one shares the key,
+		// or one overlaps the overlay, which must then be drawn after it.
+		while ( index > first )
+		{
+			auto & draw = m_draws[index - 1u];
+
+			if ( draw.key == key )
+			{
+				draw.bounds.set( std::min( draw.bounds.left(), bounds.left() )
+					, std::min( draw.bounds.top(), bounds.top() )
+					, std::max( draw.bounds.right(), bounds.right() )
+					, std::max( draw.bounds.bottom(), bounds.bottom() ) );
+				draw.items.push_back( item );
+				return index - 1u;
+			}
+
+			if ( overlaps( draw.bounds, bounds ) )
+			{
+				break;
+			}
+
+			--index;
+		}
+
+		if ( m_count == m_draws.size() )
+		{
+			m_draws.emplace_back();
+		}
+
+		auto & draw = m_draws[m_count];
+		draw.key = key;
+		draw.bounds = bounds;
+		draw.items.push_back( item );
+		return m_count++;
+	}
+}
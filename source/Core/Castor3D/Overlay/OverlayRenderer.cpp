@@ -39,8 +39,6 @@ namespace castor3d
 {
 	//*********************************************************************************************
 
-	static int32_t constexpr MaxCharsPerBuffer = 6000;
-	static uint32_t constexpr MaxPanelsPerBuffer = 100u;
 
 	namespace
 	{
@@ -50,34 +48,15 @@ namespace castor3d
 		static uint32_t constexpr TextMapBinding = 5u;
 		static uint32_t constexpr MapsBinding = 6u;
 
-		template< typename VertexT, typename BufferIndexT >
-		uint32_t doFillBuffers( typename std::vector< VertexT >::const_iterator begin
-			, uint32_t count
-			, BufferIndexT & bufferIndex )
-		{
-			auto const & vertex = *begin;
-			auto size = count * sizeof( VertexT );
-			std::memcpy( &bufferIndex.pool.data[bufferIndex.index], &vertex, size );
-			return count;
-		}
-
 		template< typename T >
 		void doUpdateUbo( UniformBufferOffsetT< T > & overlayUbo
 			, UniformBufferOffsetT< TexturesUbo::Configuration > & texturesUbo
-			, OverlayCategory const & overlay
 			, Pass const & pass
 			, Size const & size )
 		{
+			// The overlays positions are baked into the vertices, so only the pass related data remains.
 			auto & data = overlayUbo.getData();
-			auto position = overlay.getAbsolutePosition();
-			auto ratio = overlay.getRenderRatio( size );
-			data.positionRatio = Point4f
-			{
-				position[0],
-				position[1],
-				ratio[0],
-				ratio[1],
-			};
+			data.positionRatio = Point4f{ 0.0f, 0.0f, 1.0f, 1.0f };
 			data.renderSizeIndex = Point4i
 			{
 				size.getWidth(),
@@ -95,40 +74,42 @@ namespace castor3d
 			}
 		}
 
-		template< typename OverlayT, typename QuadT >
-		struct BorderSizeGetter
+		castor::Rectangle getBorderSize( BorderPanelOverlay const & overlay
+			, castor::Size const & size )
 		{
-			castor::Rectangle operator()( OverlayT const & overlay, castor::Size const & size )const
+			castor::Rectangle result = overlay.getAbsoluteBorderSize( size );
+
+			switch ( overlay.getBorderPosition() )
 			{
-				return castor::Rectangle{};
+			case BorderPosition::eMiddle:
+				result.set( result.left() / 2
+					, result.top() / 2
+					, result.right() / 2
+					, result.bottom() / 2 );
+				break;
+			case BorderPosition::eExternal:
+				break;
+			default:
+				result = castor::Rectangle{};
+				break;
 			}
-		};
 
-		template<>
-		struct BorderSizeGetter< BorderPanelOverlay, OverlayRenderer::BorderPanelVertexBufferPool::Quad >
+			return result;
+		}
+
+		template< typename VertexT >
+		void bakeVertices( std::vector< VertexT > const & src
+			, castor::Point2f const & offset
+			, castor::Point2f const & scale
+			, std::vector< VertexT > & dst )
 		{
-			castor::Rectangle operator()( BorderPanelOverlay const & overlay, castor::Size const & size )const
+			for ( auto vertex : src )
 			{
-				castor::Rectangle result = overlay.getAbsoluteBorderSize( size );
-
-				switch ( overlay.getBorderPosition() )
-				{
-				case BorderPosition::eMiddle:
-					result.set( result.left() / 2
-						, result.top() / 2
-						, result.right() / 2
-						, result.bottom() / 2 );
-					break;
-				case BorderPosition::eExternal:
-					break;
-				default:
-					result = castor::Rectangle{};
-					break;
-				}
-
-				return result;
+				vertex.coords[0] = ( offset[0] + vertex.coords[0] ) * scale[0];
+				vertex.coords[1] = ( offset[1] + vertex.coords[1] ) * scale[1];
+				dst.push_back( vertex );
 			}
-		};
+		}
 
 		enum class OverlayTexture : uint32_t
 		{
@@ -177,12 +158,11 @@ namespace castor3d
 			{
 				if ( !pass->isImplicit() )
 				{
-					doPrepareOverlay< PanelVertexBufferPool::Quad >( m_device
+					doPrepareOverlay( m_device
 						, overlay
 						, *pass
-						, m_renderer.m_panelOverlays
-						, m_renderer.m_panelVertexBuffers
 						, overlay.getPanelVertex()
+						, castor::Rectangle{}
 						, nullptr );
 				}
 			}
@@ -197,12 +177,11 @@ namespace castor3d
 			{
 				if ( !pass->isImplicit() )
 				{
-					doPrepareOverlay< PanelVertexBufferPool::Quad >( m_device
+					doPrepareOverlay( m_device
 						, overlay
 						, *pass
-						, m_renderer.m_panelOverlays
-						, m_renderer.m_panelVertexBuffers
 						, overlay.getPanelVertex()
+						, castor::Rectangle{}
 						, nullptr );
 				}
 			}
@@ -214,12 +193,11 @@ namespace castor3d
 			{
 				if ( !pass->isImplicit() )
 				{
-					doPrepareOverlay< BorderPanelVertexBufferPool::Quad >( m_device
+					doPrepareOverlay( m_device
 						, overlay
 						, *pass
-						, m_renderer.m_borderPanelOverlays
-						, m_renderer.m_borderVertexBuffers
 						, overlay.getBorderVertex()
+						, getBorderSize( overlay, m_renderer.m_size )
 						, nullptr );
 				}
 			}
@@ -234,225 +212,104 @@ namespace castor3d
 			{
 				if ( !pass->isImplicit() )
 				{
-					doPrepareOverlay< TextVertexBufferPool::Quad >( m_device
+					doPrepareOverlay( m_device
 						, overlay
 						, *pass
-						, m_renderer.m_textOverlays
-						, m_renderer.m_textVertexBuffers
 						, overlay.getTextVertex()
+						, castor::Rectangle{}
 						, overlay.getFontTexture() );
 				}
 			}
 		}
 	}
 
-	//*********************************************************************************************
-
 	namespace
 	{
-		template< typename VertexBufferIndexT, typename VertexBufferPoolT >
-		VertexBufferIndexT & getVertexBuffer( std::vector< std::unique_ptr< VertexBufferPoolT > > & pools
-			, std::map< size_t, VertexBufferIndexT > & overlays
-			, Overlay const & overlay
-			, Pass const & pass
-			, OverlayRenderer::OverlayRenderNode & node
-			, Engine & engine
-			, RenderDevice const & device
-			, ashes::PipelineVertexInputStateCreateInfo const & layout
-			, uint32_t maxCount )
+		void setVertices( std::vector< OverlayCategory::Vertex > const & vertices
+			, std::vector< OverlayCategory::Vertex > const *& panelVertices
+			, std::vector< TextOverlay::Vertex > const *& textVertices )
 		{
-			auto hash = std::hash< Overlay const * >{}( &overlay );
-			hash = castor::hashCombine( hash, pass );
-			auto it = overlays.find( hash );
-
-			if ( it == overlays.end() )
-			{
-				for ( auto & pool : pools )
-				{
-					if ( it == overlays.end() )
-					{
-						auto result = pool->allocate( node );
-
-						if ( bool( result ) )
-						{
-							it = overlays.emplace( hash, std::move( result ) ).first;
-						}
-					}
-				}
-
-				if ( it == overlays.end() )
-				{
-					pools.emplace_back( std::make_unique< VertexBufferPoolT >( engine
-						, *device.uboPools
-						, device
-						, layout
-						, maxCount ) );
-					auto result = pools.back()->allocate( node );
-					it = overlays.emplace( hash, std::move( result ) ).first;
-				}
-			}
+			panelVertices = &vertices;
+			textVertices = nullptr;
+		}
 
-			return it->second;
+		void setVertices( std::vector< TextOverlay::Vertex > const & vertices
+			, std::vector< OverlayCategory::Vertex > const *& panelVertices
+			, std::vector< TextOverlay::Vertex > const *& textVertices )
+		{
+			panelVertices = nullptr;
+			textVertices = &vertices;
 		}
 	}
 
-	//*********************************************************************************************
-
-	template< typename QuadT, typename OverlayT, typename BufferIndexT, typename BufferPoolT, typename VertexT >
+	template< typename VertexT >
 	void OverlayRenderer::Preparer::doPrepareOverlay( RenderDevice const & device
-		, OverlayT const & overlay
+		, OverlayCategory const & overlay
 		, Pass const & pass
-		, std::map< size_t, BufferIndexT > & overlays
-		, std::vector< BufferPoolT > & vertexBuffers
-		, std::vector < VertexT > const & vertices
+		, std::vector< VertexT > const & vertices
+		, castor::Rectangle const & borders
 		, FontTextureSPtr fontTexture )
 	{
 		if ( !vertices.empty() )
 		{
-			auto & bufferIndex = getVertexBuffer< BufferIndexT >( vertexBuffers
-				, overlays
-				, overlay.getOverlay()
-				, pass
-				, ( fontTexture
-					? m_renderer.doGetTextNode( device, pass, *fontTexture->getTexture(), *fontTexture->getSampler() )
-					: m_renderer.doGetPanelNode( device, pass ) )
-				, *pass.getOwner()->getEngine()
-				, device
-				, ( fontTexture
-					? m_renderer.m_textDeclaration
-					: m_renderer.m_declaration )
-				, MaxPanelsPerBuffer );
-			doUpdateUbo( bufferIndex.overlayUbo
-				, bufferIndex.texturesUbo
-				, overlay
-				, pass
-				, m_renderer.m_size );
-			doFillBuffers< VertexT >( vertices.begin()
-				, uint32_t( vertices.size() )
-				, bufferIndex );
-
-			if ( !bufferIndex.descriptorSet )
+			// Overlays sharing the pass and the font texture share the descriptor set, hence the draw.
+			auto key = std::hash< Pass const * >{}( &pass );
+
+			if ( fontTexture )
 			{
-				if ( fontTexture )
-				{
-					bufferIndex.descriptorSet = m_renderer.doCreateDescriptorSet( bufferIndex.node.pipeline
-						, pass.getTextures()
-						, pass
-						, bufferIndex.overlayUbo
-						, bufferIndex.texturesUbo
-						, bufferIndex.index
-						, *fontTexture->getTexture()
-						, *fontTexture->getSampler() );
-					bufferIndex.connection = fontTexture->onChanged.connect( [&bufferIndex]( FontTexture const & )
-						{
-							bufferIndex.descriptorSet.reset();
-						} );
-				}
-				else
-				{
-					bufferIndex.descriptorSet = m_renderer.doCreateDescriptorSet( bufferIndex.node.pipeline
-						, pass.getTextures()
-						, pass
-						, bufferIndex.overlayUbo
-						, bufferIndex.texturesUbo
-						, bufferIndex.index );
-				}
+				castor::hashCombine( key, *fontTexture );
 			}
 
-			auto borderSize = BorderSizeGetter< OverlayT, QuadT >{}( overlay, m_renderer.m_size );
-			auto borderOffset = castor::Size{ uint32_t( borderSize.left() ), uint32_t( borderSize.top() ) };
-			auto borderExtent = borderOffset + castor::Size{ uint32_t( borderSize.right() ), uint32_t( borderSize.bottom() ) };
-			auto position = overlay.getAbsolutePosition( m_renderer.m_size ) - borderOffset;
-			auto size = overlay.getAbsoluteSize( m_renderer.m_size ) + borderExtent;
-			auto & commandBuffer = *m_renderer.m_commandBuffer;
-			commandBuffer.bindPipeline( *bufferIndex.node.pipeline.pipeline );
-			commandBuffer.setViewport( makeViewport( m_renderer.m_size ) );
-			commandBuffer.setScissor( makeScissor( position, size ) );
-			commandBuffer.bindDescriptorSet( *bufferIndex.descriptorSet
-				, *bufferIndex.node.pipeline.pipelineLayout );
-			commandBuffer.bindVertexBuffer( 0u
-				, bufferIndex.pool.buffer->getBuffer()
-				, uint32_t( bufferIndex.index * sizeof( QuadT ) ) );
-			commandBuffer.draw( uint32_t( vertices.size() )
-				, 1u
-				, 0u
-				, 0u );
+			m_renderer.doGetBatch( device, pass, fontTexture, key );
+
+			auto & size = m_renderer.m_size;
+			auto position = overlay.getAbsolutePosition();
+			auto ratio = overlay.getRenderRatio( size );
+			PreparedOverlay prepared{};
+			setVertices( vertices, prepared.panelVertices, prepared.textVertices );
+			prepared.offset = castor::Point2f{ float( position[0] ), float( position[1] ) };
+			prepared.scale = castor::Point2f{ ratio[0] * float( size.getWidth() ), ratio[1] * float( size.getHeight() ) };
+
+			auto absPosition = overlay.getAbsolutePosition( size );
+			auto absSize = overlay.getAbsoluteSize( size );
+			castor::Rectangle bounds{ absPosition.x() - borders.left()
+				, absPosition.y() - borders.top()
+				, absPosition.x() + int32_t( absSize.getWidth() ) + borders.right()
+				, absPosition.y() + int32_t( absSize.getHeight() ) + borders.bottom() };
+			m_renderer.m_batcher.add( key
+				, bounds
+				, uint32_t( m_renderer.m_prepared.size() ) );
+			m_renderer.m_prepared.push_back( prepared );
 		}
 	}
 
 	//*********************************************************************************************
 
-	template< typename VertexT, uint32_t CountT >
-	OverlayRenderer::VertexBufferPool< VertexT, CountT >::VertexBufferPool( Engine & engine
-		, UniformBufferPools & uboPools
-		, RenderDevice const & device
-		, ashes::PipelineVertexInputStateCreateInfo const & decl
-		, uint32_t count )
-		: engine{ engine }
-		, uboPools{ uboPools }
-		, maxCount{ count }
-		, data{ count, Quad{} }
-		, declaration{ decl }
-		, buffer{ makeVertexBuffer< Quad >( device
-			, count
-			, 0u
-			, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			, "OverlayRenderer" ) }
+	template< typename VertexT >
+	void OverlayRenderer::VertexStream< VertexT >::upload( RenderDevice const & device )
 	{
-		for ( auto i = 0u; i < count; ++i )
+		if ( data.empty() )
 		{
-			free.insert( i );
+			return;
 		}
-	}
-
-	template< typename VertexT, uint32_t CountT >
-	OverlayRenderer::VertexBufferIndex< VertexT, CountT > OverlayRenderer::VertexBufferPool< VertexT, CountT >::allocate( OverlayRenderNode & node )
-	{
-		OverlayRenderer::VertexBufferIndex< VertexT, CountT > result{ *this
-			, node
-			, InvalidIndex };
 
-		if ( !free.empty() )
+		if ( !buffer || buffer->getCount() < data.size() )
 		{
-			result.overlayUbo = uboPools.getBuffer< Configuration >( 0u );
-			result.texturesUbo = uboPools.getBuffer< TexturesUbo::Configuration >( 0u );
-			result.index = *free.begin();
-			result.geometryBuffers.noTexture.vbo.emplace_back( buffer->getBuffer() );
-			result.geometryBuffers.noTexture.layouts.emplace_back( declaration );
-			result.geometryBuffers.noTexture.vboOffsets.emplace_back( result.index );
-			result.geometryBuffers.textured.vbo.emplace_back( buffer->getBuffer() );
-			result.geometryBuffers.textured.layouts.emplace_back( declaration );
-			result.geometryBuffers.textured.vboOffsets.emplace_back( result.index );
-			free.erase( free.begin() );
+			// The previous buffer may still be in use by the last frame.
+			device->waitIdle();
+			buffer = makeVertexBuffer< VertexT >( device
+				, uint32_t( std::max( data.size(), 2u * ( buffer ? buffer->getCount() : data.size() ) ) )
+				, 0u
+				, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				, "OverlayRenderer" );
 		}
 
-		return result;
-	}
-
-	template< typename VertexT, uint32_t CountT >
-	void OverlayRenderer::VertexBufferPool< VertexT, CountT >::deallocate( OverlayRenderer::VertexBufferIndex< VertexT, CountT > const & index )
-	{
-		CU_Require( &index.pool == this );
-		index.geometryBuffers.noTexture.vbo.clear();
-		index.geometryBuffers.noTexture.layouts.clear();
-		index.geometryBuffers.noTexture.vboOffsets.clear();
-		index.geometryBuffers.textured.vbo.clear();
-		index.geometryBuffers.textured.layouts.clear();
-		index.geometryBuffers.textured.vboOffsets.clear();
-		free.insert( index.index );
-		uboPools.putBuffer( index.overlayUbo );
-		uboPools.putBuffer( index.texturesUbo );
-	}
-
-	template< typename VertexT, uint32_t CountT >
-	void OverlayRenderer::VertexBufferPool< VertexT, CountT >::upload()
-	{
 		if ( auto bufferData = buffer->lock( 0u
-			, buffer->getCount()
+			, data.size()
 			, 0u ) )
 		{
-			std::memcpy( bufferData, data.data(), buffer->getSize() );
-			buffer->flush( 0u, buffer->getCount() );
+			std::memcpy( bufferData, data.data(), data.size() * sizeof( VertexT ) );
+			buffer->flush( 0u, data.size() );
 			buffer->unlock();
 		}
 	}
@@ -513,42 +370,27 @@ namespace castor3d
 			m_finished = device->createSemaphore( "OverlayRenderer" );
 		}
 
-
-		// Create one panel overlays buffer pool
-		m_panelVertexBuffers.emplace_back( std::make_unique< PanelVertexBufferPool >( *getRenderSystem()->getEngine()
-			, m_uboPools
-			, device
-			, m_declaration
-			, MaxPanelsPerBuffer ) );
-
-		// Create one border overlays buffer pool
-		m_borderVertexBuffers.emplace_back( std::make_unique< BorderPanelVertexBufferPool >( *getRenderSystem()->getEngine()
-			, m_uboPools
-			, device
-			, m_declaration
-			, MaxPanelsPerBuffer ) );
-
-		// create one text overlays buffer
-		m_textVertexBuffers.emplace_back( std::make_unique< TextVertexBufferPool >( *getRenderSystem()->getEngine()
-			, m_uboPools
-			, device
-			, m_textDeclaration
-			, MaxPanelsPerBuffer ) );
 	}
 
 	void OverlayRenderer::cleanup( RenderDevice const & device )
 	{
 		m_matrixUbo.cleanup( device );
-		m_panelOverlays.clear();
-		m_borderPanelOverlays.clear();
-		m_textOverlays.clear();
+
+		for ( auto & batch : m_batches )
+		{
+			m_uboPools.putBuffer( batch.second.overlayUbo );
+			m_uboPools.putBuffer( batch.second.texturesUbo );
+		}
+
+		m_batches.clear();
+		m_batcher.clear();
+		m_prepared.clear();
 		m_mapPanelNodes.clear();
 		m_mapTextNodes.clear();
 		m_panelPipelines.clear();
 		m_textPipelines.clear();
-		m_panelVertexBuffers.clear();
-		m_borderVertexBuffers.clear();
-		m_textVertexBuffers.clear();
+		m_panelVertices = {};
+		m_textVertices = {};
 		m_commandBuffer.reset();
 		m_frameBuffer.reset();
 		m_renderPass.reset();
@@ -577,6 +419,8 @@ namespace castor3d
 		, ashes::Semaphore const & toWait )
 	{
 		m_toWait = &toWait;
+		m_batcher.clear();
+		m_prepared.clear();
 		m_commandBuffer->begin( VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT );
 		m_commandBuffer->beginDebugBlock(
 			{
@@ -590,28 +434,76 @@ namespace castor3d
 			, VK_SUBPASS_CONTENTS_INLINE );
 	}
 
-	void OverlayRenderer::endPrepare( RenderPassTimer const & timer )
+	void OverlayRenderer::endPrepare( RenderDevice const & device
+		, RenderPassTimer const & timer )
 	{
-		m_commandBuffer->endRenderPass();
-		timer.endPass( *m_commandBuffer );
-		m_commandBuffer->endDebugBlock();
-		m_commandBuffer->end();
-
-		for ( auto & pool : m_panelVertexBuffers )
+		struct DrawRange
 		{
-			pool->upload();
-		}
+			uint32_t first;
+			uint32_t count;
+		};
+		std::vector< DrawRange > ranges;
+		ranges.reserve( m_batcher.getDrawsCount() );
+		m_panelVertices.data.clear();
+		m_textVertices.data.clear();
 
-		for ( auto & pool : m_borderVertexBuffers )
+		// Gather each draw's overlays vertices into the shared streams.
+		for ( auto & draw : m_batcher )
 		{
-			pool->upload();
+			auto & batch = m_batches.find( draw.key )->second;
+			auto & vertices = batch.text
+				? m_textVertices.data
+				: m_panelVertices.data;
+			DrawRange range{ uint32_t( vertices.size() ), 0u };
+
+			for ( auto item : draw.items )
+			{
+				auto & prepared = m_prepared[item];
+
+				if ( prepared.textVertices )
+				{
+					bakeVertices( *prepared.textVertices, prepared.offset, prepared.scale, m_textVertices.data );
+				}
+				else
+				{
+					bakeVertices( *prepared.panelVertices, prepared.offset, prepared.scale, m_panelVertices.data );
+				}
+			}
+
+			range.count = uint32_t( vertices.size() ) - range.first;
+			ranges.push_back( range );
 		}
 
-		for ( auto & pool : m_textVertexBuffers )
+		m_panelVertices.upload( device );
+		m_textVertices.upload( device );
+
+		auto & commandBuffer = *m_commandBuffer;
+		commandBuffer.setViewport( makeViewport( m_size ) );
+		commandBuffer.setScissor( makeScissor( m_size ) );
+		auto range = ranges.begin();
+
+		for ( auto & draw : m_batcher )
 		{
-			pool->upload();
+			auto & batch = m_batches.find( draw.key )->second;
+			commandBuffer.bindPipeline( *batch.node.pipeline.pipeline );
+			commandBuffer.bindDescriptorSet( *batch.descriptorSet
+				, *batch.node.pipeline.pipelineLayout );
+			commandBuffer.bindVertexBuffer( 0u
+				, ( batch.text
+					? m_textVertices.buffer->getBuffer()
+					: m_panelVertices.buffer->getBuffer() )
+				, 0u );
+			commandBuffer.draw( range->count
+				, 1u
+				, range->first
+				, 0u );
+			++range;
 		}
-		
+
+		m_commandBuffer->endRenderPass();
+		timer.endPass( *m_commandBuffer );
+		m_commandBuffer->endDebugBlock();
+		m_commandBuffer->end();
 		m_sizeChanged = false;
 	}
 
@@ -657,6 +549,72 @@ namespace castor3d
 		return it->second;
 	}
 
+	OverlayRenderer::OverlayBatch & OverlayRenderer::doGetBatch( RenderDevice const & device
+		, Pass const & pass
+		, FontTextureSPtr fontTexture
+		, size_t key )
+	{
+		auto it = m_batches.find( key );
+
+		if ( it == m_batches.end() )
+		{
+			auto & node = fontTexture
+				? doGetTextNode( device, pass, *fontTexture->getTexture(), *fontTexture->getSampler() )
+				: doGetPanelNode( device, pass );
+			it = m_batches.emplace( key
+				, OverlayBatch
+				{
+					node,
+					m_uboPools.getBuffer< Configuration >( 0u ),
+					m_uboPools.getBuffer< TexturesUbo::Configuration >( 0u ),
+					nullptr,
+					{},
+					fontTexture != nullptr,
+				} ).first;
+
+			if ( fontTexture )
+			{
+				auto & batch = it->second;
+				batch.connection = fontTexture->onChanged.connect( [&batch]( FontTexture const & )
+					{
+						batch.descriptorSet.reset();
+					} );
+			}
+		}
+
+		auto & batch = it->second;
+		doUpdateUbo( batch.overlayUbo
+			, batch.texturesUbo
+			, pass
+			, m_size );
+
+		if ( !batch.descriptorSet )
+		{
+			if ( fontTexture )
+			{
+				batch.descriptorSet = doCreateDescriptorSet( batch.node.pipeline
+					, pass.getTextures()
+					, pass
+					, batch.overlayUbo
+					, batch.texturesUbo
+					, uint32_t( m_batches.size() )
+					, *fontTexture->getTexture()
+					, *fontTexture->getSampler() );
+			}
+			else
+			{
+				batch.descriptorSet = doCreateDescriptorSet( batch.node.pipeline
+					, pass.getTextures()
+					, pass
+					, batch.overlayUbo
+					, batch.texturesUbo
+					, uint32_t( m_batches.size() ) );
+			}
+		}
+
+		return batch;
+	}
+
 	ashes::DescriptorSetPtr OverlayRenderer::doCreateDescriptorSet( OverlayRenderer::Pipeline & pipeline
 		, TextureFlags textures
 		, Pass const & pass
@@ -940,7 +898,6 @@ namespace castor3d
 			VertexWriter writer;
 
 			UBO_MATRIX( writer, MatrixUboBinding, 0u );
-			UBO_OVERLAY( writer, OverlayUboBinding, 0u );
 
 			// Shader inputs
 			uint32_t index = 0u;
@@ -958,10 +915,8 @@ namespace castor3d
 				{
 					vtx_text = text;
 					vtx_texture = uv;
-					auto size = writer.declLocale( "size"
-						, vec2( c3d_positionRatio.z() * writer.cast< Float >( c3d_renderSizeIndex.x() )
-							, c3d_positionRatio.w() * writer.cast< Float >( c3d_renderSizeIndex.y() ) ) );
-					out.vtx.position = c3d_projection * vec4( size * ( c3d_positionRatio.xy() + position )
+					// Positions are baked in pixels on CPU side.
+					out.vtx.position = c3d_projection * vec4( position
 						, 0.0_f
 						, 1.0_f );
 				} );
@@ -3,17 +3,95 @@
 #include "Castor3D/Material/Material.hpp"
 #include "Castor3D/Material/Pass/Pass.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
 #include "Castor3D/Scene/BillboardList.hpp"
 #include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
 #include "Castor3D/Scene/SceneNode.hpp"
 
+#include <set>
+
 namespace castor3d
 {
 	namespace
 	{
+		// The occlusion buffer is a low resolution depth buffer, with the usual screens aspect ratio.
+		static uint32_t constexpr OcclusionBufferWidth = 256u;
+		static uint32_t constexpr OcclusionBufferHeight = 128u;
+		// Above this count, the occluder costs more to rasterise than it saves.
+		static uint32_t constexpr MaxOccluderFaces = 16384u;
+		// The geometries which bounding sphere covers this part of the viewport height are occluders.
+		static float constexpr MinOccluderScreenRatio = 0.2f;
+
+		bool isOccluder( Camera const & camera
+			, CulledSubmesh const & node )
+		{
+			auto material = node.pass->getOwner()->shared_from_this();
+			auto programFlags = node.data.getProgramFlags( material );
+
+			if ( node.pass->hasAlphaBlending()
+				|| node.pass->hasAlphaTest()
+				|| checkFlag( programFlags, ProgramFlag::eSkinning )
+				|| checkFlag( programFlags, ProgramFlag::eMorphing )
+				|| node.data.getInstantiation().isInstanced( material )
+				|| node.data.getTopology() != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST
+				|| node.data.getFaceCount() > MaxOccluderFaces
+				|| !node.data.getComponent< TriFaceMapping >() )
+			{
+				return false;
+			}
+
+			if ( node.instance.isOccluder() )
+			{
+				return true;
+			}
+
+			if ( camera.getViewport().getType() == ViewportType::eOrtho )
+			{
+				return false;
+			}
+
+			auto & scale = node.sceneNode.getDerivedScale();
+			auto maxScale = std::max( { std::abs( scale[0] ), std::abs( scale[1] ), std::abs( scale[2] ) } );
+			auto & sphere = node.instance.getBoundingSphere( node.data );
+			auto center = node.sceneNode.getDerivedTransformationMatrix() * sphere.getCenter();
+			auto distance = float( castor::point::distance( center, camera.getParent()->getDerivedPosition() ) );
+
+			if ( distance <= std::numeric_limits< float >::epsilon() )
+			{
+				return false;
+			}
+
+			auto diameter = 2.0f * sphere.getRadius() * maxScale * camera.getProjectionScale() / distance;
+			return diameter >= MinOccluderScreenRatio * float( camera.getHeight() );
+		}
+
+		bool isOccluded( castor::OcclusionBuffer const & buffer
+			, CulledSubmesh const & node )
+		{
+			return !node.data.getInstantiation().isInstanced( node.pass->getOwner()->shared_from_this() )
+				&& !buffer.isVisible( node.instance.getBoundingBox( node.data )
+					, node.sceneNode.getDerivedTransformationMatrix() );
+		}
+
+		bool selectDetails( SceneCuller & culler
+			, CulledSubmesh & node
+			, bool cullBackFaces )
+		{
+			node.lod = culler.selectLod( node );
+			return cullMeshlets( culler.getCamera(), node, cullBackFaces );
+		}
+
+		bool selectDetails( SceneCuller & culler
+			, CulledBillboard & node
+			, bool cullBackFaces )
+		{
+			return true;
+		}
+
 		template< typename CulledT >
-		void cullNodes( Camera const & camera
+		void cullNodes( SceneCuller & culler
+			, bool cullBackFaces
 			, SceneCuller::CulledInstancesT< CulledT > & all
 			, SceneCuller::CulledInstancesPtrT< CulledT > & culled )
 		{
@@ -25,7 +103,8 @@ namespace castor3d
 				CulledT & node = *objectIt;
 				UInt32Array & instances = *instanceIt;
 
-				if ( isVisible( camera, node ) )
+				if ( isVisible( culler.getCamera(), node )
+					&& selectDetails( culler, node, cullBackFaces ) )
 				{
 					culled.push_back( &node, &instances );
 				}
@@ -36,30 +115,132 @@ namespace castor3d
 		}
 
 		template< typename CulledT >
-		void cullNodes( Camera const & camera
+		void cullNodes( SceneCuller & culler
+			, bool cullBackFaces
 			, SceneCuller::CulledInstanceArrayT< CulledT > & all
 			, SceneCuller::CulledInstancePtrArrayT< CulledT > & culled )
 		{
 			for ( size_t i = 0; i < size_t( RenderMode::eCount ); ++i )
 			{
-				cullNodes( camera, all[i], culled[i] );
+				cullNodes( culler, cullBackFaces, all[i], culled[i] );
 			}
 		}
 	}
 
 	FrustumCuller::FrustumCuller( Scene & scene
-		, Camera & camera )
+		, Camera & camera
+		, bool cullBackFaces
+		, bool cullOccluded )
 		: SceneCuller{ scene, &camera, 1u }
+		, m_cullBackFaces{ cullBackFaces }
+		, m_occlusionBuffer{ cullOccluded
+			? std::make_unique< castor::OcclusionBuffer >( OcclusionBufferWidth, OcclusionBufferHeight )
+			: nullptr }
 	{
 	}
 
 	void FrustumCuller::doCullGeometries()
 	{
-		cullNodes( getCamera(), m_allSubmeshes, m_culledSubmeshes );
+		cullNodes( *this, m_cullBackFaces, m_allSubmeshes, m_culledSubmeshes );
+
+		if ( m_occlusionBuffer )
+		{
+			doCullOccluded();
+		}
 	}
 
 	void FrustumCuller::doCullBillboards()
 	{
-		cullNodes( getCamera(), m_allBillboards, m_culledBillboards );
+		cullNodes( *this, m_cullBackFaces, m_allBillboards, m_culledBillboards );
+	}
+
+	void FrustumCuller::doCullOccluded()
+	{
+		m_timer.getElapsed();
+
+		if ( m_allChanged )
+		{
+			m_occluders.clear();
+		}
+
+		auto & camera = getCamera();
+		auto & buffer = *m_occlusionBuffer;
+		buffer.clear( camera.getProjection() * camera.getView() );
+		// The opaque nodes list holds the frustum culled candidates, a submesh is listed once per pass.
+		auto & opaque = m_culledSubmeshes[size_t( RenderMode::eOpaqueOnly )];
+		std::set< std::pair< Geometry const *, Submesh const * > > occluders;
+
+		for ( auto node : opaque.objects )
+		{
+			if ( isOccluder( camera, *node ) )
+			{
+				if ( occluders.emplace( &node->instance, &node->data ).second )
+				{
+					auto it = m_occluders.find( &node->data );
+
+					if ( it == m_occluders.end() )
+					{
+						Occluder occluder;
+						occluder.positions.reserve( node->data.getPointsCount() );
+
+						for ( auto & point : node->data.getPoints() )
+						{
+							occluder.positions.push_back( point.pos );
+						}
+
+						for ( auto & face : node->data.getComponent< TriFaceMapping >()->getFaces() )
+						{
+							occluder.indices.insert( occluder.indices.end(), { face[0], face[1], face[2] } );
+						}
+
+						it = m_occluders.emplace( &node->data, std::move( occluder ) ).first;
+					}
+
+					buffer.addOccluder( it->second.positions
+						, it->second.indices
+						, node->sceneNode.getDerivedTransformationMatrix() );
+				}
+			}
+		}
+
+		m_occludersCount = uint32_t( occluders.size() );
+		m_occludedCount = 0u;
+
+		if ( !occluders.empty() )
+		{
+			buffer.rasterise();
+
+			for ( size_t mode = 0u; mode < size_t( RenderMode::eCount ); ++mode )
+			{
+				auto & culled = m_culledSubmeshes[mode];
+				size_t kept = 0u;
+
+				for ( size_t i = 0u; i < culled.objects.size(); ++i )
+				{
+					auto node = culled.objects[i];
+
+					// The occluders can't be hidden by themselves, they aren't tested.
+					if ( occluders.find( { &node->instance, &node->data } ) != occluders.end()
+						|| !isOccluded( buffer, *node ) )
+					{
+						culled.objects[kept] = node;
+						culled.instances[kept] = culled.instances[i];
+						++kept;
+					}
+				}
+
+				// The opaque and transparent lists split the nodes of the eBoth list,
+				// summing them counts each occluded node once.
+				if ( mode != size_t( RenderMode::eBoth ) )
+				{
+					m_occludedCount += uint32_t( culled.objects.size() - kept );
+				}
+
+				culled.objects.resize( kept );
+				culled.instances.resize( kept );
+			}
+		}
+
+		m_occlusionTime = m_timer.getElapsed();
 	}
 }
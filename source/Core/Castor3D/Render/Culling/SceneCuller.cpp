@@ -15,6 +15,7 @@
 #include "Castor3D/Scene/ParticleSystem/ParticleSystem.hpp"
 
 #include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 namespace castor3d
 {
@@ -39,6 +40,14 @@ namespace castor3d
 
 			nodes[size_t( RenderMode::eBoth )].push_back( node, instances );
 		}
+
+		size_t hashLod( Geometry const & geometry
+			, Submesh const & submesh )
+		{
+			size_t result = std::hash< Geometry const * >{}( &geometry );
+			castor::hashCombine( result, submesh );
+			return result;
+		}
 	}
 
 	//*********************************************************************************************
@@ -73,6 +82,105 @@ namespace castor3d
 						, node.sceneNode.getDerivedTransformationMatrix() ) ) );
 	}
 
+	uint32_t selectLod( Camera const & camera
+		, CulledSubmesh const & node
+		, uint32_t current )
+	{
+		static float constexpr MaxPixelError = 1.0f;
+		static float constexpr MaxCoarserPixelError = 0.75f;
+		auto count = node.data.getLodsCount();
+
+		if ( count <= 1u
+			|| node.data.getInstantiation().isInstanced( node.pass->getOwner()->shared_from_this() ) )
+		{
+			return 0u;
+		}
+
+		auto & scale = node.sceneNode.getDerivedScale();
+		auto maxScale = std::max( { std::abs( scale[0] ), std::abs( scale[1] ), std::abs( scale[2] ) } );
+		auto & viewport = camera.getViewport();
+		float pixelsPerUnit{};
+
+		if ( viewport.getType() == ViewportType::eOrtho )
+		{
+			pixelsPerUnit = float( viewport.getHeight() ) / std::abs( viewport.getTop() - viewport.getBottom() );
+		}
+		else
+		{
+			auto & sphere = node.instance.getBoundingSphere( node.data );
+			auto center = node.sceneNode.getDerivedTransformationMatrix() * sphere.getCenter();
+			auto distance = float( castor::point::distance( center, camera.getParent()->getDerivedPosition() ) )
+				- sphere.getRadius() * maxScale;
+
+			if ( distance <= std::numeric_limits< float >::epsilon() )
+			{
+				return 0u;
+			}
+
+			pixelsPerUnit = camera.getProjectionScale() / distance;
+		}
+
+		pixelsPerUnit *= maxScale;
+
+		// The levels errors grow with the level, so the first acceptable one from the coarsest is kept.
+		for ( auto lod = count - 1u; lod > 0u; --lod )
+		{
+			auto threshold = lod > current
+				? MaxCoarserPixelError
+				: MaxPixelError;
+
+			if ( node.data.getLod( lod ).error * pixelsPerUnit <= threshold )
+			{
+				return lod;
+			}
+		}
+
+		return 0u;
+	}
+
+	bool cullMeshlets( Camera const & camera
+		, CulledSubmesh & node
+		, bool cullBackFaces )
+	{
+		node.meshletRanges.clear();
+		auto & meshlets = node.data.getMeshlets();
+
+		if ( meshlets.empty()
+			|| node.lod != 0u )
+		{
+			return true;
+		}
+
+		// The meshlets bounds don't follow the animated vertices, and the alpha blended passes sort the faces.
+		auto material = node.pass->getOwner()->shared_from_this();
+		auto programFlags = node.data.getProgramFlags( material );
+
+		if ( checkFlag( programFlags, ProgramFlag::eSkinning )
+			|| checkFlag( programFlags, ProgramFlag::eMorphing )
+			|| node.pass->hasAlphaBlending()
+			|| node.data.getInstantiation().isInstanced( material ) )
+		{
+			return true;
+		}
+
+		auto & scale = node.sceneNode.getDerivedScale();
+		// A mirroring scale reverses the faces winding.
+		cullBackFaces = cullBackFaces
+			&& !node.pass->IsTwoSided()
+			&& camera.getViewport().getType() != ViewportType::eOrtho
+			&& scale[0] > 0.0f
+			&& scale[1] > 0.0f
+			&& scale[2] > 0.0f;
+		auto count = castor::meshlet::cull( meshlets
+			, camera.getFrustum().getPlanes()
+			, node.sceneNode.getDerivedTransformationMatrix()
+			, scale
+			, camera.getParent()->getDerivedPosition()
+			, cullBackFaces
+			, node.meshletRanges );
+		return count != 0u;
+	}
+
 	//*********************************************************************************************
 
 	size_t hash( CulledBillboard const & culled )
@@ -124,6 +232,7 @@ namespace castor3d
 
 	void SceneCuller::compute()
 	{
+		CU_ProfileScope( "SceneCuller::compute" );
 		m_allChanged = m_sceneDirty;
 
 		if ( m_allChanged )
@@ -154,6 +263,18 @@ namespace castor3d
 		}
 	}
 
+	uint32_t SceneCuller::selectLod( CulledSubmesh const & node )
+	{
+		if ( node.data.getLodsCount() <= 1u )
+		{
+			return 0u;
+		}
+
+		auto & lod = m_selectedLods.emplace( hashLod( node.instance, node.data ), 0u ).first->second;
+		lod = castor3d::selectLod( getCamera(), node, lod );
+		return lod;
+	}
+
 	UInt32Array SceneCuller::getInitialInstances()const
 	{
 		UInt32Array instances;
@@ -193,23 +314,32 @@ namespace castor3d
 	void SceneCuller::doListGeometries()
 	{
 		auto & scene = getScene();
-		auto lock( castor::makeUniqueLock( scene.getGeometryCache() ) );
+		// Lock free, the view holds the geometries as of the start of the frame.
+		auto view = scene.getGeometryCache().getView();
 		auto instances = getInitialInstances();
+		// Only the selected levels of detail of the listed submeshes are kept.
+		std::unordered_map< size_t, uint32_t > selectedLods;
 
-		for ( auto primitive : scene.getGeometryCache() )
+		for ( auto & primitive : *view )
 		{
-			if ( primitive.second
-				&& primitive.second->getParent() )
+			if ( primitive->getParent() )
 			{
-				auto & geometry = *primitive.second;
+				auto & geometry = *primitive;
 				auto & node = *geometry.getParent();
 
-				if ( primitive.second->getMesh() )
+				if ( geometry.getMesh() )
 				{
 					auto & mesh = *geometry.getMesh();
 
 					for ( auto submesh : mesh )
 					{
+						auto it = m_selectedLods.find( hashLod( geometry, *submesh ) );
+
+						if ( it != m_selectedLods.end() )
+						{
+							selectedLods.emplace( *it );
+						}
+
 						auto material = geometry.getMaterial( *submesh );
 
 						if ( material )
@@ -257,20 +387,21 @@ namespace castor3d
 				}
 			}
 		}
+
+		m_selectedLods = std::move( selectedLods );
 	}
 
 	void SceneCuller::doListBillboards()
 	{
 		auto & scene = getScene();
-		auto lock( castor::makeUniqueLock( scene.getBillboardListCache() ) );
+		auto view = scene.getBillboardListCache().getView();
 		auto instances = getInitialInstances();
 
-		for ( auto billboard : scene.getBillboardListCache() )
+		for ( auto & billboard : *view )
 		{
-			if ( billboard.second
-				&& billboard.second->getParent() )
+			if ( billboard->getParent() )
 			{
-				auto & billboards = *billboard.second;
+				auto & billboards = *billboard;
 				MaterialSPtr material( billboards.getMaterial() );
 
 				if ( material )
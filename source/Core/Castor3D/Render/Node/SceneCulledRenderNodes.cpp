@@ -80,12 +80,35 @@ namespace castor3d
 			itObject->second.emplace_back( node );
 		}
 
+		void doCopyCulledData( CulledSubmesh const & culled
+			, bool useMeshlets
+			, SubmeshRenderNode & node )
+		{
+			node.lod = culled.lod;
+
+			if ( useMeshlets )
+			{
+				node.meshletRanges = culled.meshletRanges;
+			}
+			else
+			{
+				node.meshletRanges.clear();
+			}
+		}
+
+		void doCopyCulledData( CulledBillboard const & culled
+			, bool useMeshlets
+			, BillboardListRenderNode & node )
+		{
+		}
+
 		template< typename MapType
 			, typename CulledMapType
 			, typename CulledT >
 		void doParseRenderNodes( MapType & inputNodes
 			, CulledMapType & outputNodes
-			, SceneCuller::CulledInstancesPtrT< CulledT > const & culledNodes )
+			, SceneCuller::CulledInstancesPtrT< CulledT > const & culledNodes
+			, bool useMeshlets )
 		{
 			for ( auto & pipelines : inputNodes )
 			{
@@ -97,6 +120,7 @@ namespace castor3d
 
 					if ( it != culledNodes.objects.end() )
 					{
+						doCopyCulledData( **it, useMeshlets, node.second );
 						doAddRenderNode( *pipelines.first, &node.second, outputNodes );
 					}
 				}
@@ -140,6 +164,20 @@ namespace castor3d
 			return billboard.getGeometryBuffers();
 		}
 
+		SubmeshLod getLod( Submesh const & submesh
+			, GeometryBuffers const & geometryBuffers
+			, uint32_t lod )
+		{
+			return submesh.getLod( lod );
+		}
+
+		SubmeshLod getLod( BillboardBase const & billboard
+			, GeometryBuffers const & geometryBuffers
+			, uint32_t lod )
+		{
+			return { 0u, geometryBuffers.idxCount, 0.0f };
+		}
+
 		template< typename NodeType >
 		void doAddRenderNodeCommands( RenderPipeline & pipeline
 			, NodeType const & node
@@ -185,8 +223,24 @@ namespace castor3d
 					commandBuffer.bindIndexBuffer( *geometryBuffers.ibo
 						, geometryBuffers.iboOffset
 						, VK_INDEX_TYPE_UINT32 );
-					commandBuffer.drawIndexed( geometryBuffers.idxCount
-						, instanceCount );
+
+					if ( node.meshletRanges.empty() )
+					{
+						auto lod = getLod( node.data, geometryBuffers, node.lod );
+						commandBuffer.drawIndexed( lod.indexCount
+							, instanceCount
+							, lod.firstIndex );
+					}
+					else
+					{
+						// Only the visible meshlets are drawn.
+						for ( auto & range : node.meshletRanges )
+						{
+							commandBuffer.drawIndexed( range.indexCount
+								, instanceCount
+								, range.firstIndex );
+						}
+					}
 				}
 				else
 				{
@@ -340,6 +394,7 @@ namespace castor3d
 	void SceneCulledRenderNodes::parse( RenderQueue const & queue )
 	{
 		auto & culler = queue.getOwner()->getCuller();
+		auto useMeshlets = queue.getOwner()->usesMeshlets();
 
 		auto & allNodes = queue.getAllRenderNodes();
 		instancedStaticNodes.backCulled.clear();
@@ -406,31 +461,39 @@ namespace castor3d
 
 		doParseRenderNodes( allNodes.staticNodes.frontCulled
 			, staticNodes.frontCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, culler.getCulledSubmeshes( queue.getMode() )
+			, useMeshlets );
 		doParseRenderNodes( allNodes.staticNodes.backCulled
 			, staticNodes.backCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, culler.getCulledSubmeshes( queue.getMode() )
+			, useMeshlets );
 
 		doParseRenderNodes( allNodes.skinnedNodes.frontCulled
 			, skinnedNodes.frontCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, culler.getCulledSubmeshes( queue.getMode() )
+			, useMeshlets );
 		doParseRenderNodes( allNodes.skinnedNodes.backCulled
 			, skinnedNodes.backCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, culler.getCulledSubmeshes( queue.getMode() )
+			, useMeshlets );
 
 		doParseRenderNodes( allNodes.morphingNodes.frontCulled
 			, morphingNodes.frontCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, culler.getCulledSubmeshes( queue.getMode() )
+			, useMeshlets );
 		doParseRenderNodes( allNodes.morphingNodes.backCulled
 			, morphingNodes.backCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, culler.getCulledSubmeshes( queue.getMode() )
+			, useMeshlets );
 
 		doParseRenderNodes( allNodes.billboardNodes.frontCulled
 			, billboardNodes.frontCulled
-			, culler.getCulledBillboards( queue.getMode() ) );
+			, culler.getCulledBillboards( queue.getMode() )
+			, useMeshlets );
 		doParseRenderNodes( allNodes.billboardNodes.backCulled
 			, billboardNodes.backCulled
-			, culler.getCulledBillboards( queue.getMode() ) );
+			, culler.getCulledBillboards( queue.getMode() )
+			, useMeshlets );
 	}
 
 	void SceneCulledRenderNodes::prepareCommandBuffers( RenderQueue const & queue
@@ -4,6 +4,7 @@
 #include "Castor3D/Cache/SamplerCache.hpp"
 #include "Castor3D/Material/Texture/Sampler.hpp"
 #include "Castor3D/Miscellaneous/DebugName.hpp"
+#include "Castor3D/Miscellaneous/Logger.hpp"
 #include "Castor3D/Miscellaneous/makeVkType.hpp"
 #include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Scene.hpp"
@@ -23,6 +24,10 @@
 #include <ashespp/RenderPass/RenderPassCreateInfo.hpp>
 
 #include <CastorUtils/Graphics/Image.hpp>
+#include <CastorUtils/Graphics/ImageLayout.hpp>
+#include <CastorUtils/Graphics/PixelBufferCache.hpp>
+#include <CastorUtils/Graphics/SphericalHarmonics.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
 
 #include <ShaderWriter/Source.hpp>
 
@@ -101,6 +106,129 @@ namespace castor3d
 		}
 #endif
 
+		static uint32_t constexpr IblCacheVersion = 1u;
+
+		enum class IblCacheEntry
+			: uint32_t
+		{
+			eIrradiance,
+			ePrefiltered,
+		};
+
+		struct IblCacheSettings
+		{
+			uint32_t version;
+			IblCacheEntry entry;
+			uint32_t size;
+			uint32_t levels;
+			uint32_t shIrradiance;
+		};
+
+		uint64_t getCacheKey( uint64_t sourceHash
+			, IblCacheEntry entry
+			, ashes::Image const & image
+			, bool shIrradiance )
+		{
+			IblCacheSettings settings{ IblCacheVersion
+				, entry
+				, image.getDimensions().width
+				, image.getMipmapLevels()
+				, ( shIrradiance && entry == IblCacheEntry::eIrradiance ) ? 1u : 0u };
+			return castor::hashBytes( &settings, sizeof( settings ), sourceHash );
+		}
+
+		bool isSrgb( VkFormat format )
+		{
+			switch ( format )
+			{
+			case VK_FORMAT_R8G8B8_SRGB:
+			case VK_FORMAT_B8G8R8_SRGB:
+			case VK_FORMAT_R8G8B8A8_SRGB:
+			case VK_FORMAT_B8G8R8A8_SRGB:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		PxBufferBaseSPtr doDownloadCube( RenderDevice const & device
+			, ashes::Image const & image
+			, uint32_t baseLevel
+			, uint32_t levels )
+		{
+			auto extent = image.getDimensions();
+			auto result = PxBufferBase::create( Size{ ashes::getSubresourceDimension( extent.width, baseLevel )
+					, ashes::getSubresourceDimension( extent.height, baseLevel ) }
+				, 6u
+				, levels
+				, PixelFormat( image.getFormat() ) );
+			ImageLayout layout{ ImageLayout::e2DArray, *result };
+
+			for ( uint32_t face = 0u; face < 6u; ++face )
+			{
+				for ( uint32_t level = 0u; level < levels; ++level )
+				{
+					auto view = image.createView( "IblTexturesDownload"
+						, VK_IMAGE_VIEW_TYPE_2D
+						, image.getFormat()
+						, baseLevel + level
+						, 1u
+						, face
+						, 1u );
+					auto staging = device->createStagingTexture( image.getFormat()
+						, VkExtent2D{ ashes::getSubresourceDimension( extent.width, baseLevel + level )
+							, ashes::getSubresourceDimension( extent.height, baseLevel + level ) } );
+					staging->downloadTextureData( *device.graphicsQueue
+						, *device.graphicsCommandPool
+						, image.getFormat()
+						, layout.layerMipBuffer( *result, face, level ).data()
+						, view );
+				}
+			}
+
+			return result;
+		}
+
+		void doUploadCube( RenderDevice const & device
+			, ashes::Image const & image
+			, PxBufferBase const & buffer )
+		{
+			auto extent = image.getDimensions();
+			ImageLayout layout{ ImageLayout::e2DArray, buffer };
+
+			for ( uint32_t face = 0u; face < 6u; ++face )
+			{
+				for ( uint32_t level = 0u; level < buffer.getLevels(); ++level )
+				{
+					auto view = image.createView( "IblTexturesUpload"
+						, VK_IMAGE_VIEW_TYPE_2D
+						, image.getFormat()
+						, level
+						, 1u
+						, face
+						, 1u );
+					auto staging = device->createStagingTexture( image.getFormat()
+						, VkExtent2D{ ashes::getSubresourceDimension( extent.width, level )
+							, ashes::getSubresourceDimension( extent.height, level ) } );
+					staging->uploadTextureData( *device.graphicsQueue
+						, *device.graphicsCommandPool
+						, image.getFormat()
+						, layout.layerMipBuffer( buffer, face, level ).data()
+						, view );
+				}
+			}
+		}
+
+		bool isCompatible( PxBufferBase const & buffer
+			, ashes::Image const & image )
+		{
+			return buffer.getFormat() == PixelFormat( image.getFormat() )
+				&& buffer.getWidth() == image.getDimensions().width
+				&& buffer.getHeight() == image.getDimensions().height
+				&& buffer.getLayers() == 6u
+				&& buffer.getLevels() == image.getMipmapLevels();
+		}
+
 		SamplerSPtr doCreateSampler( Engine & engine
 			, RenderDevice const & device )
 		{
@@ -132,8 +260,14 @@ namespace castor3d
 	IblTextures::IblTextures( Scene & scene
 		, RenderDevice const & device
 		, ashes::Image const & source
-		, SamplerSPtr sampler )
+		, SamplerSPtr sampler
+		, uint64_t sourceHash
+		, bool shIrradiance )
 		: OwnedBy< Scene >{ scene }
+		, m_device{ device }
+		, m_source{ source }
+		, m_sourceHash{ sourceHash }
+		, m_shIrradiance{ shIrradiance }
 		, m_prefilteredBrdf{ doCreatePrefilteredBrdf( device, Size{ 512u, 512u } ) }
 #if !C3D_GenerateBRDFIntegration
 		, m_prefilteredBrdfView{ doCreatePrefilteredBrdfView( *scene.getEngine(), device, *m_prefilteredBrdf ) }
@@ -159,8 +293,119 @@ namespace castor3d
 
 	void IblTextures::update()
 	{
-		m_radianceComputer.render();
+		if ( m_sourceHash && doLoadCache() )
+		{
+			return;
+		}
+
+		if ( !m_shIrradiance
+			|| !doComputeShIrradiance() )
+		{
+			m_radianceComputer.render();
+		}
+
 		m_environmentPrefilter.render();
+
+		if ( m_sourceHash )
+		{
+			doSaveCache();
+		}
+	}
+
+	bool IblTextures::doLoadCache()
+	{
+		auto & cache = getOwner()->getEngine()->getTextureCache();
+		auto & irradianceImage = *getIrradianceTexture().image;
+		auto & prefilteredImage = *getPrefilteredEnvironmentTexture().image;
+		auto irradiance = cache.load( getCacheKey( m_sourceHash, IblCacheEntry::eIrradiance, irradianceImage, m_shIrradiance ) );
+		auto prefiltered = cache.load( getCacheKey( m_sourceHash, IblCacheEntry::ePrefiltered, prefilteredImage, m_shIrradiance ) );
+
+		if ( !irradiance
+			|| !prefiltered
+			|| !isCompatible( *irradiance, irradianceImage )
+			|| !isCompatible( *prefiltered, prefilteredImage ) )
+		{
+			return false;
+		}
+
+		doUploadCube( m_device, irradianceImage, *irradiance );
+		doUploadCube( m_device, prefilteredImage, *prefiltered );
+		log::debug << "IblTextures - Loaded from cache" << std::endl;
+		return true;
+	}
+
+	void IblTextures::doSaveCache()
+	{
+		try
+		{
+			auto & cache = getOwner()->getEngine()->getTextureCache();
+			auto & irradianceImage = *getIrradianceTexture().image;
+			auto & prefilteredImage = *getPrefilteredEnvironmentTexture().image;
+			cache.save( getCacheKey( m_sourceHash, IblCacheEntry::eIrradiance, irradianceImage, m_shIrradiance )
+				, *doDownloadCube( m_device, irradianceImage, 0u, irradianceImage.getMipmapLevels() ) );
+			cache.save( getCacheKey( m_sourceHash, IblCacheEntry::ePrefiltered, prefilteredImage, m_shIrradiance )
+				, *doDownloadCube( m_device, prefilteredImage, 0u, prefilteredImage.getMipmapLevels() ) );
+		}
+		catch ( castor::Exception & exc )
+		{
+			log::warn << "IblTextures - Couldn't cache the maps: " << exc.what() << std::endl;
+		}
+	}
+
+	bool IblTextures::doComputeShIrradiance()
+	{
+		auto & irradianceImage = *getIrradianceTexture().image;
+		auto irradianceSize = irradianceImage.getDimensions().width;
+		auto extent = m_source.getDimensions();
+		// The harmonics are very low frequency, the smallest level not below the irradiance map size is enough.
+		uint32_t level = 0u;
+
+		while ( level + 1u < m_source.getMipmapLevels()
+			&& ashes::getSubresourceDimension( extent.width, level + 1u ) >= irradianceSize )
+		{
+			++level;
+		}
+
+		try
+		{
+			auto source = doDownloadCube( m_device, m_source, level, 1u );
+			source = PxBufferBase::create( source->getDimensions()
+				, 6u
+				, 1u
+				, PixelFormat::eR32G32B32A32_SFLOAT
+				, source->getConstPtr()
+				, source->getFormat() );
+
+			if ( isSrgb( m_source.getFormat() ) )
+			{
+				auto data = reinterpret_cast< float * >( source->getPtr() );
+				auto end = data + source->getSize() / sizeof( float );
+
+				while ( data != end )
+				{
+					for ( uint32_t c = 0u; c < 3u; ++c )
+					{
+						data[c] = data[c] <= 0.04045f
+							? data[c] / 12.92f
+							: std::pow( ( data[c] + 0.055f ) / 1.055f, 2.4f );
+					}
+
+					data += 4u;
+				}
+			}
+
+			auto harmonics = castor::SphericalHarmonics::fromCube( *source );
+			doUploadCube( m_device
+				, irradianceImage
+				, *harmonics.toIrradianceCube( irradianceSize ) );
+			return true;
+		}
+		catch ( castor::Exception & exc )
+		{
+			log::warn << "IblTextures - Couldn't compute the spherical harmonics irradiance: " << exc.what() << std::endl;
+		}
+
+		return false;
 	}
 
 	void IblTextures::debugDisplay( Size const & /*renderSize*/ )const
@@ -282,6 +282,9 @@ namespace castor3d
 		auto inMaterial = writer.declInput< Int >( "inMaterial"
 			, RenderPass::VertexInputs::MaterialLocation
 			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
+		auto inBonesOffset = writer.declInput< UInt >( "inBonesOffset"
+			, RenderPass::VertexInputs::BonesOffsetLocation
+			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
 		auto inPosition2 = writer.declInput< Vec4 >( "inPosition2"
 			, RenderPass::VertexInputs::Position2Location
 			, checkFlag( flags.programFlags, ProgramFlag::eMorphing ) );
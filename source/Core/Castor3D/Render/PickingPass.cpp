@@ -10,6 +10,8 @@
 #include "Castor3D/Material/Pass/Pass.hpp"
 #include "Castor3D/Material/Texture/TextureLayout.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/Face.hpp"
+#include "Castor3D/Render/Ray.hpp"
 #include "Castor3D/Render/RenderPipeline.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Render/Node/SceneCulledRenderNodes.hpp"
@@ -291,6 +293,7 @@ namespace castor3d
 			, [this]( RenderDevice const & device )
 			{
 				m_transferFence = device->createFence( "PickingPass" );
+				m_asyncFence = device->createFence( "PickingPassAsync" );
 			} ) );
 	}
 
@@ -334,7 +337,12 @@ namespace castor3d
 			{
 				doUpdateNodes( m_renderQueue.getCulledRenderNodes() );
 				auto pixel = doFboPick( device, position, myCamera, m_renderQueue.getCommandBuffer() );
-				m_pickNodeType = doPick( pixel, m_renderQueue.getCulledRenderNodes() );
+				m_pickNodeType = doPick( pixel
+					, m_renderQueue.getCulledRenderNodes()
+					, m_geometry
+					, m_billboard
+					, m_submesh
+					, m_face );
 			}
 
 			m_picking = false;
@@ -343,6 +351,260 @@ namespace castor3d
 		return m_pickNodeType;
 	}
 
+	uint32_t PickingPass::pickAsync( castor::Position const & position
+		, PickCallback callback )
+	{
+		return m_requests.push( PickRequest
+			{
+				0u,
+				castor::Rectangle{ position.x(), position.y(), position.x() + 1, position.y() + 1 },
+				std::move( callback ),
+				nullptr,
+			} );
+	}
+
+	std::future< PickingPass::PickResult > PickingPass::pickAsync( castor::Position const & position )
+	{
+		auto promise = std::make_shared< std::promise< PickResult > >();
+		auto result = promise->get_future();
+		pickAsync( position
+			, [promise]( PickResult const & value )
+			{
+				promise->set_value( value );
+			} );
+		return result;
+	}
+
+	uint32_t PickingPass::pickAsync( castor::Rectangle const & area
+		, AreaPickCallback callback )
+	{
+		return m_requests.push( PickRequest
+			{
+				0u,
+				area,
+				nullptr,
+				std::move( callback ),
+			} );
+	}
+
+	void PickingPass::processRequests( RenderDevice const & device )
+	{
+		if ( m_pendingRequest
+			&& m_asyncFence->wait( 0u ) == VK_SUCCESS )
+		{
+			m_asyncFence->reset();
+			doResolveRequest();
+			m_picking = false;
+		}
+
+		if ( !m_pendingRequest
+			&& m_asyncFence
+			&& !m_picking.exchange( true ) )
+		{
+			PickRequest request;
+
+			if ( m_requests.pop( request ) )
+			{
+				m_pendingRequest = std::make_unique< PickRequest >( std::move( request ) );
+				doStartRequest( device );
+			}
+			else
+			{
+				m_picking = false;
+			}
+		}
+	}
+
+	PickingPass::PickResult PickingPass::pickCpu( castor::Position const & position
+		, Camera const & camera )const
+	{
+		PickResult result;
+		Ray ray{ position, camera };
+		float nearest = std::numeric_limits< float >::max();
+		auto view = getCuller().getScene().getGeometryCache().getView();
+
+		for ( auto & geometry : *view )
+		{
+			if ( geometry->getParent()
+				&& geometry->getMesh() )
+			{
+				Face face{ 0u, 0u, 0u };
+				SubmeshSPtr submesh;
+				float distance = 0.0f;
+
+				if ( ray.intersects( geometry, face, submesh, distance ) != castor::Intersection::eOut
+					&& distance < nearest )
+				{
+					nearest = distance;
+					result.type = PickNodeType::eStatic;
+					result.geometry = geometry;
+					result.submesh = submesh;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	void PickingPass::doStartRequest( RenderDevice const & device )
+	{
+		// The area is clamped to the pass, a point request picks its pixel.
+		auto & area = m_pendingRequest->area;
+		auto & dimensions = m_colourTexture->getDimensions();
+		auto topLeft = convertToTopDown( Position{ area.left(), area.bottom() - 1 }, m_size );
+		int32_t left = std::clamp( topLeft.x(), 0, int32_t( dimensions.width ) - 1 );
+		int32_t top = std::clamp( topLeft.y(), 0, int32_t( dimensions.height ) - 1 );
+		m_pendingArea =
+		{
+			{ left, top },
+			{ uint32_t( std::clamp( int32_t( area.getWidth() ), 1, int32_t( dimensions.width ) - left ) )
+				, uint32_t( std::clamp( int32_t( area.getHeight() ), 1, int32_t( dimensions.height ) - top ) ) },
+		};
+		auto count = m_pendingArea.extent.width * m_pendingArea.extent.height;
+
+		if ( !m_asyncStagingBuffer
+			|| m_asyncStagingBuffer->getCount() < count )
+		{
+			m_asyncStagingBuffer = makeBuffer< Point4f >( device
+				, count
+				, VK_BUFFER_USAGE_TRANSFER_DST_BIT
+				, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				, "PickingPassAsyncStagingBuffer" );
+		}
+
+		ShadowMapLightTypeArray shadowMaps;
+		m_renderQueue.update( shadowMaps, m_pendingArea );
+
+		if ( !m_renderQueue.getCulledRenderNodes().hasNodes() )
+		{
+			// Nothing to render, the request is resolved immediately.
+			m_pendingArea.extent = { 0u, 0u };
+			doResolveRequest();
+			m_picking = false;
+			return;
+		}
+
+		doUpdateNodes( m_renderQueue.getCulledRenderNodes() );
+		static ashes::VkClearValueArray const clearValues
+		{
+			makeClearValue( 1.0f, 0.5f, 0.5f, 1.0f ),
+			defaultClearDepthStencil,
+		};
+		m_asyncCommandBuffer->begin();
+		m_asyncCommandBuffer->beginDebugBlock(
+			{
+				"PickingPass Async Render",
+				makeFloatArray( getEngine()->getNextRainbowColour() ),
+			} );
+		m_asyncCommandBuffer->beginRenderPass( *m_renderPass
+			, *m_frameBuffer
+			, clearValues
+			, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS );
+		m_asyncCommandBuffer->executeCommands( { m_renderQueue.getCommandBuffer() } );
+		m_asyncCommandBuffer->endRenderPass();
+		VkBufferImageCopy copyRegion
+		{
+			0u,
+			0u,
+			0u,
+			{ m_colourView->subresourceRange.aspectMask, 0u, 0u, 1u },
+			{ m_pendingArea.offset.x, m_pendingArea.offset.y, 0 },
+			{ m_pendingArea.extent.width, m_pendingArea.extent.height, 1u },
+		};
+		m_asyncCommandBuffer->memoryBarrier( m_asyncStagingBuffer->getBuffer().getCompatibleStageFlags()
+			, VK_PIPELINE_STAGE_TRANSFER_BIT
+			, m_asyncStagingBuffer->getBuffer().makeTransferDestination() );
+		m_asyncCommandBuffer->copyToBuffer( copyRegion
+			, *m_colourTexture
+			, m_asyncStagingBuffer->getBuffer() );
+		m_asyncCommandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TRANSFER_BIT
+			, VK_PIPELINE_STAGE_HOST_BIT
+			, m_asyncStagingBuffer->getBuffer().makeHostRead() );
+		m_asyncCommandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TRANSFER_BIT
+			, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+			, m_colourView.makeShaderInputResource( VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL ) );
+		m_asyncCommandBuffer->endDebugBlock();
+		m_asyncCommandBuffer->end();
+		// The fence is polled by the next processRequests calls.
+		device.graphicsQueue->submit( *m_asyncCommandBuffer, m_asyncFence.get() );
+	}
+
+	void PickingPass::doResolveRequest()
+	{
+		auto request = std::move( m_pendingRequest );
+		auto count = m_pendingArea.extent.width * m_pendingArea.extent.height;
+		std::vector< Point4f > pixels;
+
+		if ( count )
+		{
+			if ( auto * data = m_asyncStagingBuffer->lock( 0u, count, 0u ) )
+			{
+				pixels.assign( data, data + count );
+				m_asyncStagingBuffer->unlock();
+			}
+		}
+
+		auto & nodes = m_renderQueue.getCulledRenderNodes();
+
+		if ( request->callback )
+		{
+			// A point request reads its single pixel.
+			PickResult result;
+			result.id = request->id;
+
+			if ( !pixels.empty() )
+			{
+				GeometryWPtr geometry;
+				BillboardBaseWPtr billboard;
+				SubmeshWPtr submesh;
+				result.type = doPick( pixels.front(), nodes, geometry, billboard, submesh, result.face );
+				result.geometry = geometry.lock();
+				result.billboard = billboard.lock();
+				result.submesh = submesh.lock();
+			}
+
+			request->callback( result );
+			return;
+		}
+
+		// An area request decodes each distinct pixel value once, and keeps each object once.
+		AreaPickResult result;
+		result.id = request->id;
+		std::set< std::array< uint32_t, 3u > > decoded;
+		std::set< Geometry const * > geometries;
+		std::set< BillboardBase const * > billboards;
+
+		for ( auto & pixel : pixels )
+		{
+			if ( decoded.insert( { uint32_t( pixel[0] ), uint32_t( pixel[1] ), uint32_t( pixel[2] ) } ).second )
+			{
+				GeometryWPtr geometry;
+				BillboardBaseWPtr billboard;
+				SubmeshWPtr submesh;
+				uint32_t face{};
+				doPick( pixel, nodes, geometry, billboard, submesh, face );
+
+				if ( auto picked = geometry.lock() )
+				{
+					if ( geometries.insert( picked.get() ).second )
+					{
+						result.geometries.push_back( picked );
+					}
+				}
+
+				if ( auto picked = billboard.lock() )
+				{
+					if ( billboards.insert( picked.get() ).second )
+					{
+						result.billboards.push_back( picked );
+					}
+				}
+			}
+		}
+
+		request->areaCallback( result );
+	}
+
 	void PickingPass::doUpdateNodes( SceneCulledRenderNodes & nodes )
 	{
 		auto & myCamera = getCuller().getCamera();
@@ -469,7 +731,11 @@ namespace castor3d
 	}
 
 	PickNodeType PickingPass::doPick( Point4f const & pixel
-		, SceneCulledRenderNodes & nodes )
+		, SceneCulledRenderNodes & nodes
+		, GeometryWPtr & geometry
+		, BillboardBaseWPtr & billboard
+		, SubmeshWPtr & submesh
+		, uint32_t & face )
 	{
 		PickNodeType result{ PickNodeType::eNone };
 
@@ -480,27 +746,27 @@ namespace castor3d
 			switch ( result )
 			{
 			case PickNodeType::eStatic:
-				pickFromList( nodes.staticNodes.backCulled, pixel, m_geometry, m_submesh, m_face );
+				pickFromList( nodes.staticNodes.backCulled, pixel, geometry, submesh, face );
 				break;
 
 			case PickNodeType::eInstantiatedStatic:
-				pickFromInstantiatedList( nodes.instancedStaticNodes.backCulled, pixel, m_geometry, m_submesh, m_face );
+				pickFromInstantiatedList( nodes.instancedStaticNodes.backCulled, pixel, geometry, submesh, face );
 				break;
 
 			case PickNodeType::eSkinning:
-				pickFromList( nodes.skinnedNodes.backCulled, pixel, m_geometry, m_submesh, m_face );
+				pickFromList( nodes.skinnedNodes.backCulled, pixel, geometry, submesh, face );
 				break;
 
 			case PickNodeType::eInstantiatedSkinning:
-				pickFromInstantiatedList( nodes.instancedSkinnedNodes.backCulled, pixel, m_geometry, m_submesh, m_face );
+				pickFromInstantiatedList( nodes.instancedSkinnedNodes.backCulled, pixel, geometry, submesh, face );
 				break;
 
 			case PickNodeType::eMorphing:
-				pickFromList( nodes.morphingNodes.backCulled, pixel, m_geometry, m_submesh, m_face );
+				pickFromList( nodes.morphingNodes.backCulled, pixel, geometry, submesh, face );
 				break;
 
 			case PickNodeType::eBillboard:
-				pickFromList( nodes.billboardNodes.backCulled, pixel, m_billboard, m_billboard, m_face );
+				pickFromList( nodes.billboardNodes.backCulled, pixel, billboard, billboard, face );
 				break;
 
 			default:
@@ -568,7 +834,7 @@ namespace castor3d
 					&& it->second[0].buffer
 					&& instantiatedBones.hasInstancedBonesBuffer() )
 				{
-					doCopyNodesBones( renderNodes, instantiatedBones.getInstancedBonesBuffer() );
+					doCopyNodesBones( renderNodes, instantiatedBones, it->second[0].data );
 				}
 			} );
 	}
@@ -591,6 +857,7 @@ namespace castor3d
 		, Size const & size )
 	{
 		m_commandBuffer = device.graphicsCommandPool->createCommandBuffer( "PickingPass" );
+		m_asyncCommandBuffer = device.graphicsCommandPool->createCommandBuffer( "PickingPassAsync" );
 
 		m_colourTexture = createTexture( device
 			, size
@@ -738,6 +1005,30 @@ namespace castor3d
 
 	void PickingPass::doCleanup( RenderDevice const & device )
 	{
+		if ( m_pendingRequest )
+		{
+			m_asyncFence->wait( ashes::MaxTimeout );
+			m_asyncFence->reset();
+			doResolveRequest();
+			m_picking = false;
+		}
+
+		// The remaining requests receive empty results, so that no future is left broken.
+		// The callbacks are called unlocked, since they may push new requests.
+		m_requests.cancel( []( PickRequest & request )
+			{
+				if ( request.callback )
+				{
+					request.callback( PickResult{ request.id } );
+				}
+				else
+				{
+					request.areaCallback( AreaPickResult{ request.id } );
+				}
+			} );
+
+		m_asyncStagingBuffer.reset();
+		m_asyncCommandBuffer.reset();
 		m_commandBuffer.reset();
 		m_scenes.clear();
 		m_stagingBuffer.reset();
@@ -813,6 +1104,9 @@ namespace castor3d
 		auto inMaterial = writer.declInput< Int >( "inMaterial"
 			, RenderPass::VertexInputs::MaterialLocation
 			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
+		auto inBonesOffset = writer.declInput< UInt >( "inBonesOffset"
+			, RenderPass::VertexInputs::BonesOffsetLocation
+			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
 		auto inPosition2 = writer.declInput< Vec4 >( "inPosition2"
 			, RenderPass::VertexInputs::Position2Location
 			, checkFlag( flags.programFlags, ProgramFlag::eMorphing ) );
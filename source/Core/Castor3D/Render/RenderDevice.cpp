@@ -2,6 +2,7 @@
 
 #include "Castor3D/Buffer/GpuBufferPool.hpp"
 #include "Castor3D/Buffer/UniformBufferPools.hpp"
+#include "Castor3D/Buffer/UploadQueue.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Miscellaneous/Logger.hpp"
 
@@ -205,6 +206,7 @@ namespace castor3d
 
 		bufferPool = std::make_shared< GpuBufferPool >( renderSystem, *this, cuT( "GlobalBufferPool" ) );
 		uboPools = std::make_shared< UniformBufferPools >( renderSystem, *this );
+		uploadQueue = std::make_shared< UploadQueue >( *this );
 	}
 
 	VkFormat RenderDevice::selectSuitableDepthFormat( VkFormatFeatureFlags requiredFeatures )const
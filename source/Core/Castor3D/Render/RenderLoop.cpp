@@ -2,6 +2,7 @@
 
 #include "Castor3D/Engine.hpp"
 #include "Castor3D/Buffer/UniformBufferPools.hpp"
+#include "Castor3D/Buffer/UploadQueue.hpp"
 #include "Castor3D/Cache/AnimatedObjectGroupCache.hpp"
 #include "Castor3D/Cache/BillboardUboPools.hpp"
 #include "Castor3D/Cache/GeometryCache.hpp"
@@ -22,6 +23,7 @@
 #include "Castor3D/Scene/Scene.hpp"
 
 #include <CastorUtils/Design/BlockGuard.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 using namespace castor;
 
@@ -67,14 +69,15 @@ namespace castor3d
 			auto & device = m_renderSystem.getCurrentRenderDevice();
 			getEngine()->getFrameListenerCache().forEach( [&device]( FrameListener & listener )
 				{
-					listener.fireEvents( EventType::ePreRender, device );
-					listener.fireEvents( EventType::ePreRender );
+					listener.fireAllEvents( EventType::ePreRender, device );
+					listener.fireAllEvents( EventType::ePreRender );
 				} );
 			getEngine()->getFrameListenerCache().forEach( [&device]( FrameListener & listener )
 				{
-					listener.fireEvents( EventType::eQueueRender, device );
-					listener.fireEvents( EventType::eQueueRender );
+					listener.fireAllEvents( EventType::eQueueRender, device );
+					listener.fireAllEvents( EventType::eQueueRender );
 				} );
+			device.uploadQueue->waitIdle();
 			m_uploadResources =
 			{
 				UploadResources{ { nullptr, nullptr }, nullptr },
@@ -92,7 +95,7 @@ namespace castor3d
 
 		getEngine()->getFrameListenerCache().forEach( []( FrameListener & listener )
 			{
-				listener.fireEvents( EventType::ePostRender );
+				listener.fireAllEvents( EventType::ePostRender );
 			} );
 	}
 
@@ -143,6 +146,12 @@ namespace castor3d
 		return m_debugOverlays->isShown();
 	}
 
+	CpuFrameTimings RenderLoop::getLastCpuTimings()const
+	{
+		std::lock_guard< std::mutex > lock{ m_cpuTimingsMutex };
+		return m_lastCpuTimings;
+	}
+
 	RenderDeviceSPtr RenderLoop::doCreateDevice( ashes::WindowHandle handle
 		, RenderWindow & window )
 	{
@@ -173,15 +182,27 @@ namespace castor3d
 	{
 		if ( m_renderSystem.hasMainDevice() )
 		{
-			RenderInfo & info = m_debugOverlays->beginFrame();
-			doGpuStep( info );
-			doCpuStep();
-			m_lastFrameTime = m_debugOverlays->endFrame();
+			{
+				CU_ProfileScope( "RenderLoop::renderFrame" );
+				RenderInfo & info = m_debugOverlays->beginFrame();
+				m_cpuTimings.reset();
+				auto start = CpuFrameTimings::Clock::now();
+				doGpuStep( info );
+				doCpuStep();
+				m_cpuTimings.total = std::chrono::duration_cast< Nanoseconds >( CpuFrameTimings::Clock::now() - start );
+				m_lastFrameTime = m_debugOverlays->endFrame();
+				std::lock_guard< std::mutex > lock{ m_cpuTimingsMutex };
+				m_lastCpuTimings = m_cpuTimings;
+			}
+
+			// The frame's zones are complete, they can be summarised.
+			CU_ProfileFrame();
 		}
 	}
 
 	void RenderLoop::doProcessEvents( EventType eventType )
 	{
+		CU_ProfileScope( "RenderLoop::processCpuEvents" );
 		getEngine()->getFrameListenerCache().forEach( [eventType]( FrameListener & listener )
 			{
 				listener.fireEvents( eventType );
@@ -191,6 +212,7 @@ namespace castor3d
 	void RenderLoop::doProcessEvents( EventType eventType
 		, RenderDevice const & device )
 	{
+		CU_ProfileScope( "RenderLoop::processGpuEvents" );
 		getEngine()->getFrameListenerCache().forEach( [eventType, &device]( FrameListener & listener )
 			{
 				listener.fireEvents( eventType, device );
@@ -199,6 +221,8 @@ namespace castor3d
 
 	void RenderLoop::doGpuStep( RenderInfo & info )
 	{
+		CU_ProfileScope( "RenderLoop::gpuStep" );
+
 		{
 			auto guard = makeBlockGuard(
 				[this]()
@@ -225,39 +249,58 @@ namespace castor3d
 			}
 
 			// Usually GPU initialisation
-			doProcessEvents( EventType::ePreRender, device );
-			doProcessEvents( EventType::ePreRender );
+			{
+				CpuPhaseTimer timer{ &m_cpuTimings, CpuFramePhase::eEvents };
+				doProcessEvents( EventType::ePreRender, device );
+				doProcessEvents( EventType::ePreRender );
+			}
 
 			// GPU Update
 			GpuUpdater updater{ device, info };
-			getEngine()->getMaterialCache().update( updater );
-			getEngine()->getRenderTargetCache().update( updater );
+			{
+				CpuPhaseTimer timer{ &m_cpuTimings, CpuFramePhase::eGpuUpdate };
+				getEngine()->getMaterialCache().update( updater );
+				getEngine()->getRenderTargetCache().update( updater );
+			}
 
-			auto & uploadResources = m_uploadResources[m_currentUpdate];
-			uploadResources.commands.commandBuffer->begin( VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT );
-			device.uboPools->upload( *uploadResources.commands.commandBuffer );
-			uploadResources.commands.commandBuffer->end();
-			device.graphicsQueue->submit( { *uploadResources.commands.commandBuffer }
-				, {}
-				, {}
-				, {}
-				, uploadResources.fence.get() );
-			uploadResources.fence->wait( ashes::MaxTimeout );
-			uploadResources.fence->reset();
+			{
+				CpuPhaseTimer timer{ &m_cpuTimings, CpuFramePhase::eUpload };
+				// Resources uploads pushed since last frame are submitted as one batch, before the render.
+				device.uploadQueue->update();
+				CU_ProfileCounter( "UploadQueue::pending", device.uploadQueue->getPendingCount() );
+				auto & uploadResources = m_uploadResources[m_currentUpdate];
+				uploadResources.commands.commandBuffer->begin( VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT );
+				device.uboPools->upload( *uploadResources.commands.commandBuffer );
+				uploadResources.commands.commandBuffer->end();
+				device.graphicsQueue->submit( { *uploadResources.commands.commandBuffer }
+					, {}
+					, {}
+					, {}
+					, uploadResources.fence.get() );
+				uploadResources.fence->wait( ashes::MaxTimeout );
+				uploadResources.fence->reset();
+			}
 
 			// Render
-			getEngine()->getRenderTargetCache().render( device, info );
+			{
+				CpuPhaseTimer timer{ &m_cpuTimings, CpuFramePhase::eRender };
+				getEngine()->getRenderTargetCache().render( device, info );
+			}
 
 			// Usually GPU cleanup
+			CpuPhaseTimer timer{ &m_cpuTimings, CpuFramePhase::eEvents };
 			doProcessEvents( EventType::eQueueRender, device );
 			doProcessEvents( EventType::eQueueRender );
 		}
 
-		getEngine()->getRenderWindowCache().forEach( [this]( RenderWindow & window )
-			{
-				window.render( m_first );
-			} );
-		m_first = false;
+		{
+			CpuPhaseTimer timer{ &m_cpuTimings, CpuFramePhase::eRender };
+			getEngine()->getRenderWindowCache().forEach( [this]( RenderWindow & window )
+				{
+					window.render( m_first );
+				} );
+			m_first = false;
+		}
 
 		{
 			auto guard = makeBlockGuard(
@@ -275,29 +318,53 @@ namespace castor3d
 
 	void RenderLoop::doCpuStep()
 	{
-		doProcessEvents( EventType::ePostRender );
+		CU_ProfileScope( "RenderLoop::cpuStep" );
+		auto timings = &m_cpuTimings;
+		{
+			CpuPhaseTimer timer{ timings, CpuFramePhase::eEvents };
+			doProcessEvents( EventType::ePostRender );
+		}
+
 		CpuUpdater updater;
-		getEngine()->getMaterialCache().update( updater );
-		getEngine()->getSceneCache().forEach( [&updater]( Scene & scene )
-			{
-				scene.update( updater );
-			} );
-		getEngine()->getRenderTargetCache().update( updater );
+		updater.timings = timings;
+		{
+			CpuPhaseTimer timer{ timings, CpuFramePhase::eMaterials };
+			getEngine()->getMaterialCache().update( updater );
+		}
+		{
+			CpuPhaseTimer timer{ timings, CpuFramePhase::eScene };
+			getEngine()->getSceneCache().forEach( [&updater]( Scene & scene )
+				{
+					scene.update( updater );
+				} );
+		}
+		{
+			CpuPhaseTimer timer{ timings, CpuFramePhase::eTargets };
+			getEngine()->getRenderTargetCache().update( updater );
+		}
 		std::vector< TechniqueQueues > techniquesQueues;
-		getEngine()->getRenderTechniqueCache().forEach( [&updater, &techniquesQueues]( RenderTechnique & technique )
-			{
-				TechniqueQueues techniqueQueues;
-				updater.queues = &techniqueQueues.queues;
-				technique.update( updater );
-				techniqueQueues.shadowMaps = technique.getShadowMaps();
-				techniquesQueues.push_back( techniqueQueues );
-			} );
-		doUpdateQueues( techniquesQueues );
+		{
+			CpuPhaseTimer timer{ timings, CpuFramePhase::eTechniques };
+			getEngine()->getRenderTechniqueCache().forEach( [&updater, &techniquesQueues]( RenderTechnique & technique )
+				{
+					TechniqueQueues techniqueQueues;
+					updater.queues = &techniqueQueues.queues;
+					technique.update( updater );
+					techniqueQueues.shadowMaps = technique.getShadowMaps();
+					techniquesQueues.push_back( techniqueQueues );
+				} );
+		}
+		{
+			CpuPhaseTimer timer{ timings, CpuFramePhase::eQueues };
+			doUpdateQueues( techniquesQueues );
+		}
 		m_debugOverlays->endCpuTask();
 	}
 
 	void RenderLoop::doUpdateQueues( std::vector< TechniqueQueues > & techniquesQueues )
 	{
+		CU_ProfileScope( "RenderLoop::updateQueues" );
+
 		for ( auto & techniqueQueues : techniquesQueues )
 		{
 			if ( techniqueQueues.queues.size() > m_queueUpdater.getCount() )
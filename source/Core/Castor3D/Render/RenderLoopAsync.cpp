@@ -4,6 +4,7 @@
 #include "Castor3D/Render/RenderSystem.hpp"
 
 #include <CastorUtils/Miscellaneous/PreciseTimer.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 #include <CastorUtils/Design/ScopeGuard.hpp>
 #include <CastorUtils/Design/BlockGuard.hpp>
 
@@ -165,6 +166,7 @@ namespace castor3d
 
 	void RenderLoopAsync::doMainLoop()
 	{
+		CU_ProfileThread( cuT( "RenderLoop" ) );
 		PreciseTimer timer;
 		m_frameEnded = true;
 		auto scopeGuard{ makeScopeGuard( [this]()
@@ -128,6 +128,38 @@ namespace castor3d
 		}
 	}
 
+	castor::String getName( CpuFramePhase value )
+	{
+		switch ( value )
+		{
+		case CpuFramePhase::eEvents:
+			return cuT( "events" );
+		case CpuFramePhase::eGpuUpdate:
+			return cuT( "gpu_update" );
+		case CpuFramePhase::eUpload:
+			return cuT( "upload" );
+		case CpuFramePhase::eRender:
+			return cuT( "render" );
+		case CpuFramePhase::eMaterials:
+			return cuT( "materials" );
+		case CpuFramePhase::eScene:
+			return cuT( "scene" );
+		case CpuFramePhase::eAnimations:
+			return cuT( "animations" );
+		case CpuFramePhase::eTargets:
+			return cuT( "targets" );
+		case CpuFramePhase::eCulling:
+			return cuT( "culling" );
+		case CpuFramePhase::eTechniques:
+			return cuT( "techniques" );
+		case CpuFramePhase::eQueues:
+			return cuT( "queues" );
+		default:
+			CU_Failure( "Unsupported CpuFramePhase" );
+			return castor::cuEmptyString;
+		}
+	}
+
 	bool isValidNodeForPass( PassFlags const & passFlags, RenderMode value )
 	{
 		auto transparent = checkFlag( passFlags, PassFlag::eAlphaBlending );
@@ -13,6 +13,8 @@
 #include "Castor3D/Material/Material.hpp"
 #include "Castor3D/Material/Pass/Pass.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/BonesInstantiationComponent.hpp"
+#include "Castor3D/Model/Skeleton/Skeleton.hpp"
 #include "Castor3D/Render/RenderModule.hpp"
 #include "Castor3D/Render/RenderPassTimer.hpp"
 #include "Castor3D/Render/RenderPipeline.hpp"
@@ -617,6 +619,11 @@ namespace castor3d
 		return TextureFlags{ TextureFlag::eAll };
 	}
 
+	bool RenderPass::usesMeshlets()const
+	{
+		return true;
+	}
+
 	namespace
 	{
 		template< typename RenderNodeT >
@@ -948,39 +955,52 @@ namespace castor3d
 	}
 
 	uint32_t RenderPass::doCopyNodesBones( SkinningRenderNodePtrArray const & renderNodes
-		, ShaderBuffer & bonesBuffer )const
+		, BonesInstantiationComponent & bones
+		, std::vector< InstantiationData > & matrixBuffer )const
 	{
-		uint32_t const mtxSize = sizeof( float ) * 16;
-		VkDeviceSize const stride = mtxSize * 400u;
-		auto const count = std::min( uint32_t( bonesBuffer.getSize() / stride ), uint32_t( renderNodes.size() ) );
-		CU_Require( count <= renderNodes.size() );
+		auto & palettes = bones.getBonePalettes();
+		auto & bonesBuffer = bones.getInstancedBonesBuffer();
+		auto const count = std::min( uint32_t( matrixBuffer.size() / m_instanceMult )
+			, uint32_t( renderNodes.size() ) );
 		auto buffer = bonesBuffer.getPtr();
+		auto instance = matrixBuffer.begin();
 		auto it = renderNodes.begin();
 		auto i = 0u;
+		palettes.reset();
 
 		while ( i < count )
 		{
 			auto & node = *it;
+			auto offset = palettes.allocate( uint32_t( node->skeleton.getSkeleton().getBonesCount() ) );
 
+			if ( offset == InvalidIndex )
+			{
+				break;
+			}
+
+			node->skeleton.fillBuffer( buffer + offset * BonePaletteAllocator::MatrixSize );
+
+			// All the instance multiplier copies share the node's palette.
 			for ( auto inst = 0u; inst < m_instanceMult; ++inst )
 			{
-				node->skeleton.fillBuffer( buffer );
-				buffer += stride;
+				instance->m_bonesOffset = offset;
+				++instance;
 			}
 
 			++i;
 			++it;
 		}
 
-		bonesBuffer.update( 0u, stride * count );
-		return count;
+		bonesBuffer.update( 0u, palettes.getAllocatedBytes() );
+		return i;
 	}
 
 	uint32_t RenderPass::doCopyNodesBones( SkinningRenderNodePtrArray const & renderNodes
-		, ShaderBuffer & bonesBuffer
+		, BonesInstantiationComponent & bones
+		, std::vector< InstantiationData > & matrixBuffer
 		, RenderInfo & info )const
 	{
-		auto count = doCopyNodesBones( renderNodes, bonesBuffer );
+		auto count = doCopyNodesBones( renderNodes, bones, matrixBuffer );
 		info.m_visibleObjectsCount += count;
 		return count;
 	}
@@ -1113,7 +1133,7 @@ namespace castor3d
 					&& instantiatedBones.hasInstancedBonesBuffer() )
 				{
 					uint32_t count1 = doCopyNodesMatrices( renderNodes, it->second[index].data );
-					uint32_t count2 = doCopyNodesBones( renderNodes, instantiatedBones.getInstancedBonesBuffer() );
+					uint32_t count2 = doCopyNodesBones( renderNodes, instantiatedBones, it->second[index].data );
 					CU_Require( count1 == count2 );
 				}
 			} );
@@ -1139,7 +1159,7 @@ namespace castor3d
 					&& instantiatedBones.hasInstancedBonesBuffer() )
 				{
 					uint32_t count1 = doCopyNodesMatrices( renderNodes, it->second[index].data, info );
-					uint32_t count2 = doCopyNodesBones( renderNodes, instantiatedBones.getInstancedBonesBuffer(), info );
+					uint32_t count2 = doCopyNodesBones( renderNodes, instantiatedBones, it->second[index].data, info );
 					CU_Require( count1 == count2 );
 					info.m_visibleFaceCount += submesh.getFaceCount() * count1;
 					info.m_visibleVertexCount += submesh.getPointsCount() * count1;
@@ -1429,6 +1449,9 @@ namespace castor3d
 		auto material = writer.declInput< Int >( "material"
 			, RenderPass::VertexInputs::MaterialLocation
 			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
+		auto inBonesOffset = writer.declInput< UInt >( "inBonesOffset"
+			, RenderPass::VertexInputs::BonesOffsetLocation
+			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
 		auto inPosition2 = writer.declInput< Vec4 >( "inPosition2"
 			, RenderPass::VertexInputs::Position2Location
 			, checkFlag( flags.programFlags, ProgramFlag::eMorphing ) );
@@ -11,6 +11,8 @@
 #include "Castor3D/Render/Culling/SceneCuller.hpp"
 #include "Castor3D/Render/Node/SceneCulledRenderNodes.hpp"
 
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
 using namespace castor;
 
 using ashes::operator==;
@@ -50,6 +52,8 @@ namespace castor3d
 
 	void RenderQueue::update( ShadowMapLightTypeArray & shadowMaps )
 	{
+		CU_ProfileScope( "RenderQueue::update" );
+
 		if ( m_allChanged )
 		{
 			doParseAllRenderNodes( shadowMaps );
@@ -114,6 +118,7 @@ namespace castor3d
 
 	void RenderQueue::doPrepareCommandBuffer()
 	{
+		CU_ProfileScope( "RenderQueue::prepareCommandBuffer" );
 		auto & culledNodes = getCulledRenderNodes();
 		culledNodes.prepareCommandBuffers( *this
 			, m_viewport.value()
@@ -122,12 +127,14 @@ namespace castor3d
 
 	void RenderQueue::doParseAllRenderNodes( ShadowMapLightTypeArray & shadowMaps )
 	{
+		CU_ProfileScope( "RenderQueue::parseAllRenderNodes" );
 		auto & allNodes = getAllRenderNodes();
 		allNodes.parse( *this, shadowMaps );
 	}
 
 	void RenderQueue::doParseCulledRenderNodes()
 	{
+		CU_ProfileScope( "RenderQueue::parseCulledRenderNodes" );
 		auto & culledNodes = getCulledRenderNodes();
 		culledNodes.parse( *this );
 	}
@@ -12,6 +12,7 @@
 #include "Castor3D/Overlay/Overlay.hpp"
 #include "Castor3D/Overlay/OverlayCategory.hpp"
 #include "Castor3D/Overlay/OverlayRenderer.hpp"
+#include "Castor3D/Render/CpuFrameTimings.hpp"
 #include "Castor3D/Render/RenderModule.hpp"
 #include "Castor3D/Render/RenderPassTimer.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
@@ -87,6 +88,12 @@ namespace castor3d
 			castor::TextWriter< RenderTarget >::checkError( result, target.getName() + " tone mapping" );
 		}
 
+		if ( result && target.isOcclusionCullingEnabled() )
+		{
+			result = file.writeText( m_tabs + cuT( "\tocclusion_culling true\n" ) ) > 0;
+			castor::TextWriter< RenderTarget >::checkError( result, target.getName() + " occlusion culling" );
+		}
+
 		if ( result )
 		{
 			for ( auto const & effect : target.m_hdrPostEffects )
@@ -223,7 +230,7 @@ namespace castor3d
 					, Parameters{} );
 			}
 
-			m_culler = std::make_unique< FrustumCuller >( *getScene(), *getCamera() );
+			m_culler = std::make_unique< FrustumCuller >( *getScene(), *getCamera(), true, m_occlusionCulling );
 			auto & renderSystem = *getEngine()->getRenderSystem();
 			m_hdrConfigUbo.initialise( device );
 			doInitialiseRenderPass( device );
@@ -370,7 +377,10 @@ namespace castor3d
 		camera.update();
 
 		CU_Require( m_culler );
-		m_culler->compute();
+		{
+			CpuPhaseTimer timer{ updater.timings, CpuFramePhase::eCulling };
+			m_culler->compute();
+		}
 
 		m_hdrConfigUbo.cpuUpdate( m_hdrConfig );
 
@@ -468,7 +478,7 @@ namespace castor3d
 		{
 			m_camera = camera;
 			camera->resize( m_size );
-			m_culler = std::make_unique< FrustumCuller >( *getScene(), *getCamera() );
+			m_culler = std::make_unique< FrustumCuller >( *getScene(), *getCamera(), true, m_occlusionCulling );
 		}
 	}
 
@@ -901,6 +911,7 @@ namespace castor3d
 		// And now render overlays.
 		m_signalFinished = &doRenderOverlays( device
 			, *m_signalFinished );
+		info.m_drawCalls += m_overlayRenderer->getDrawCallsCount();
 
 		// Combine objects and overlays framebuffers, flipping them if necessary.
 		m_signalFinished = &doCombine( *m_signalFinished );
@@ -990,7 +1001,7 @@ namespace castor3d
 				}
 			}
 
-			m_overlayRenderer->endPrepare( *m_overlaysTimer );
+			m_overlayRenderer->endPrepare( device, *m_overlaysTimer );
 			m_overlayRenderer->render( device, *m_overlaysTimer );
 			result = &m_overlayRenderer->getSemaphore();
 		}
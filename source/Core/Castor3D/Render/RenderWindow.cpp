@@ -354,6 +354,9 @@ namespace castor3d
 					, *target->getCamera() );
 #endif
 
+				// Resolves the asynchronous pick requests rendered so far, and starts the next one.
+				m_pickingPass->processRequests( *m_device );
+
 				if ( waitOnly )
 				{
 					waitFrame();
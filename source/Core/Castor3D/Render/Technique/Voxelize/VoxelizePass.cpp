@@ -154,6 +154,11 @@ namespace castor3d
 		return *result;
 	}
 
+	bool VoxelizePass::usesMeshlets()const
+	{
+		return false;
+	}
+
 	bool VoxelizePass::doInitialise( RenderDevice const & device
 		, Size const & CU_UnusedParam( size ) )
 	{
@@ -348,6 +353,9 @@ namespace castor3d
 		auto inTransform = writer.declInput< Mat4 >( "inTransform"
 			, RenderPass::VertexInputs::TransformLocation
 			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
+		auto inBonesOffset = writer.declInput< UInt >( "inBonesOffset"
+			, RenderPass::VertexInputs::BonesOffsetLocation
+			, checkFlag( flags.programFlags, ProgramFlag::eInstantiation ) );
 		auto inPosition2 = writer.declInput< Vec4 >( "inPosition2"
 			, RenderPass::VertexInputs::Position2Location
 			, checkFlag( flags.programFlags, ProgramFlag::eMorphing ) );
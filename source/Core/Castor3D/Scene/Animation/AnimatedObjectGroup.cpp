@@ -138,6 +138,7 @@ namespace castor3d
 		, OwnedBy< Scene >( scene )
 	{
 		m_timer.getElapsed();
+		m_throttleState.phase = uint32_t( std::hash< String >{}( name ) );
 	}
 
 	AnimatedObjectGroup::~AnimatedObjectGroup()
@@ -276,20 +277,22 @@ namespace castor3d
 
 	void AnimatedObjectGroup::update()
 	{
-#if defined( NDEBUG )
-
-		auto tslf = std::chrono::duration_cast< Milliseconds >( m_timer.getElapsed() );
-
-#else
-
-		auto tslf = 25_ms;
-
-#endif
+		auto tslf = doGetElapsed();
+		m_throttleState.blend = 1.0f;
+		m_throttleState.interval = 1u;
+		m_throttleState.elapsed = m_throttleState.accumulated + tslf;
+		m_throttleState.accumulated = Milliseconds{ 0u };
+		m_throttleState.skipped = 0u;
+		doUpdate( tslf, true );
+	}
 
-		for ( auto it : m_objects )
-		{
-			it.second->update( tslf );
-		}
+	void AnimatedObjectGroup::update( AnimationThrottle const & throttle
+		, float projectedSize
+		, bool visible )
+	{
+		auto tslf = doGetElapsed();
+		doUpdate( tslf
+			, throttle.step( m_throttleState, tslf, projectedSize, visible ) );
 	}
 
 	void AnimatedObjectGroup::startAnimation( String const & name )
@@ -375,4 +378,41 @@ namespace castor3d
 			it.second.state = AnimationState::ePaused;
 		}
 	}
+
+	Milliseconds AnimatedObjectGroup::doGetElapsed()
+	{
+#if defined( NDEBUG )
+
+		return std::chrono::duration_cast< Milliseconds >( m_timer.getElapsed() );
+
+#else
+
+		return 25_ms;
+
+#endif
+	}
+
+	void AnimatedObjectGroup::doUpdate( Milliseconds const & elapsed
+		, bool updateSkeletons )
+	{
+		// Only the skeletons are throttled, the other animations are cheap enough.
+		for ( auto it : m_objects )
+		{
+			if ( it.second->getKind() == AnimationType::eSkeleton )
+			{
+				auto & skeleton = static_cast< AnimatedSkeleton & >( *it.second );
+
+				if ( updateSkeletons )
+				{
+					skeleton.update( m_throttleState.elapsed );
+				}
+
+				skeleton.setPoseBlend( m_throttleState.blend );
+			}
+			else
+			{
+				it.second->update( elapsed );
+			}
+		}
+	}
 }
@@ -11,6 +11,27 @@ using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		// Component wise, the poses being close enough for the rotations to stay almost orthonormal.
+		castor::Matrix4x4f blend( castor::Matrix4x4f const & lhs
+			, castor::Matrix4x4f const & rhs
+			, float factor )
+		{
+			castor::Matrix4x4f result;
+			auto dst = result.ptr();
+			auto src0 = lhs.constPtr();
+			auto src1 = rhs.constPtr();
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				dst[i] = src0[i] + ( src1[i] - src0[i] ) * factor;
+			}
+
+			return result;
+		}
+	}
+
 	AnimatedSkeleton::AnimatedSkeleton( String const & name
 		, Skeleton & skeleton
 		, Mesh & mesh
@@ -32,73 +53,53 @@ namespace castor3d
 		{
 			animation.get().update( elapsed );
 		}
-	}
 
-	void AnimatedSkeleton::fillShader( castor::Matrix4x4f * variable )const
-	{
-		Skeleton & skeleton = m_skeleton;
-		uint32_t i{ 0u };
-
-		if ( m_playingAnimations.empty() )
+		// The pose displayed until now is the start of the next interpolation.
+		if ( m_poseBlend < 1.0f
+			&& m_previousPose.size() == m_currentPose.size() )
 		{
-			for ( auto bone : skeleton )
+			for ( size_t i = 0u; i < m_currentPose.size(); ++i )
 			{
-				variable[i++] = skeleton.getGlobalInverseTransform();
+				m_previousPose[i] = blend( m_previousPose[i], m_currentPose[i], m_poseBlend );
 			}
 		}
 		else
 		{
-			for ( auto bone : skeleton )
-			{
-				castor::Matrix4x4f final{ 1.0 };
-
-				for ( auto & animation : m_playingAnimations )
-				{
-					auto object = animation.get().getObject( *bone );
+			std::swap( m_previousPose, m_currentPose );
+		}
 
-					if ( object )
-					{
-						final *= object->getFinalTransform();
-					}
-				}
+		doComputePose( m_currentPose );
 
-				variable[i++] = final;
-			}
+		if ( m_previousPose.size() != m_currentPose.size() )
+		{
+			m_previousPose = m_currentPose;
 		}
 	}
 
-	void AnimatedSkeleton::fillBuffer( uint8_t * buffer )const
+	void AnimatedSkeleton::fillShader( castor::Matrix4x4f * variable )const
 	{
 		Skeleton & skeleton = m_skeleton;
-		auto stride = 16u * sizeof( float );
+		size_t i{ 0u };
 
-		if ( m_playingAnimations.empty() )
+		for ( auto bone : skeleton )
 		{
-			for ( auto bone : skeleton )
-			{
-				std::memcpy( buffer, skeleton.getGlobalInverseTransform().constPtr(), stride );
-				buffer += stride;
-			}
+			variable[i] = doGetBoneTransform( *bone, i );
+			++i;
 		}
-		else
-		{
-			for ( auto bone : skeleton )
-			{
-				castor::Matrix4x4f final{ 1.0f };
-
-				for ( auto & animation : m_playingAnimations )
-				{
-					auto object = animation.get().getObject( *bone );
+	}
 
-					if ( object )
-					{
-						final *= object->getFinalTransform();
-					}
-				}
+	void AnimatedSkeleton::fillBuffer( uint8_t * buffer )const
+	{
+		Skeleton & skeleton = m_skeleton;
+		auto stride = 16u * sizeof( float );
+		size_t i{ 0u };
 
-				std::memcpy( buffer, final.constPtr (), stride );
-				buffer += stride;
-			}
+		for ( auto bone : skeleton )
+		{
+			auto transform = doGetBoneTransform( *bone, i );
+			std::memcpy( buffer, transform.constPtr(), stride );
+			buffer += stride;
+			++i;
 		}
 	}
 
@@ -127,10 +128,75 @@ namespace castor3d
 			{
 				return &instance.get() == &static_cast< SkeletonAnimationInstance & >( animation );
 			} ) );
+
+		if ( m_playingAnimations.empty() )
+		{
+			m_previousPose.clear();
+			m_currentPose.clear();
+		}
 	}
 
 	void AnimatedSkeleton::doClearAnimations()
 	{
 		m_playingAnimations.clear();
+		m_previousPose.clear();
+		m_currentPose.clear();
+	}
+
+	castor::Matrix4x4f AnimatedSkeleton::doGetBoneTransform( Bone const & bone
+		, size_t index )const
+	{
+		if ( m_playingAnimations.empty() )
+		{
+			return m_skeleton.getGlobalInverseTransform();
+		}
+
+		// No pose computed yet, since the animation started.
+		if ( index >= m_currentPose.size() )
+		{
+			return doComputeBoneTransform( bone );
+		}
+
+		if ( m_poseBlend >= 1.0f )
+		{
+			return m_currentPose[index];
+		}
+
+		return blend( m_previousPose[index], m_currentPose[index], m_poseBlend );
+	}
+
+	void AnimatedSkeleton::doComputePose( std::vector< castor::Matrix4x4f > & pose )const
+	{
+		Skeleton & skeleton = m_skeleton;
+		pose.clear();
+
+		if ( m_playingAnimations.empty() )
+		{
+			return;
+		}
+
+		pose.reserve( skeleton.getBonesCount() );
+
+		for ( auto bone : skeleton )
+		{
+			pose.push_back( doComputeBoneTransform( *bone ) );
+		}
+	}
+
+	castor::Matrix4x4f AnimatedSkeleton::doComputeBoneTransform( Bone const & bone )const
+	{
+		castor::Matrix4x4f result{ 1.0f };
+
+		for ( auto & animation : m_playingAnimations )
+		{
+			auto object = animation.get().getObject( bone );
+
+			if ( object )
+			{
+				result *= object->getFinalTransform();
+			}
+		}
+
+		return result;
 	}
 }
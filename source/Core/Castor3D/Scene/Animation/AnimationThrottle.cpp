@@ -0,0 +1,91 @@
+#include "Castor3D/Scene/Animation/AnimationThrottle.hpp"
+
+#include <CastorUtils/Exception/Assertion.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace castor3d
+{
+	AnimationThrottle::AnimationThrottle( float fullRateSize
+		, uint32_t maxInterval
+		, uint32_t hiddenInterval
+		, float boundsMargin )
+		: m_fullRateSize{ fullRateSize }
+		, m_maxInterval{ maxInterval }
+		, m_hiddenInterval{ hiddenInterval }
+		, m_boundsMargin{ boundsMargin }
+	{
+		CU_Require( m_fullRateSize > 0.0f );
+		CU_Require( m_maxInterval > 0u );
+		CU_Require( m_hiddenInterval > 0u );
+	}
+
+	float AnimationThrottle::getProjectedSize( float radius
+		, float distance
+		, float projectionScale )
+	{
+		// The camera is inside of the sphere.
+		if ( distance <= radius )
+		{
+			return std::numeric_limits< float >::max();
+		}
+
+		return 2.0f * radius * projectionScale / distance;
+	}
+
+	float AnimationThrottle::getBoundsScale( State const & state )const
+	{
+		auto staleness = float( std::min( state.skipped, m_hiddenInterval ) ) / float( m_hiddenInterval );
+		return 1.0f + m_boundsMargin * ( 1.0f + staleness );
+	}
+
+	uint32_t AnimationThrottle::getInterval( float projectedSize
+		, bool visible )const
+	{
+		if ( !visible )
+		{
+			return m_hiddenInterval;
+		}
+
+		if ( projectedSize >= m_fullRateSize )
+		{
+			return 1u;
+		}
+
+		if ( projectedSize * float( m_maxInterval ) <= m_fullRateSize )
+		{
+			return m_maxInterval;
+		}
+
+		// The update rate is proportional to the projected size.
+		return std::min( m_maxInterval
+			, uint32_t( std::ceil( m_fullRateSize / projectedSize ) ) );
+	}
+
+	bool AnimationThrottle::step( State & state
+		, castor::Milliseconds const & elapsed
+		, float projectedSize
+		, bool visible )const
+	{
+		auto interval = m_enabled
+			? getInterval( projectedSize, visible )
+			: 1u;
+		state.accumulated += elapsed;
+		++state.skipped;
+		// The phase staggers the groups sharing the same interval over its frames.
+		auto result = ( m_frame + state.phase ) % interval == 0u;
+
+		if ( result )
+		{
+			state.elapsed = state.accumulated;
+			state.accumulated = castor::Milliseconds{ 0u };
+			state.skipped = 0u;
+			state.interval = interval;
+		}
+
+		// The displayed pose reaches the last computed one when the next update is due.
+		state.blend = std::min( 1.0f, float( state.skipped + 1u ) / float( state.interval ) );
+		return result;
+	}
+}
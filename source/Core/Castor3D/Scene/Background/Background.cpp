@@ -89,7 +89,9 @@ namespace castor3d
 			m_ibl = std::make_unique< IblTextures >( m_scene
 				, device
 				, m_texture->getTexture()
-				, sampler );
+				, sampler
+				, m_iblSourceHash
+				, m_shIrradiance );
 			m_ibl->update();
 		}
 
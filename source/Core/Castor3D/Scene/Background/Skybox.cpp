@@ -22,6 +22,9 @@
 #include <ashespp/Shader/ShaderModule.hpp>
 #include <ashespp/Sync/Fence.hpp>
 
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
+
 #include "Castor3D/Shader/Shaders/GlslUtils.hpp"
 
 using namespace castor;
@@ -49,12 +52,34 @@ namespace castor3d
 				VK_SAMPLE_COUNT_1_BIT,
 				VK_IMAGE_TILING_OPTIMAL,
 				( VK_IMAGE_USAGE_SAMPLED_BIT
+					| VK_IMAGE_USAGE_TRANSFER_SRC_BIT
 					| VK_IMAGE_USAGE_TRANSFER_DST_BIT
 					| VkImageUsageFlags( attachment
 						? VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
 						: VkImageUsageFlagBits( 0u ) ) ),
 			};
 		}
+
+		bool hashFile( Path const & filePath
+			, uint64_t & hash )
+		{
+			if ( filePath.empty()
+				|| !File::fileExists( filePath ) )
+			{
+				return false;
+			}
+
+			BinaryFile file{ filePath, File::OpenMode::eRead };
+			ByteArray data( size_t( file.getLength() ) );
+
+			if ( file.readArray( data.data(), data.size() ) < data.size() )
+			{
+				return false;
+			}
+
+			hash = hashBytes( data.data(), data.size(), hash );
+			return true;
+		}
 	}
 
 	//************************************************************************************************
@@ -301,6 +326,7 @@ namespace castor3d
 		, ashes::RenderPass const & renderPass )
 	{
 		CU_Require( m_texture );
+		m_iblSourceHash = doGetIblSourceHash();
 		return doInitialiseTexture( device );
 	}
 
@@ -345,6 +371,35 @@ namespace castor3d
 		return m_texture->initialise( device );
 	}
 
+	uint64_t SkyboxBackground::doGetIblSourceHash()const
+	{
+		uint64_t result = hashBytes( nullptr, 0u );
+		bool found = false;
+
+		if ( m_equiTexture )
+		{
+			auto size = m_equiSize.getWidth();
+			found = hashFile( m_equiTexturePath, result );
+			result = hashBytes( &size, sizeof( size ), result );
+		}
+		else if ( m_crossTexture )
+		{
+			found = hashFile( m_crossTexturePath, result );
+		}
+		else if ( m_texture->getLayersCount() == 6u )
+		{
+			found = true;
+
+			for ( uint32_t i = 0u; i < 6u && found; ++i )
+			{
+				found = hashFile( Path{ m_texture->getLayerCubeFaceView( 0u, CubeMapFace( i ) ).toString() }, result );
+			}
+		}
+
+		// Without readable sources, the IBL maps can't be identified, hence not cached.
+		return found ? result : 0u;
+	}
+
 	void SkyboxBackground::doInitialiseEquiTexture( RenderDevice const & device )
 	{
 		m_equiTexture->initialise( device );
@@ -2,10 +2,11 @@
 
 #include "Castor3D/Buffer/GpuBuffer.hpp"
 #include "Castor3D/Material/Material.hpp"
-#include "Castor3D/Miscellaneous/Logger.hpp"
 #include "Castor3D/Render/RenderModule.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 
+#include <numeric>
+
 using namespace castor;
 
 namespace castor3d
@@ -160,107 +161,59 @@ namespace castor3d
 
 	void BillboardBase::sortByDistance( castor::Point3f const & cameraPosition )
 	{
-		m_needUpdate = m_cameraPosition != cameraPosition;
+		m_needUpdate = m_needUpdate
+			|| m_cameraPosition != cameraPosition;
 		m_cameraPosition = cameraPosition;
 	}
 
+	void BillboardBase::setVertices( uint8_t const * data
+		, uint32_t count )
+	{
+		m_vertices.assign( data, data + size_t( count ) * m_vertexStride );
+		m_hasVertices = true;
+		m_sortedIndices.clear();
+		m_needUpdate = true;
+	}
+
 	void BillboardBase::update( GpuUpdater & updater )
 	{
-		if ( m_count )
+		// Externally filled buffers may have changed, the CPU side copy only changes when marked so.
+		if ( !m_count
+			|| ( m_hasVertices && !m_needUpdate ) )
 		{
-			auto & device = updater.device;
-			auto mappedSize = ashes::getAlignedSize( VkDeviceSize( m_count ) * m_vertexStride
-				, device.properties.limits.nonCoherentAtomSize );
+			return;
+		}
 
-			if ( auto gpuBuffer = m_vertexBuffer->getBuffer().lock( 0
-				, mappedSize
-				, 0u ) )
+		auto count = m_hasVertices
+			? std::min( m_count, uint32_t( m_vertices.size() / m_vertexStride ) )
+			: m_count;
+		auto & device = updater.device;
+		auto size = size_t( count ) * m_vertexStride;
+		auto mappedSize = ashes::getAlignedSize( VkDeviceSize( size )
+			, device.properties.limits.nonCoherentAtomSize );
+
+		if ( auto gpuBuffer = m_vertexBuffer->getBuffer().lock( 0
+			, mappedSize
+			, 0u ) )
+		{
+			if ( !m_hasVertices )
 			{
-				struct Element
-				{
-					uint8_t * m_buffer;
-					castor::Coords3f m_position;
-					uint32_t m_stride;
-
-					Element( uint8_t * buffer
-						, uint32_t offset
-						, uint32_t stride )
-						: m_buffer{ buffer }
-						, m_position{ reinterpret_cast< float * >( buffer + offset ) }
-						, m_stride{ stride }
-					{
-					}
-
-					Element( Element const & rhs )
-						: m_buffer{ rhs.m_buffer }
-						, m_position{ rhs.m_position }
-						, m_stride{ rhs.m_stride }
-					{
-					}
-
-					Element( Element && rhs )noexcept
-						: m_buffer{ rhs.m_buffer }
-						, m_position{ std::move( rhs.m_position ) }
-						, m_stride{ rhs.m_stride }
-					{
-						rhs.m_buffer = nullptr;
-					}
-
-					Element & operator=( Element const & rhs )
-					{
-						std::memcpy( m_buffer, rhs.m_buffer, m_stride );
-						return *this;
-					}
-
-					Element & operator=( Element && rhs )noexcept
-					{
-						if ( &rhs != this )
-						{
-							m_buffer = rhs.m_buffer;
-							m_position = std::move( rhs.m_position );
-							m_stride = std::move( rhs.m_stride );
-							rhs.m_buffer = nullptr;
-						}
-						return *this;
-					}
-				};
-
-				ByteArray copy{ gpuBuffer, gpuBuffer + ( size_t( m_vertexStride ) * m_count ) };
-				std::vector< Element > elements;
-				auto buffer = copy.data();
-				elements.reserve( m_count );
-
-				for ( uint32_t i = 0u; i < m_count; ++i )
-				{
-					elements.emplace_back( buffer, m_centerOffset, m_vertexStride );
-					buffer += m_vertexStride;
-				}
+				// Filled by the GPU (particles), the buffer is still in last sort order.
+				m_vertices.assign( gpuBuffer, gpuBuffer + size );
+			}
 
-				try
-				{
-					std::sort( elements.begin()
-						, elements.end()
-						, [this]( Element const & p_a
-						, Element const & p_b )
-						{
-							return point::lengthSquared( p_a.m_position - m_cameraPosition )
-								> point::lengthSquared( p_b.m_position - m_cameraPosition );
-						} );
-
-					for ( auto & element : elements )
-					{
-						std::memcpy( gpuBuffer, element.m_buffer, m_vertexStride );
-						gpuBuffer += m_vertexStride;
-					}
-				}
-				catch ( Exception const & p_exc )
-				{
-					log::error << "Submesh::SortFaces - Error: " << p_exc.what() << std::endl;
-				}
+			doSortVertices( count, m_hasVertices );
+			auto src = m_vertices.data();
 
-				m_vertexBuffer->getBuffer().flush( 0u, mappedSize );
-				m_vertexBuffer->getBuffer().unlock();
+			for ( auto index : m_sortedIndices )
+			{
+				std::memcpy( gpuBuffer, src + size_t( index ) * m_vertexStride, m_vertexStride );
+				gpuBuffer += m_vertexStride;
 			}
+
+			m_vertexBuffer->getBuffer().flush( 0u, mappedSize );
+			m_vertexBuffer->getBuffer().unlock();
+			m_needUpdate = false;
 		}
 	}
 
@@ -317,6 +270,33 @@ namespace castor3d
 		layouts.emplace_back( *m_vertexLayout );
 	}
 
+	void BillboardBase::doSortVertices( uint32_t count
+		, bool previousOrder )
+	{
+		m_sortKeys.resize( count );
+		auto position = m_vertices.data() + m_centerOffset;
+
+		for ( auto & key : m_sortKeys )
+		{
+			castor::Point3f point{ reinterpret_cast< float const * >( position ) };
+			// Inverted keys, to sort from farthest to nearest.
+			key = ~castor::floatToRadixKey( point::lengthSquared( point - m_cameraPosition ) );
+			position += m_vertexStride;
+		}
+
+		if ( !previousOrder
+			|| m_sortedIndices.size() != count )
+		{
+			m_sortedIndices.resize( count );
+			std::iota( m_sortedIndices.begin(), m_sortedIndices.end(), 0u );
+		}
+
+		// Between two frames, the order barely changes.
+		m_sorter.sortCoherent( m_sortKeys.data()
+			, m_sortedIndices.data()
+			, count );
+	}
+
 	//*************************************************************************************************
 
 	BillboardList::BillboardList( String const & name
@@ -373,21 +353,19 @@ namespace castor3d
 				, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
 				, getName() + "Billboard" );
 
-			if ( auto * buffer = m_vertexBuffer->getBuffer().lock( 0u
-				, uint32_t( m_vertexStride * m_arrayPositions.size() )
-				, 0u ) )
-			{
-				for ( auto & pos : m_arrayPositions )
-				{
-					std::memcpy( buffer, pos.constPtr(), m_vertexStride );
-					buffer += m_vertexStride;
-				}
+		}
 
-				m_vertexBuffer->getBuffer().flush( 0u, uint32_t( m_vertexStride * m_arrayPositions.size() ) );
-				m_vertexBuffer->getBuffer().unlock();
-			}
+		// The vertex buffer is written, sorted, on next update.
+		ByteArray vertices( m_vertexStride * m_arrayPositions.size() );
+		auto buffer = vertices.data();
+
+		for ( auto & pos : m_arrayPositions )
+		{
+			std::memcpy( buffer, pos.constPtr(), m_vertexStride );
+			buffer += m_vertexStride;
 		}
 
+		setVertices( vertices.data(), uint32_t( m_arrayPositions.size() ) );
 		return BillboardBase::initialise( device, uint32_t( m_arrayPositions.size() ) );
 	}
 
@@ -25,6 +25,12 @@ namespace castor3d
 			castor::TextWriter< RenderedObject >::checkError( result, "Object shadow receiver status" );
 		}
 
+		if ( p_object.isOccluder() )
+		{
+			result = p_file.writeText( m_tabs + cuT( "occluder true\n" ) ) > 0;
+			castor::TextWriter< RenderedObject >::checkError( result, "Object occluder status" );
+		}
+
 		return result;
 	}
 }
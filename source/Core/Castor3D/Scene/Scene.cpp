@@ -23,6 +23,7 @@
 #include "Castor3D/Model/Mesh/Mesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Overlay/Overlay.hpp"
+#include "Castor3D/Render/CpuFrameTimings.hpp"
 #include "Castor3D/Render/RenderLoop.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Render/RenderTarget.hpp"
@@ -33,6 +34,7 @@
 #include "Castor3D/Scene/Geometry.hpp"
 #include "Castor3D/Scene/SceneNode.hpp"
 #include "Castor3D/Scene/Animation/AnimatedObjectGroup.hpp"
+#include "Castor3D/Scene/Animation/AnimatedSkeleton.hpp"
 #include "Castor3D/Scene/Background/BackgroundTextWriter.hpp"
 #include "Castor3D/Scene/Background/Background.hpp"
 #include "Castor3D/Scene/Background/Colour.hpp"
@@ -43,6 +45,7 @@
 
 #include <CastorUtils/Graphics/Font.hpp>
 #include <CastorUtils/Graphics/FontCache.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 using namespace castor;
 
@@ -93,6 +96,64 @@ namespace castor3d
 
 			return result;
 		}
+
+		void getAnimationImportance( AnimationThrottle const & throttle
+			, AnimatedObjectGroup const & group
+			, std::vector< Camera const * > const & cameras
+			, float & projectedSize
+			, bool & visible )
+		{
+			projectedSize = 0.0f;
+			visible = false;
+			bool hasSkeleton = false;
+			auto boundsScale = throttle.getBoundsScale( group.getThrottleState() );
+
+			for ( auto const & it : group.getObjects() )
+			{
+				if ( it.second->getKind() != AnimationType::eSkeleton )
+				{
+					continue;
+				}
+
+				auto & geometry = static_cast< AnimatedSkeleton const & >( *it.second ).getGeometry();
+				auto node = geometry.getParent();
+				auto mesh = geometry.getMesh();
+
+				if ( !node || !mesh )
+				{
+					// Unplaced geometries can't be ranked, keep them at full rate.
+					projectedSize = std::numeric_limits< float >::max();
+					visible = true;
+					return;
+				}
+
+				hasSkeleton = true;
+				// The skinned bounds aren't known until the pose is computed, so the rest pose bounds
+				// are inflated, the more the pose is stale.
+				auto & transform = node->getDerivedTransformationMatrix();
+				auto scale = node->getDerivedScale();
+				auto maxScale = std::max( std::abs( scale[0] ), std::max( std::abs( scale[1] ), std::abs( scale[2] ) ) );
+				castor::BoundingSphere sphere{ mesh->getBoundingSphere().getCenter()
+					, mesh->getBoundingSphere().getRadius() * boundsScale };
+				auto center = transform * sphere.getCenter();
+				auto radius = sphere.getRadius() * maxScale;
+
+				for ( auto camera : cameras )
+				{
+					auto distance = float( castor::point::distance( center, camera->getParent()->getDerivedPosition() ) );
+					projectedSize = std::max( projectedSize
+						, AnimationThrottle::getProjectedSize( radius, distance, camera->getProjectionScale() ) );
+					visible = visible
+						|| camera->isVisible( sphere, transform, scale );
+				}
+			}
+
+			if ( !hasSkeleton )
+			{
+				projectedSize = std::numeric_limits< float >::max();
+				visible = true;
+			}
+		}
 	}
 
 	//*************************************************************************************************
@@ -130,9 +191,11 @@ namespace castor3d
 	//*************************************************************************************************
 
 	Scene::TextWriter::TextWriter( castor::String const & tabs
-		, castor::Path const & materialsFile )
+		, castor::Path const & materialsFile
+		, castor::Path binaryFile )
 		: castor::TextWriter< Scene >{ tabs }
 		, m_materialsFile{ materialsFile }
+		, m_binaryFile{ std::move( binaryFile ) }
 	{
 	}
 
@@ -226,6 +289,13 @@ namespace castor3d
 			castor::TextWriter< Scene >::checkError( result, "Scene LPV indirect attenuation" );
 		}
 
+		if ( result && scene.getAnimationThrottle().isEnabled() )
+		{
+			log::info << cuT( "Scene::write - Animation throttle" ) << std::endl;
+			result = file.writeText( m_tabs + cuT( "\tanimation_throttle true\n" ) ) > 0;
+			castor::TextWriter< Scene >::checkError( result, "Scene animation throttle" );
+		}
+
 		if ( result )
 		{
 			result = writeView< castor::Font >( scene.getFontView()
@@ -273,7 +343,9 @@ namespace castor3d
 			}
 		}
 
-		if ( result && !scene.getMeshCache().isEmpty() )
+		if ( result
+			&& m_binaryFile.empty()
+			&& !scene.getMeshCache().isEmpty() )
 		{
 			result = file.writeText( cuT( "\n" ) + m_tabs + cuT( "\t// Meshes\n" ) ) > 0;
 
@@ -335,7 +407,17 @@ namespace castor3d
 			}
 		}
 
-		if ( result && !scene.getObjectRootNode()->getChildren().empty() )
+		if ( result && !m_binaryFile.empty() )
+		{
+			// Object nodes, lights, geometries and meshes are loaded from the binary file.
+			// It is included after the cameras, since objects can be attached to camera nodes.
+			log::info << cuT( "Scene::write - Binary file" ) << std::endl;
+			String path = m_binaryFile;
+			string::replace( path, cuT( "\\" ), cuT( "/" ) );
+			result = file.writeText( cuT( "\n" ) + m_tabs + cuT( "\tinclude_binary \"" ) + path + cuT( "\"\n" ) ) > 0;
+			castor::TextWriter< Scene >::checkError( result, "Scene binary file" );
+		}
+		else if ( result && !scene.getObjectRootNode()->getChildren().empty() )
 		{
 			result = file.writeText( cuT( "\n" ) + m_tabs + cuT( "\t// Objects nodes\n" ) ) > 0;
 
@@ -350,7 +432,9 @@ namespace castor3d
 			}
 		}
 
-		if ( result && !scene.getLightCache() .isEmpty() )
+		if ( result
+			&& m_binaryFile.empty()
+			&& !scene.getLightCache() .isEmpty() )
 		{
 			result = file.writeText( cuT( "\n" ) + m_tabs + cuT( "\t// Lights\n" ) ) > 0;
 
@@ -367,7 +451,9 @@ namespace castor3d
 			}
 		}
 
-		if ( result && !scene.getGeometryCache().isEmpty() )
+		if ( result
+			&& m_binaryFile.empty()
+			&& !scene.getGeometryCache().isEmpty() )
 		{
 			result = file.writeText( cuT( "\n" ) + m_tabs + cuT( "\t// Geometries\n" ) ) > 0;
 
@@ -506,19 +592,35 @@ namespace castor3d
 		};
 		auto gpuEvtInitialise = [this]( auto element )
 		{
-			this->getListener().postEvent( makeGpuInitialiseEvent( *element ) );
+			this->getListener().postEvent( EventType::ePreRender
+				, [&object = *element]( RenderDevice const & device )
+				{
+					object.initialise( device );
+				} );
 		};
 		auto gpuEvtClean = [this]( auto element )
 		{
-			this->getListener().postEvent( makeGpuCleanupEvent( *element ) );
+			this->getListener().postEvent( EventType::ePreRender
+				, [&object = *element]( RenderDevice const & device )
+				{
+					object.cleanup( device );
+				} );
 		};
 		auto cpuEvtInitialise = [this]( auto element )
 		{
-			this->getListener().postEvent( makeCpuInitialiseEvent( *element ) );
+			this->getListener().postEvent( EventType::ePreRender
+				, [&object = *element]()
+				{
+					object.initialise();
+				} );
 		};
 		auto cpuEvtClean = [this]( auto element )
 		{
-			this->getListener().postEvent( makeCpuCleanupEvent( *element ) );
+			this->getListener().postEvent( EventType::ePreRender
+				, [&object = *element]()
+				{
+					object.cleanup();
+				} );
 		};
 		auto attachObject = []( auto element
 			, SceneNode & parent
@@ -707,9 +809,9 @@ namespace castor3d
 			, mergeResource );
 
 		m_materialCacheView = makeCacheView< Material, EventType::ePreRender >( getName()
-			, [this]( MaterialSPtr element )
+			, [this, gpuEvtInitialise]( MaterialSPtr element )
 				{
-					this->getListener().postEvent( makeGpuInitialiseEvent( *element ) );
+					gpuEvtInitialise( element );
 					this->m_materialsListeners.emplace( element
 						, element->onChanged.connect( [this]( Material const & material )
 							{
@@ -717,11 +819,11 @@ namespace castor3d
 							} ) );
 					m_dirtyMaterials = true;
 				}
-			, [this]( MaterialSPtr element )
+			, [this, cpuEvtClean]( MaterialSPtr element )
 				{
 					m_dirtyMaterials = true;
 					this->m_materialsListeners.erase( element );
-					this->getListener().postEvent( makeCpuCleanupEvent( *element ) );
+					cpuEvtClean( element );
 				}
 			, getEngine()->getMaterialCache() );
 		m_samplerCacheView = makeCacheView< Sampler, EventType::ePreRender >( getName()
@@ -855,11 +957,27 @@ namespace castor3d
 
 	void Scene::update( CpuUpdater & updater )
 	{
+		CU_ProfileScope( "Scene::cpuUpdate" );
+		// Frame boundary: publish the objects added or removed since last frame.
+		// Culling may have run on the previous views, so it has to be done again.
+		auto flushed = getSceneNodeCache().flush();
+		flushed = getGeometryCache().flush() || flushed;
+		flushed = getLightCache().flush() || flushed;
+		flushed = getBillboardListCache().flush() || flushed;
+
+		if ( flushed )
+		{
+			setChanged();
+		}
+
 		if ( m_initialised )
 		{
 			m_rootNode->update();
 			doUpdateBoundingBox();
-			doUpdateAnimations();
+			{
+				CpuPhaseTimer timer{ updater.timings, CpuFramePhase::eAnimations };
+				doUpdateAnimations();
+			}
 			doUpdateMaterials();
 			getLightCache().update( updater );
 			getGeometryCache().update( updater );
@@ -872,7 +990,9 @@ namespace castor3d
 
 	void Scene::update( GpuUpdater & updater )
 	{
+		CU_ProfileScope( "Scene::gpuUpdate" );
 		getLightCache().update( updater );
+		getBillboardListCache().update( updater );
 		getMeshCache().forEach( []( Mesh & mesh )
 		{
 			for ( auto & submesh : mesh )
@@ -1136,13 +1256,45 @@ namespace castor3d
 			groups.emplace_back( group );
 		} );
 
+		std::vector< Camera const * > cameras;
+
+		if ( m_animationThrottle.isEnabled() )
+		{
+			using LockType = std::unique_lock< CameraCache const >;
+			LockType lock{ castor::makeUniqueLock( getCameraCache() ) };
+
+			for ( auto const & it : getCameraCache() )
+			{
+				if ( it.second->getParent() )
+				{
+					cameras.push_back( it.second.get() );
+				}
+			}
+		}
+
+		// Without any camera, there is nothing to throttle against.
+		auto update = [this, &cameras]( AnimatedObjectGroup & group )
+		{
+			if ( cameras.empty() )
+			{
+				group.update();
+			}
+			else
+			{
+				float projectedSize{};
+				bool visible{};
+				getAnimationImportance( m_animationThrottle, group, cameras, projectedSize, visible );
+				group.update( m_animationThrottle, projectedSize, visible );
+			}
+		};
+
 		if ( groups.size() > m_animationUpdater.getCount() )
 		{
 			for ( auto & group : groups )
 			{
-				m_animationUpdater.pushJob( [&group]()
+				m_animationUpdater.pushJob( [&group, &update]()
 				{
-					group.get().update();
+					update( group.get() );
 				} );
 			}
 
@@ -1152,9 +1304,11 @@ namespace castor3d
 		{
 			for ( auto & group : groups )
 			{
-				group.get().update();
+				update( group.get() );
 			}
 		}
+
+		m_animationThrottle.nextFrame();
 	}
 
 	void Scene::doUpdateMaterials()
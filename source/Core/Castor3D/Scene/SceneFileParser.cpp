@@ -7,6 +7,7 @@
 
 #include <CastorUtils/Data/ZipArchive.hpp>
 #include <CastorUtils/FileParser/ParserParameter.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 using namespace castor;
 
@@ -36,6 +37,37 @@ namespace castor3d
 		{
 			return getEnumMapT( EnumT::eMin, EnumT::eMax );
 		}
+
+		// The archive files decompressed ahead, in parallel, at most.
+		static uint64_t constexpr ArchivePrefetchSize = 256ull * 1024ull * 1024ull;
+
+		Path findSceneFile( PathArray const & files
+			, Path const & archivePath )
+		{
+			auto it = std::find_if( files.begin()
+				, files.end()
+				, [&archivePath]( Path const & lookup )
+				{
+					auto fileName = lookup.getFileName( true );
+					return fileName == cuT( "main.cscn" )
+						|| fileName == cuT( "scene.cscn" )
+						|| fileName == archivePath.getFileName() + cuT( ".cscn" );
+				} );
+
+			if ( it == files.end() )
+			{
+				it = std::find_if( files.begin()
+					, files.end()
+					, []( Path const & lookup )
+					{
+						return lookup.getExtension() == cuT( "cscn" );
+					} );
+			}
+
+			return it == files.end()
+				? Path{}
+				: *it;
+		}
 	}
 
 	//*********************************************************************************************
@@ -178,6 +210,11 @@ namespace castor3d
 		m_mapComparisonModes[cuT( "none" )] = uint32_t( false );
 		m_mapComparisonModes[cuT( "ref_to_texture" )] = uint32_t( true );
 
+		m_mapTextureCompressions[cuT( "none" )] = uint32_t( castor::BlockCompressionQuality::eCount );
+		m_mapTextureCompressions[cuT( "fast" )] = uint32_t( castor::BlockCompressionQuality::eFast );
+		m_mapTextureCompressions[cuT( "normal" )] = uint32_t( castor::BlockCompressionQuality::eNormal );
+		m_mapTextureCompressions[cuT( "high" )] = uint32_t( castor::BlockCompressionQuality::eHigh );
+
 		m_mapMipmapModes[cuT( "none" )] = uint32_t( VK_SAMPLER_MIPMAP_MODE_NEAREST );
 
 		m_mapBlendFactors = getEnumMapT( VK_BLEND_FACTOR_ZERO, VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA );
@@ -221,57 +258,24 @@ namespace castor3d
 
 	bool SceneFileParser::parseFile( Path const & pathFile )
 	{
-		Path path = pathFile;
+		CU_ProfileScope( "SceneFileParser::parseFile" );
 
-		if ( path.getExtension() == cuT( "zip" ) )
+		if ( pathFile.getExtension() == cuT( "zip" ) )
 		{
-			castor::ZipArchive archive( path, File::OpenMode::eRead );
-			path = Engine::getEngineDirectory() / pathFile.getFileName();
-
-			bool ok = true;
-
-			if ( !File::directoryExists( path ) )
-			{
-				ok = archive.inflate( path );
-			}
+			return doParseArchive( pathFile );
+		}
 
-			if ( ok )
-			{
-				PathArray files;
+		castor::ByteArray data;
 
-				if ( File::listDirectoryFiles( path, files, true ) )
-				{
-					auto it = std::find_if( files.begin()
-						, files.end()
-						, [pathFile]( Path const & lookup )
-						{
-							auto fileName = lookup.getFileName( true );
-							return fileName == cuT( "main.cscn" )
-								|| fileName == cuT( "scene.cscn" )
-								|| fileName == pathFile.getFileName() + cuT( ".cscn" );
-						} );
-
-					if ( it != files.end() )
-					{
-						path = *it;
-					}
-					else
-					{
-						auto it = std::find_if( files.begin(), files.end(), []( Path const & p_path )
-							{
-								return p_path.getExtension() == cuT( "cscn" );
-							} );
-
-						if ( it != files.end() )
-						{
-							path = *it;
-						}
-					}
-				}
-			}
+		if ( !File::fileExists( pathFile )
+			&& castor::ZipArchive::readMountedFile( pathFile, data ) )
+		{
+			// Included from a scene read from an archive.
+			return FileParser::parseFile( pathFile
+				, String( data.begin(), data.end() ) );
 		}
 
-		return FileParser::parseFile( path );
+		return FileParser::parseFile( pathFile );
 	}
 
 	bool SceneFileParser::parseFile( castor::Path const & pathFile, SceneFileContextSPtr context )
@@ -280,6 +284,64 @@ namespace castor3d
 		return parseFile( pathFile );
 	}
 
+	bool SceneFileParser::doParseArchive( Path const & pathFile )
+	{
+		auto archive = std::make_shared< castor::ZipArchive >( pathFile, File::OpenMode::eRead );
+
+		if ( m_extractArchives )
+		{
+			Path folder;
+			PathArray files;
+
+			if ( !archive->extract( Engine::getEngineDirectory() / cuT( "Cache" ) / cuT( "Archives" ), folder )
+				|| !File::listDirectoryFiles( folder, files, true ) )
+			{
+				return false;
+			}
+
+			auto scene = findSceneFile( files, pathFile );
+			return !scene.empty()
+				&& FileParser::parseFile( scene );
+		}
+
+		// The files are read from the archive, through a virtual folder.
+		auto root = Engine::getEngineDirectory() / pathFile.getFileName();
+		auto files = archive->listFiles();
+		auto scene = findSceneFile( files, pathFile );
+
+		if ( scene.empty() )
+		{
+			return false;
+		}
+
+		PathArray prefetched;
+		uint64_t size = 0u;
+
+		for ( auto & file : files )
+		{
+			if ( file.getExtension() != cuT( "cscn" )
+				&& size < ArchivePrefetchSize )
+			{
+				prefetched.push_back( file );
+				size += archive->getFileSize( file );
+			}
+		}
+
+		archive->prefetch( prefetched );
+		castor::ByteArray data;
+		bool result = archive->readFile( scene, data );
+
+		if ( result )
+		{
+			// Unmounted even if the parsing throws.
+			castor::ZipArchive::MountGuard guard{ root, archive };
+			result = FileParser::parseFile( root / scene
+				, String( data.begin(), data.end() ) );
+		}
+
+		return result;
+	}
+
 	void SceneFileParser::doInitialiseParser( Path const & path )
 	{
 		if ( !m_context )
@@ -314,6 +376,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "tone_mapping" ), parserRenderTargetToneMapping, { makeParameter< ParameterType::eName >(), makeParameter< ParameterType::eText >() } );
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "ssao" ), parserRenderTargetSsao );
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "hdr_config" ), parserRenderTargetHdrConfig );
+		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "occlusion_culling" ), parserRenderTargetOcclusionCulling, { makeParameter< ParameterType::eBool >() } );
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "}" ), parserRenderTargetEnd );
 
 		addParser( uint32_t( CSCNSection::eSampler ), cuT( "min_filter" ), parserSamplerMinFilter, { makeParameter< ParameterType::eCheckedText >( m_mapFilters ) } );
@@ -332,6 +395,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eSampler ), cuT( "comparison_func" ), parserSamplerComparisonFunc, { makeParameter< ParameterType::eCheckedText >( m_mapComparisonFuncs ) } );
 
 		addParser( uint32_t( CSCNSection::eScene ), cuT( "include" ), parserSceneInclude, { makeParameter< ParameterType::ePath >() } );
+		addParser( uint32_t( CSCNSection::eScene ), cuT( "include_binary" ), parserSceneIncludeBinary, { makeParameter< ParameterType::ePath >() } );
 		addParser( uint32_t( CSCNSection::eScene ), cuT( "background_colour" ), parserSceneBkColour, { makeParameter< ParameterType::eRgbColour >() } );
 		addParser( uint32_t( CSCNSection::eScene ), cuT( "background_image" ), parserSceneBkImage, { makeParameter< ParameterType::ePath >() } );
 		addParser( uint32_t( CSCNSection::eScene ), cuT( "font" ), parserSceneFont, { makeParameter< ParameterType::eName >() } );
@@ -356,6 +420,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eScene ), cuT( "mesh" ), parserMesh, { makeParameter< ParameterType::eName >() } );
 		addParser( uint32_t( CSCNSection::eScene ), cuT( "directional_shadow_cascades" ), parserDirectionalShadowCascades, { makeParameter< ParameterType::eUInt32 >( castor::makeRange( 0u, shader::DirectionalMaxCascadesCount ) ) } );
 		addParser( uint32_t( CSCNSection::eScene ), cuT( "lpv_indirect_attenuation" ), parserLpvIndirectAttenuation, { makeParameter< ParameterType::eFloat >() } );
+		addParser( uint32_t( CSCNSection::eScene ), cuT( "animation_throttle" ), parserSceneAnimationThrottle, { makeParameter< ParameterType::eBool >() } );
 
 		addParser( uint32_t( CSCNSection::eParticleSystem ), cuT( "parent" ), parserParticleSystemParent, { makeParameter< ParameterType::eName >() } );
 		addParser( uint32_t( CSCNSection::eParticleSystem ), cuT( "particles_count" ), parserParticleSystemCount, { makeParameter< ParameterType::eUInt32 >() } );
@@ -406,6 +471,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "materials" ), parserObjectMaterials );
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "cast_shadows" ), parserObjectCastShadows, { makeParameter< ParameterType::eBool >() } );
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "receive_shadows" ), parserObjectReceivesShadows, { makeParameter< ParameterType::eBool >() } );
+		addParser( uint32_t( CSCNSection::eObject ), cuT( "occluder" ), parserObjectOccluder, { makeParameter< ParameterType::eBool >() } );
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "}" ), parserObjectEnd );
 
 		addParser( uint32_t( CSCNSection::eObjectMaterials ), cuT( "material" ), parserObjectMaterialsMaterial, { makeParameter< ParameterType::eUInt16 >(), makeParameter< ParameterType::eName >() } );
@@ -416,6 +482,8 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eMesh ), cuT( "import" ), parserMeshImport, { makeParameter< ParameterType::ePath >(), makeParameter< ParameterType::eText >() } );
 		addParser( uint32_t( CSCNSection::eMesh ), cuT( "morph_import" ), parserMeshMorphImport, { makeParameter< ParameterType::ePath >(), makeParameter< ParameterType::eFloat >(), makeParameter< ParameterType::eText >() } );
 		addParser( uint32_t( CSCNSection::eMesh ), cuT( "division" ), parserMeshDivide, { makeParameter< ParameterType::eName >(), makeParameter< ParameterType::eUInt16 >() } );
+		addParser( uint32_t( CSCNSection::eMesh ), cuT( "lods" ), parserMeshLods, { makeParameter< ParameterType::eUInt32 >( makeRange( 1u, 8u ) ), makeParameter< ParameterType::eFloat >() } );
+		addParser( uint32_t( CSCNSection::eMesh ), cuT( "meshlets" ), parserMeshMeshlets );
 		addParser( uint32_t( CSCNSection::eMesh ), cuT( "default_material" ), parserMeshDefaultMaterial, { makeParameter< ParameterType::eName >() } );
 		addParser( uint32_t( CSCNSection::eMesh ), cuT( "default_materials" ), parserMeshDefaultMaterials );
 		addParser( uint32_t( CSCNSection::eMesh ), cuT( "}" ), parserMeshEnd );
@@ -485,6 +553,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eTextureUnit ), cuT( "normal_directx" ), parserUnitNormalDirectX, { makeParameter< ParameterType::eBool >() } );
 		addParser( uint32_t( CSCNSection::eTextureUnit ), cuT( "sampler" ), parserUnitSampler, { makeParameter< ParameterType::eName >() } );
 		addParser( uint32_t( CSCNSection::eTextureUnit ), cuT( "invert_y" ), parserUnitInvertY, { makeParameter< ParameterType::eBool >() } );
+		addParser( uint32_t( CSCNSection::eTextureUnit ), cuT( "compression" ), parserUnitCompression, { makeParameter< ParameterType::eCheckedText >( m_mapTextureCompressions ) } );
 		addParser( uint32_t( CSCNSection::eTextureUnit ), cuT( "}" ), parserUnitEnd );
 
 		addParser( uint32_t( CSCNSection::eShaderProgram ), cuT( "vertex_program" ), parserVertexShader );
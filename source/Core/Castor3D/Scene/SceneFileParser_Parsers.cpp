@@ -1,6 +1,7 @@
 #include "Castor3D/Scene/SceneFileParser_Parsers.hpp"
 
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/Binary/BinaryScene.hpp"
 #include "Castor3D/Cache/AnimatedObjectGroupCache.hpp"
 #include "Castor3D/Cache/BillboardCache.hpp"
 #include "Castor3D/Cache/CacheView.hpp"
@@ -52,6 +53,7 @@
 #include "Castor3D/Scene/ParticleSystem/ParticleSystem.hpp"
 #include "Castor3D/Shader/Program.hpp"
 
+#include <CastorUtils/Data/ZipArchive.hpp>
 #include <CastorUtils/FileParser/ParserParameter.hpp>
 
 using namespace castor;
@@ -601,6 +603,23 @@ namespace castor3d
 	}
 	CU_EndAttributePush( CSCNSection::eHdrConfig )
 
+	CU_ImplementAttributeParser( parserRenderTargetOcclusionCulling )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->renderTarget )
+		{
+			CU_ParsingError( cuT( "No target initialised." ) );
+		}
+		else if ( !params.empty() )
+		{
+			bool value;
+			params[0]->get( value );
+			parsingContext->renderTarget->setOcclusionCulling( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserRenderTargetEnd )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -896,6 +915,37 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserSceneIncludeBinary )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else if ( !params.empty() )
+		{
+			Path path;
+			params[0]->get( path );
+			path = parsingContext->m_file.getPath() / path;
+
+			if ( !File::fileExists( path ) )
+			{
+				CU_ParsingError( cuT( "Binary scene file [" ) + path + cuT( "] does not exist." ) );
+			}
+			else
+			{
+				BinaryFile file{ path, File::OpenMode::eRead };
+
+				if ( !BinaryParser< Scene >{ path.getPath() }.parse( *parsingContext->scene, file ) )
+				{
+					CU_ParsingError( cuT( "Couldn't load binary scene file [" ) + path + cuT( "]." ) );
+				}
+			}
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserSceneBkColour )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -1343,6 +1393,23 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserSceneAnimationThrottle )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else if ( !params.empty() )
+		{
+			bool value;
+			params[0]->get( value );
+			parsingContext->scene->getAnimationThrottle().setEnabled( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserParticleSystemParent )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -2230,6 +2297,23 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserObjectOccluder )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->geometry )
+		{
+			CU_ParsingError( cuT( "No Geometry initialised." ) );
+		}
+		else if ( !params.empty() )
+		{
+			bool value;
+			params[0]->get( value );
+			parsingContext->geometry->setOccluder( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserObjectEnd )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -2558,6 +2642,58 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserMeshLods )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->mesh )
+		{
+			CU_ParsingError( cuT( "No Mesh initialised." ) );
+		}
+		else if ( !params.empty() )
+		{
+			uint32_t count;
+			float ratio{ 0.5f };
+			params[0]->get( count );
+
+			if ( params.size() > 1 )
+			{
+				params[1]->get( ratio );
+			}
+
+			if ( ratio <= 0.0f || ratio >= 1.0f )
+			{
+				CU_ParsingError( cuT( "LOD ratio must be in ]0, 1[." ) );
+			}
+			else
+			{
+				for ( auto submesh : *parsingContext->mesh )
+				{
+					submesh->generateLods( count, ratio );
+				}
+			}
+		}
+	}
+	CU_EndAttribute()
+
+	CU_ImplementAttributeParser( parserMeshMeshlets )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->mesh )
+		{
+			CU_ParsingError( cuT( "No Mesh initialised." ) );
+		}
+		else
+		{
+			for ( auto submesh : *parsingContext->mesh )
+			{
+				submesh->generateMeshlets();
+			}
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserMeshDefaultMaterial )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -3656,7 +3792,8 @@ namespace castor3d
 			Path relative;
 			params[0]->get( relative );
 
-			if ( File::fileExists( context->m_file.getPath() / relative ) )
+			if ( File::fileExists( context->m_file.getPath() / relative )
+				|| ZipArchive::findMountedFile( context->m_file.getPath() / relative ) )
 			{
 				folder = context->m_file.getPath();
 			}
@@ -4167,6 +4304,32 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserUnitCompression )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->textureUnit )
+		{
+			CU_ParsingError( cuT( "No TextureUnit initialised." ) );
+		}
+		else if ( params.empty() )
+		{
+			CU_ParsingError( cuT( "Missing parameter." ) );
+		}
+		else
+		{
+			uint32_t value;
+			params[0]->get( value );
+			parsingContext->compressTexture = value != uint32_t( castor::BlockCompressionQuality::eCount );
+
+			if ( parsingContext->compressTexture )
+			{
+				parsingContext->textureCompression = castor::BlockCompressionQuality( value );
+			}
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserUnitEnd )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -4203,8 +4366,21 @@ namespace castor3d
 							, parsingContext->imageInfo
 							, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 							, parsingContext->relative );
+
+						if ( parsingContext->compressTexture )
+						{
+							auto compressed = getBlockCompressedFormat( parsingContext->textureConfiguration
+								, parsingContext->textureCompression );
+							texture->setCompression( compressed.format
+								, { parsingContext->textureCompression, 0u }
+								, compressed.component );
+							parsingContext->textureUnit->setCompressedConfiguration( std::move( compressed.configuration ) );
+						}
+
 						texture->setSource( parsingContext->folder
-							, parsingContext->relative );
+							, parsingContext->relative
+							, ( parsingContext->textureConfiguration.colourMask[0]
+								|| parsingContext->textureConfiguration.emissiveMask[0] ) );
 						parsingContext->textureUnit->setTexture( texture );
 						parsingContext->textureUnit->setConfiguration( parsingContext->textureConfiguration );
 						parsingContext->pass->addTextureUnit( std::move( parsingContext->textureUnit ) );
@@ -4228,6 +4404,7 @@ namespace castor3d
 					VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT
 				};
 				parsingContext->textureConfiguration = TextureConfiguration{};
+				parsingContext->compressTexture = false;
 			}
 		}
 		else
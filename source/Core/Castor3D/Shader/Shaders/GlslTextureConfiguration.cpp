@@ -142,10 +142,15 @@ namespace castor3d
 			, sdw::Vec4 const & sampled
 			, sdw::Mat3 const & tbn )const
 		{
+			auto mapNormal = fma( getVec3( writer, sampled, normalMask )
+				, vec3( 2.0_f )
+				, -vec3( 1.0_f ) );
+			// Two components normal maps (BC5) have their Z reconstructed (miscVals.z).
 			return normalize( tbn
-				* fma( getVec3( writer, sampled, normalMask )
-					, vec3( 2.0_f )
-					, -vec3( 1.0_f ) ) );
+				* writer.ternary( miscVals.z() != 0.0_f
+					, vec3( mapNormal.xy()
+						, sqrt( max( 0.0_f, 1.0_f - dot( mapNormal.xy(), mapNormal.xy() ) ) ) )
+					, mapNormal ) );
 		}
 
 		sdw::Vec3 TextureConfigData::getNormal( sdw::ShaderWriter & writer
@@ -174,7 +174,10 @@ namespace castor3d
 					m_data.normalFc[index] = writeFlags( config.normalMask, config.normalFactor, config.normalGMultiplier );
 					m_data.heightFc[index] = writeFlags( config.heightMask, config.heightFactor );
 					m_data.miscVals[index] = writeFlags( float( config.needsGammaCorrection )
-						, float( config.needsYInversion ) );
+						, float( config.needsYInversion )
+						, ( config.normalMask[0] == TextureConfiguration::RgMask
+							? 1.0f
+							: 0.0f ) );
 
 #else
 
@@ -186,7 +189,10 @@ namespace castor3d
 					data.normalFc = writeFlags( config.normalMask, config.normalFactor, config.normalGMultiplier );
 					data.heightFc = writeFlags( config.heightMask, config.heightFactor );
 					data.miscVals = writeFlags( float( config.needsGammaCorrection )
-						, float( config.needsYInversion ) );
+						, float( config.needsYInversion )
+						, ( config.normalMask[0] == TextureConfiguration::RgMask
+							? 1.0f
+							: 0.0f ) );
 
 #endif
 				} );
@@ -83,20 +83,19 @@ namespace castor3d
 
 		if ( checkFlag( flags, ProgramFlag::eInstantiation ) )
 		{
-			auto gl_InstanceID = writer.getVariable< Int >( cuT( "gl_InstanceIndex" ) );
 			auto transform = writer.getVariable< Mat4 >( cuT( "inTransform" ) );
-			auto mtxInstanceOffset = writer.declLocale( cuT( "mtxInstanceOffset" )
-				, gl_InstanceID * 400_i );
+			// The instance's bone palette is packed in the storage buffer, at the offset given in its instance data.
+			auto mtxInstanceOffset = writer.getVariable< UInt >( cuT( "inBonesOffset" ) );
 
 			auto & ssbo = *data.ssbo;
-			mtxBoneTransform = ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds0[0_i] )] * inWeights0[0_i];
-			mtxBoneTransform += ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds0[1_i] )] * inWeights0[1_i];
-			mtxBoneTransform += ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds0[2_i] )] * inWeights0[2_i];
-			mtxBoneTransform += ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds0[3_i] )] * inWeights0[3_i];
-			mtxBoneTransform += ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds1[0_i] )] * inWeights1[0_i];
-			mtxBoneTransform += ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds1[1_i] )] * inWeights1[1_i];
-			mtxBoneTransform += ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds1[2_i] )] * inWeights1[2_i];
-			mtxBoneTransform += ssbo[writer.cast< UInt >( mtxInstanceOffset + inBoneIds1[3_i] )] * inWeights1[3_i];
+			mtxBoneTransform = ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds0[0_i] )] * inWeights0[0_i];
+			mtxBoneTransform += ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds0[1_i] )] * inWeights0[1_i];
+			mtxBoneTransform += ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds0[2_i] )] * inWeights0[2_i];
+			mtxBoneTransform += ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds0[3_i] )] * inWeights0[3_i];
+			mtxBoneTransform += ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds1[0_i] )] * inWeights1[0_i];
+			mtxBoneTransform += ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds1[1_i] )] * inWeights1[1_i];
+			mtxBoneTransform += ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds1[2_i] )] * inWeights1[2_i];
+			mtxBoneTransform += ssbo[mtxInstanceOffset + writer.cast< UInt >( inBoneIds1[3_i] )] * inWeights1[3_i];
 			mtxBoneTransform = transform * mtxBoneTransform;
 		}
 		else
@@ -4,6 +4,8 @@
 
 #include "CastorUtils/Log/Logger.hpp"
 
+#include <cstdio>
+
 namespace castor
 {
 	File::File( Path const & p_fileName, FlagCombination< OpenMode > const & p_mode, EncodingMode p_encoding )
@@ -305,6 +307,24 @@ namespace castor
 		return result;
 	}
 
+	bool File::moveFileName( Path const & srcFileName
+		, Path const & dstFileName )
+	{
+		auto src = string::stringCast< char >( srcFileName );
+		auto dst = string::stringCast< char >( dstFileName );
+		// Some platforms don't replace an existing destination file.
+		bool result = std::rename( src.c_str(), dst.c_str() ) == 0
+			|| ( deleteFile( dstFileName )
+				&& std::rename( src.c_str(), dst.c_str() ) == 0 );
+
+		if ( !result )
+		{
+			Logger::logWarning( cuT( "moveFile - Can't rename file : " ) + srcFileName );
+		}
+
+		return result;
+	}
+
 	bool File::listDirectoryFiles( Path const & folderPath, PathArray & files, bool recursive )
 	{
 		files = filterDirectoryFiles( folderPath
@@ -2,7 +2,14 @@
 
 #include "CastorUtils/Log/Logger.hpp"
 #include "CastorUtils/Data/BinaryFile.hpp"
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Miscellaneous/Hash.hpp"
 #include "CastorUtils/Miscellaneous/Utils.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <atomic>
+#include <iomanip>
+#include <sstream>
 
 #ifdef WIN32
 #	undef HAVE_UNISTD_H
@@ -28,6 +35,49 @@ namespace castor
 {
 	static const size_t CHUNK = 16384;
 
+	namespace
+	{
+		using MountedArchive = std::pair< Path, std::shared_ptr< ZipArchive > >;
+
+		struct Mounts
+		{
+			std::mutex mutex;
+			std::vector< MountedArchive > archives;
+		};
+
+		Mounts & getMounts()
+		{
+			static Mounts result;
+			return result;
+		}
+
+		MountedArchive findMount( Path const & file
+			, Path & relative )
+		{
+			auto & mounts = getMounts();
+			auto lock( makeUniqueLock( mounts.mutex ) );
+
+			for ( auto & mount : mounts.archives )
+			{
+				if ( file == mount.first )
+				{
+					relative = Path{};
+					return mount;
+				}
+
+				auto prefix = mount.first + Path::NativeSeparator;
+
+				if ( file.find( prefix ) == 0u )
+				{
+					relative = Path{ file.substr( prefix.size() ) };
+					return mount;
+				}
+			}
+
+			return {};
+		}
+	}
+
 	//*********************************************************************************************
 
 	namespace zlib
@@ -120,52 +170,6 @@ namespace castor
 				}
 			}
 
-			virtual bool findFolder( String const & infolder )
-			{
-				bool result = false;
-				//std::string folder = string::stringCast< char >( infolder );
-
-				////Search for the folder
-				//struct zip_stat stat = { 0 };
-
-				//if ( zip_stat( m_zip, folder.c_str(), 0, &stat ) == -1 )
-				//{
-				//	int zep, sep;
-				//	zip_error_get( m_zip, &zep, &sep );
-				//	std::string error = libzip::getError( zep ) + " - " + libzip::getError( sep );
-				//	Logger::logWarning( "Couldn't retrieve ZIP archive folder [" + folder + "] informations : " + error );
-				//}
-				//else
-				//{
-				//	result = true;
-				//}
-
-				return result;
-			}
-
-			virtual bool findFile( String const & infile )
-			{
-				bool result = false;
-				//std::string file = string::stringCast< char >( infile );
-
-				////Search for the folder
-				//struct zip_stat stat = { 0 };
-
-				//if ( zip_stat( m_zip, file.c_str(), 0, &stat ) == -1 )
-				//{
-				//	int zep, sep;
-				//	zip_error_get( m_zip, &zep, &sep );
-				//	std::string error = libzip::getError( zep ) + " - " + libzip::getError( sep );
-				//	Logger::logWarning( "Couldn't retrieve ZIP archive file [" + file + "] informations : " + error );
-				//}
-				//else
-				//{
-				//	result = true;
-				//}
-
-				return result;
-			}
-
 			virtual void deflate( ZipArchive::Folder const & infolder )
 			{
 				for ( auto folder : infolder.folders )
@@ -218,6 +222,141 @@ namespace castor
 				return result;
 			}
 
+			virtual std::vector< ZipArchive::Entry > index()
+			{
+				std::vector< ZipArchive::Entry > result;
+				unz_global_info gi;
+				auto error = unzGetGlobalInfo( m_unzip, &gi );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzGetGlobalInfo: " + zlib::getError( error ) );
+				}
+
+				if ( gi.number_entry == 0 )
+				{
+					return result;
+				}
+
+				error = unzGoToFirstFile( m_unzip );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzGoToFirstFile: " + zlib::getError( error ) );
+				}
+
+				result.reserve( gi.number_entry );
+				std::vector< char > fileNameInZip;
+
+				for ( uLong i = 0; i < gi.number_entry; ++i )
+				{
+					unz_file_info fileInfo;
+					error = unzGetCurrentFileInfo( m_unzip, &fileInfo, NULL, 0, NULL, 0, NULL, 0 );
+
+					if ( error == UNZ_OK )
+					{
+						fileNameInZip.resize( fileInfo.size_filename + 1u );
+						error = unzGetCurrentFileInfo( m_unzip
+							, &fileInfo
+							, fileNameInZip.data()
+							, uLong( fileNameInZip.size() )
+							, NULL
+							, 0
+							, NULL
+							, 0 );
+					}
+
+					if ( error != UNZ_OK )
+					{
+						CU_Exception( "Error in unzGetCurrentFileInfo: " + zlib::getError( error ) );
+					}
+
+					unz_file_pos position;
+					error = unzGetFilePos( m_unzip, &position );
+
+					if ( error != UNZ_OK )
+					{
+						CU_Exception( "Error in unzGetFilePos: " + zlib::getError( error ) );
+					}
+
+					auto last = fileInfo.size_filename
+						? fileNameInZip[fileInfo.size_filename - 1]
+						: '/';
+
+					if ( last != '/' && last != '\\' )
+					{
+						result.push_back( { Path{ string::stringCast< xchar >( fileNameInZip.data(), fileNameInZip.data() + fileInfo.size_filename ) }
+							, uint64_t( fileInfo.compressed_size )
+							, uint64_t( fileInfo.uncompressed_size )
+							, uint32_t( fileInfo.crc )
+							, uint64_t( position.pos_in_zip_directory )
+							, uint64_t( position.num_of_file ) } );
+					}
+
+					if ( ( i + 1 ) < gi.number_entry )
+					{
+						error = unzGoToNextFile( m_unzip );
+
+						if ( error != UNZ_OK )
+						{
+							CU_Exception( "Error in unzGoToNextFile: " + zlib::getError( error ) );
+						}
+					}
+				}
+
+				return result;
+			}
+
+			virtual ByteArray read( ZipArchive::Entry const & entry )
+			{
+				unz_file_pos position{ uLong( entry.dirOffset ), uLong( entry.fileIndex ) };
+				auto error = unzGoToFilePos( m_unzip, &position );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzGoToFilePos: " + zlib::getError( error ) );
+				}
+
+				error = unzOpenCurrentFile( m_unzip );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzOpenCurrentFile: " + zlib::getError( error ) );
+				}
+
+				ByteArray result( size_t( entry.uncompressedSize ) );
+				size_t offset = 0u;
+
+				do
+				{
+					error = unzReadCurrentFile( m_unzip
+						, result.data() + offset
+						, static_cast< unsigned int >( std::min( result.size() - offset, CHUNK * 64u ) ) );
+					offset += size_t( std::max( error, 0 ) );
+				}
+				while ( error > 0 && offset < result.size() );
+
+				// Closing checks the CRC, once the whole file is read.
+				auto closeError = unzCloseCurrentFile( m_unzip );
+
+				if ( error < 0 )
+				{
+					CU_Exception( "Error in unzReadCurrentFile: " + zlib::getError( error ) );
+				}
+
+				if ( offset != result.size() )
+				{
+					CU_Exception( "Truncated ZIP entry: " + string::stringCast< char >( entry.name ) );
+				}
+
+				if ( closeError != UNZ_OK )
+				{
+					CU_Exception( "Error in unzCloseCurrentFile: " + zlib::getError( closeError ) );
+				}
+
+				return result;
+			}
+
 		private:
 			virtual void doInflateCurrentFile( Path const & outFolder, StringArray & result )
 			{
@@ -488,8 +627,17 @@ namespace castor
 
 	ZipArchive::ZipArchive( Path const & p_path, File::OpenMode p_mode )
 		: m_impl( std::make_unique< zlib::ZipImpl >() )
+		, m_path( p_path )
 	{
 		m_impl->open( p_path, p_mode );
+
+		if ( p_mode == File::OpenMode::eRead )
+		{
+			for ( auto & entry : m_impl->index() )
+			{
+				m_entries.emplace( entry.name, entry );
+			}
+		}
 	}
 
 	ZipArchive::~ZipArchive()
@@ -570,11 +718,257 @@ namespace castor
 
 	bool ZipArchive::findFolder( String const & p_folder )
 	{
-		return m_impl->findFolder( p_folder );
+		auto folder = Path{ p_folder } + Path::NativeSeparator;
+		return m_entries.end() != std::find_if( m_entries.begin()
+			, m_entries.end()
+			, [&folder]( std::pair< Path const, Entry > const & lookup )
+			{
+				return lookup.first.find( folder ) == 0u;
+			} );
 	}
 
 	bool ZipArchive::findFile( String const & p_file )
 	{
-		return m_impl->findFile( p_file );
+		return m_entries.end() != m_entries.find( Path{ p_file } );
+	}
+
+	PathArray ZipArchive::listFiles()const
+	{
+		PathArray result;
+		result.reserve( m_entries.size() );
+
+		for ( auto & entry : m_entries )
+		{
+			result.push_back( entry.first );
+		}
+
+		return result;
+	}
+
+	uint64_t ZipArchive::getFileSize( Path const & file )const
+	{
+		auto it = m_entries.find( file );
+		return it == m_entries.end()
+			? 0u
+			: it->second.uncompressedSize;
+	}
+
+	bool ZipArchive::readFile( Path const & file
+		, ByteArray & data )
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+		auto prefetched = m_prefetched.find( file );
+
+		if ( prefetched != m_prefetched.end() )
+		{
+			data = std::move( prefetched->second );
+			m_prefetched.erase( prefetched );
+			return true;
+		}
+
+		auto it = m_entries.find( file );
+
+		if ( it == m_entries.end() )
+		{
+			return false;
+		}
+
+		try
+		{
+			data = m_impl->read( it->second );
+			return true;
+		}
+		catch ( std::exception & exc )
+		{
+			Logger::logError( exc.what() );
+		}
+
+		return false;
+	}
+
+	void ZipArchive::prefetch( PathArray const & files
+		, uint32_t threadsCount )
+	{
+		std::vector< Entry const * > entries;
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+
+			for ( auto & file : files )
+			{
+				auto it = m_entries.find( file );
+
+				if ( it != m_entries.end()
+					&& m_prefetched.end() == m_prefetched.find( file ) )
+				{
+					entries.push_back( &it->second );
+				}
+			}
+		}
+
+		if ( entries.empty() )
+		{
+			return;
+		}
+
+		threadsCount = threadsCount ? threadsCount : getParallelThreadsCount();
+		threadsCount = std::min( threadsCount, uint32_t( entries.size() ) );
+		std::atomic< size_t > next{ 0u };
+		// The unzip handles have a current file, so each thread uses its own.
+		auto worker = [this, &entries, &next]()
+		{
+			std::vector< std::pair< Path, ByteArray > > results;
+
+			try
+			{
+				zlib::ZipImpl impl;
+				impl.open( m_path, File::OpenMode::eRead );
+
+				for ( auto index = next++; index < entries.size(); index = next++ )
+				{
+					results.emplace_back( entries[index]->name, impl.read( *entries[index] ) );
+				}
+
+				impl.close();
+			}
+			catch ( std::exception & exc )
+			{
+				// The remaining files will be read on demand.
+				Logger::logError( exc.what() );
+			}
+
+			auto lock( makeUniqueLock( m_mutex ) );
+
+			for ( auto & result : results )
+			{
+				m_prefetched.emplace( std::move( result.first ), std::move( result.second ) );
+			}
+		};
+		parallelFor( threadsCount
+			, threadsCount
+			, [&worker]( uint32_t, size_t, size_t )
+			{
+				worker();
+			} );
+	}
+
+	bool ZipArchive::extract( Path const & cacheFolder
+		, Path & folder )
+	{
+		std::stringstream stream;
+		stream << std::hex << std::setw( 16 ) << std::setfill( '0' ) << getContentHash();
+		folder = cacheFolder / ( m_path.getFileName() + cuT( "_" ) + string::stringCast< xchar >( stream.str() ) );
+		auto marker = folder / cuT( ".complete" );
+
+		if ( File::fileExists( marker ) )
+		{
+			return true;
+		}
+
+		if ( !File::directoryExists( cacheFolder ) )
+		{
+			File::directoryCreate( cacheFolder );
+		}
+
+		// The marker is written last, so that an interrupted extraction is done again.
+		bool result = inflate( folder );
+
+		if ( result )
+		{
+			BinaryFile file{ marker, File::OpenMode::eWrite };
+			result = file.isOk();
+		}
+
+		return result;
+	}
+
+	uint64_t ZipArchive::getContentHash()const
+	{
+		auto count = uint64_t( m_entries.size() );
+		auto result = hashBytes( &count, sizeof( count ) );
+
+		for ( auto & entry : m_entries )
+		{
+			result = hashBytes( entry.first.data(), entry.first.size() * sizeof( xchar ), result );
+			result = hashBytes( &entry.second.uncompressedSize, sizeof( entry.second.uncompressedSize ), result );
+			result = hashBytes( &entry.second.crc, sizeof( entry.second.crc ), result );
+		}
+
+		return result;
+	}
+
+	void ZipArchive::mount( Path const & root
+		, std::shared_ptr< ZipArchive > archive )
+	{
+		auto & mounts = getMounts();
+		auto lock( makeUniqueLock( mounts.mutex ) );
+		auto it = std::find_if( mounts.archives.begin()
+			, mounts.archives.end()
+			, [&root]( MountedArchive const & lookup )
+			{
+				return lookup.first == root;
+			} );
+
+		if ( it != mounts.archives.end() )
+		{
+			it->second = std::move( archive );
+		}
+		else
+		{
+			mounts.archives.emplace_back( root, std::move( archive ) );
+		}
+	}
+
+	void ZipArchive::unmount( Path const & root )
+	{
+		auto & mounts = getMounts();
+		auto lock( makeUniqueLock( mounts.mutex ) );
+		auto it = std::find_if( mounts.archives.begin()
+			, mounts.archives.end()
+			, [&root]( MountedArchive const & lookup )
+			{
+				return lookup.first == root;
+			} );
+
+		if ( it != mounts.archives.end() )
+		{
+			mounts.archives.erase( it );
+		}
+	}
+
+	bool ZipArchive::findMountedFile( Path const & file )
+	{
+		Path relative;
+		auto mount = findMount( file, relative );
+		return mount.second
+			&& mount.second->findFile( relative );
+	}
+
+	bool ZipArchive::readMountedFile( Path const & file
+		, ByteArray & data )
+	{
+		Path relative;
+		auto mount = findMount( file, relative );
+		return mount.second
+			&& mount.second->readFile( relative, data );
+	}
+
+	PathArray ZipArchive::listMountedFiles( Path const & folder )
+	{
+		PathArray result;
+		Path relative;
+		auto mount = findMount( folder, relative );
+
+		if ( mount.second )
+		{
+			for ( auto & file : mount.second->listFiles() )
+			{
+				if ( file.getPath() == relative )
+				{
+					result.push_back( mount.first / file );
+				}
+			}
+		}
+
+		return result;
 	}
 }
@@ -2,29 +2,83 @@
 
 #include "CastorUtils/FileParser/ParserParameter.hpp"
 
+#include "CastorUtils/Data/BinaryFile.hpp"
+
 namespace castor
 {
 	namespace
 	{
-		String doStripComments( String const & p_line )
+		void doStripComments( String & line )
 		{
-			String result = p_line;
-			auto index = result.find( "//" );
+			auto index = line.find( "//" );
 
 			if ( index != String::npos )
 			{
-				result = result.substr( 0, index );
+				line.erase( index );
 			}
 
-			index = result.find( "/*" );
+			index = line.find( "/*" );
 
 			if ( index != String::npos )
 			{
-				result = result.substr( index, result.find( "*/", index ) - index );
+				line = line.substr( index, line.find( "*/", index ) - index );
+			}
+		}
+
+		StringView doTrim( StringView text )
+		{
+			auto begin = text.find_first_not_of( cuT( " \t\r" ) );
+
+			if ( begin == StringView::npos )
+			{
+				return StringView{};
 			}
 
-			return result;
+			return text.substr( begin, text.find_last_not_of( cuT( " \t\r" ) ) - begin + 1u );
 		}
+		/**
+		 *\~english
+		 *\brief		Walks through the lines of a file content, without copying it.
+		 *\~french
+		 *\brief		Parcourt les lignes du contenu d'un fichier, sans le copier.
+		 */
+		class LineReader
+		{
+		public:
+			explicit LineReader( StringView content )
+				: m_content{ content }
+			{
+				// UTF-8 BOM.
+				if ( m_content.substr( 0u, 3u ) == StringView{ cuT( "\xEF\xBB\xBF" ) } )
+				{
+					m_content.remove_prefix( 3u );
+				}
+			}
+
+			bool isEnd()const
+			{
+				return m_position > m_content.size();
+			}
+			/**
+			 *\~english
+			 *\return		The next line, trimmed.
+			 *\remarks		A content ending with a line break gives a last empty line.
+			 *\~french
+			 *\return		La ligne suivante, épurée.
+			 *\remarks		Un contenu terminé par un saut de ligne donne une dernière ligne vide.
+			 */
+			StringView next()
+			{
+				auto end = std::min( m_content.find( cuT( '\n' ), m_position ), m_content.size() );
+				auto result = m_content.substr( m_position, end - m_position );
+				m_position = end + 1u;
+				return doTrim( result );
+			}
+
+		private:
+			StringView m_content;
+			size_t m_position{ 0u };
+		};
 	}
 
 	FileParser::FileParser( uint32_t rootSectionId )
@@ -54,12 +108,15 @@ namespace castor
 		bool result = false;
 
 		{
-			TextFile file( path, File::OpenMode::eRead );
+			// Read at once, the lines are then tokenised in place.
+			BinaryFile file( path, File::OpenMode::eRead );
 			result = file.isOk();
 
 			if ( result )
 			{
-				file.copyToString( content );
+				content.resize( size_t( file.getLength() ) );
+				result = content.empty()
+					|| file.readArray( &content[0], content.size() ) == content.size();
 			}
 		}
 
@@ -84,6 +141,8 @@ namespace castor
 		bool bNextIsOpenBrace = false;
 		bool bCommented = false;
 		doInitialiseParser( path );
+		// The parsers may have been changed without addParser.
+		m_keywords.clear();
 		auto save = 0ull;
 
 		if ( m_context->m_sections.empty() )
@@ -95,29 +154,26 @@ namespace castor
 		bool bReuse = false;
 		String strLine;
 		String strLine2;
-		String file = content;
-		string::replace( file, cuT( "\r\n" ), cuT( "\n" ) );
-		StringArray lines = string::split( file, cuT( "\n" ), uint32_t( std::count( file.begin(), file.end(), '\n' ) + 1 ), true );
-		auto it = lines.begin();
+		LineReader reader{ content };
 
-		while ( it != lines.end() )
+		while ( !reader.isEnd() )
 		{
 			if ( !bReuse )
 			{
-				strLine = *it++;
+				// Assigned, to reuse the line's storage.
+				auto line = reader.next();
+				strLine.assign( line.data(), line.size() );
 				m_context->m_line++;
 			}
 			else
 			{
+				string::trim( strLine );
 				bReuse = false;
 			}
 
-			//m_logger.logDebug( string::toString( m_context->m_line ) + cuT( " - " ) + strLine.c_str() );
-			string::trim( strLine );
-
 			if ( !strLine.empty() )
 			{
-				if ( strLine.size() < 2 || strLine.substr( 0, 2 ) != cuT( "//" ) )
+				if ( strLine.compare( 0u, 2u, cuT( "//" ) ) != 0 )
 				{
 					if ( !bCommented )
 					{
@@ -318,6 +374,7 @@ namespace castor
 		else
 		{
 			m_parsers[p_section][p_name] = { p_function, p_params };
+			m_keywords.erase( p_section );
 		}
 	}
 
@@ -326,7 +383,7 @@ namespace castor
 		bool bContinue = true;
 		bool result = false;
 		std::size_t uiBlockEndIndex = p_line.find( cuT( "}" ) );
-		p_line = doStripComments( p_line );
+		doStripComments( p_line );
 
 		if ( uiBlockEndIndex != String::npos )
 		{
@@ -381,7 +438,7 @@ namespace castor
 		{
 			if ( !m_context->m_sections.empty() )
 			{
-				result = doInvokeParser( p_line, m_parsers[m_context->m_sections.back()] );
+				result = doInvokeParser( p_line, m_context->m_sections.back() );
 			}
 			else
 			{
@@ -398,16 +455,16 @@ namespace castor
 
 		if ( !m_context->m_sections.empty() )
 		{
-			AttributeParserMap::const_iterator const & iter = m_parsers[m_context->m_sections.back()].find( cuT( "}" ) );
+			auto parser = doGetKeywords( m_context->m_sections.back() ).find( cuT( "}" ) );
 
-			if ( iter == m_parsers[m_context->m_sections.back()].end() )
+			if ( !parser )
 			{
 				m_context->m_sections.pop_back();
 				result = false;
 			}
 			else
 			{
-				result = iter->second.m_function( this, iter->second.m_params );
+				result = parser->m_function( this, parser->m_params );
 			}
 		}
 		else
@@ -418,20 +475,24 @@ namespace castor
 		return result;
 	}
 
-	bool FileParser::doInvokeParser( String & p_line, AttributeParserMap const & p_parsers )
+	bool FileParser::doInvokeParser( String & p_line, uint32_t p_section )
 	{
 		bool result = false;
-		StringArray splitCmd = string::split( p_line, cuT( " \t" ), 1, false );
-		m_context->m_functionName = splitCmd[0];
-		AttributeParserMap::const_iterator const & iter = p_parsers.find( splitCmd[0] );
+		StringView line{ p_line };
+		auto nameEnd = std::min( line.find_first_of( cuT( " \t" ) ), line.size() );
+		auto name = line.substr( 0u, nameEnd );
+		auto params = doTrim( line.substr( nameEnd ) );
+		m_context->m_functionName.assign( name.data(), name.size() );
+		// The parser is kept, the tables may be rebuilt while it runs.
+		auto parser = doGetKeywords( p_section ).find( name );
 
 		if ( !doIsInIgnoredBlock() )
 		{
-			if ( iter == p_parsers.end() )
+			if ( !parser )
 			{
-				if ( splitCmd[0] == cuT( "define" ) && splitCmd.size() > 1 )
+				if ( name == cuT( "define" ) && !params.empty() )
 				{
-					doAddDefine( splitCmd[1] );
+					doAddDefine( String{ params } );
 				}
 				else if ( !doDiscardParser( p_line ) )
 				{
@@ -440,24 +501,23 @@ namespace castor
 			}
 			else
 			{
-				String strParameters;
+				String strParameters{ params };
 
-				if ( splitCmd.size() >= 2 )
+				if ( !strParameters.empty() )
 				{
-					strParameters = string::trim( splitCmd[1] );
 					doCheckDefines( strParameters );
 				}
 
 				ParserParameterArray filled;
 
-				if ( !checkParams( strParameters, iter->second.m_params, filled ) )
+				if ( !checkParams( strParameters, parser->m_params, filled ) )
 				{
 					bool ignored = true;
 					std::swap( ignored, m_ignored );
 
 					try
 					{
-						result = iter->second.m_function( this, filled );
+						result = parser->m_function( this, filled );
 					}
 					catch ( Exception & p_exc )
 					{
@@ -468,7 +528,7 @@ namespace castor
 				}
 				else
 				{
-					result = iter->second.m_function( this, filled );
+					result = parser->m_function( this, filled );
 				}
 			}
 		}
@@ -476,6 +536,18 @@ namespace castor
 		return result;
 	}
 
+	ParserKeywordTable const & FileParser::doGetKeywords( uint32_t p_section )
+	{
+		auto it = m_keywords.find( p_section );
+
+		if ( it == m_keywords.end() )
+		{
+			it = m_keywords.emplace( p_section, ParserKeywordTable{ m_parsers[p_section] } ).first;
+		}
+
+		return it->second;
+	}
+
 	void FileParser::doEnterBlock()
 	{
 		if ( m_ignored )
@@ -0,0 +1,127 @@
+#include "CastorUtils/FileParser/ParserKeywordTable.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace castor
+{
+	ParserKeywordTable::ParserKeywordTable( AttributeParserMap const & parsers )
+	{
+		auto count = uint32_t( std::distance( parsers.begin(), parsers.end() ) );
+		auto size = 1u;
+
+		while ( size < count )
+		{
+			size <<= 1u;
+		}
+
+		m_mask = size - 1u;
+		m_seeds.resize( size, 0 );
+		m_slots.resize( size );
+		std::vector< std::vector< Slot > > buckets( size );
+
+		for ( auto & parser : parsers )
+		{
+			buckets[hash( 0u, parser.first ) & m_mask].push_back( { parser.first, &parser.second } );
+		}
+
+		// The biggest buckets are placed first, while most of the slots are free.
+		std::vector< uint32_t > order( size );
+		std::iota( order.begin(), order.end(), 0u );
+		std::stable_sort( order.begin()
+			, order.end()
+			, [&buckets]( uint32_t lhs, uint32_t rhs )
+			{
+				return buckets[lhs].size() > buckets[rhs].size();
+			} );
+		std::vector< bool > used( size, false );
+		std::vector< uint32_t > indices;
+		auto it = order.begin();
+
+		while ( it != order.end() && buckets[*it].size() > 1u )
+		{
+			auto & bucket = buckets[*it];
+			auto seed = 1u;
+			indices.clear();
+
+			while ( indices.size() < bucket.size() )
+			{
+				auto index = hash( seed, bucket[indices.size()].name ) & m_mask;
+
+				if ( used[index]
+					|| std::find( indices.begin(), indices.end(), index ) != indices.end() )
+				{
+					++seed;
+					indices.clear();
+				}
+				else
+				{
+					indices.push_back( index );
+				}
+			}
+
+			m_seeds[*it] = int32_t( seed );
+
+			for ( size_t i = 0u; i < bucket.size(); ++i )
+			{
+				used[indices[i]] = true;
+				m_slots[indices[i]] = bucket[i];
+			}
+
+			++it;
+		}
+
+		// The single names directly go in the remaining free slots.
+		auto index = 0u;
+
+		while ( it != order.end() && !buckets[*it].empty() )
+		{
+			while ( used[index] )
+			{
+				++index;
+			}
+
+			m_seeds[*it] = -int32_t( index ) - 1;
+			m_slots[index] = buckets[*it].front();
+			used[index] = true;
+			++it;
+		}
+	}
+
+	ParserFunctionAndParams const * ParserKeywordTable::find( StringView name )const
+	{
+		auto seed = m_seeds[hash( 0u, name ) & m_mask];
+
+		if ( !seed )
+		{
+			return nullptr;
+		}
+
+		auto & slot = m_slots[seed < 0
+			? uint32_t( -seed - 1 )
+			: ( hash( uint32_t( seed ), name ) & m_mask )];
+		return slot.name == name
+			? slot.parser
+			: nullptr;
+	}
+
+	uint32_t ParserKeywordTable::hash( uint32_t seed
+		, StringView name )
+	{
+		// FNV-1a, the seed replacing the offset basis.
+		auto result = seed ? seed : 0x811C9DC5u;
+
+		for ( auto c : name )
+		{
+			result = ( result ^ uint32_t( uint8_t( c ) ) ) * 0x01000193u;
+		}
+
+		// The table is indexed by the low bits, which FNV alone mixes poorly.
+		result ^= result >> 16u;
+		result *= 0x85EBCA6Bu;
+		result ^= result >> 13u;
+		result *= 0xC2B2AE35u;
+		result ^= result >> 16u;
+		return result;
+	}
+}
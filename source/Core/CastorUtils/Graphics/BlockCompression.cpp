@@ -0,0 +1,1198 @@
+#include "CastorUtils/Graphics/BlockCompression.hpp"
+
+#include "CastorUtils/Graphics/PixelBufferBase.hpp"
+#include "CastorUtils/Graphics/PixelFormat.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <ashes/common/Format.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define CU_BlockCompressionSSE2 1
+#	include <emmintrin.h>
+#else
+#	define CU_BlockCompressionSSE2 0
+#endif
+
+namespace castor
+{
+	namespace PF
+	{
+		namespace
+		{
+			using BlockPixel = std::array< float, 4u >;
+			using BlockPixels = std::array< BlockPixel, 16u >;
+			using BlockIndices = std::array< uint8_t, 16u >;
+
+			static BlockPixel const RgbMask{ 1.0f, 1.0f, 1.0f, 0.0f };
+			static BlockPixel const RgbaMask{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+			uint32_t getBlockByteSize( PixelFormat format )
+			{
+				switch ( format )
+				{
+				case PixelFormat::eBC1_RGB_UNORM_BLOCK:
+				case PixelFormat::eBC1_RGB_SRGB_BLOCK:
+				case PixelFormat::eBC1_RGBA_UNORM_BLOCK:
+				case PixelFormat::eBC1_RGBA_SRGB_BLOCK:
+				case PixelFormat::eBC4_UNORM_BLOCK:
+					return 8u;
+				default:
+					return 16u;
+				}
+			}
+
+			inline float clampChannel( float value )
+			{
+				return std::min( 255.0f, std::max( 0.0f, value ) );
+			}
+
+			inline void write16( uint8_t * block, uint16_t value )
+			{
+				block[0] = uint8_t( value & 0xFFu );
+				block[1] = uint8_t( ( value >> 8 ) & 0xFFu );
+			}
+
+			inline uint16_t read16( uint8_t const * block )
+			{
+				return uint16_t( block[0] | ( block[1] << 8 ) );
+			}
+
+			/**
+			 *\~english
+			 *\brief		Selects, for each pixel, the nearest palette entry.
+			 *\return		The accumulated squared error.
+			 *\~french
+			 *\brief		Sélectionne, pour chaque pixel, l'entrée de palette la plus proche.
+			 *\return		L'erreur quadratique cumulée.
+			 */
+			template< size_t CountT >
+			float selectIndices( BlockPixels const & pixels
+				, std::array< BlockPixel, CountT > const & palette
+				, uint32_t paletteSize
+				, BlockPixel const & mask
+				, BlockIndices & indices )
+			{
+				float result = 0.0f;
+#if CU_BlockCompressionSSE2
+				__m128 weights = _mm_loadu_ps( mask.data() );
+				__m128 entries[CountT];
+
+				for ( uint32_t j = 0u; j < paletteSize; ++j )
+				{
+					entries[j] = _mm_loadu_ps( palette[j].data() );
+				}
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					__m128 pixel = _mm_loadu_ps( pixels[i].data() );
+					float best = std::numeric_limits< float >::max();
+					uint8_t bestIndex = 0u;
+
+					for ( uint32_t j = 0u; j < paletteSize; ++j )
+					{
+						__m128 diff = _mm_sub_ps( pixel, entries[j] );
+						diff = _mm_mul_ps( _mm_mul_ps( diff, diff ), weights );
+						diff = _mm_add_ps( diff, _mm_shuffle_ps( diff, diff, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+						diff = _mm_add_ss( diff, _mm_movehl_ps( diff, diff ) );
+						float dist = _mm_cvtss_f32( diff );
+
+						if ( dist < best )
+						{
+							best = dist;
+							bestIndex = uint8_t( j );
+						}
+					}
+
+					indices[i] = bestIndex;
+					result += best;
+				}
+#else
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					float best = std::numeric_limits< float >::max();
+					uint8_t bestIndex = 0u;
+
+					for ( uint32_t j = 0u; j < paletteSize; ++j )
+					{
+						float dist = 0.0f;
+
+						for ( uint32_t c = 0u; c < 4u; ++c )
+						{
+							auto diff = pixels[i][c] - palette[j][c];
+							dist += diff * diff * mask[c];
+						}
+
+						if ( dist < best )
+						{
+							best = dist;
+							bestIndex = uint8_t( j );
+						}
+					}
+
+					indices[i] = bestIndex;
+					result += best;
+				}
+#endif
+				return result;
+			}
+
+			/**
+			 *\~english
+			 *\brief		Computes the endpoints of the segment best fitting the given pixels.
+			 *\~french
+			 *\brief		Calcule les extrémités du segment représentant au mieux les pixels donnés.
+			 */
+			void fitEndpoints( BlockCompressionQuality quality
+				, BlockPixel const * pixels
+				, uint32_t count
+				, BlockPixel const & mask
+				, BlockPixel & e0
+				, BlockPixel & e1 )
+			{
+				BlockPixel min{ 255.0f, 255.0f, 255.0f, 255.0f };
+				BlockPixel max{ 0.0f, 0.0f, 0.0f, 0.0f };
+				BlockPixel mean{};
+
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						min[c] = std::min( min[c], pixels[i][c] );
+						max[c] = std::max( max[c], pixels[i][c] );
+						mean[c] += pixels[i][c];
+					}
+				}
+
+				if ( quality == BlockCompressionQuality::eFast || count < 2u )
+				{
+					e0 = min;
+					e1 = max;
+					return;
+				}
+
+				for ( auto & c : mean )
+				{
+					c /= float( count );
+				}
+
+				float covariance[4][4]{};
+
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					BlockPixel diff;
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						diff[c] = ( pixels[i][c] - mean[c] ) * mask[c];
+					}
+
+					for ( uint32_t r = 0u; r < 4u; ++r )
+					{
+						for ( uint32_t c = 0u; c < 4u; ++c )
+						{
+							covariance[r][c] += diff[r] * diff[c];
+						}
+					}
+				}
+
+				// Power iteration, starting from the bounding box diagonal.
+				BlockPixel axis;
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					axis[c] = ( max[c] - min[c] ) * mask[c];
+				}
+
+				for ( uint32_t iteration = 0u; iteration < 8u; ++iteration )
+				{
+					BlockPixel next{};
+					float norm = 0.0f;
+
+					for ( uint32_t r = 0u; r < 4u; ++r )
+					{
+						for ( uint32_t c = 0u; c < 4u; ++c )
+						{
+							next[r] += covariance[r][c] * axis[c];
+						}
+
+						norm = std::max( norm, std::abs( next[r] ) );
+					}
+
+					if ( norm <= std::numeric_limits< float >::epsilon() )
+					{
+						break;
+					}
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						axis[c] = next[c] / norm;
+					}
+				}
+
+				float length = 0.0f;
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					length += axis[c] * axis[c];
+				}
+
+				if ( length <= std::numeric_limits< float >::epsilon() )
+				{
+					e0 = min;
+					e1 = max;
+					return;
+				}
+
+				float minT = std::numeric_limits< float >::max();
+				float maxT = -std::numeric_limits< float >::max();
+
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					float t = 0.0f;
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						t += ( pixels[i][c] - mean[c] ) * axis[c];
+					}
+
+					minT = std::min( minT, t );
+					maxT = std::max( maxT, t );
+				}
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					e0[c] = clampChannel( mean[c] + axis[c] * minT / length );
+					e1[c] = clampChannel( mean[c] + axis[c] * maxT / length );
+				}
+			}
+
+			/**
+			 *\~english
+			 *\brief		Least squares refinement of the endpoints, given the selected indices.
+			 *\return		\p false if the system is degenerate.
+			 *\~french
+			 *\brief		Affinage par moindres carrés des extrémités, à partir des indices sélectionnés.
+			 *\return		\p false si le système est dégénéré.
+			 */
+			bool refineEndpoints( BlockPixels const & pixels
+				, BlockIndices const & indices
+				, float const * indexWeights
+				, uint32_t paletteSize
+				, BlockPixel & e0
+				, BlockPixel & e1 )
+			{
+				float aa = 0.0f;
+				float ab = 0.0f;
+				float bb = 0.0f;
+				BlockPixel ap{};
+				BlockPixel bp{};
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					if ( indices[i] >= paletteSize )
+					{
+						continue;
+					}
+
+					auto b = indexWeights[indices[i]];
+					auto a = 1.0f - b;
+					aa += a * a;
+					ab += a * b;
+					bb += b * b;
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						ap[c] += a * pixels[i][c];
+						bp[c] += b * pixels[i][c];
+					}
+				}
+
+				auto det = aa * bb - ab * ab;
+
+				if ( std::abs( det ) <= std::numeric_limits< float >::epsilon() )
+				{
+					return false;
+				}
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					e0[c] = clampChannel( ( ap[c] * bb - bp[c] * ab ) / det );
+					e1[c] = clampChannel( ( bp[c] * aa - ap[c] * ab ) / det );
+				}
+
+				return true;
+			}
+
+			//*********************************************************************************************
+
+			uint16_t toRgb565( BlockPixel const & colour )
+			{
+				auto r = uint32_t( std::lround( colour[0] * 31.0f / 255.0f ) );
+				auto g = uint32_t( std::lround( colour[1] * 63.0f / 255.0f ) );
+				auto b = uint32_t( std::lround( colour[2] * 31.0f / 255.0f ) );
+				return uint16_t( ( r << 11 ) | ( g << 5 ) | b );
+			}
+
+			BlockPixel fromRgb565( uint16_t colour )
+			{
+				auto r = uint32_t( ( colour >> 11 ) & 0x1Fu );
+				auto g = uint32_t( ( colour >> 5 ) & 0x3Fu );
+				auto b = uint32_t( colour & 0x1Fu );
+				return BlockPixel{ float( ( r << 3 ) | ( r >> 2 ) )
+					, float( ( g << 2 ) | ( g >> 4 ) )
+					, float( ( b << 3 ) | ( b >> 2 ) )
+					, 255.0f };
+			}
+
+			std::array< BlockPixel, 4u > getBC1Palette( uint16_t c0
+				, uint16_t c1
+				, bool fourColours )
+			{
+				std::array< BlockPixel, 4u > result;
+				result[0] = fromRgb565( c0 );
+				result[1] = fromRgb565( c1 );
+
+				for ( uint32_t c = 0u; c < 3u; ++c )
+				{
+					auto v0 = uint32_t( result[0][c] );
+					auto v1 = uint32_t( result[1][c] );
+
+					if ( fourColours )
+					{
+						result[2][c] = float( ( 2u * v0 + v1 ) / 3u );
+						result[3][c] = float( ( v0 + 2u * v1 ) / 3u );
+					}
+					else
+					{
+						result[2][c] = float( ( v0 + v1 ) / 2u );
+						result[3][c] = 0.0f;
+					}
+				}
+
+				result[2][3] = 255.0f;
+				result[3][3] = fourColours ? 255.0f : 0.0f;
+				return result;
+			}
+
+			void encodeBC1( BlockCompressionQuality quality
+				, BlockPixels const & pixels
+				, bool allowTransparency
+				, uint8_t * block )
+			{
+				BlockPixels opaque;
+				uint32_t opaqueCount = 0u;
+
+				for ( auto & pixel : pixels )
+				{
+					if ( !allowTransparency || pixel[3] >= 128.0f )
+					{
+						opaque[opaqueCount++] = pixel;
+					}
+				}
+
+				bool fourColours = opaqueCount == 16u;
+				BlockIndices indices{};
+				uint16_t c0 = 0u;
+				uint16_t c1 = 0u;
+
+				if ( opaqueCount )
+				{
+					// In three colours mode, the fourth palette entry is reserved for transparency.
+					static float const fourWeights[4]{ 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+					static float const threeWeights[3]{ 0.0f, 1.0f, 0.5f };
+					auto paletteSize = fourColours ? 4u : 3u;
+					auto indexWeights = fourColours ? fourWeights : threeWeights;
+					BlockPixel e0;
+					BlockPixel e1;
+					fitEndpoints( quality, opaque.data(), opaqueCount, RgbMask, e0, e1 );
+					auto passes = quality == BlockCompressionQuality::eHigh ? 3u : 1u;
+					float bestError = std::numeric_limits< float >::max();
+
+					for ( uint32_t pass = 0u; pass < passes; ++pass )
+					{
+						auto p0 = toRgb565( e0 );
+						auto p1 = toRgb565( e1 );
+
+						// Enforce the endpoints order matching the wanted mode.
+						if ( ( fourColours && p0 < p1 )
+							|| ( !fourColours && p0 > p1 ) )
+						{
+							std::swap( p0, p1 );
+						}
+
+						auto palette = getBC1Palette( p0, p1, p0 > p1 );
+						BlockIndices passIndices;
+						auto error = selectIndices( pixels
+							, palette
+							, ( p0 > p1 ) ? 4u : 3u
+							, RgbMask
+							, passIndices );
+
+						if ( !fourColours )
+						{
+							// Transparent pixels neither count in the error nor in the refinement.
+							error = 0.0f;
+
+							for ( uint32_t i = 0u; i < 16u; ++i )
+							{
+								if ( pixels[i][3] < 128.0f )
+								{
+									passIndices[i] = 3u;
+								}
+								else
+								{
+									for ( uint32_t c = 0u; c < 3u; ++c )
+									{
+										auto diff = pixels[i][c] - palette[passIndices[i]][c];
+										error += diff * diff;
+									}
+								}
+							}
+						}
+
+						if ( error < bestError )
+						{
+							bestError = error;
+							c0 = p0;
+							c1 = p1;
+							indices = passIndices;
+						}
+
+						if ( pass + 1u < passes
+							&& !refineEndpoints( pixels, passIndices, indexWeights, paletteSize, e0, e1 ) )
+						{
+							break;
+						}
+					}
+
+					if ( c0 == c1 )
+					{
+						indices.fill( 0u );
+					}
+				}
+
+				if ( !fourColours )
+				{
+					for ( uint32_t i = 0u; i < 16u; ++i )
+					{
+						if ( pixels[i][3] < 128.0f )
+						{
+							indices[i] = 3u;
+						}
+					}
+				}
+
+				uint32_t bits = 0u;
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					bits |= uint32_t( indices[i] & 0x03u ) << ( i * 2u );
+				}
+
+				write16( block + 0u, c0 );
+				write16( block + 2u, c1 );
+				block[4] = uint8_t( bits & 0xFFu );
+				block[5] = uint8_t( ( bits >> 8 ) & 0xFFu );
+				block[6] = uint8_t( ( bits >> 16 ) & 0xFFu );
+				block[7] = uint8_t( ( bits >> 24 ) & 0xFFu );
+			}
+
+			void decodeBC1( uint8_t const * block
+				, bool allowTransparency
+				, bool forceFourColours
+				, uint8_t * pixels )
+			{
+				auto c0 = read16( block + 0u );
+				auto c1 = read16( block + 2u );
+				auto palette = getBC1Palette( c0, c1, forceFourColours || c0 > c1 );
+				auto bits = uint32_t( block[4] )
+					| ( uint32_t( block[5] ) << 8 )
+					| ( uint32_t( block[6] ) << 16 )
+					| ( uint32_t( block[7] ) << 24 );
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					auto & entry = palette[( bits >> ( i * 2u ) ) & 0x03u];
+					pixels[i * 4u + 0u] = uint8_t( entry[0] );
+					pixels[i * 4u + 1u] = uint8_t( entry[1] );
+					pixels[i * 4u + 2u] = uint8_t( entry[2] );
+					pixels[i * 4u + 3u] = allowTransparency
+						? uint8_t( entry[3] )
+						: uint8_t( 255u );
+				}
+			}
+
+			//*********************************************************************************************
+
+			std::array< uint32_t, 8u > getBC4Palette( uint32_t e0
+				, uint32_t e1 )
+			{
+				std::array< uint32_t, 8u > result;
+				result[0] = e0;
+				result[1] = e1;
+
+				if ( e0 > e1 )
+				{
+					for ( uint32_t i = 2u; i < 8u; ++i )
+					{
+						result[i] = ( ( 8u - i ) * e0 + ( i - 1u ) * e1 ) / 7u;
+					}
+				}
+				else
+				{
+					for ( uint32_t i = 2u; i < 6u; ++i )
+					{
+						result[i] = ( ( 6u - i ) * e0 + ( i - 1u ) * e1 ) / 5u;
+					}
+
+					result[6] = 0u;
+					result[7] = 255u;
+				}
+
+				return result;
+			}
+
+			uint32_t selectBC4Indices( uint8_t const * values
+				, std::array< uint32_t, 8u > const & palette
+				, BlockIndices & indices )
+			{
+				uint32_t result = 0u;
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					uint32_t best = std::numeric_limits< uint32_t >::max();
+
+					for ( uint32_t j = 0u; j < 8u; ++j )
+					{
+						auto diff = int32_t( values[i] ) - int32_t( palette[j] );
+						auto dist = uint32_t( diff * diff );
+
+						if ( dist < best )
+						{
+							best = dist;
+							indices[i] = uint8_t( j );
+						}
+					}
+
+					result += best;
+				}
+
+				return result;
+			}
+
+			uint32_t tryBC4Endpoints( uint8_t const * values
+				, uint32_t e0
+				, uint32_t e1
+				, uint32_t & bestError
+				, uint32_t & best0
+				, uint32_t & best1
+				, BlockIndices & bestIndices )
+			{
+				BlockIndices indices;
+				auto error = selectBC4Indices( values, getBC4Palette( e0, e1 ), indices );
+
+				if ( error < bestError )
+				{
+					bestError = error;
+					best0 = e0;
+					best1 = e1;
+					bestIndices = indices;
+				}
+
+				return error;
+			}
+
+			void encodeBC4( BlockCompressionQuality quality
+				, uint8_t const * values
+				, uint8_t * block )
+			{
+				uint32_t min = 255u;
+				uint32_t max = 0u;
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					min = std::min( min, uint32_t( values[i] ) );
+					max = std::max( max, uint32_t( values[i] ) );
+				}
+
+				uint32_t bestError = std::numeric_limits< uint32_t >::max();
+				uint32_t e0 = max;
+				uint32_t e1 = min;
+				BlockIndices indices{};
+				tryBC4Endpoints( values, max, min, bestError, e0, e1, indices );
+
+				if ( quality != BlockCompressionQuality::eFast
+					&& bestError > 0u
+					&& max > min )
+				{
+					// Least squares refinement of the eight values mode endpoints.
+					static float const weights[8]{ 0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f };
+					float aa = 0.0f, ab = 0.0f, bb = 0.0f, ap = 0.0f, bp = 0.0f;
+
+					for ( uint32_t i = 0u; i < 16u; ++i )
+					{
+						auto b = weights[indices[i]];
+						auto a = 1.0f - b;
+						aa += a * a;
+						ab += a * b;
+						bb += b * b;
+						ap += a * values[i];
+						bp += b * values[i];
+					}
+
+					auto det = aa * bb - ab * ab;
+
+					if ( std::abs( det ) > std::numeric_limits< float >::epsilon() )
+					{
+						auto r0 = uint32_t( std::lround( clampChannel( ( ap * bb - bp * ab ) / det ) ) );
+						auto r1 = uint32_t( std::lround( clampChannel( ( bp * aa - ap * ab ) / det ) ) );
+
+						if ( r0 < r1 )
+						{
+							std::swap( r0, r1 );
+						}
+
+						if ( r0 > r1 )
+						{
+							tryBC4Endpoints( values, r0, r1, bestError, e0, e1, indices );
+						}
+					}
+				}
+
+				if ( quality == BlockCompressionQuality::eHigh
+					&& bestError > 0u )
+				{
+					// Six values mode, with explicit 0 and 255.
+					uint32_t innerMin = 255u;
+					uint32_t innerMax = 0u;
+
+					for ( uint32_t i = 0u; i < 16u; ++i )
+					{
+						if ( values[i] != 0u && values[i] != 255u )
+						{
+							innerMin = std::min( innerMin, uint32_t( values[i] ) );
+							innerMax = std::max( innerMax, uint32_t( values[i] ) );
+						}
+					}
+
+					if ( innerMin > innerMax )
+					{
+						innerMin = 0u;
+						innerMax = 0u;
+					}
+
+					tryBC4Endpoints( values, innerMin, innerMax, bestError, e0, e1, indices );
+				}
+
+				uint64_t bits = 0u;
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					bits |= uint64_t( indices[i] & 0x07u ) << ( i * 3u );
+				}
+
+				block[0] = uint8_t( e0 );
+				block[1] = uint8_t( e1 );
+
+				for ( uint32_t i = 0u; i < 6u; ++i )
+				{
+					block[2u + i] = uint8_t( ( bits >> ( i * 8u ) ) & 0xFFu );
+				}
+			}
+
+			void decodeBC4( uint8_t const * block
+				, uint32_t channel
+				, uint8_t * pixels )
+			{
+				auto palette = getBC4Palette( block[0], block[1] );
+				uint64_t bits = 0u;
+
+				for ( uint32_t i = 0u; i < 6u; ++i )
+				{
+					bits |= uint64_t( block[2u + i] ) << ( i * 8u );
+				}
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					pixels[i * 4u + channel] = uint8_t( palette[( bits >> ( i * 3u ) ) & 0x07u] );
+				}
+			}
+
+			//*********************************************************************************************
+
+			static uint32_t const BC7Weights4[16]{ 0u, 4u, 9u, 13u, 17u, 21u, 26u, 30u, 34u, 38u, 43u, 47u, 51u, 55u, 60u, 64u };
+
+			struct BC7Endpoint
+			{
+				std::array< uint32_t, 4u > colour;
+				uint32_t pbit;
+			};
+
+			class BitWriter
+			{
+			public:
+				explicit BitWriter( uint8_t * block )
+					: m_block{ block }
+				{
+					std::memset( m_block, 0, 16u );
+				}
+
+				void write( uint32_t value, uint32_t count )
+				{
+					for ( uint32_t i = 0u; i < count; ++i, ++m_position )
+					{
+						if ( ( value >> i ) & 0x01u )
+						{
+							m_block[m_position / 8u] |= uint8_t( 1u << ( m_position % 8u ) );
+						}
+					}
+				}
+
+			private:
+				uint8_t * m_block;
+				uint32_t m_position{ 0u };
+			};
+
+			class BitReader
+			{
+			public:
+				explicit BitReader( uint8_t const * block )
+					: m_block{ block }
+				{
+				}
+
+				uint32_t read( uint32_t count )
+				{
+					uint32_t result = 0u;
+
+					for ( uint32_t i = 0u; i < count; ++i, ++m_position )
+					{
+						result |= uint32_t( ( m_block[m_position / 8u] >> ( m_position % 8u ) ) & 0x01u ) << i;
+					}
+
+					return result;
+				}
+
+			private:
+				uint8_t const * m_block;
+				uint32_t m_position{ 0u };
+			};
+
+			BC7Endpoint quantiseBC7Endpoint( BlockPixel const & colour )
+			{
+				BC7Endpoint result{};
+				float bestError = std::numeric_limits< float >::max();
+
+				for ( uint32_t pbit = 0u; pbit < 2u; ++pbit )
+				{
+					BC7Endpoint endpoint{};
+					endpoint.pbit = pbit;
+					float error = 0.0f;
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						auto value = std::lround( ( colour[c] - float( pbit ) ) / 2.0f );
+						endpoint.colour[c] = uint32_t( std::min( 127l, std::max( 0l, long( value ) ) ) );
+						auto diff = colour[c] - float( ( endpoint.colour[c] << 1 ) | pbit );
+						error += diff * diff;
+					}
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						result = endpoint;
+					}
+				}
+
+				return result;
+			}
+
+			std::array< BlockPixel, 16u > getBC7Palette( BC7Endpoint const & e0
+				, BC7Endpoint const & e1 )
+			{
+				std::array< BlockPixel, 16u > result;
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					auto v0 = ( e0.colour[c] << 1 ) | e0.pbit;
+					auto v1 = ( e1.colour[c] << 1 ) | e1.pbit;
+
+					for ( uint32_t i = 0u; i < 16u; ++i )
+					{
+						result[i][c] = float( ( ( 64u - BC7Weights4[i] ) * v0 + BC7Weights4[i] * v1 + 32u ) >> 6 );
+					}
+				}
+
+				return result;
+			}
+
+			void encodeBC7( BlockCompressionQuality quality
+				, BlockPixels const & pixels
+				, uint8_t * block )
+			{
+				// Only mode 6 (single subset, RGBA 7.7.7.7 + P-bit endpoints, 4 bits indices) is used.
+				static float const indexWeights[16]
+				{
+					0.0f / 64.0f, 4.0f / 64.0f, 9.0f / 64.0f, 13.0f / 64.0f,
+					17.0f / 64.0f, 21.0f / 64.0f, 26.0f / 64.0f, 30.0f / 64.0f,
+					34.0f / 64.0f, 38.0f / 64.0f, 43.0f / 64.0f, 47.0f / 64.0f,
+					51.0f / 64.0f, 55.0f / 64.0f, 60.0f / 64.0f, 64.0f / 64.0f,
+				};
+				BlockPixel e0;
+				BlockPixel e1;
+				fitEndpoints( quality, pixels.data(), 16u, RgbaMask, e0, e1 );
+				auto passes = quality == BlockCompressionQuality::eHigh ? 3u : 1u;
+				float bestError = std::numeric_limits< float >::max();
+				BC7Endpoint q0{};
+				BC7Endpoint q1{};
+				BlockIndices indices{};
+
+				for ( uint32_t pass = 0u; pass < passes; ++pass )
+				{
+					auto p0 = quantiseBC7Endpoint( e0 );
+					auto p1 = quantiseBC7Endpoint( e1 );
+					BlockIndices passIndices;
+					auto error = selectIndices( pixels
+						, getBC7Palette( p0, p1 )
+						, 16u
+						, RgbaMask
+						, passIndices );
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						q0 = p0;
+						q1 = p1;
+						indices = passIndices;
+					}
+
+					if ( pass + 1u < passes
+						&& !refineEndpoints( pixels, passIndices, indexWeights, 16u, e0, e1 ) )
+					{
+						break;
+					}
+				}
+
+				// The anchor index MSB is implicit, and must be 0.
+				if ( indices[0] >= 8u )
+				{
+					std::swap( q0, q1 );
+
+					for ( auto & index : indices )
+					{
+						index = uint8_t( 15u - index );
+					}
+				}
+
+				BitWriter writer{ block };
+				writer.write( 1u << 6, 7u );
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					writer.write( q0.colour[c], 7u );
+					writer.write( q1.colour[c], 7u );
+				}
+
+				writer.write( q0.pbit, 1u );
+				writer.write( q1.pbit, 1u );
+				writer.write( indices[0], 3u );
+
+				for ( uint32_t i = 1u; i < 16u; ++i )
+				{
+					writer.write( indices[i], 4u );
+				}
+			}
+
+			bool decodeBC7( uint8_t const * block
+				, uint8_t * pixels )
+			{
+				BitReader reader{ block };
+
+				if ( reader.read( 7u ) != ( 1u << 6 ) )
+				{
+					// Only mode 6 blocks are supported.
+					return false;
+				}
+
+				BC7Endpoint e0{};
+				BC7Endpoint e1{};
+
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					e0.colour[c] = reader.read( 7u );
+					e1.colour[c] = reader.read( 7u );
+				}
+
+				e0.pbit = reader.read( 1u );
+				e1.pbit = reader.read( 1u );
+				auto palette = getBC7Palette( e0, e1 );
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					auto & entry = palette[reader.read( i == 0u ? 3u : 4u )];
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						pixels[i * 4u + c] = uint8_t( entry[c] );
+					}
+				}
+
+				return true;
+			}
+
+			//*********************************************************************************************
+
+			void fetchBlock( uint8_t const * buffer
+				, uint32_t width
+				, uint32_t height
+				, uint32_t blockX
+				, uint32_t blockY
+				, uint8_t * pixels )
+			{
+				// Out of image pixels replicate the image edges.
+				for ( uint32_t y = 0u; y < 4u; ++y )
+				{
+					auto srcY = std::min( blockY * 4u + y, height - 1u );
+
+					for ( uint32_t x = 0u; x < 4u; ++x )
+					{
+						auto srcX = std::min( blockX * 4u + x, width - 1u );
+						std::memcpy( pixels + ( y * 4u + x ) * 4u
+							, buffer + ( size_t( srcY ) * width + srcX ) * 4u
+							, 4u );
+					}
+				}
+			}
+		}
+
+		bool isBlockCompressionSupported( PixelFormat format )
+		{
+			switch ( format )
+			{
+			case PixelFormat::eBC1_RGB_UNORM_BLOCK:
+			case PixelFormat::eBC1_RGB_SRGB_BLOCK:
+			case PixelFormat::eBC1_RGBA_UNORM_BLOCK:
+			case PixelFormat::eBC1_RGBA_SRGB_BLOCK:
+			case PixelFormat::eBC3_UNORM_BLOCK:
+			case PixelFormat::eBC3_SRGB_BLOCK:
+			case PixelFormat::eBC4_UNORM_BLOCK:
+			case PixelFormat::eBC5_UNORM_BLOCK:
+			case PixelFormat::eBC7_UNORM_BLOCK:
+			case PixelFormat::eBC7_SRGB_BLOCK:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		void compressBlock( BlockCompressionQuality quality
+			, uint8_t const * pixels
+			, PixelFormat format
+			, uint8_t * block )
+		{
+			BlockPixels floats;
+			std::array< uint8_t, 16u > channel;
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					floats[i][c] = float( pixels[i * 4u + c] );
+				}
+			}
+
+			auto extractChannel = [&pixels, &channel]( uint32_t index )
+			{
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					channel[i] = pixels[i * 4u + index];
+				}
+
+				return channel.data();
+			};
+
+			switch ( format )
+			{
+			case PixelFormat::eBC1_RGB_UNORM_BLOCK:
+			case PixelFormat::eBC1_RGB_SRGB_BLOCK:
+				encodeBC1( quality, floats, false, block );
+				break;
+			case PixelFormat::eBC1_RGBA_UNORM_BLOCK:
+			case PixelFormat::eBC1_RGBA_SRGB_BLOCK:
+				encodeBC1( quality, floats, true, block );
+				break;
+			case PixelFormat::eBC3_UNORM_BLOCK:
+			case PixelFormat::eBC3_SRGB_BLOCK:
+				encodeBC4( quality, extractChannel( 3u ), block );
+				encodeBC1( quality, floats, false, block + 8u );
+				break;
+			case PixelFormat::eBC4_UNORM_BLOCK:
+				encodeBC4( quality, extractChannel( 0u ), block );
+				break;
+			case PixelFormat::eBC5_UNORM_BLOCK:
+				encodeBC4( quality, extractChannel( 0u ), block );
+				encodeBC4( quality, extractChannel( 1u ), block + 8u );
+				break;
+			case PixelFormat::eBC7_UNORM_BLOCK:
+			case PixelFormat::eBC7_SRGB_BLOCK:
+				encodeBC7( quality, floats, block );
+				break;
+			default:
+				CU_Failure( "Unsupported block compression format" );
+				break;
+			}
+		}
+
+		bool decompressBlock( PixelFormat format
+			, uint8_t const * block
+			, uint8_t * pixels )
+		{
+			switch ( format )
+			{
+			case PixelFormat::eBC1_RGB_UNORM_BLOCK:
+			case PixelFormat::eBC1_RGB_SRGB_BLOCK:
+				decodeBC1( block, false, false, pixels );
+				return true;
+			case PixelFormat::eBC1_RGBA_UNORM_BLOCK:
+			case PixelFormat::eBC1_RGBA_SRGB_BLOCK:
+				decodeBC1( block, true, false, pixels );
+				return true;
+			case PixelFormat::eBC3_UNORM_BLOCK:
+			case PixelFormat::eBC3_SRGB_BLOCK:
+				decodeBC1( block + 8u, false, true, pixels );
+				decodeBC4( block, 3u, pixels );
+				return true;
+			case PixelFormat::eBC4_UNORM_BLOCK:
+				std::memset( pixels, 0, 16u * 4u );
+				decodeBC4( block, 0u, pixels );
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					pixels[i * 4u + 3u] = 255u;
+				}
+
+				return true;
+			case PixelFormat::eBC5_UNORM_BLOCK:
+				std::memset( pixels, 0, 16u * 4u );
+				decodeBC4( block, 0u, pixels );
+				decodeBC4( block + 8u, 1u, pixels );
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					pixels[i * 4u + 3u] = 255u;
+				}
+
+				return true;
+			case PixelFormat::eBC7_UNORM_BLOCK:
+			case PixelFormat::eBC7_SRGB_BLOCK:
+				return decodeBC7( block, pixels );
+			default:
+				return false;
+			}
+		}
+
+		void compressBuffer( BlockCompressionOptions const & options
+			, Size const & dimensions
+			, PixelFormat srcFormat
+			, uint8_t const * srcBuffer
+			, PixelFormat dstFormat
+			, uint8_t * dstBuffer )
+		{
+			CU_Require( isBlockCompressionSupported( dstFormat ) );
+			auto width = std::max( 1u, dimensions.getWidth() );
+			auto height = std::max( 1u, dimensions.getHeight() );
+			ByteArray converted;
+
+			if ( srcFormat != PixelFormat::eR8G8B8A8_UNORM
+				&& srcFormat != PixelFormat::eR8G8B8A8_SRGB )
+			{
+				auto count = uint32_t( width * height );
+				converted.resize( count * 4u );
+				convertBuffer( srcFormat
+					, srcBuffer
+					, count * getBytesPerPixel( srcFormat )
+					, PixelFormat::eR8G8B8A8_UNORM
+					, converted.data()
+					, uint32_t( converted.size() ) );
+				srcBuffer = converted.data();
+			}
+
+			auto blocksX = ( width + 3u ) / 4u;
+			auto blocksY = ( height + 3u ) / 4u;
+			auto blockSize = getBlockByteSize( dstFormat );
+			auto partsCount = options.threadsCount
+				? options.threadsCount
+				: getParallelThreadsCount();
+			parallelFor( blocksY
+				, std::min( partsCount, blocksY )
+				, [&]( uint32_t part, size_t begin, size_t end )
+				{
+					std::array< uint8_t, 16u * 4u > pixels;
+
+					for ( auto blockY = uint32_t( begin ); blockY < end; ++blockY )
+					{
+						auto dst = dstBuffer + size_t( blockY ) * blocksX * blockSize;
+
+						for ( uint32_t blockX = 0u; blockX < blocksX; ++blockX )
+						{
+							fetchBlock( srcBuffer, width, height, blockX, blockY, pixels.data() );
+							compressBlock( options.quality, pixels.data(), dstFormat, dst );
+							dst += blockSize;
+						}
+					}
+				} );
+		}
+
+		PxBufferBaseSPtr compressBuffer( PxBufferBaseSPtr src
+			, PixelFormat format
+			, BlockCompressionOptions const & options )
+		{
+			if ( src->getFormat() == format )
+			{
+				return src;
+			}
+
+			CU_Require( !isCompressed( src->getFormat() ) );
+			auto result = PxBufferBase::create( src->getDimensions()
+				, src->getLayers()
+				, src->getLevels()
+				, format );
+			auto extent = VkExtent3D{ src->getWidth(), src->getHeight(), 1u };
+			auto srcFormat = VkFormat( src->getFormat() );
+			auto dstFormat = VkFormat( format );
+			auto srcBlockSize = ashes::getBlockSize( srcFormat );
+			auto dstBlockSize = ashes::getBlockSize( dstFormat );
+			auto srcAlign = uint32_t( getBytesPerPixel( src->getFormat() ) );
+			auto dstAlign = uint32_t( getBytesPerPixel( format ) );
+			auto srcLevel = src->getConstPtr();
+			auto dstLevel = result->getPtr();
+
+			for ( uint32_t layer = 0u; layer < src->getLayers(); ++layer )
+			{
+				for ( uint32_t level = 0u; level < src->getLevels(); ++level )
+				{
+					compressBuffer( options
+						, Size{ std::max( 1u, extent.width >> level ), std::max( 1u, extent.height >> level ) }
+						, src->getFormat()
+						, srcLevel
+						, format
+						, dstLevel );
+					srcLevel += ashes::getSize( srcFormat, extent, srcBlockSize, level, srcAlign );
+					dstLevel += ashes::getSize( dstFormat, extent, dstBlockSize, level, dstAlign );
+				}
+			}
+
+			if ( src->isFlipped() )
+			{
+				result->flip();
+			}
+
+			return result;
+		}
+	}
+}
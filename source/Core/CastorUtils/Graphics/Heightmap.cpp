@@ -0,0 +1,208 @@
+#include "CastorUtils/Graphics/Heightmap.hpp"
+
+#include "CastorUtils/Data/BinaryFile.hpp"
+#include "CastorUtils/Exception/Exception.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <algorithm>
+
+namespace castor
+{
+	namespace
+	{
+		static uint32_t constexpr MinCellsPerThread = 65536u;
+		static uint32_t constexpr FileTag = 0x48443343u; // "C3DH"
+
+		uint32_t getThreadsCount( size_t cellsCount
+			, uint32_t threadsCount )
+		{
+			threadsCount = threadsCount ? threadsCount : getParallelThreadsCount();
+			return uint32_t( std::max( size_t( 1u )
+				, std::min( size_t( threadsCount ), cellsCount / MinCellsPerThread ) ) );
+		}
+
+		/**
+		 *\~english
+		 *\return		A random value in [-1, 1), only depending on the seed and the cell.
+		 *\~french
+		 *\return		Une valeur aléatoire dans [-1, 1), ne dépendant que de la graine et de la cellule.
+		 */
+		float getRandom( uint32_t seed
+			, uint32_t x
+			, uint32_t y )
+		{
+			// SplitMix64 finaliser, over the seed and the cell coordinates.
+			uint64_t value = ( uint64_t( seed ) * 0x9E3779B97F4A7C15ull )
+				^ ( ( uint64_t( x ) << 32u ) | uint64_t( y ) );
+			value = ( value ^ ( value >> 30u ) ) * 0xBF58476D1CE4E5B9ull;
+			value = ( value ^ ( value >> 27u ) ) * 0x94D049BB133111EBull;
+			value = value ^ ( value >> 31u );
+			return float( value >> 40u ) * ( 2.0f / 16777216.0f ) - 1.0f;
+		}
+	}
+
+	Heightmap::Heightmap( uint32_t size )
+		: m_size{ size }
+		, m_heights( size_t( size ) * size, 0.0f )
+	{
+	}
+
+	Heightmap Heightmap::generate( uint32_t detail
+		, float roughness
+		, uint32_t seed
+		, uint32_t threadsCount )
+	{
+		Heightmap result{ ( 1u << detail ) + 1u };
+		auto & map = result;
+		auto max = result.m_size - 1u;
+
+		for ( auto step = max; step > 1u; step /= 2u )
+		{
+			auto half = step / 2u;
+			auto scale = roughness * float( step );
+			auto cells = max / step;
+
+			// Square step, the centers only read the corners of their square.
+			parallelFor( cells
+				, getThreadsCount( size_t( cells ) * cells, threadsCount )
+				, [&map, seed, step, half, scale, max]( uint32_t, size_t begin, size_t end )
+				{
+					for ( auto row = uint32_t( begin ); row < end; ++row )
+					{
+						auto y = half + row * step;
+
+						for ( auto x = half; x < max; x += step )
+						{
+							auto average = ( map( x - half, y - half )
+								+ map( x + half, y - half )
+								+ map( x + half, y + half )
+								+ map( x - half, y + half ) ) / 4.0f;
+							map( x, y ) = average + getRandom( seed, x, y ) * scale;
+						}
+					}
+				} );
+
+			// Diamond step, the edges midpoints only read the corners and the centers.
+			auto rows = max / half + 1u;
+			parallelFor( rows
+				, getThreadsCount( size_t( rows ) * ( cells + 1u ), threadsCount )
+				, [&map, seed, step, half, scale, max]( uint32_t, size_t begin, size_t end )
+				{
+					for ( auto row = uint32_t( begin ); row < end; ++row )
+					{
+						auto y = row * half;
+
+						for ( auto x = ( y + half ) % step; x <= max; x += step )
+						{
+							auto total = 0.0f;
+							auto count = 0u;
+
+							if ( y >= half )
+							{
+								total += map( x, y - half );
+								++count;
+							}
+
+							if ( x + half <= max )
+							{
+								total += map( x + half, y );
+								++count;
+							}
+
+							if ( y + half <= max )
+							{
+								total += map( x, y + half );
+								++count;
+							}
+
+							if ( x >= half )
+							{
+								total += map( x - half, y );
+								++count;
+							}
+
+							map( x, y ) = total / float( count ) + getRandom( seed, x, y ) * scale;
+						}
+					}
+				} );
+		}
+
+		return result;
+	}
+
+	bool Heightmap::load( Path const & path )
+	{
+		if ( !File::fileExists( path ) )
+		{
+			return false;
+		}
+
+		BinaryFile file{ path, File::OpenMode::eRead };
+		uint32_t tag{};
+		uint32_t size{};
+
+		if ( !file.isOk()
+			|| file.read( tag ) != sizeof( tag )
+			|| tag != FileTag
+			|| file.read( size ) != sizeof( size )
+			|| size < 2u )
+		{
+			return false;
+		}
+
+		// The header's size is checked against the actual data, before allocating for it.
+		auto available = file.getLength() - file.tell();
+
+		if ( available < 0
+			|| uint64_t( size ) * size > uint64_t( available ) / sizeof( float ) )
+		{
+			return false;
+		}
+
+		std::vector< float > heights( size_t( size ) * size );
+
+		if ( file.readArray( heights.data(), heights.size() ) != heights.size() * sizeof( float ) )
+		{
+			return false;
+		}
+
+		m_size = size;
+		m_heights = std::move( heights );
+		return true;
+	}
+
+	bool Heightmap::save( Path const & path )const
+	{
+		try
+		{
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			return file.isOk()
+				&& file.write( FileTag ) == sizeof( FileTag )
+				&& file.write( m_size ) == sizeof( m_size )
+				&& file.writeArray( m_heights.data(), m_heights.size() ) == m_heights.size() * sizeof( float );
+		}
+		catch ( Exception & )
+		{
+			// The file couldn't be opened.
+			return false;
+		}
+	}
+
+	Point3f Heightmap::getNormal( uint32_t x, uint32_t y )const
+	{
+		auto max = m_size - 1u;
+		auto dx = ( ( *this )( std::min( x + 1u, max ), y ) - ( *this )( x ? x - 1u : 0u, y ) )
+			/ float( std::min( x + 1u, max ) - ( x ? x - 1u : 0u ) );
+		auto dy = ( ( *this )( x, std::min( y + 1u, max ) ) - ( *this )( x, y ? y - 1u : 0u ) )
+			/ float( std::min( y + 1u, max ) - ( y ? y - 1u : 0u ) );
+		return point::getNormalised( Point3f{ -dx, 1.0f, -dy } );
+	}
+
+	Point3f Heightmap::getTangent( uint32_t x, uint32_t y )const
+	{
+		auto max = m_size - 1u;
+		auto dx = ( ( *this )( std::min( x + 1u, max ), y ) - ( *this )( x ? x - 1u : 0u, y ) )
+			/ float( std::min( x + 1u, max ) - ( x ? x - 1u : 0u ) );
+		return point::getNormalised( Point3f{ 1.0f, dx, 0.0f } );
+	}
+}
@@ -4,6 +4,7 @@
 #include "CastorUtils/Data/LoaderException.hpp"
 #include "CastorUtils/Data/Path.hpp"
 #include "CastorUtils/Graphics/ImageLayout.hpp"
+#include "CastorUtils/Miscellaneous/Profiler.hpp"
 
 namespace castor
 {
@@ -46,6 +47,8 @@ namespace castor
 	Image ImageLoader::load( String const & name
 		, Path const & path )const
 	{
+		CU_ProfileScope( "ImageLoader::load" );
+
 		if ( path.empty() )
 		{
 			CU_LoaderError( "Can't load image: Path is empty" );
@@ -0,0 +1,486 @@
+#include "CastorUtils/Graphics/MeshSimplifier.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+
+namespace castor
+{
+	namespace
+	{
+		// Keeps the open borders from being eaten by the collapses.
+		static double constexpr BorderWeight = 10.0;
+		// Rejects the collapses rotating a triangle normal by more than ~75 degrees.
+		static double constexpr MinNormalDot = 0.25;
+
+		struct Vec3
+		{
+			double x;
+			double y;
+			double z;
+		};
+
+		Vec3 toVec3( Point3f const & point )
+		{
+			return Vec3{ point[0], point[1], point[2] };
+		}
+
+		Vec3 operator-( Vec3 const & lhs, Vec3 const & rhs )
+		{
+			return Vec3{ lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z };
+		}
+
+		Vec3 cross( Vec3 const & lhs, Vec3 const & rhs )
+		{
+			return Vec3{ lhs.y * rhs.z - lhs.z * rhs.y
+				, lhs.z * rhs.x - lhs.x * rhs.z
+				, lhs.x * rhs.y - lhs.y * rhs.x };
+		}
+
+		double dot( Vec3 const & lhs, Vec3 const & rhs )
+		{
+			return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+		}
+
+		double length( Vec3 const & value )
+		{
+			return std::sqrt( dot( value, value ) );
+		}
+
+		template< typename QuadricT >
+		void addPlane( QuadricT & quadric
+			, Vec3 const & normal
+			, double distance
+			, double weight )
+		{
+			auto a = normal.x;
+			auto b = normal.y;
+			auto c = normal.z;
+			auto d = distance;
+			quadric[0] += weight * a * a;
+			quadric[1] += weight * a * b;
+			quadric[2] += weight * a * c;
+			quadric[3] += weight * a * d;
+			quadric[4] += weight * b * b;
+			quadric[5] += weight * b * c;
+			quadric[6] += weight * b * d;
+			quadric[7] += weight * c * c;
+			quadric[8] += weight * c * d;
+			quadric[9] += weight * d * d;
+			quadric[10] += weight;
+		}
+
+		uint64_t getEdgeKey( uint32_t a, uint32_t b )
+		{
+			return ( uint64_t( std::min( a, b ) ) << 32u ) | std::max( a, b );
+		}
+	}
+
+	MeshSimplifier::MeshSimplifier( std::vector< Point3f > const & positions
+		, std::vector< uint32_t > const & indices )
+		: m_positions{ positions }
+		, m_vertexTriangles( positions.size() )
+		, m_quadrics( positions.size(), Quadric{} )
+		, m_stamps( positions.size(), 0u )
+		, m_locked( positions.size(), 0u )
+		, m_collapsed( positions.size(), 0u )
+	{
+		CU_Require( indices.size() % 3u == 0u );
+		m_triangles.reserve( indices.size() / 3u );
+
+		for ( size_t i = 0u; i < indices.size(); i += 3u )
+		{
+			Triangle triangle{ indices[i + 0u], indices[i + 1u], indices[i + 2u] };
+			CU_Require( triangle[0] < positions.size()
+				&& triangle[1] < positions.size()
+				&& triangle[2] < positions.size() );
+
+			if ( triangle[0] != triangle[1]
+				&& triangle[1] != triangle[2]
+				&& triangle[2] != triangle[0] )
+			{
+				auto index = uint32_t( m_triangles.size() );
+				m_triangles.push_back( triangle );
+
+				for ( auto vertex : triangle )
+				{
+					m_vertexTriangles[vertex].push_back( index );
+				}
+			}
+		}
+
+		m_removed.resize( m_triangles.size(), 0u );
+		m_triangleCount = uint32_t( m_triangles.size() );
+		doLockSeams();
+		doComputeQuadrics();
+
+		for ( auto & triangle : m_triangles )
+		{
+			doPushEdge( triangle[0], triangle[1] );
+			doPushEdge( triangle[1], triangle[2] );
+			doPushEdge( triangle[2], triangle[0] );
+		}
+	}
+
+	uint32_t MeshSimplifier::simplify( uint32_t targetIndexCount
+		, float maxError )
+	{
+		auto maxCost = double( maxError ) * double( maxError );
+		auto greater = []( Collapse const & lhs, Collapse const & rhs )
+		{
+			return lhs.cost > rhs.cost;
+		};
+
+		while ( getIndexCount() > targetIndexCount
+			&& !m_heap.empty() )
+		{
+			std::pop_heap( m_heap.begin(), m_heap.end(), greater );
+			auto collapse = m_heap.back();
+
+			if ( collapse.cost > maxCost )
+			{
+				// Kept for a later call with a higher error bound.
+				std::push_heap( m_heap.begin(), m_heap.end(), greater );
+				break;
+			}
+
+			m_heap.pop_back();
+
+			if ( m_collapsed[collapse.from]
+				|| m_collapsed[collapse.to]
+				|| m_stamps[collapse.from] != collapse.fromStamp
+				|| m_stamps[collapse.to] != collapse.toStamp
+				|| !doIsValid( collapse.from, collapse.to ) )
+			{
+				continue;
+			}
+
+			doCollapse( collapse );
+		}
+
+		return getIndexCount();
+	}
+
+	std::vector< uint32_t > MeshSimplifier::getIndices()const
+	{
+		std::vector< uint32_t > result;
+		result.reserve( getIndexCount() );
+
+		for ( size_t i = 0u; i < m_triangles.size(); ++i )
+		{
+			if ( !m_removed[i] )
+			{
+				result.insert( result.end(), m_triangles[i].begin(), m_triangles[i].end() );
+			}
+		}
+
+		return result;
+	}
+
+	void MeshSimplifier::doLockSeams()
+	{
+		// Vertices sharing a position with different attributes would open cracks if moved separately.
+		std::vector< uint32_t > sorted( m_positions.size() );
+		std::iota( sorted.begin(), sorted.end(), 0u );
+		auto less = [this]( uint32_t lhs, uint32_t rhs )
+		{
+			auto & l = m_positions[lhs];
+			auto & r = m_positions[rhs];
+			return std::tie( l[0], l[1], l[2] ) < std::tie( r[0], r[1], r[2] );
+		};
+		std::sort( sorted.begin(), sorted.end(), less );
+
+		for ( size_t i = 1u; i < sorted.size(); ++i )
+		{
+			if ( !less( sorted[i - 1u], sorted[i] ) )
+			{
+				m_locked[sorted[i - 1u]] = 1u;
+				m_locked[sorted[i]] = 1u;
+			}
+		}
+	}
+
+	void MeshSimplifier::doComputeQuadrics()
+	{
+		std::unordered_map< uint64_t, uint32_t > edges;
+		edges.reserve( m_triangles.size() * 3u );
+
+		for ( auto & triangle : m_triangles )
+		{
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				++edges[getEdgeKey( triangle[i], triangle[( i + 1u ) % 3u] )];
+			}
+		}
+
+		for ( auto & triangle : m_triangles )
+		{
+			auto p0 = toVec3( m_positions[triangle[0]] );
+			auto p1 = toVec3( m_positions[triangle[1]] );
+			auto p2 = toVec3( m_positions[triangle[2]] );
+			auto normal = cross( p1 - p0, p2 - p0 );
+			auto doubleArea = length( normal );
+
+			if ( doubleArea <= 0.0 )
+			{
+				continue;
+			}
+
+			normal = Vec3{ normal.x / doubleArea, normal.y / doubleArea, normal.z / doubleArea };
+			auto distance = -dot( normal, p0 );
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				auto a = triangle[i];
+				auto b = triangle[( i + 1u ) % 3u];
+				addPlane( m_quadrics[a], normal, distance, doubleArea * 0.5 );
+
+				if ( edges[getEdgeKey( a, b )] == 1u )
+				{
+					// Open edge: add a plane orthogonal to the triangle, going through the edge.
+					auto pa = toVec3( m_positions[a] );
+					auto edge = toVec3( m_positions[b] ) - pa;
+					auto edgeLength = length( edge );
+
+					if ( edgeLength > 0.0 )
+					{
+						auto border = cross( edge, normal );
+						auto borderLength = length( border );
+						border = Vec3{ border.x / borderLength, border.y / borderLength, border.z / borderLength };
+						auto weight = edgeLength * edgeLength * BorderWeight;
+						addPlane( m_quadrics[a], border, -dot( border, pa ), weight );
+						addPlane( m_quadrics[b], border, -dot( border, pa ), weight );
+					}
+				}
+			}
+		}
+	}
+
+	void MeshSimplifier::doPushEdge( uint32_t a
+		, uint32_t b )
+	{
+		if ( m_collapsed[a] || m_collapsed[b] )
+		{
+			return;
+		}
+
+		Quadric quadric;
+
+		for ( size_t i = 0u; i < quadric.size(); ++i )
+		{
+			quadric[i] = m_quadrics[a][i] + m_quadrics[b][i];
+		}
+
+		auto infinite = std::numeric_limits< double >::infinity();
+		auto costAtoB = m_locked[a] ? infinite : doGetCost( quadric, b );
+		auto costBtoA = m_locked[b] ? infinite : doGetCost( quadric, a );
+
+		if ( costAtoB == infinite && costBtoA == infinite )
+		{
+			return;
+		}
+
+		m_heap.push_back( costAtoB <= costBtoA
+			? Collapse{ costAtoB, a, b, m_stamps[a], m_stamps[b] }
+			: Collapse{ costBtoA, b, a, m_stamps[b], m_stamps[a] } );
+		std::push_heap( m_heap.begin()
+			, m_heap.end()
+			, []( Collapse const & lhs, Collapse const & rhs )
+			{
+				return lhs.cost > rhs.cost;
+			} );
+	}
+
+	bool MeshSimplifier::doIsValid( uint32_t from
+		, uint32_t to )
+	{
+		// Link condition: the vertices shared by both one rings must only be the ones of the collapsed triangles.
+		m_neighbours.clear();
+		uint32_t shared = 0u;
+
+		for ( auto index : m_vertexTriangles[from] )
+		{
+			if ( m_removed[index] )
+			{
+				continue;
+			}
+
+			auto & triangle = m_triangles[index];
+			shared += ( triangle[0] == to || triangle[1] == to || triangle[2] == to ) ? 1u : 0u;
+
+			for ( auto vertex : triangle )
+			{
+				if ( vertex != from
+					&& vertex != to
+					&& std::find( m_neighbours.begin(), m_neighbours.end(), vertex ) == m_neighbours.end() )
+				{
+					m_neighbours.push_back( vertex );
+				}
+			}
+		}
+
+		if ( !shared )
+		{
+			return false;
+		}
+
+		uint32_t common = 0u;
+
+		for ( auto index : m_vertexTriangles[to] )
+		{
+			if ( m_removed[index] )
+			{
+				continue;
+			}
+
+			for ( auto vertex : m_triangles[index] )
+			{
+				auto it = std::find( m_neighbours.begin(), m_neighbours.end(), vertex );
+
+				if ( it != m_neighbours.end() )
+				{
+					*it = m_neighbours.back();
+					m_neighbours.pop_back();
+					++common;
+				}
+			}
+		}
+
+		if ( common > shared )
+		{
+			return false;
+		}
+
+		// The remaining triangles must not flip.
+		auto target = toVec3( m_positions[to] );
+
+		for ( auto index : m_vertexTriangles[from] )
+		{
+			auto & triangle = m_triangles[index];
+
+			if ( m_removed[index]
+				|| triangle[0] == to
+				|| triangle[1] == to
+				|| triangle[2] == to )
+			{
+				continue;
+			}
+
+			std::array< Vec3, 3u > points
+			{
+				toVec3( m_positions[triangle[0]] ),
+				toVec3( m_positions[triangle[1]] ),
+				toVec3( m_positions[triangle[2]] ),
+			};
+			auto before = cross( points[1] - points[0], points[2] - points[0] );
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				if ( triangle[i] == from )
+				{
+					points[i] = target;
+				}
+			}
+
+			auto after = cross( points[1] - points[0], points[2] - points[0] );
+
+			if ( dot( before, after ) <= MinNormalDot * length( before ) * length( after ) )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void MeshSimplifier::doCollapse( Collapse const & collapse )
+	{
+		auto from = collapse.from;
+		auto to = collapse.to;
+		auto & toTriangles = m_vertexTriangles[to];
+
+		for ( auto index : m_vertexTriangles[from] )
+		{
+			if ( m_removed[index] )
+			{
+				continue;
+			}
+
+			auto & triangle = m_triangles[index];
+
+			if ( triangle[0] == to || triangle[1] == to || triangle[2] == to )
+			{
+				m_removed[index] = 1u;
+				--m_triangleCount;
+			}
+			else
+			{
+				std::replace( triangle.begin(), triangle.end(), from, to );
+				toTriangles.push_back( index );
+			}
+		}
+
+		m_vertexTriangles[from].clear();
+		m_collapsed[from] = 1u;
+		toTriangles.erase( std::remove_if( toTriangles.begin()
+				, toTriangles.end()
+				, [this]( uint32_t index )
+				{
+					return m_removed[index] != 0u;
+				} )
+			, toTriangles.end() );
+
+		for ( size_t i = 0u; i < m_quadrics[to].size(); ++i )
+		{
+			m_quadrics[to][i] += m_quadrics[from][i];
+		}
+
+		++m_stamps[to];
+		m_error = std::max( m_error, float( std::sqrt( collapse.cost ) ) );
+
+		// The quadric of the kept vertex changed, so do its edges costs.
+		m_neighbours.clear();
+
+		for ( auto index : toTriangles )
+		{
+			for ( auto vertex : m_triangles[index] )
+			{
+				if ( vertex != to
+					&& std::find( m_neighbours.begin(), m_neighbours.end(), vertex ) == m_neighbours.end() )
+				{
+					m_neighbours.push_back( vertex );
+				}
+			}
+		}
+
+		for ( auto vertex : m_neighbours )
+		{
+			doPushEdge( to, vertex );
+		}
+	}
+
+	double MeshSimplifier::doGetCost( Quadric const & quadric
+		, uint32_t vertex )const
+	{
+		auto & position = m_positions[vertex];
+		double x = position[0];
+		double y = position[1];
+		double z = position[2];
+		auto error = quadric[0] * x * x
+			+ 2.0 * quadric[1] * x * y
+			+ 2.0 * quadric[2] * x * z
+			+ 2.0 * quadric[3] * x
+			+ quadric[4] * y * y
+			+ 2.0 * quadric[5] * y * z
+			+ 2.0 * quadric[6] * y
+			+ quadric[7] * z * z
+			+ 2.0 * quadric[8] * z
+			+ quadric[9];
+		// Normalised by the planes weights, to get a squared distance.
+		return std::max( 0.0, error ) / std::max( quadric[10], std::numeric_limits< double >::min() );
+	}
+}
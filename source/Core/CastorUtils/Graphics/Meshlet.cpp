@@ -0,0 +1,401 @@
+#include "CastorUtils/Graphics/Meshlet.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+#include "CastorUtils/Math/MathModule.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace castor
+{
+	namespace meshlet
+	{
+		namespace
+		{
+			static uint32_t constexpr Invalid = ~( 0u );
+			// Under this meshlets count, the threads creation costs more than the culling itself.
+			static size_t constexpr MinParallelMeshlets = 1024u;
+
+			Point3f getNormal( std::vector< Point3f > const & positions
+				, uint32_t const * triangle )
+			{
+				auto & a = positions[triangle[0]];
+				return point::cross( positions[triangle[1]] - a
+					, positions[triangle[2]] - a );
+			}
+
+			Meshlet computeBounds( std::vector< Point3f > const & positions
+				, std::vector< uint32_t > const & indices
+				, uint32_t firstIndex
+				, uint32_t indexCount )
+			{
+				Meshlet result{ firstIndex, indexCount, Point3f{}, 0.0f, Point3f{}, 1.0f };
+				auto begin = indices.data() + firstIndex;
+				auto end = begin + indexCount;
+
+				// Bounding sphere, centered on the bounding box.
+				Point3f min{ positions[*begin] };
+				Point3f max{ min };
+
+				for ( auto it = begin; it != end; ++it )
+				{
+					auto & position = positions[*it];
+
+					for ( uint32_t i = 0u; i < 3u; ++i )
+					{
+						min[i] = std::min( min[i], position[i] );
+						max[i] = std::max( max[i], position[i] );
+					}
+				}
+
+				result.center = ( min + max ) / 2.0f;
+				float radius = 0.0f;
+
+				for ( auto it = begin; it != end; ++it )
+				{
+					radius = std::max( radius, float( point::distanceSquared( positions[*it], result.center ) ) );
+				}
+
+				result.radius = std::sqrt( radius );
+
+				// Normal cone, the axis is the area weighted average normal.
+				Point3f axis;
+				std::vector< Point3f > normals;
+				normals.reserve( indexCount / 3u );
+
+				for ( auto it = begin; it != end; it += 3 )
+				{
+					auto normal = getNormal( positions, it );
+					axis += normal;
+					auto length = float( point::length( normal ) );
+
+					if ( length > std::numeric_limits< float >::epsilon() )
+					{
+						normals.push_back( normal / length );
+					}
+				}
+
+				auto length = float( point::length( axis ) );
+
+				if ( length > std::numeric_limits< float >::epsilon()
+					&& !normals.empty() )
+				{
+					result.coneAxis = axis / length;
+					auto minDot = 1.0f;
+
+					for ( auto & normal : normals )
+					{
+						minDot = std::min( minDot, point::dot( normal, result.coneAxis ) );
+					}
+
+					// A cone wider than an half space can't be back facing.
+					result.coneCutoff = minDot > 0.0f
+						? std::sqrt( 1.0f - minDot * minDot )
+						: 1.0f;
+				}
+
+				return result;
+			}
+
+			uint32_t cullRange( Meshlet const * begin
+				, Meshlet const * end
+				, std::array< PlaneEquation, 6u > const & planes
+				, Matrix4x4f const & transform
+				, float scale
+				, bool useCones
+				, Point3f const & viewPosition
+				, MeshletRangeArray & ranges )
+			{
+				uint32_t result{ 0u };
+
+				for ( auto meshlet = begin; meshlet != end; ++meshlet )
+				{
+					Point3f center = transform * meshlet->center;
+					auto radius = meshlet->radius * scale;
+					auto visible = std::all_of( planes.begin()
+						, planes.end()
+						, [&center, radius]( PlaneEquation const & plane )
+						{
+							return plane.distance( center ) >= -radius;
+						} );
+
+					if ( visible
+						&& useCones
+						&& meshlet->coneCutoff < 1.0f )
+					{
+						// The whole sphere must see the cone from behind.
+						auto axis = point::getNormalised( Point3f{ transform * ( meshlet->center + meshlet->coneAxis ) } - center );
+						auto view = center - viewPosition;
+						visible = point::dot( view, axis ) < meshlet->coneCutoff * float( point::length( view ) ) + radius * ( 1.0f + meshlet->coneCutoff );
+					}
+
+					if ( visible )
+					{
+						if ( !ranges.empty()
+							&& ranges.back().firstIndex + ranges.back().indexCount == meshlet->firstIndex )
+						{
+							ranges.back().indexCount += meshlet->indexCount;
+						}
+						else
+						{
+							ranges.push_back( { meshlet->firstIndex, meshlet->indexCount } );
+						}
+
+						result += meshlet->indexCount;
+					}
+				}
+
+				return result;
+			}
+		}
+
+		MeshletArray build( std::vector< Point3f > const & positions
+			, std::vector< uint32_t > & indices
+			, uint32_t maxVertices
+			, uint32_t maxTriangles )
+		{
+			CU_Require( indices.size() % 3u == 0u );
+			CU_Require( maxVertices >= 3u && maxTriangles >= 1u );
+			auto triangleCount = uint32_t( indices.size() / 3u );
+			auto vertexCount = uint32_t( positions.size() );
+
+			// Vertex to triangles adjacency, in a compact layout.
+			std::vector< uint32_t > offsets( vertexCount + 1u, 0u );
+
+			for ( auto index : indices )
+			{
+				CU_Require( index < vertexCount );
+				++offsets[index + 1u];
+			}
+
+			std::partial_sum( offsets.begin(), offsets.end(), offsets.begin() );
+			std::vector< uint32_t > adjacency( indices.size() );
+			{
+				auto cursors = offsets;
+
+				for ( uint32_t i = 0u; i < indices.size(); ++i )
+				{
+					adjacency[cursors[indices[i]]++] = i / 3u;
+				}
+			}
+
+			std::vector< uint8_t > emitted( triangleCount, 0u );
+			std::vector< uint32_t > vertexMeshlet( vertexCount, Invalid );
+			std::vector< uint32_t > candidateMeshlet( triangleCount, Invalid );
+			std::vector< uint32_t > candidates;
+			std::vector< uint32_t > triangles;
+			std::vector< uint32_t > sorted;
+			sorted.reserve( indices.size() );
+			MeshletArray result;
+			uint32_t meshletVertices{ 0u };
+			uint32_t emittedCount{ 0u };
+			uint32_t seedCursor{ 0u };
+			Point3f centroid;
+
+			auto getNewVertices = [&]( uint32_t triangle )
+			{
+				auto index = indices.data() + triangle * 3u;
+				return uint32_t( vertexMeshlet[index[0]] != result.size() )
+					+ uint32_t( vertexMeshlet[index[1]] != result.size() )
+					+ uint32_t( vertexMeshlet[index[2]] != result.size() );
+			};
+			auto getCenter = [&]( uint32_t triangle )
+			{
+				auto index = indices.data() + triangle * 3u;
+				return ( positions[index[0]] + positions[index[1]] + positions[index[2]] ) / 3.0f;
+			};
+			auto addTriangle = [&]( uint32_t triangle )
+			{
+				auto meshlet = uint32_t( result.size() );
+				emitted[triangle] = 1u;
+				++emittedCount;
+				triangles.push_back( triangle );
+				centroid += getCenter( triangle );
+
+				for ( uint32_t i = 0u; i < 3u; ++i )
+				{
+					auto vertex = indices[triangle * 3u + i];
+
+					if ( vertexMeshlet[vertex] != meshlet )
+					{
+						vertexMeshlet[vertex] = meshlet;
+						++meshletVertices;
+
+						for ( auto it = offsets[vertex]; it < offsets[vertex + 1u]; ++it )
+						{
+							auto neighbour = adjacency[it];
+
+							if ( !emitted[neighbour]
+								&& candidateMeshlet[neighbour] != meshlet )
+							{
+								candidateMeshlet[neighbour] = meshlet;
+								candidates.push_back( neighbour );
+							}
+						}
+					}
+				}
+			};
+			auto flush = [&]()
+			{
+				auto firstIndex = uint32_t( sorted.size() );
+
+				for ( auto triangle : triangles )
+				{
+					sorted.insert( sorted.end(), indices.begin() + triangle * 3u, indices.begin() + triangle * 3u + 3u );
+				}
+
+				result.push_back( computeBounds( positions, sorted, firstIndex, uint32_t( sorted.size() ) - firstIndex ) );
+				triangles.clear();
+				meshletVertices = 0u;
+				centroid = Point3f{};
+			};
+
+			while ( emittedCount < triangleCount )
+			{
+				// Prefer the neighbour adding the less vertices, then the closest to the meshlet centroid.
+				auto best = Invalid;
+				auto bestNew = 4u;
+				auto bestDistance = std::numeric_limits< double >::max();
+				auto center = triangles.empty()
+					? Point3f{}
+					: centroid / float( triangles.size() );
+				auto end = std::remove_if( candidates.begin()
+					, candidates.end()
+					, [&emitted]( uint32_t triangle )
+					{
+						return emitted[triangle] != 0u;
+					} );
+				candidates.erase( end, candidates.end() );
+
+				for ( auto candidate : candidates )
+				{
+					auto newVertices = getNewVertices( candidate );
+
+					if ( newVertices <= bestNew )
+					{
+						auto distance = point::distanceSquared( getCenter( candidate ), center );
+
+						if ( newVertices < bestNew || distance < bestDistance )
+						{
+							best = candidate;
+							bestNew = newVertices;
+							bestDistance = distance;
+						}
+					}
+				}
+
+				if ( best != Invalid
+					&& meshletVertices + bestNew <= maxVertices
+					&& triangles.size() < maxTriangles )
+				{
+					addTriangle( best );
+				}
+				else
+				{
+					if ( !triangles.empty() )
+					{
+						flush();
+					}
+
+					// The next meshlet starts from the previous one's border, if possible.
+					auto seed = best;
+
+					if ( seed == Invalid )
+					{
+						while ( emitted[seedCursor] )
+						{
+							++seedCursor;
+						}
+
+						seed = seedCursor;
+					}
+
+					candidates.clear();
+					addTriangle( seed );
+				}
+			}
+
+			if ( !triangles.empty() )
+			{
+				flush();
+			}
+
+			indices = std::move( sorted );
+			return result;
+		}
+
+		uint32_t cull( MeshletArray const & meshlets
+			, std::array< PlaneEquation, 6u > const & planes
+			, Matrix4x4f const & transform
+			, Point3f const & scale
+			, Point3f const & viewPosition
+			, bool cullBackFaces
+			, MeshletRangeArray & ranges
+			, uint32_t threadsCount )
+		{
+			ranges.clear();
+			auto maxScale = std::max( { std::abs( scale[0] ), std::abs( scale[1] ), std::abs( scale[2] ) } );
+			auto minScale = std::min( { std::abs( scale[0] ), std::abs( scale[1] ), std::abs( scale[2] ) } );
+			// A non uniform scale doesn't preserve the normal cones angles.
+			auto useCones = cullBackFaces
+				&& maxScale - minScale <= maxScale * 0.001f;
+			threadsCount = meshlets.size() < MinParallelMeshlets
+				? 1u
+				: ( threadsCount ? threadsCount : getParallelThreadsCount() );
+
+			if ( threadsCount == 1u )
+			{
+				return cullRange( meshlets.data()
+					, meshlets.data() + meshlets.size()
+					, planes
+					, transform
+					, maxScale
+					, useCones
+					, viewPosition
+					, ranges );
+			}
+
+			// Each part culls a contiguous range of the meshlets, the parts ranges are then concatenated.
+			std::vector< MeshletRangeArray > parts( threadsCount );
+			std::vector< uint32_t > counts( threadsCount, 0u );
+			parallelFor( meshlets.size()
+				, threadsCount
+				, [&]( uint32_t part, size_t begin, size_t end )
+				{
+					counts[part] = cullRange( meshlets.data() + begin
+						, meshlets.data() + end
+						, planes
+						, transform
+						, maxScale
+						, useCones
+						, viewPosition
+						, parts[part] );
+				} );
+
+			uint32_t result{ 0u };
+
+			for ( uint32_t part = 0u; part < threadsCount; ++part )
+			{
+				for ( auto & range : parts[part] )
+				{
+					if ( !ranges.empty()
+						&& ranges.back().firstIndex + ranges.back().indexCount == range.firstIndex )
+					{
+						ranges.back().indexCount += range.indexCount;
+					}
+					else
+					{
+						ranges.push_back( range );
+					}
+				}
+
+				result += counts[part];
+			}
+
+			return result;
+		}
+	}
+}
@@ -0,0 +1,286 @@
+#include "CastorUtils/Graphics/MipmapGeneration.hpp"
+
+#include "CastorUtils/Graphics/PixelBufferBase.hpp"
+#include "CastorUtils/Graphics/PixelFormat.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <ashes/common/Format.hpp>
+
+#include <array>
+#include <cmath>
+
+namespace castor
+{
+	namespace PF
+	{
+		namespace
+		{
+			static uint32_t constexpr NoAlpha = ~0u;
+			static uint32_t constexpr EncodeTableSize = 4096u;
+			// Below this rows count, a level is filtered by a single thread.
+			static uint32_t constexpr MinRowsPerThread = 16u;
+
+			struct FormatDesc
+			{
+				uint32_t components;
+				uint32_t alpha;
+				bool isFloat;
+				bool isSrgb;
+			};
+
+			bool getFormatDesc( PixelFormat format
+				, FormatDesc & desc )
+			{
+				switch ( format )
+				{
+				case PixelFormat::eR8_UNORM:
+					desc = { 1u, NoAlpha, false, false };
+					return true;
+				case PixelFormat::eR8_SRGB:
+					desc = { 1u, NoAlpha, false, true };
+					return true;
+				case PixelFormat::eR8G8_UNORM:
+					desc = { 2u, 1u, false, false };
+					return true;
+				case PixelFormat::eR8G8_SRGB:
+					desc = { 2u, 1u, false, true };
+					return true;
+				case PixelFormat::eR8G8B8_UNORM:
+				case PixelFormat::eB8G8R8_UNORM:
+					desc = { 3u, NoAlpha, false, false };
+					return true;
+				case PixelFormat::eR8G8B8_SRGB:
+				case PixelFormat::eB8G8R8_SRGB:
+					desc = { 3u, NoAlpha, false, true };
+					return true;
+				case PixelFormat::eR8G8B8A8_UNORM:
+				case PixelFormat::eB8G8R8A8_UNORM:
+				case PixelFormat::eA8B8G8R8_UNORM:
+					desc = { 4u, 3u, false, false };
+					return true;
+				case PixelFormat::eR8G8B8A8_SRGB:
+				case PixelFormat::eB8G8R8A8_SRGB:
+				case PixelFormat::eA8B8G8R8_SRGB:
+					desc = { 4u, 3u, false, true };
+					return true;
+				case PixelFormat::eR32_SFLOAT:
+					desc = { 1u, NoAlpha, true, false };
+					return true;
+				case PixelFormat::eR32G32_SFLOAT:
+					desc = { 2u, NoAlpha, true, false };
+					return true;
+				case PixelFormat::eR32G32B32_SFLOAT:
+					desc = { 3u, NoAlpha, true, false };
+					return true;
+				case PixelFormat::eR32G32B32A32_SFLOAT:
+					desc = { 4u, 3u, true, false };
+					return true;
+				default:
+					return false;
+				}
+			}
+
+			struct SrgbTables
+			{
+				SrgbTables()
+				{
+					for ( uint32_t i = 0u; i < decode.size(); ++i )
+					{
+						auto value = float( i ) / 255.0f;
+						decode[i] = value <= 0.04045f
+							? value / 12.92f
+							: std::pow( ( value + 0.055f ) / 1.055f, 2.4f );
+					}
+
+					for ( uint32_t i = 0u; i < encode.size(); ++i )
+					{
+						auto value = float( i ) / float( EncodeTableSize - 1u );
+						value = value <= 0.0031308f
+							? value * 12.92f
+							: 1.055f * std::pow( value, 1.0f / 2.4f ) - 0.055f;
+						encode[i] = uint8_t( std::min( 255.0f, value * 255.0f + 0.5f ) );
+					}
+				}
+
+				float toLinear( uint8_t value )const
+				{
+					return decode[value];
+				}
+
+				uint8_t toSrgb( float value )const
+				{
+					return encode[uint32_t( std::min( 1.0f, std::max( 0.0f, value ) ) * float( EncodeTableSize - 1u ) + 0.5f )];
+				}
+
+				std::array< float, 256u > decode;
+				std::array< uint8_t, EncodeTableSize > encode;
+			};
+
+			SrgbTables const & getSrgbTables()
+			{
+				static SrgbTables const tables;
+				return tables;
+			}
+
+			struct LevelDesc
+			{
+				Size srcSize;
+				Size dstSize;
+				FormatDesc format;
+			};
+
+			template< typename FuncT >
+			void dispatchRows( uint32_t rows
+				, uint32_t threadsCount
+				, FuncT filterRows )
+			{
+				parallelFor( rows
+					, std::max( 1u, std::min( threadsCount, rows / MinRowsPerThread ) )
+					, [&filterRows]( uint32_t part, size_t begin, size_t end )
+					{
+						filterRows( uint32_t( begin ), uint32_t( end ) );
+					} );
+			}
+
+			template< typename ComponentT, typename FilterT >
+			void filterLevelT( LevelDesc const & level
+				, ComponentT const * src
+				, ComponentT * dst
+				, uint32_t threadsCount
+				, FilterT filter )
+			{
+				auto components = level.format.components;
+				auto srcStride = level.srcSize.getWidth() * components;
+				auto maxX = level.srcSize.getWidth() - 1u;
+				auto maxY = level.srcSize.getHeight() - 1u;
+				dispatchRows( level.dstSize.getHeight()
+					, threadsCount
+					, [&]( uint32_t begin, uint32_t end )
+					{
+						for ( uint32_t y = begin; y < end; ++y )
+						{
+							auto row0 = src + std::min( y * 2u, maxY ) * srcStride;
+							auto row1 = src + std::min( y * 2u + 1u, maxY ) * srcStride;
+							auto out = dst + y * level.dstSize.getWidth() * components;
+
+							for ( uint32_t x = 0u; x < level.dstSize.getWidth(); ++x )
+							{
+								auto x0 = std::min( x * 2u, maxX ) * components;
+								auto x1 = std::min( x * 2u + 1u, maxX ) * components;
+
+								for ( uint32_t c = 0u; c < components; ++c )
+								{
+									*out++ = filter( c
+										, row0[x0 + c]
+										, row0[x1 + c]
+										, row1[x0 + c]
+										, row1[x1 + c] );
+								}
+							}
+						}
+					} );
+			}
+
+			void filterLevel( LevelDesc const & level
+				, uint8_t const * src
+				, uint8_t * dst
+				, bool gammaCorrect
+				, uint32_t threadsCount )
+			{
+				if ( level.format.isFloat )
+				{
+					filterLevelT( level
+						, reinterpret_cast< float const * >( src )
+						, reinterpret_cast< float * >( dst )
+						, threadsCount
+						, []( uint32_t, float a, float b, float c, float d )
+						{
+							return ( a + b + c + d ) * 0.25f;
+						} );
+				}
+				else if ( gammaCorrect )
+				{
+					auto & tables = getSrgbTables();
+					auto alpha = level.format.alpha;
+					filterLevelT( level
+						, src
+						, dst
+						, threadsCount
+						, [&tables, alpha]( uint32_t component, uint8_t a, uint8_t b, uint8_t c, uint8_t d )
+						{
+							if ( component == alpha )
+							{
+								return uint8_t( ( uint32_t( a ) + b + c + d + 2u ) / 4u );
+							}
+
+							return tables.toSrgb( ( tables.toLinear( a )
+								+ tables.toLinear( b )
+								+ tables.toLinear( c )
+								+ tables.toLinear( d ) ) * 0.25f );
+						} );
+				}
+				else
+				{
+					filterLevelT( level
+						, src
+						, dst
+						, threadsCount
+						, []( uint32_t, uint8_t a, uint8_t b, uint8_t c, uint8_t d )
+						{
+							return uint8_t( ( uint32_t( a ) + b + c + d + 2u ) / 4u );
+						} );
+				}
+			}
+		}
+
+		bool isMipmapGenerationSupported( PixelFormat format )
+		{
+			FormatDesc desc;
+			return getFormatDesc( format, desc );
+		}
+
+		bool generateMipmaps( PxBufferBase & buffer
+			, MipmapGenerationOptions const & options )
+		{
+			FormatDesc desc;
+
+			if ( !getFormatDesc( buffer.getFormat(), desc ) )
+			{
+				return false;
+			}
+
+			auto threadsCount = options.threadsCount
+				? options.threadsCount
+				: getParallelThreadsCount();
+			auto gammaCorrect = !desc.isFloat
+				&& ( options.gammaCorrect || desc.isSrgb );
+			auto extent = VkExtent3D{ buffer.getWidth(), buffer.getHeight(), 1u };
+			auto format = VkFormat( buffer.getFormat() );
+			auto blockSize = ashes::getBlockSize( format );
+			auto align = uint32_t( getBytesPerPixel( buffer.getFormat() ) );
+			auto data = buffer.getPtr();
+
+			for ( uint32_t layer = 0u; layer < buffer.getLayers(); ++layer )
+			{
+				auto src = data;
+				data += ashes::getSize( format, extent, blockSize, 0u, align );
+
+				for ( uint32_t level = 1u; level < buffer.getLevels(); ++level )
+				{
+					LevelDesc levelDesc{ Size{ std::max( 1u, extent.width >> ( level - 1u ) ), std::max( 1u, extent.height >> ( level - 1u ) ) }
+						, Size{ std::max( 1u, extent.width >> level ), std::max( 1u, extent.height >> level ) }
+						, desc };
+					filterLevel( levelDesc
+						, src
+						, data
+						, gammaCorrect
+						, threadsCount );
+					src = data;
+					data += ashes::getSize( format, extent, blockSize, level, align );
+				}
+			}
+
+			return true;
+		}
+	}
+}
@@ -0,0 +1,455 @@
+#include "CastorUtils/Graphics/OcclusionBuffer.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_set>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define CU_OcclusionBufferSSE2 1
+#	include <emmintrin.h>
+#else
+#	define CU_OcclusionBufferSSE2 0
+#endif
+
+namespace castor
+{
+	namespace
+	{
+		// Under this triangles count, the threads creation costs more than the rasterisation itself.
+		static size_t constexpr MinParallelTriangles = 2048u;
+		// The vertices nearer than this, in clip space W, are considered as crossing the near plane.
+		static float constexpr MinClipW = 1.0e-5f;
+
+		struct ClipPosition
+		{
+			float x;
+			float y;
+			float z;
+			float w;
+		};
+
+		inline ClipPosition project( float const * mtx
+			, Point3f const & position )
+		{
+			return ClipPosition
+			{
+				mtx[0] * position[0] + mtx[4] * position[1] + mtx[ 8] * position[2] + mtx[12],
+				mtx[1] * position[0] + mtx[5] * position[1] + mtx[ 9] * position[2] + mtx[13],
+				mtx[2] * position[0] + mtx[6] * position[1] + mtx[10] * position[2] + mtx[14],
+				mtx[3] * position[0] + mtx[7] * position[1] + mtx[11] * position[2] + mtx[15],
+			};
+		}
+
+		// Edge function a * x + b * y + c, positive inside of a counter clockwise triangle.
+		// On the occluder silhouette, a pixel is covered only if the triangle covers it entirely,
+		// so that an object seen past the occluder's edge is never culled.
+		// An inner edge is covered on its other side by the neighbour triangle, so the pixel center is tested,
+		// and the triangles sharing it leave no crack.
+		struct Edge
+		{
+			Edge( float x0, float y0, float x1, float y1, bool inner )
+				: a{ y0 - y1 }
+				, b{ x1 - x0 }
+				, c{ -( a * x0 + b * y0 ) }
+			{
+				// Evaluated from the pixel integer coordinates, at its center for an inner edge,
+				// at its corner where the function is the lowest otherwise.
+				c += inner
+					? ( a + b ) * 0.5f
+					: std::min( a, 0.0f ) + std::min( b, 0.0f );
+			}
+
+			float a;
+			float b;
+			float c;
+		};
+	}
+
+	OcclusionBuffer::OcclusionBuffer( uint32_t width
+		, uint32_t height )
+		: m_width{ width }
+		, m_height{ height }
+		, m_tilesX{ ( width + TileSize - 1u ) / TileSize }
+		, m_tilesY{ ( height + TileSize - 1u ) / TileSize }
+		, m_bins( m_tilesX * m_tilesY )
+	{
+		CU_Require( width > 0u && height > 0u );
+
+		do
+		{
+			m_sizes.emplace_back( width, height );
+			m_levels.emplace_back( width * height, FarDepth );
+			width = std::max( 1u, ( width + 1u ) / 2u );
+			height = std::max( 1u, ( height + 1u ) / 2u );
+		}
+		while ( m_sizes.back().first > 1u || m_sizes.back().second > 1u );
+	}
+
+	void OcclusionBuffer::clear( Matrix4x4f const & viewProjection )
+	{
+		m_viewProjection = viewProjection;
+		m_triangles.clear();
+
+		for ( auto & level : m_levels )
+		{
+			std::fill( level.begin(), level.end(), FarDepth );
+		}
+	}
+
+	void OcclusionBuffer::addOccluder( std::vector< Point3f > const & positions
+		, std::vector< uint32_t > const & indices
+		, Matrix4x4f const & transform )
+	{
+		CU_Require( indices.size() % 3u == 0u );
+		Matrix4x4f mvp{ m_viewProjection * transform };
+		std::vector< ClipPosition > clipPositions;
+		clipPositions.reserve( positions.size() );
+
+		for ( auto & position : positions )
+		{
+			clipPositions.push_back( project( mvp.constPtr(), position ) );
+		}
+
+		auto halfWidth = float( m_width ) / 2.0f;
+		auto halfHeight = float( m_height ) / 2.0f;
+		auto first = m_triangles.size();
+		std::vector< std::array< uint32_t, 3u > > vertices;
+		std::unordered_set< uint64_t > edges;
+		auto getEdge = []( uint32_t from, uint32_t to )
+		{
+			return ( uint64_t( from ) << 32u ) | uint64_t( to );
+		};
+
+		for ( size_t i = 0u; i < indices.size(); i += 3u )
+		{
+			std::array< ClipPosition const *, 3u > clip
+			{
+				&clipPositions[indices[i + 0u]],
+				&clipPositions[indices[i + 1u]],
+				&clipPositions[indices[i + 2u]],
+			};
+
+			if ( clip[0]->w < MinClipW
+				|| clip[1]->w < MinClipW
+				|| clip[2]->w < MinClipW )
+			{
+				continue;
+			}
+
+			// Trivial rejection, when the three vertices are outside of the same side of the frustum.
+			if ( ( clip[0]->x > clip[0]->w && clip[1]->x > clip[1]->w && clip[2]->x > clip[2]->w )
+				|| ( clip[0]->x < -clip[0]->w && clip[1]->x < -clip[1]->w && clip[2]->x < -clip[2]->w )
+				|| ( clip[0]->y > clip[0]->w && clip[1]->y > clip[1]->w && clip[2]->y > clip[2]->w )
+				|| ( clip[0]->y < -clip[0]->w && clip[1]->y < -clip[1]->w && clip[2]->y < -clip[2]->w ) )
+			{
+				continue;
+			}
+
+			Triangle triangle;
+
+			for ( uint32_t v = 0u; v < 3u; ++v )
+			{
+				triangle.x[v] = ( clip[v]->x / clip[v]->w + 1.0f ) * halfWidth;
+				triangle.y[v] = ( clip[v]->y / clip[v]->w + 1.0f ) * halfHeight;
+				triangle.z[v] = clip[v]->z / clip[v]->w;
+			}
+
+			auto area = ( triangle.x[1] - triangle.x[0] ) * ( triangle.y[2] - triangle.y[0] )
+				- ( triangle.x[2] - triangle.x[0] ) * ( triangle.y[1] - triangle.y[0] );
+
+			// Too small to cover more than a pixel.
+			if ( std::abs( area ) < 1.0f )
+			{
+				continue;
+			}
+
+			std::array< uint32_t, 3u > triangleVertices{ indices[i + 0u], indices[i + 1u], indices[i + 2u] };
+
+			// Both windings are kept, the nearest face wins anyway.
+			if ( area < 0.0f )
+			{
+				std::swap( triangle.x[1], triangle.x[2] );
+				std::swap( triangle.y[1], triangle.y[2] );
+				std::swap( triangle.z[1], triangle.z[2] );
+				std::swap( triangleVertices[1], triangleVertices[2] );
+			}
+
+			triangle.minX = std::max( 0, int32_t( std::floor( std::min( { triangle.x[0], triangle.x[1], triangle.x[2] } ) ) ) );
+			triangle.minY = std::max( 0, int32_t( std::floor( std::min( { triangle.y[0], triangle.y[1], triangle.y[2] } ) ) ) );
+			triangle.maxX = std::min( int32_t( m_width ) - 1, int32_t( std::ceil( std::max( { triangle.x[0], triangle.x[1], triangle.x[2] } ) ) ) );
+			triangle.maxY = std::min( int32_t( m_height ) - 1, int32_t( std::ceil( std::max( { triangle.y[0], triangle.y[1], triangle.y[2] } ) ) ) );
+
+			if ( triangle.minX <= triangle.maxX
+				&& triangle.minY <= triangle.maxY )
+			{
+				m_triangles.push_back( triangle );
+				vertices.push_back( triangleVertices );
+
+				for ( uint32_t v = 0u; v < 3u; ++v )
+				{
+					edges.insert( getEdge( triangleVertices[v], triangleVertices[( v + 1u ) % 3u] ) );
+				}
+			}
+		}
+
+		// All the triangles are now counter clockwise on screen, so the neighbour across an edge
+		// lies on its other side when it goes through this edge the other way around.
+		for ( size_t i = 0u; i < vertices.size(); ++i )
+		{
+			auto & triangleVertices = vertices[i];
+			auto & triangle = m_triangles[first + i];
+			triangle.innerEdges = 0u;
+
+			for ( uint32_t v = 0u; v < 3u; ++v )
+			{
+				if ( edges.find( getEdge( triangleVertices[( v + 2u ) % 3u], triangleVertices[( v + 1u ) % 3u] ) ) != edges.end() )
+				{
+					triangle.innerEdges |= 1u << v;
+				}
+			}
+		}
+	}
+
+	void OcclusionBuffer::rasterise( uint32_t threadsCount )
+	{
+		for ( auto & bin : m_bins )
+		{
+			bin.clear();
+		}
+
+		for ( uint32_t i = 0u; i < m_triangles.size(); ++i )
+		{
+			auto & triangle = m_triangles[i];
+
+			for ( auto y = uint32_t( triangle.minY ) / TileSize; y <= uint32_t( triangle.maxY ) / TileSize; ++y )
+			{
+				for ( auto x = uint32_t( triangle.minX ) / TileSize; x <= uint32_t( triangle.maxX ) / TileSize; ++x )
+				{
+					m_bins[y * m_tilesX + x].push_back( i );
+				}
+			}
+		}
+
+		auto tilesCount = uint32_t( m_bins.size() );
+		threadsCount = m_triangles.size() < MinParallelTriangles
+			? 1u
+			: std::min( tilesCount
+				, threadsCount ? threadsCount : getParallelThreadsCount() );
+
+		if ( threadsCount == 1u )
+		{
+			for ( uint32_t tile = 0u; tile < tilesCount; ++tile )
+			{
+				doRasteriseTile( tile );
+			}
+		}
+		else
+		{
+			// Each tile only writes its own pixels, so the threads just pick the next available tile.
+			std::atomic_uint32_t next{ 0u };
+			auto worker = [this, &next, tilesCount]()
+			{
+				uint32_t tile;
+
+				while ( ( tile = next++ ) < tilesCount )
+				{
+					doRasteriseTile( tile );
+				}
+			};
+			parallelFor( threadsCount
+				, threadsCount
+				, [&worker]( uint32_t part, size_t begin, size_t end )
+				{
+					worker();
+				} );
+		}
+
+		doBuildHierarchy();
+	}
+
+	bool OcclusionBuffer::isVisible( BoundingBox const & box
+		, Matrix4x4f const & transform )const
+	{
+		Matrix4x4f mvp{ m_viewProjection * transform };
+		auto min = box.getMin();
+		auto max = box.getMax();
+		auto minX = std::numeric_limits< float >::max();
+		auto minY = std::numeric_limits< float >::max();
+		auto maxX = std::numeric_limits< float >::lowest();
+		auto maxY = std::numeric_limits< float >::lowest();
+		auto minZ = std::numeric_limits< float >::max();
+
+		for ( uint32_t corner = 0u; corner < 8u; ++corner )
+		{
+			auto clip = project( mvp.constPtr()
+				, Point3f{ ( corner & 1u ) ? max[0] : min[0]
+					, ( corner & 2u ) ? max[1] : min[1]
+					, ( corner & 4u ) ? max[2] : min[2] } );
+
+			if ( clip.w < MinClipW )
+			{
+				return true;
+			}
+
+			minX = std::min( minX, clip.x / clip.w );
+			minY = std::min( minY, clip.y / clip.w );
+			maxX = std::max( maxX, clip.x / clip.w );
+			maxY = std::max( maxY, clip.y / clip.w );
+			minZ = std::min( minZ, clip.z / clip.w );
+		}
+
+		auto x0 = std::max( 0, int32_t( std::floor( ( minX + 1.0f ) * float( m_width ) / 2.0f ) ) );
+		auto y0 = std::max( 0, int32_t( std::floor( ( minY + 1.0f ) * float( m_height ) / 2.0f ) ) );
+		auto x1 = std::min( int32_t( m_width ) - 1, int32_t( std::floor( ( maxX + 1.0f ) * float( m_width ) / 2.0f ) ) );
+		auto y1 = std::min( int32_t( m_height ) - 1, int32_t( std::floor( ( maxY + 1.0f ) * float( m_height ) / 2.0f ) ) );
+
+		if ( x0 > x1 || y0 > y1 )
+		{
+			return true;
+		}
+
+		// The level is chosen so that the rectangle covers at most 3x3 texels.
+		auto size = uint32_t( std::max( x1 - x0, y1 - y0 ) + 1 );
+		uint32_t level = 0u;
+
+		while ( ( 2u << level ) < size
+			&& level + 1u < m_levels.size() )
+		{
+			++level;
+		}
+
+		auto & depths = m_levels[level];
+		auto width = m_sizes[level].first;
+
+		for ( auto y = uint32_t( y0 ) >> level; y <= uint32_t( y1 ) >> level; ++y )
+		{
+			for ( auto x = uint32_t( x0 ) >> level; x <= uint32_t( x1 ) >> level; ++x )
+			{
+				if ( minZ <= depths[y * width + x] )
+				{
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	float OcclusionBuffer::getDepth( uint32_t x
+		, uint32_t y
+		, uint32_t level )const
+	{
+		CU_Require( level < m_levels.size() );
+		CU_Require( x < m_sizes[level].first && y < m_sizes[level].second );
+		return m_levels[level][y * m_sizes[level].first + x];
+	}
+
+	void OcclusionBuffer::doRasteriseTile( uint32_t tile )
+	{
+		auto tileMinX = int32_t( ( tile % m_tilesX ) * TileSize );
+		auto tileMinY = int32_t( ( tile / m_tilesX ) * TileSize );
+		auto tileMaxX = std::min( int32_t( m_width ), tileMinX + int32_t( TileSize ) ) - 1;
+		auto tileMaxY = std::min( int32_t( m_height ), tileMinY + int32_t( TileSize ) ) - 1;
+		auto & depths = m_levels[0];
+
+		for ( auto index : m_bins[tile] )
+		{
+			auto & triangle = m_triangles[index];
+			Edge e0{ triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2], ( triangle.innerEdges & 1u ) != 0u };
+			Edge e1{ triangle.x[2], triangle.y[2], triangle.x[0], triangle.y[0], ( triangle.innerEdges & 2u ) != 0u };
+			Edge e2{ triangle.x[0], triangle.y[0], triangle.x[1], triangle.y[1], ( triangle.innerEdges & 4u ) != 0u };
+			// Depth plane, evaluated at the pixel corner where it is the farthest.
+			auto area = ( triangle.x[1] - triangle.x[0] ) * ( triangle.y[2] - triangle.y[0] )
+				- ( triangle.x[2] - triangle.x[0] ) * ( triangle.y[1] - triangle.y[0] );
+			auto dzdx = ( ( triangle.z[1] - triangle.z[0] ) * ( triangle.y[2] - triangle.y[0] )
+				- ( triangle.z[2] - triangle.z[0] ) * ( triangle.y[1] - triangle.y[0] ) ) / area;
+			auto dzdy = ( ( triangle.z[2] - triangle.z[0] ) * ( triangle.x[1] - triangle.x[0] )
+				- ( triangle.z[1] - triangle.z[0] ) * ( triangle.x[2] - triangle.x[0] ) ) / area;
+			auto z0 = triangle.z[0] - dzdx * triangle.x[0] - dzdy * triangle.y[0]
+				+ std::max( dzdx, 0.0f ) + std::max( dzdy, 0.0f );
+			auto maxZ = std::max( { triangle.z[0], triangle.z[1], triangle.z[2] } );
+			auto minX = std::max( tileMinX, triangle.minX );
+			auto minY = std::max( tileMinY, triangle.minY );
+			auto maxX = std::min( tileMaxX, triangle.maxX );
+			auto maxY = std::min( tileMaxY, triangle.maxY );
+
+			for ( auto y = minY; y <= maxY; ++y )
+			{
+				auto fy = float( y );
+				auto row = depths.data() + y * int32_t( m_width );
+				auto x = minX;
+#if CU_OcclusionBufferSSE2
+				auto const steps = _mm_set_ps( 3.0f, 2.0f, 1.0f, 0.0f );
+				auto const zero = _mm_setzero_ps();
+				auto const vMaxZ = _mm_set1_ps( maxZ );
+
+				for ( ; x + 3 <= maxX; x += 4 )
+				{
+					auto fx = _mm_add_ps( _mm_set1_ps( float( x ) ), steps );
+					auto w0 = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( e0.a ), fx ), _mm_set1_ps( e0.b * fy + e0.c ) );
+					auto w1 = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( e1.a ), fx ), _mm_set1_ps( e1.b * fy + e1.c ) );
+					auto w2 = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( e2.a ), fx ), _mm_set1_ps( e2.b * fy + e2.c ) );
+					auto inside = _mm_and_ps( _mm_and_ps( _mm_cmpge_ps( w0, zero ), _mm_cmpge_ps( w1, zero ) )
+						, _mm_cmpge_ps( w2, zero ) );
+
+					if ( _mm_movemask_ps( inside ) )
+					{
+						auto z = _mm_min_ps( vMaxZ
+							, _mm_add_ps( _mm_mul_ps( _mm_set1_ps( dzdx ), fx ), _mm_set1_ps( dzdy * fy + z0 ) ) );
+						auto previous = _mm_loadu_ps( row + x );
+						auto result = _mm_min_ps( previous, z );
+						_mm_storeu_ps( row + x
+							, _mm_or_ps( _mm_and_ps( inside, result ), _mm_andnot_ps( inside, previous ) ) );
+					}
+				}
+#endif
+
+				for ( ; x <= maxX; ++x )
+				{
+					auto fx = float( x );
+
+					if ( e0.a * fx + e0.b * fy + e0.c >= 0.0f
+						&& e1.a * fx + e1.b * fy + e1.c >= 0.0f
+						&& e2.a * fx + e2.b * fy + e2.c >= 0.0f )
+					{
+						auto z = std::min( maxZ, dzdx * fx + dzdy * fy + z0 );
+						row[x] = std::min( row[x], z );
+					}
+				}
+			}
+		}
+	}
+
+	void OcclusionBuffer::doBuildHierarchy()
+	{
+		for ( size_t level = 1u; level < m_levels.size(); ++level )
+		{
+			auto & source = m_levels[level - 1u];
+			auto & destination = m_levels[level];
+			auto srcWidth = m_sizes[level - 1u].first;
+			auto srcHeight = m_sizes[level - 1u].second;
+			auto dstWidth = m_sizes[level].first;
+			auto dstHeight = m_sizes[level].second;
+
+			for ( uint32_t y = 0u; y < dstHeight; ++y )
+			{
+				auto y0 = std::min( srcHeight - 1u, y * 2u );
+				auto y1 = std::min( srcHeight - 1u, y * 2u + 1u );
+
+				for ( uint32_t x = 0u; x < dstWidth; ++x )
+				{
+					auto x0 = std::min( srcWidth - 1u, x * 2u );
+					auto x1 = std::min( srcWidth - 1u, x * 2u + 1u );
+					destination[y * dstWidth + x] = std::max( { source[y0 * srcWidth + x0]
+						, source[y0 * srcWidth + x1]
+						, source[y1 * srcWidth + x0]
+						, source[y1 * srcWidth + x1] } );
+				}
+			}
+		}
+	}
+}
@@ -1,5 +1,7 @@
 #include "CastorUtils/Graphics/PixelBuffer.hpp"
 
+#include "CastorUtils/Graphics/BlockCompression.hpp"
+
 #include "CastorUtils/Miscellaneous/BitSize.hpp"
 
 #include <ashes/common/Format.hpp>
@@ -62,12 +64,28 @@ namespace castor
 						, dstBlockSize
 						, level
 						, dstAlign ) );
-					PF::convertBuffer( srcFormat
-						, srcLevel
-						, srcLevelSize
-						, dstFormat
-						, dstLevel
-						, dstLevelSize );
+
+					// The other compressed formats keep going through convertBuffer.
+					if ( PF::isBlockCompressionSupported( dstFormat )
+						&& !PF::isCompressed( srcFormat ) )
+					{
+						PF::compressBuffer( BlockCompressionOptions{}
+							, Size{ std::max( 1u, extent.width >> level ), std::max( 1u, extent.height >> level ) }
+							, srcFormat
+							, srcLevel
+							, dstFormat
+							, dstLevel );
+					}
+					else
+					{
+						PF::convertBuffer( srcFormat
+							, srcLevel
+							, srcLevelSize
+							, dstFormat
+							, dstLevel
+							, dstLevelSize );
+					}
+
 					srcLevelStart += srcLevelSize;
 					dstLevelStart += dstLevelSize;
 				}
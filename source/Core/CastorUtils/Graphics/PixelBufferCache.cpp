@@ -0,0 +1,280 @@
+#include "CastorUtils/Graphics/PixelBufferCache.hpp"
+
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Data/BinaryFile.hpp"
+#include "CastorUtils/Exception/Exception.hpp"
+#include "CastorUtils/Graphics/PixelBufferBase.hpp"
+#include "CastorUtils/Log/LoggerInstance.hpp"
+#include "CastorUtils/Miscellaneous/StringUtils.hpp"
+
+#include <atomic>
+#include <iomanip>
+#include <thread>
+
+namespace castor
+{
+	namespace
+	{
+		static uint32_t constexpr CacheMagic = 0x43585043u; // "CPXC"
+		static uint32_t constexpr CacheVersion = 1u;
+		static xchar const * const CacheExtension = cuT( "cpx" );
+		static xchar const * const TemporaryExtension = cuT( "tmp" );
+
+		struct CacheHeader
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint64_t key;
+			uint32_t format;
+			uint32_t width;
+			uint32_t height;
+			uint32_t layers;
+			uint32_t levels;
+			uint32_t flipped;
+			uint64_t dataSize;
+		};
+
+		Path getTemporaryFilePath( Path const & path )
+		{
+			// Unique per writer, so that concurrent saves of the same entry don't share a file.
+			static std::atomic< uint32_t > counter{ 0u };
+			auto stream = makeStringStream();
+			stream << std::hex << std::hash< std::thread::id >{}( std::this_thread::get_id() )
+				<< cuT( "_" ) << counter++;
+			return Path{ path + cuT( "." ) + stream.str() + cuT( "." ) + TemporaryExtension };
+		}
+	}
+
+	PxBufferCache::PxBufferCache( LoggerInstance & logger
+		, Path directory
+		, uint64_t maxSize )
+		: m_logger{ logger }
+		, m_directory{ std::move( directory ) }
+		, m_maxSize{ maxSize }
+	{
+	}
+
+	PxBufferBaseSPtr PxBufferCache::load( uint64_t key )const
+	{
+		auto path = getFilePath( key );
+
+		if ( !File::fileExists( path ) )
+		{
+			return nullptr;
+		}
+
+		try
+		{
+			BinaryFile file{ path, File::OpenMode::eRead };
+			CacheHeader header{};
+
+			if ( file.read( header ) != sizeof( CacheHeader )
+				|| header.magic != CacheMagic
+				|| header.version != CacheVersion
+				|| header.key != key
+				|| uint64_t( file.getLength() ) != sizeof( CacheHeader ) + header.dataSize )
+			{
+				m_logger.logWarning( makeStringStream() << cuT( "PxBufferCache - Invalid cache entry " ) << path );
+				return nullptr;
+			}
+
+			auto result = PxBufferBase::create( Size{ header.width, header.height }
+				, header.layers
+				, header.levels
+				, PixelFormat( header.format ) );
+
+			if ( result->getSize() != header.dataSize
+				|| file.readArray( result->getPtr(), result->getSize() ) != result->getSize() )
+			{
+				m_logger.logWarning( makeStringStream() << cuT( "PxBufferCache - Invalid cache entry " ) << path );
+				return nullptr;
+			}
+
+			if ( header.flipped )
+			{
+				result->flip();
+			}
+
+			doUseEntry( key, sizeof( CacheHeader ) + header.dataSize );
+			return result;
+		}
+		catch ( Exception & exc )
+		{
+			m_logger.logWarning( makeStringStream() << cuT( "PxBufferCache - Couldn't read " ) << path << cuT( ": " ) << exc.getFullDescription() );
+			return nullptr;
+		}
+	}
+
+	bool PxBufferCache::save( uint64_t key
+		, PxBufferBase const & buffer )const
+	{
+		auto size = sizeof( CacheHeader ) + buffer.getSize();
+
+		if ( size > m_maxSize )
+		{
+			return false;
+		}
+
+		if ( !File::directoryExists( m_directory ) )
+		{
+			File::directoryCreate( m_directory );
+		}
+
+		auto path = getFilePath( key );
+		auto temporary = getTemporaryFilePath( path );
+		bool result = false;
+
+		try
+		{
+			CacheHeader header{ CacheMagic
+				, CacheVersion
+				, key
+				, uint32_t( buffer.getFormat() )
+				, buffer.getWidth()
+				, buffer.getHeight()
+				, buffer.getLayers()
+				, buffer.getLevels()
+				, buffer.isFlipped() ? 1u : 0u
+				, buffer.getSize() };
+			BinaryFile file{ temporary, File::OpenMode::eWrite };
+			result = file.write( header ) == sizeof( CacheHeader )
+				&& file.writeArray( buffer.getConstPtr(), buffer.getSize() ) == buffer.getSize();
+		}
+		catch ( Exception & exc )
+		{
+			m_logger.logWarning( makeStringStream() << cuT( "PxBufferCache - Couldn't write " ) << path << cuT( ": " ) << exc.getFullDescription() );
+		}
+
+		// The file is closed, the complete entry can replace the previous one.
+		result = result
+			&& File::moveFileName( temporary, path );
+
+		if ( !result )
+		{
+			// Don't leave a truncated entry behind.
+			File::deleteFile( temporary );
+			return false;
+		}
+
+		m_logger.logDebug( makeStringStream() << cuT( "PxBufferCache - Saved " ) << path );
+		doUseEntry( key, size );
+		doEvictEntries();
+		return true;
+	}
+
+	void PxBufferCache::clear()const
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		if ( File::directoryExists( m_directory ) )
+		{
+			for ( auto & file : File::filterDirectoryFiles( m_directory
+				, []( Path const & folder, String const & name )
+				{
+					auto extension = Path{ name }.getExtension();
+					return extension == CacheExtension
+						|| extension == TemporaryExtension;
+				} ) )
+			{
+				File::deleteFile( file );
+			}
+		}
+
+		m_entries.clear();
+		m_used.clear();
+		m_size = 0u;
+		m_listed = true;
+	}
+
+	uint64_t PxBufferCache::getSize()const
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+		doListEntries();
+		return m_size;
+	}
+
+	Path PxBufferCache::getFilePath( uint64_t key )const
+	{
+		auto stream = makeStringStream();
+		stream << std::hex << std::setw( 16 ) << std::setfill( cuT( '0' ) ) << key;
+		return m_directory / ( stream.str() + cuT( "." ) + CacheExtension );
+	}
+
+	void PxBufferCache::doListEntries()const
+	{
+		if ( m_listed )
+		{
+			return;
+		}
+
+		m_listed = true;
+
+		if ( !File::directoryExists( m_directory ) )
+		{
+			return;
+		}
+
+		// The previous sessions use order isn't known, their entries are the first evicted.
+		for ( auto & path : File::filterDirectoryFiles( m_directory
+			, []( Path const & folder, String const & name )
+			{
+				return Path{ name }.getExtension() == CacheExtension;
+			} ) )
+		{
+			try
+			{
+				auto key = std::stoull( string::stringCast< char >( path.getFileName() ), nullptr, 16 );
+				BinaryFile file{ path, File::OpenMode::eRead };
+				auto & entry = m_entries.emplace( key, Entry{ uint64_t( file.getLength() ), m_used.end() } ).first->second;
+
+				if ( entry.used == m_used.end() )
+				{
+					entry.used = m_used.insert( m_used.end(), key );
+					m_size += entry.size;
+				}
+			}
+			catch ( std::exception & )
+			{
+				m_logger.logWarning( makeStringStream() << cuT( "PxBufferCache - Couldn't list " ) << path );
+			}
+		}
+	}
+
+	void PxBufferCache::doUseEntry( uint64_t key
+		, uint64_t size )const
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+		doListEntries();
+		doRemoveEntry( key );
+		m_entries.emplace( key, Entry{ size, m_used.insert( m_used.end(), key ) } );
+		m_size += size;
+	}
+
+	void PxBufferCache::doEvictEntries()const
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		// The most recently used entry, just saved, is always kept.
+		while ( m_size > m_maxSize
+			&& m_used.size() > 1u )
+		{
+			auto key = m_used.front();
+			auto path = getFilePath( key );
+			m_logger.logDebug( makeStringStream() << cuT( "PxBufferCache - Evicted " ) << path );
+			File::deleteFile( path );
+			doRemoveEntry( key );
+		}
+	}
+
+	void PxBufferCache::doRemoveEntry( uint64_t key )const
+	{
+		auto it = m_entries.find( key );
+
+		if ( it != m_entries.end() )
+		{
+			m_size -= it->second.size;
+			m_used.erase( it->second.used );
+			m_entries.erase( it );
+		}
+	}
+}
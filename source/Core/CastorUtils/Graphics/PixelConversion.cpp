@@ -0,0 +1,1037 @@
+#include "CastorUtils/Graphics/PixelFormat.hpp"
+#include "CastorUtils/Miscellaneous/CpuInformations.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define CU_PixelConversionSSE2 1
+#	include <emmintrin.h>
+#	if defined( __GNUC__ ) || defined( __clang__ )
+// The AVX2 kernels are compiled for that target only, and selected at run time.
+#		define CU_PixelConversionAVX2 1
+#		define CU_TargetAVX2 __attribute__( ( target( "avx2" ) ) )
+#		include <immintrin.h>
+#	elif defined( _MSC_VER )
+#		define CU_PixelConversionAVX2 1
+#		define CU_TargetAVX2
+#		include <immintrin.h>
+#	else
+#		define CU_PixelConversionAVX2 0
+#	endif
+#else
+#	define CU_PixelConversionSSE2 0
+#	define CU_PixelConversionAVX2 0
+#endif
+
+namespace castor
+{
+	namespace PF
+	{
+		namespace
+		{
+			// Under this pixels count per thread, the threads creation costs more than the conversion itself.
+			static size_t constexpr MinPixelsPerThread = 131072u;
+			// The pixels count staged through the intermediate RGBA buffers, they stay in L1.
+			static size_t constexpr BlockPixels = 256u;
+
+			//*********************************************************************************************
+			// Scalar kernels, they reproduce PixelComponents' conversions, and process the SIMD kernels tails.
+
+			template< size_t SizeT >
+			void copyPixels( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				std::memcpy( dst, src, count * SizeT );
+			}
+
+			void swapRgb( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i, src += 3u, dst += 3u )
+				{
+					dst[0] = src[2];
+					dst[1] = src[1];
+					dst[2] = src[0];
+				}
+			}
+
+			void swapRgba( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i, src += 4u, dst += 4u )
+				{
+					dst[0] = src[2];
+					dst[1] = src[1];
+					dst[2] = src[0];
+					dst[3] = src[3];
+				}
+			}
+
+			template< bool SwapT >
+			void expandRgb( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i, src += 3u, dst += 4u )
+				{
+					dst[0] = src[SwapT ? 2u : 0u];
+					dst[1] = src[1];
+					dst[2] = src[SwapT ? 0u : 2u];
+					dst[3] = 0xFF;
+				}
+			}
+
+			template< bool SwapT >
+			void shrinkRgba( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i, src += 4u, dst += 3u )
+				{
+					dst[0] = src[SwapT ? 2u : 0u];
+					dst[1] = src[1];
+					dst[2] = src[SwapT ? 0u : 2u];
+				}
+			}
+
+			void expandGrey3( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i, dst += 3u )
+				{
+					dst[0] = src[i];
+					dst[1] = src[i];
+					dst[2] = src[i];
+				}
+			}
+
+			void expandGrey4( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i, dst += 4u )
+				{
+					dst[0] = src[i];
+					dst[1] = src[i];
+					dst[2] = src[i];
+					dst[3] = 0xFF;
+				}
+			}
+
+			void expandGreyAlpha( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i, src += 2u, dst += 4u )
+				{
+					dst[0] = src[0];
+					dst[1] = src[0];
+					dst[2] = src[0];
+					dst[3] = src[1];
+				}
+			}
+
+			void u8ToF32( uint8_t const * src
+				, float * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					dst[i] = src[i] / 255.0f;
+				}
+			}
+
+			void f32ToU8( float const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					dst[i] = uint8_t( src[i] * 255 );
+				}
+			}
+
+			void f32ToF16( float const * src
+				, uint16_t * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					floatToHalf( &dst[i], src[i] );
+				}
+			}
+
+			void f16ToF32( uint16_t const * src
+				, float * dst
+				, size_t count )
+			{
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					halfToFloat( dst[i], &src[i] );
+				}
+			}
+
+			void u8ToF16( uint8_t const * src
+				, uint16_t * dst
+				, size_t count )
+			{
+				// Only 256 possible values, converted once through the scalar path.
+				static std::array< uint16_t, 256u > const lookup = []()
+				{
+					std::array< uint16_t, 256u > result;
+
+					for ( uint32_t i = 0u; i < 256u; ++i )
+					{
+						floatToHalf( &result[i], i / 255.0f );
+					}
+
+					return result;
+				}();
+
+				for ( size_t i = 0u; i < count; ++i )
+				{
+					dst[i] = lookup[src[i]];
+				}
+			}
+
+#if CU_PixelConversionSSE2
+
+			//*********************************************************************************************
+			// SSE2 kernels, the 3 bytes pixels shuffles need SSSE3 and are left to the scalar kernels.
+
+			void swapRgbaSSE2( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				auto const greenAlpha = _mm_set1_epi32( int32_t( 0xFF00FF00u ) );
+				auto const redBlue = _mm_set1_epi32( 0x00FF00FF );
+				size_t i = 0u;
+
+				for ( ; i + 4u <= count; i += 4u )
+				{
+					auto pixels = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + i * 4u ) );
+					auto rb = _mm_and_si128( pixels, redBlue );
+					rb = _mm_or_si128( _mm_slli_epi32( rb, 16 ), _mm_srli_epi32( rb, 16 ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + i * 4u )
+						, _mm_or_si128( _mm_and_si128( pixels, greenAlpha ), rb ) );
+				}
+
+				swapRgba( src + i * 4u, dst + i * 4u, count - i );
+			}
+
+			void expandGrey4SSE2( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				auto const alpha = _mm_set1_epi8( -1 );
+				size_t i = 0u;
+
+				for ( ; i + 16u <= count; i += 16u )
+				{
+					auto grey = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + i ) );
+					// (l, l) and (l, a) pairs, interleaved into (l, l, l, a).
+					auto lo = _mm_unpacklo_epi8( grey, grey );
+					auto loAlpha = _mm_unpacklo_epi8( grey, alpha );
+					auto hi = _mm_unpackhi_epi8( grey, grey );
+					auto hiAlpha = _mm_unpackhi_epi8( grey, alpha );
+					auto out = reinterpret_cast< __m128i * >( dst + i * 4u );
+					_mm_storeu_si128( out + 0, _mm_unpacklo_epi16( lo, loAlpha ) );
+					_mm_storeu_si128( out + 1, _mm_unpackhi_epi16( lo, loAlpha ) );
+					_mm_storeu_si128( out + 2, _mm_unpacklo_epi16( hi, hiAlpha ) );
+					_mm_storeu_si128( out + 3, _mm_unpackhi_epi16( hi, hiAlpha ) );
+				}
+
+				expandGrey4( src + i, dst + i * 4u, count - i );
+			}
+
+			void expandGreyAlphaSSE2( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				auto const greyMask = _mm_set1_epi16( 0x00FF );
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					auto pixels = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + i * 2u ) );
+					auto grey = _mm_and_si128( pixels, greyMask );
+					// Low words are (l, l), high words are (l, a).
+					auto lo = _mm_or_si128( grey, _mm_slli_epi16( grey, 8 ) );
+					auto hi = _mm_or_si128( grey, _mm_andnot_si128( greyMask, pixels ) );
+					auto out = reinterpret_cast< __m128i * >( dst + i * 4u );
+					_mm_storeu_si128( out + 0, _mm_unpacklo_epi16( lo, hi ) );
+					_mm_storeu_si128( out + 1, _mm_unpackhi_epi16( lo, hi ) );
+				}
+
+				expandGreyAlpha( src + i * 2u, dst + i * 4u, count - i );
+			}
+
+			void u8ToF32SSE2( uint8_t const * src
+				, float * dst
+				, size_t count )
+			{
+				// A division, not a multiplication by the inverse, to give the scalar results.
+				auto const max = _mm_set1_ps( 255.0f );
+				auto const zero = _mm_setzero_si128();
+				size_t i = 0u;
+
+				for ( ; i + 16u <= count; i += 16u )
+				{
+					auto bytes = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + i ) );
+					auto lo = _mm_unpacklo_epi8( bytes, zero );
+					auto hi = _mm_unpackhi_epi8( bytes, zero );
+					_mm_storeu_ps( dst + i + 0u, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( lo, zero ) ), max ) );
+					_mm_storeu_ps( dst + i + 4u, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( lo, zero ) ), max ) );
+					_mm_storeu_ps( dst + i + 8u, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( hi, zero ) ), max ) );
+					_mm_storeu_ps( dst + i + 12u, _mm_div_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( hi, zero ) ), max ) );
+				}
+
+				u8ToF32( src + i, dst + i, count - i );
+			}
+
+			inline __m128i toByteSSE2( float const * src )
+			{
+				// Truncated and wrapped to 8 bits, as the scalar uint8_t( value * 255 ).
+				return _mm_and_si128( _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( src ), _mm_set1_ps( 255.0f ) ) )
+					, _mm_set1_epi32( 0xFF ) );
+			}
+
+			void f32ToU8SSE2( float const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				size_t i = 0u;
+
+				for ( ; i + 16u <= count; i += 16u )
+				{
+					auto lo = _mm_packs_epi32( toByteSSE2( src + i + 0u ), toByteSSE2( src + i + 4u ) );
+					auto hi = _mm_packs_epi32( toByteSSE2( src + i + 8u ), toByteSSE2( src + i + 12u ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + i ), _mm_packus_epi16( lo, hi ) );
+				}
+
+				f32ToU8( src + i, dst + i, count - i );
+			}
+
+			// floatToHalf on 4 lanes, the halves are in the low words.
+			inline __m128i floatToHalfSSE2( __m128 value )
+			{
+				auto bits = _mm_castps_si128( value );
+				auto sign = _mm_and_si128( _mm_srli_epi32( bits, 16 ), _mm_set1_epi32( 0x8000 ) );
+				auto abs = _mm_and_si128( bits, _mm_set1_epi32( 0x7FFFFFFF ) );
+				// Normalised: rebiased exponent and mantissa, rounded half up on the first dropped bit.
+				auto normal = _mm_add_epi32( _mm_sub_epi32( _mm_srli_epi32( abs, 13 ), _mm_set1_epi32( 112 << 10 ) )
+					, _mm_and_si128( _mm_srli_epi32( abs, 12 ), _mm_set1_epi32( 1 ) ) );
+				// Underflow: the mantissa with its hidden bit, shifted by the exponent (exactly, by a power of 2 scale), and rounded half up.
+				auto shifted = _mm_cvttps_epi32( _mm_mul_ps( _mm_castsi128_ps( abs ), _mm_set1_ps( 33554432.0f ) ) );
+				auto denormal = _mm_srli_epi32( _mm_add_epi32( shifted, _mm_set1_epi32( 1 ) ), 1 );
+				auto isDenormal = _mm_cmplt_epi32( abs, _mm_set1_epi32( 0x38800000 ) );
+				auto isInf = _mm_cmpgt_epi32( abs, _mm_set1_epi32( 0x477FFFFF ) );
+				auto isNaN = _mm_cmpgt_epi32( abs, _mm_set1_epi32( 0x7F800000 ) );
+				auto result = _mm_or_si128( _mm_and_si128( isInf, _mm_set1_epi32( 0x7C00 ) )
+					, _mm_andnot_si128( isInf, normal ) );
+				result = _mm_or_si128( _mm_and_si128( isDenormal, denormal )
+					, _mm_andnot_si128( isDenormal, result ) );
+				result = _mm_or_si128( result, sign );
+				return _mm_or_si128( _mm_and_si128( isNaN, _mm_set1_epi32( 0xFE00 ) )
+					, _mm_andnot_si128( isNaN, result ) );
+			}
+
+			// halfToFloat on 4 lanes, the halves are in the low words.
+			inline __m128 halfToFloatSSE2( __m128i value )
+			{
+				auto sign = _mm_slli_epi32( _mm_and_si128( value, _mm_set1_epi32( 0x8000 ) ), 16 );
+				auto abs = _mm_and_si128( value, _mm_set1_epi32( 0x7FFF ) );
+				auto normal = _mm_add_epi32( _mm_slli_epi32( abs, 13 ), _mm_set1_epi32( 112 << 23 ) );
+				// Denormals (and zeroes) are exactly their mantissa times 2^-24.
+				auto denormal = _mm_castps_si128( _mm_mul_ps( _mm_cvtepi32_ps( abs ), _mm_set1_ps( 1.0f / 16777216.0f ) ) );
+				auto isDenormal = _mm_cmplt_epi32( abs, _mm_set1_epi32( 0x0400 ) );
+				auto isInf = _mm_cmpgt_epi32( abs, _mm_set1_epi32( 0x7BFF ) );
+				auto isNaN = _mm_cmpgt_epi32( abs, _mm_set1_epi32( 0x7C00 ) );
+				auto result = _mm_or_si128( _mm_and_si128( isInf, _mm_set1_epi32( 0x7F800000 ) )
+					, _mm_andnot_si128( isInf, normal ) );
+				result = _mm_or_si128( _mm_and_si128( isDenormal, denormal )
+					, _mm_andnot_si128( isDenormal, result ) );
+				result = _mm_or_si128( result, sign );
+				return _mm_castsi128_ps( _mm_or_si128( _mm_and_si128( isNaN, _mm_set1_epi32( int32_t( 0xFFC00000u ) ) )
+					, _mm_andnot_si128( isNaN, result ) ) );
+			}
+
+			inline __m128i signExtendSSE2( __m128i value )
+			{
+				return _mm_srai_epi32( _mm_slli_epi32( value, 16 ), 16 );
+			}
+
+			void f32ToF16SSE2( float const * src
+				, uint16_t * dst
+				, size_t count )
+			{
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					// Sign extended, for the signed saturation to keep the 16 bits.
+					auto lo = signExtendSSE2( floatToHalfSSE2( _mm_loadu_ps( src + i + 0u ) ) );
+					auto hi = signExtendSSE2( floatToHalfSSE2( _mm_loadu_ps( src + i + 4u ) ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + i ), _mm_packs_epi32( lo, hi ) );
+				}
+
+				f32ToF16( src + i, dst + i, count - i );
+			}
+
+			void f16ToF32SSE2( uint16_t const * src
+				, float * dst
+				, size_t count )
+			{
+				auto const zero = _mm_setzero_si128();
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					auto halves = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + i ) );
+					_mm_storeu_ps( dst + i + 0u, halfToFloatSSE2( _mm_unpacklo_epi16( halves, zero ) ) );
+					_mm_storeu_ps( dst + i + 4u, halfToFloatSSE2( _mm_unpackhi_epi16( halves, zero ) ) );
+				}
+
+				f16ToF32( src + i, dst + i, count - i );
+			}
+
+#endif
+#if CU_PixelConversionAVX2
+
+			//*********************************************************************************************
+			// AVX2 kernels, the bytes shuffles stay inside each 128 bits lane.
+
+			CU_TargetAVX2 inline __m256i loadRgbAVX2( uint8_t const * src )
+			{
+				// Pixels 0-3 in the low lane, 4-7 in the high one, 4 bytes are read past the 8th pixel.
+				return _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) ) )
+					, _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + 12u ) )
+					, 1 );
+			}
+
+			CU_TargetAVX2 inline void storeRgbAVX2( uint8_t * dst
+				, __m256i pixels )
+			{
+				// 4 garbage bytes are written past the 8th pixel, the caller keeps them in its range.
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), _mm256_castsi256_si128( pixels ) );
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + 12u ), _mm256_extracti128_si256( pixels, 1 ) );
+			}
+
+			CU_TargetAVX2 void swapRgbaAVX2( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				auto const shuffle = _mm256_setr_epi8( 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15
+					, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15 );
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					auto pixels = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( src + i * 4u ) );
+					_mm256_storeu_si256( reinterpret_cast< __m256i * >( dst + i * 4u )
+						, _mm256_shuffle_epi8( pixels, shuffle ) );
+				}
+
+				swapRgba( src + i * 4u, dst + i * 4u, count - i );
+			}
+
+			template< bool SwapT >
+			CU_TargetAVX2 void expandRgbAVX2( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				auto const shuffle = SwapT
+					? _mm256_setr_epi8( 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1
+						, 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1 )
+					: _mm256_setr_epi8( 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+						, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1 );
+				auto const alpha = _mm256_set1_epi32( int32_t( 0xFF000000u ) );
+				size_t i = 0u;
+
+				for ( ; i + 10u <= count; i += 8u )
+				{
+					auto pixels = _mm256_shuffle_epi8( loadRgbAVX2( src + i * 3u ), shuffle );
+					_mm256_storeu_si256( reinterpret_cast< __m256i * >( dst + i * 4u )
+						, _mm256_or_si256( pixels, alpha ) );
+				}
+
+				expandRgb< SwapT >( src + i * 3u, dst + i * 4u, count - i );
+			}
+
+			template< bool SwapT >
+			CU_TargetAVX2 void shrinkRgbaAVX2( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				auto const shuffle = SwapT
+					? _mm256_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+						, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 )
+					: _mm256_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+						, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 );
+				size_t i = 0u;
+
+				for ( ; i + 10u <= count; i += 8u )
+				{
+					auto pixels = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( src + i * 4u ) );
+					storeRgbAVX2( dst + i * 3u, _mm256_shuffle_epi8( pixels, shuffle ) );
+				}
+
+				shrinkRgba< SwapT >( src + i * 4u, dst + i * 3u, count - i );
+			}
+
+			CU_TargetAVX2 void expandGrey4AVX2( uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				auto const alpha = _mm256_set1_epi32( int32_t( 0xFF000000u ) );
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					auto grey = _mm256_cvtepu8_epi32( _mm_loadl_epi64( reinterpret_cast< __m128i const * >( src + i ) ) );
+					auto pixels = _mm256_or_si256( _mm256_or_si256( grey, _mm256_slli_epi32( grey, 8 ) )
+						, _mm256_or_si256( _mm256_slli_epi32( grey, 16 ), alpha ) );
+					_mm256_storeu_si256( reinterpret_cast< __m256i * >( dst + i * 4u ), pixels );
+				}
+
+				expandGrey4( src + i, dst + i * 4u, count - i );
+			}
+
+			CU_TargetAVX2 void u8ToF32AVX2( uint8_t const * src
+				, float * dst
+				, size_t count )
+			{
+				auto const max = _mm256_set1_ps( 255.0f );
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					auto values = _mm256_cvtepu8_epi32( _mm_loadl_epi64( reinterpret_cast< __m128i const * >( src + i ) ) );
+					_mm256_storeu_ps( dst + i, _mm256_div_ps( _mm256_cvtepi32_ps( values ), max ) );
+				}
+
+				u8ToF32( src + i, dst + i, count - i );
+			}
+
+			CU_TargetAVX2 inline __m256i toByteAVX2( float const * src )
+			{
+				return _mm256_and_si256( _mm256_cvttps_epi32( _mm256_mul_ps( _mm256_loadu_ps( src ), _mm256_set1_ps( 255.0f ) ) )
+					, _mm256_set1_epi32( 0xFF ) );
+			}
+
+			CU_TargetAVX2 void f32ToU8AVX2( float const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				// The packs work per lane, the 4 bytes groups are put back in order.
+				auto const order = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+				size_t i = 0u;
+
+				for ( ; i + 16u <= count; i += 16u )
+				{
+					auto words = _mm256_packs_epi32( toByteAVX2( src + i ), toByteAVX2( src + i + 8u ) );
+					auto bytes = _mm256_permutevar8x32_epi32( _mm256_packus_epi16( words, words ), order );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + i ), _mm256_castsi256_si128( bytes ) );
+				}
+
+				f32ToU8( src + i, dst + i, count - i );
+			}
+
+			// Same as floatToHalfSSE2, on 8 lanes.
+			CU_TargetAVX2 inline __m256i floatToHalfAVX2( __m256 value )
+			{
+				auto bits = _mm256_castps_si256( value );
+				auto sign = _mm256_and_si256( _mm256_srli_epi32( bits, 16 ), _mm256_set1_epi32( 0x8000 ) );
+				auto abs = _mm256_and_si256( bits, _mm256_set1_epi32( 0x7FFFFFFF ) );
+				auto normal = _mm256_add_epi32( _mm256_sub_epi32( _mm256_srli_epi32( abs, 13 ), _mm256_set1_epi32( 112 << 10 ) )
+					, _mm256_and_si256( _mm256_srli_epi32( abs, 12 ), _mm256_set1_epi32( 1 ) ) );
+				auto shifted = _mm256_cvttps_epi32( _mm256_mul_ps( _mm256_castsi256_ps( abs ), _mm256_set1_ps( 33554432.0f ) ) );
+				auto denormal = _mm256_srli_epi32( _mm256_add_epi32( shifted, _mm256_set1_epi32( 1 ) ), 1 );
+				auto isDenormal = _mm256_cmpgt_epi32( _mm256_set1_epi32( 0x38800000 ), abs );
+				auto isInf = _mm256_cmpgt_epi32( abs, _mm256_set1_epi32( 0x477FFFFF ) );
+				auto isNaN = _mm256_cmpgt_epi32( abs, _mm256_set1_epi32( 0x7F800000 ) );
+				auto result = _mm256_blendv_epi8( normal, _mm256_set1_epi32( 0x7C00 ), isInf );
+				result = _mm256_or_si256( _mm256_blendv_epi8( result, denormal, isDenormal ), sign );
+				return _mm256_blendv_epi8( result, _mm256_set1_epi32( 0xFE00 ), isNaN );
+			}
+
+			// Same as halfToFloatSSE2, on 8 lanes.
+			CU_TargetAVX2 inline __m256 halfToFloatAVX2( __m256i value )
+			{
+				auto sign = _mm256_slli_epi32( _mm256_and_si256( value, _mm256_set1_epi32( 0x8000 ) ), 16 );
+				auto abs = _mm256_and_si256( value, _mm256_set1_epi32( 0x7FFF ) );
+				auto normal = _mm256_add_epi32( _mm256_slli_epi32( abs, 13 ), _mm256_set1_epi32( 112 << 23 ) );
+				auto denormal = _mm256_castps_si256( _mm256_mul_ps( _mm256_cvtepi32_ps( abs ), _mm256_set1_ps( 1.0f / 16777216.0f ) ) );
+				auto isDenormal = _mm256_cmpgt_epi32( _mm256_set1_epi32( 0x0400 ), abs );
+				auto isInf = _mm256_cmpgt_epi32( abs, _mm256_set1_epi32( 0x7BFF ) );
+				auto isNaN = _mm256_cmpgt_epi32( abs, _mm256_set1_epi32( 0x7C00 ) );
+				auto result = _mm256_blendv_epi8( normal, _mm256_set1_epi32( 0x7F800000 ), isInf );
+				result = _mm256_or_si256( _mm256_blendv_epi8( result, denormal, isDenormal ), sign );
+				return _mm256_castsi256_ps( _mm256_blendv_epi8( result, _mm256_set1_epi32( int32_t( 0xFFC00000u ) ), isNaN ) );
+			}
+
+			CU_TargetAVX2 void f32ToF16AVX2( float const * src
+				, uint16_t * dst
+				, size_t count )
+			{
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					auto halves = floatToHalfAVX2( _mm256_loadu_ps( src + i ) );
+					auto words = _mm256_permute4x64_epi64( _mm256_packus_epi32( halves, halves ), 0xD8 );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst + i ), _mm256_castsi256_si128( words ) );
+				}
+
+				f32ToF16( src + i, dst + i, count - i );
+			}
+
+			CU_TargetAVX2 void f16ToF32AVX2( uint16_t const * src
+				, float * dst
+				, size_t count )
+			{
+				size_t i = 0u;
+
+				for ( ; i + 8u <= count; i += 8u )
+				{
+					auto halves = _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast< __m128i const * >( src + i ) ) );
+					_mm256_storeu_ps( dst + i, halfToFloatAVX2( halves ) );
+				}
+
+				f16ToF32( src + i, dst + i, count - i );
+			}
+
+#endif
+
+			//*********************************************************************************************
+
+			using PixelsKernel = void( * )( uint8_t const * src, uint8_t * dst, size_t count );
+
+			struct Kernels
+			{
+				// Pixels kernels, the count is in pixels.
+				PixelsKernel swapRgb;
+				PixelsKernel swapRgba;
+				PixelsKernel expandRgb;
+				PixelsKernel expandBgr;
+				PixelsKernel shrinkRgba;
+				PixelsKernel shrinkBgra;
+				PixelsKernel expandGrey3;
+				PixelsKernel expandGrey4;
+				PixelsKernel expandGreyAlpha;
+				// Components kernels, the count is in components.
+				void( *u8ToF32 )( uint8_t const * src, float * dst, size_t count );
+				void( *f32ToU8 )( float const * src, uint8_t * dst, size_t count );
+				void( *f32ToF16 )( float const * src, uint16_t * dst, size_t count );
+				void( *f16ToF32 )( uint16_t const * src, float * dst, size_t count );
+			};
+
+			Kernels const & getKernels( PixelConversionSimd simd )
+			{
+				static Kernels const scalar
+				{
+					swapRgb,
+					swapRgba,
+					expandRgb< false >,
+					expandRgb< true >,
+					shrinkRgba< false >,
+					shrinkRgba< true >,
+					expandGrey3,
+					expandGrey4,
+					expandGreyAlpha,
+					u8ToF32,
+					f32ToU8,
+					f32ToF16,
+					f16ToF32,
+				};
+#if CU_PixelConversionSSE2
+				static Kernels const sse2
+				{
+					swapRgb,
+					swapRgbaSSE2,
+					expandRgb< false >,
+					expandRgb< true >,
+					shrinkRgba< false >,
+					shrinkRgba< true >,
+					expandGrey3,
+					expandGrey4SSE2,
+					expandGreyAlphaSSE2,
+					u8ToF32SSE2,
+					f32ToU8SSE2,
+					f32ToF16SSE2,
+					f16ToF32SSE2,
+				};
+#endif
+#if CU_PixelConversionAVX2
+				static Kernels const avx2
+				{
+					swapRgb,
+					swapRgbaAVX2,
+					expandRgbAVX2< false >,
+					expandRgbAVX2< true >,
+					shrinkRgbaAVX2< false >,
+					shrinkRgbaAVX2< true >,
+					expandGrey3,
+					expandGrey4AVX2,
+					expandGreyAlphaSSE2,
+					u8ToF32AVX2,
+					f32ToU8AVX2,
+					f32ToF16AVX2,
+					f16ToF32AVX2,
+				};
+#endif
+
+				switch ( simd )
+				{
+#if CU_PixelConversionAVX2
+				case PixelConversionSimd::eAVX2:
+					return avx2;
+#endif
+#if CU_PixelConversionSSE2
+				case PixelConversionSimd::eSSE2:
+					return sse2;
+#endif
+				default:
+					return scalar;
+				}
+			}
+
+			//*********************************************************************************************
+
+			// The memory layouts of the formats having fast conversions.
+			// sRGB formats share their UNORM counterpart's layout, the scalar path copies their bytes as well.
+			enum class Layout
+			{
+				eNone,
+				eGrey,
+				eGreyAlpha,
+				eRgb,
+				eBgr,
+				eRgba,
+				eBgra,
+				eRgba16F,
+				eRgba32F,
+			};
+
+			Layout getLayout( PixelFormat format )
+			{
+				switch ( format )
+				{
+				case PixelFormat::eR8_UNORM:
+					return Layout::eGrey;
+				case PixelFormat::eR8A8_UNORM:
+					return Layout::eGreyAlpha;
+				case PixelFormat::eR8G8B8_UNORM:
+				case PixelFormat::eR8G8B8_SRGB:
+					return Layout::eRgb;
+				case PixelFormat::eB8G8R8_UNORM:
+				case PixelFormat::eB8G8R8_SRGB:
+					return Layout::eBgr;
+				case PixelFormat::eR8G8B8A8_UNORM:
+				case PixelFormat::eR8G8B8A8_SRGB:
+					return Layout::eRgba;
+				case PixelFormat::eA8B8G8R8_UNORM:
+				case PixelFormat::eA8B8G8R8_SRGB:
+					// Stored as b, g, r, a by PixelComponents.
+					return Layout::eBgra;
+				case PixelFormat::eR16G16B16A16_SFLOAT:
+					return Layout::eRgba16F;
+				case PixelFormat::eR32G32B32A32_SFLOAT:
+					return Layout::eRgba32F;
+				default:
+					return Layout::eNone;
+				}
+			}
+
+			bool isFloat( Layout layout )
+			{
+				return layout == Layout::eRgba16F
+					|| layout == Layout::eRgba32F;
+			}
+
+			bool isColour( Layout layout )
+			{
+				return layout == Layout::eRgb
+					|| layout == Layout::eBgr
+					|| layout == Layout::eRgba
+					|| layout == Layout::eBgra;
+			}
+
+			/**
+			 *\~english
+			 *\return		The kernel converting the bytes pixels from \p src layout to \p dst layout, \p nullptr if there is none.
+			 *\~french
+			 *\return		Le kernel convertissant les pixels d'octets de la disposition \p src vers la disposition \p dst, \p nullptr s'il n'y en a pas.
+			 */
+			PixelsKernel getPixelsKernel( Kernels const & kernels
+				, Layout src
+				, Layout dst )
+			{
+				if ( !isColour( dst ) )
+				{
+					// The scalar path computes a luminance for the grey formats.
+					return nullptr;
+				}
+
+				auto dstAlpha = dst == Layout::eRgba || dst == Layout::eBgra;
+
+				if ( src == Layout::eGrey )
+				{
+					return dstAlpha ? kernels.expandGrey4 : kernels.expandGrey3;
+				}
+
+				if ( src == Layout::eGreyAlpha )
+				{
+					return dstAlpha ? kernels.expandGreyAlpha : nullptr;
+				}
+
+				if ( !isColour( src ) )
+				{
+					return nullptr;
+				}
+
+				auto srcAlpha = src == Layout::eRgba || src == Layout::eBgra;
+				auto swap = ( src == Layout::eBgr || src == Layout::eBgra ) != ( dst == Layout::eBgr || dst == Layout::eBgra );
+
+				if ( srcAlpha )
+				{
+					return dstAlpha
+						? ( swap ? kernels.swapRgba : copyPixels< 4u > )
+						: ( swap ? kernels.shrinkBgra : kernels.shrinkRgba );
+				}
+
+				return dstAlpha
+					? ( swap ? kernels.expandBgr : kernels.expandRgb )
+					: ( swap ? kernels.swapRgb : copyPixels< 3u > );
+			}
+
+			struct Conversion
+			{
+				Layout src;
+				Layout dst;
+				size_t srcSize;
+				size_t dstSize;
+				// Converts directly, for the bytes formats.
+				PixelsKernel direct;
+				// Stages the bytes source as RGBA, when it isn't already.
+				PixelsKernel toRgba;
+				// Writes the staged RGBA bytes to the destination, when it isn't RGBA already.
+				PixelsKernel fromRgba;
+			};
+
+			bool getConversion( Kernels const & kernels
+				, PixelFormat srcFormat
+				, PixelFormat dstFormat
+				, Conversion & conversion )
+			{
+				conversion = { getLayout( srcFormat )
+					, getLayout( dstFormat )
+					, getBytesPerPixel( srcFormat )
+					, getBytesPerPixel( dstFormat )
+					, nullptr
+					, nullptr
+					, nullptr };
+
+				if ( conversion.src == Layout::eNone
+					|| conversion.dst == Layout::eNone )
+				{
+					return false;
+				}
+
+				if ( isFloat( conversion.src ) )
+				{
+					if ( !isFloat( conversion.dst )
+						&& conversion.dst != Layout::eRgba )
+					{
+						conversion.fromRgba = getPixelsKernel( kernels, Layout::eRgba, conversion.dst );
+						return conversion.fromRgba != nullptr;
+					}
+
+					return true;
+				}
+
+				if ( isFloat( conversion.dst ) )
+				{
+					if ( conversion.src != Layout::eRgba )
+					{
+						conversion.toRgba = getPixelsKernel( kernels, conversion.src, Layout::eRgba );
+						return conversion.toRgba != nullptr;
+					}
+
+					return true;
+				}
+
+				conversion.direct = getPixelsKernel( kernels, conversion.src, conversion.dst );
+				return conversion.direct != nullptr;
+			}
+
+			void convertPixels( Kernels const & kernels
+				, Conversion const & conversion
+				, uint8_t const * src
+				, uint8_t * dst
+				, size_t count )
+			{
+				if ( conversion.direct )
+				{
+					conversion.direct( src, dst, count );
+					return;
+				}
+
+				if ( isFloat( conversion.src ) && isFloat( conversion.dst ) )
+				{
+					if ( conversion.src == conversion.dst )
+					{
+						std::memcpy( dst, src, count * conversion.srcSize );
+					}
+					else if ( conversion.src == Layout::eRgba32F )
+					{
+						kernels.f32ToF16( reinterpret_cast< float const * >( src )
+							, reinterpret_cast< uint16_t * >( dst )
+							, count * 4u );
+					}
+					else
+					{
+						kernels.f16ToF32( reinterpret_cast< uint16_t const * >( src )
+							, reinterpret_cast< float * >( dst )
+							, count * 4u );
+					}
+
+					return;
+				}
+
+				// The other conversions go through RGBA bytes, or RGBA floats, staged by blocks.
+				std::array< uint8_t, BlockPixels * 4u > bytes;
+				std::array< float, BlockPixels * 4u > floats;
+
+				for ( size_t done = 0u; done < count; done += BlockPixels )
+				{
+					auto blockCount = std::min( BlockPixels, count - done );
+					auto blockSrc = src + done * conversion.srcSize;
+					auto blockDst = dst + done * conversion.dstSize;
+
+					if ( isFloat( conversion.dst ) )
+					{
+						auto rgba = blockSrc;
+
+						if ( conversion.toRgba )
+						{
+							conversion.toRgba( blockSrc, bytes.data(), blockCount );
+							rgba = bytes.data();
+						}
+
+						if ( conversion.dst == Layout::eRgba32F )
+						{
+							kernels.u8ToF32( rgba, reinterpret_cast< float * >( blockDst ), blockCount * 4u );
+						}
+						else
+						{
+							u8ToF16( rgba, reinterpret_cast< uint16_t * >( blockDst ), blockCount * 4u );
+						}
+					}
+					else
+					{
+						auto rgba = reinterpret_cast< float const * >( blockSrc );
+
+						if ( conversion.src == Layout::eRgba16F )
+						{
+							kernels.f16ToF32( reinterpret_cast< uint16_t const * >( blockSrc ), floats.data(), blockCount * 4u );
+							rgba = floats.data();
+						}
+
+						if ( conversion.fromRgba )
+						{
+							kernels.f32ToU8( rgba, bytes.data(), blockCount * 4u );
+							conversion.fromRgba( bytes.data(), blockDst, blockCount );
+						}
+						else
+						{
+							kernels.f32ToU8( rgba, blockDst, blockCount * 4u );
+						}
+					}
+				}
+			}
+		}
+
+		PixelConversionSimd getConversionSimd()
+		{
+			static PixelConversionSimd const result = []()
+			{
+#if CU_PixelConversionAVX2
+				CpuInformations cpu;
+
+				if ( cpu.AVX2() && cpu.OSXSAVE() )
+				{
+					return PixelConversionSimd::eAVX2;
+				}
+#endif
+#if CU_PixelConversionSSE2
+				return PixelConversionSimd::eSSE2;
+#else
+				return PixelConversionSimd::eNone;
+#endif
+			}();
+			return result;
+		}
+
+		bool convertBufferFast( PixelConversionSimd simd
+			, PixelFormat srcFormat
+			, uint8_t const * srcBuffer
+			, uint32_t srcSize
+			, PixelFormat dstFormat
+			, uint8_t * dstBuffer
+			, uint32_t dstSize
+			, uint32_t threadsCount )
+		{
+			if ( simd > getConversionSimd() )
+			{
+				return false;
+			}
+
+			auto & kernels = getKernels( simd );
+			Conversion conversion;
+
+			if ( !getConversion( kernels, srcFormat, dstFormat, conversion ) )
+			{
+				return false;
+			}
+
+			auto count = size_t( srcSize / conversion.srcSize );
+
+			if ( count != dstSize / conversion.dstSize )
+			{
+				// Left to the scalar path, which checks it.
+				return false;
+			}
+
+			auto maxThreadsCount = count / MinPixelsPerThread;
+
+			if ( maxThreadsCount <= 1u )
+			{
+				convertPixels( kernels, conversion, srcBuffer, dstBuffer, count );
+				return true;
+			}
+
+			// Each part converts a contiguous range of pixels, the kernels never write outside theirs.
+			threadsCount = uint32_t( std::min( maxThreadsCount
+				, size_t( threadsCount ? threadsCount : getParallelThreadsCount() ) ) );
+			parallelFor( count
+				, threadsCount
+				, [&kernels, &conversion, srcBuffer, dstBuffer]( uint32_t, size_t begin, size_t end )
+				{
+					convertPixels( kernels
+						, conversion
+						, srcBuffer + begin * conversion.srcSize
+						, dstBuffer + begin * conversion.dstSize
+						, end - begin );
+				} );
+			return true;
+		}
+	}
+}
@@ -0,0 +1,290 @@
+#include "CastorUtils/Graphics/SphericalHarmonics.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+#include "CastorUtils/Graphics/ImageLayout.hpp"
+#include "CastorUtils/Graphics/PixelBufferBase.hpp"
+#include "CastorUtils/Math/MathModule.hpp"
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <cmath>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define CU_SphericalHarmonicsSSE2 1
+#	include <emmintrin.h>
+#else
+#	define CU_SphericalHarmonicsSSE2 0
+#endif
+
+namespace castor
+{
+	namespace
+	{
+		static uint32_t constexpr FacesCount = 6u;
+		using Basis = std::array< float, SphericalHarmonics::CoefficientsCount >;
+
+		Basis getBasis( Point3f const & dir )
+		{
+			auto x = dir[0];
+			auto y = dir[1];
+			auto z = dir[2];
+			return Basis
+			{
+				0.282095f,
+				0.488603f * y,
+				0.488603f * z,
+				0.488603f * x,
+				1.092548f * x * y,
+				1.092548f * y * z,
+				0.315392f * ( 3.0f * z * z - 1.0f ),
+				1.092548f * x * z,
+				0.546274f * ( x * x - y * y ),
+			};
+		}
+
+		struct FaceProjection
+		{
+			std::array< std::array< float, 4u >, SphericalHarmonics::CoefficientsCount > sums{};
+			float weight{ 0.0f };
+		};
+
+		void projectFace( uint32_t face
+			, uint32_t size
+			, float const * texels
+			, FaceProjection & result )
+		{
+			auto texelSize = 2.0f / float( size );
+#if CU_SphericalHarmonicsSSE2
+			std::array< __m128, SphericalHarmonics::CoefficientsCount > sums;
+
+			for ( auto & sum : sums )
+			{
+				sum = _mm_setzero_ps();
+			}
+#endif
+
+			for ( uint32_t y = 0u; y < size; ++y )
+			{
+				auto v = ( float( y ) + 0.5f ) * texelSize - 1.0f;
+
+				for ( uint32_t x = 0u; x < size; ++x )
+				{
+					auto u = ( float( x ) + 0.5f ) * texelSize - 1.0f;
+					// Solid angle subtended by the texel.
+					auto d2 = 1.0f + u * u + v * v;
+					auto weight = texelSize * texelSize / ( d2 * std::sqrt( d2 ) );
+					auto basis = getBasis( SphericalHarmonics::getCubeDirection( face, u, v ) );
+					result.weight += weight;
+
+#if CU_SphericalHarmonicsSSE2
+					auto colour = _mm_mul_ps( _mm_loadu_ps( texels ), _mm_set1_ps( weight ) );
+
+					for ( uint32_t i = 0u; i < SphericalHarmonics::CoefficientsCount; ++i )
+					{
+						sums[i] = _mm_add_ps( sums[i], _mm_mul_ps( colour, _mm_set1_ps( basis[i] ) ) );
+					}
+#else
+					for ( uint32_t i = 0u; i < SphericalHarmonics::CoefficientsCount; ++i )
+					{
+						for ( uint32_t c = 0u; c < 3u; ++c )
+						{
+							result.sums[i][c] += texels[c] * weight * basis[i];
+						}
+					}
+#endif
+
+					texels += 4u;
+				}
+			}
+
+#if CU_SphericalHarmonicsSSE2
+			for ( uint32_t i = 0u; i < SphericalHarmonics::CoefficientsCount; ++i )
+			{
+				_mm_storeu_ps( result.sums[i].data(), sums[i] );
+			}
+#endif
+		}
+
+		template< typename FuncT >
+		void dispatchFaces( uint32_t threadsCount
+			, FuncT function )
+		{
+			parallelFor( FacesCount
+				, std::min( FacesCount, threadsCount ? threadsCount : getParallelThreadsCount() )
+				, [&function]( uint32_t part, size_t begin, size_t end )
+				{
+					for ( auto face = uint32_t( begin ); face < end; ++face )
+					{
+						function( face );
+					}
+				} );
+		}
+	}
+
+	SphericalHarmonics::SphericalHarmonics()
+		: m_coefficients{}
+	{
+	}
+
+	SphericalHarmonics::SphericalHarmonics( Coefficients const & coefficients )
+		: m_coefficients{ coefficients }
+	{
+	}
+
+	SphericalHarmonics SphericalHarmonics::fromCube( PxBufferBase const & cube
+		, uint32_t threadsCount )
+	{
+		CU_Require( cube.getLayers() == FacesCount );
+		CU_Require( cube.getWidth() == cube.getHeight() );
+		PxBufferBaseSPtr converted;
+		auto buffer = &cube;
+
+		if ( cube.getFormat() != PixelFormat::eR32G32B32A32_SFLOAT )
+		{
+			converted = PxBufferBase::create( cube.getDimensions()
+				, cube.getLayers()
+				, cube.getLevels()
+				, PixelFormat::eR32G32B32A32_SFLOAT
+				, cube.getConstPtr()
+				, cube.getFormat() );
+			buffer = converted.get();
+		}
+
+		ImageLayout layout{ ImageLayout::e2DArray, *buffer };
+		std::array< FaceProjection, FacesCount > faces;
+		dispatchFaces( threadsCount
+			, [&]( uint32_t face )
+			{
+				projectFace( face
+					, buffer->getWidth()
+					, reinterpret_cast< float const * >( layout.layerMipBuffer( *buffer, face, 0u ).data() )
+					, faces[face] );
+			} );
+
+		float weight = 0.0f;
+		Coefficients coefficients{};
+
+		for ( auto & face : faces )
+		{
+			weight += face.weight;
+
+			for ( uint32_t i = 0u; i < CoefficientsCount; ++i )
+			{
+				for ( uint32_t c = 0u; c < 3u; ++c )
+				{
+					coefficients[i][c] += face.sums[i][c];
+				}
+			}
+		}
+
+		// The texels solid angles sum is only close to 4 Pi, normalise it to remove the discretisation bias.
+		auto normalisation = 4.0f * Pi< float > / weight;
+
+		for ( auto & coefficient : coefficients )
+		{
+			coefficient *= normalisation;
+		}
+
+		return SphericalHarmonics{ coefficients };
+	}
+
+	Point3f SphericalHarmonics::evaluate( Point3f const & direction )const
+	{
+		auto basis = getBasis( direction );
+		Point3f result;
+
+		for ( uint32_t i = 0u; i < CoefficientsCount; ++i )
+		{
+			result += m_coefficients[i] * basis[i];
+		}
+
+		return result;
+	}
+
+	Point3f SphericalHarmonics::evaluateIrradiance( Point3f const & normal )const
+	{
+		// Clamped cosine lobe convolution (Ramamoorthi and Hanrahan), divided by Pi.
+		static std::array< float, CoefficientsCount > const bands
+		{
+			1.0f,
+			2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f,
+			0.25f, 0.25f, 0.25f, 0.25f, 0.25f,
+		};
+		auto basis = getBasis( normal );
+		Point3f result;
+
+		for ( uint32_t i = 0u; i < CoefficientsCount; ++i )
+		{
+			result += m_coefficients[i] * ( basis[i] * bands[i] );
+		}
+
+		for ( uint32_t c = 0u; c < 3u; ++c )
+		{
+			result[c] = std::max( 0.0f, result[c] );
+		}
+
+		return result;
+	}
+
+	PxBufferBaseSPtr SphericalHarmonics::toIrradianceCube( uint32_t size
+		, uint32_t threadsCount )const
+	{
+		auto result = PxBufferBase::create( Size{ size, size }
+			, FacesCount
+			, 1u
+			, PixelFormat::eR32G32B32A32_SFLOAT );
+		ImageLayout layout{ ImageLayout::e2DArray, *result };
+		auto texelSize = 2.0f / float( size );
+		dispatchFaces( threadsCount
+			, [&]( uint32_t face )
+			{
+				auto texels = reinterpret_cast< float * >( layout.layerMipBuffer( *result, face, 0u ).data() );
+
+				for ( uint32_t y = 0u; y < size; ++y )
+				{
+					auto v = ( float( y ) + 0.5f ) * texelSize - 1.0f;
+
+					for ( uint32_t x = 0u; x < size; ++x )
+					{
+						auto u = ( float( x ) + 0.5f ) * texelSize - 1.0f;
+						auto irradiance = evaluateIrradiance( getCubeDirection( face, u, v ) );
+						*texels++ = irradiance[0];
+						*texels++ = irradiance[1];
+						*texels++ = irradiance[2];
+						*texels++ = 1.0f;
+					}
+				}
+			} );
+		return result;
+	}
+
+	Point3f SphericalHarmonics::getCubeDirection( uint32_t face
+		, float u
+		, float v )
+	{
+		Point3f result;
+
+		switch ( face )
+		{
+		case 0u:
+			result = Point3f{ 1.0f, -v, -u };
+			break;
+		case 1u:
+			result = Point3f{ -1.0f, -v, u };
+			break;
+		case 2u:
+			result = Point3f{ u, 1.0f, v };
+			break;
+		case 3u:
+			result = Point3f{ u, -1.0f, -v };
+			break;
+		case 4u:
+			result = Point3f{ u, -v, 1.0f };
+			break;
+		default:
+			result = Point3f{ -u, -v, -1.0f };
+			break;
+		}
+
+		return point::getNormalised( result );
+	}
+}
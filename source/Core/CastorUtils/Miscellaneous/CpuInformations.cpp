@@ -27,7 +27,8 @@ namespace castor
 		Platform::callCpuid( 0u, data );
 		auto ids = data[0];
 
-		for ( int32_t i = 0; i < ids; ++i )
+		// ids is the highest supported leaf.
+		for ( int32_t i = 0; i <= ids; ++i )
 		{
 			Platform::callCpuid( i, data );
 			datas.push_back( data );
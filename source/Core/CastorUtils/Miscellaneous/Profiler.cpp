@@ -0,0 +1,435 @@
+#include "CastorUtils/Miscellaneous/Profiler.hpp"
+
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Data/TextFile.hpp"
+#include "CastorUtils/Exception/Exception.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+namespace castor
+{
+	namespace
+	{
+		struct Event
+		{
+			ProfilerZone const * zone;
+			uint64_t begin;
+			// The end time for scopes, the value for counters.
+			uint64_t end;
+		};
+
+		struct ThreadBuffer
+		{
+			explicit ThreadBuffer( uint32_t id
+				, uint32_t capacity )
+				: id{ id }
+				, name{ cuT( "Thread " ) + string::toString( id ) }
+				, events( capacity )
+			{
+			}
+
+			// Only contended while the events are summarised or exported.
+			void lock()noexcept
+			{
+				while ( locked.test_and_set( std::memory_order_acquire ) )
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			void unlock()noexcept
+			{
+				locked.clear( std::memory_order_release );
+			}
+
+			void push( Event const & event )noexcept
+			{
+				lock();
+				events[size_t( written % events.size() )] = event;
+				++written;
+				unlock();
+			}
+
+			// The index of the oldest event still in the ring.
+			uint64_t getFirst( uint64_t from )const noexcept
+			{
+				return std::max( from
+					, written > events.size() ? written - events.size() : 0u );
+			}
+
+			uint32_t const id;
+			String name;
+			std::vector< Event > events;
+			uint64_t written{ 0u };
+			uint64_t summarised{ 0u };
+			bool ended{ false };
+			std::atomic_flag locked = ATOMIC_FLAG_INIT;
+		};
+
+		struct Registry
+		{
+			std::mutex mutex;
+			std::vector< std::unique_ptr< ThreadBuffer > > threads;
+			uint32_t nextId{ 0u };
+			uint32_t capacity{ Profiler::DefaultThreadCapacity };
+			uint64_t origin{ 0u };
+			ProfilerFrameSummary current;
+			ProfilerFrameSummary last;
+		};
+
+		// Constant initialised, checking it doesn't go through the registry's initialisation guard.
+		std::atomic< bool > capturing{ false };
+
+		Registry & getRegistry()
+		{
+			// Never destroyed, the threads may still exit or record after the static objects destruction.
+			static Registry & registry = *new Registry;
+			return registry;
+		}
+
+		// Marks the thread's buffer as ended when the thread exits, its events are kept for export.
+		struct ThreadHandle
+		{
+			~ThreadHandle()
+			{
+				if ( buffer )
+				{
+					auto & registry = getRegistry();
+					auto lock = makeUniqueLock( registry.mutex );
+					buffer->ended = true;
+					buffer = nullptr;
+				}
+			}
+
+			ThreadBuffer * buffer{ nullptr };
+			// The name given before the thread recorded its first event.
+			String name;
+		};
+
+		ThreadHandle & getThreadHandle()
+		{
+			thread_local ThreadHandle handle;
+			return handle;
+		}
+
+		ThreadBuffer & getThreadBuffer()
+		{
+			auto & handle = getThreadHandle();
+
+			if ( !handle.buffer )
+			{
+				// First event of this thread, its ring buffer is allocated once for all.
+				auto & registry = getRegistry();
+				auto lock = makeUniqueLock( registry.mutex );
+				registry.threads.push_back( std::make_unique< ThreadBuffer >( registry.nextId++
+					, registry.capacity ) );
+				handle.buffer = registry.threads.back().get();
+
+				if ( !handle.name.empty() )
+				{
+					handle.buffer->name = handle.name;
+				}
+			}
+
+			return *handle.buffer;
+		}
+
+		void summarise( ThreadBuffer & buffer
+			, ProfilerFrameSummary & summary )
+		{
+			buffer.lock();
+
+			for ( auto index = buffer.getFirst( buffer.summarised ); index < buffer.written; ++index )
+			{
+				auto & event = buffer.events[size_t( index % buffer.events.size() )];
+
+				if ( event.zone->kind == ProfilerZone::Kind::eFrame )
+				{
+					continue;
+				}
+
+				auto value = event.zone->kind == ProfilerZone::Kind::eScope
+					? int64_t( event.end - event.begin )
+					: int64_t( event.end );
+				auto it = std::find_if( summary.begin()
+					, summary.end()
+					, [&event]( ProfilerZoneSummary const & lookup )
+					{
+						return lookup.zone == event.zone;
+					} );
+
+				if ( it == summary.end() )
+				{
+					summary.push_back( { event.zone, 1u, value, value } );
+				}
+				else
+				{
+					++it->count;
+					it->total += value;
+					it->max = std::max( it->max, value );
+				}
+			}
+
+			buffer.summarised = buffer.written;
+			buffer.unlock();
+		}
+
+		void writeString( std::ostream & stream
+			, std::string const & value )
+		{
+			stream << '"';
+
+			for ( auto c : value )
+			{
+				switch ( c )
+				{
+				case '"':
+					stream << "\\\"";
+					break;
+				case '\\':
+					stream << "\\\\";
+					break;
+				default:
+					if ( uint8_t( c ) < 0x20u )
+					{
+						stream << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << uint32_t( c ) << std::dec;
+					}
+					else
+					{
+						stream << c;
+					}
+					break;
+				}
+			}
+
+			stream << '"';
+		}
+
+		void writeTime( std::ostream & stream
+			, uint64_t time
+			, uint64_t origin )
+		{
+			// The trace times are in microseconds.
+			auto relative = time > origin ? time - origin : 0u;
+			stream << ( relative / 1000u ) << '.' << std::setw( 3 ) << std::setfill( '0' ) << ( relative % 1000u );
+		}
+	}
+
+	void Profiler::startCapture()
+	{
+		auto & registry = getRegistry();
+		auto lock = makeUniqueLock( registry.mutex );
+
+		if ( !registry.origin
+			|| std::none_of( registry.threads.begin()
+				, registry.threads.end()
+				, []( std::unique_ptr< ThreadBuffer > const & buffer )
+				{
+					return buffer->written != 0u;
+				} ) )
+		{
+			registry.origin = now();
+		}
+
+		capturing.store( true, std::memory_order_release );
+	}
+
+	void Profiler::stopCapture()
+	{
+		capturing.store( false, std::memory_order_release );
+	}
+
+	bool Profiler::isCapturing()noexcept
+	{
+		return capturing.load( std::memory_order_relaxed );
+	}
+
+	void Profiler::clear()
+	{
+		auto & registry = getRegistry();
+		auto lock = makeUniqueLock( registry.mutex );
+		registry.threads.erase( std::remove_if( registry.threads.begin()
+				, registry.threads.end()
+				, []( std::unique_ptr< ThreadBuffer > const & buffer )
+				{
+					return buffer->ended;
+				} )
+			, registry.threads.end() );
+
+		for ( auto & buffer : registry.threads )
+		{
+			buffer->lock();
+			buffer->written = 0u;
+			buffer->summarised = 0u;
+			buffer->unlock();
+		}
+
+		registry.current.clear();
+		registry.last.clear();
+		registry.origin = now();
+	}
+
+	void Profiler::setThreadCapacity( uint32_t capacity )
+	{
+		auto & registry = getRegistry();
+		auto lock = makeUniqueLock( registry.mutex );
+		registry.capacity = std::max( 1u, capacity );
+	}
+
+	void Profiler::setThreadName( String const & name )
+	{
+		// The buffer isn't allocated here, threads that never record don't pay for it.
+		auto & handle = getThreadHandle();
+		auto & registry = getRegistry();
+		auto lock = makeUniqueLock( registry.mutex );
+		handle.name = name;
+
+		if ( handle.buffer )
+		{
+			handle.buffer->name = name;
+		}
+	}
+
+	uint64_t Profiler::now()noexcept
+	{
+		return uint64_t( std::chrono::duration_cast< Nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+	}
+
+	void Profiler::record( ProfilerZone const & zone
+		, uint64_t begin
+		, uint64_t end )noexcept
+	{
+		getThreadBuffer().push( { &zone, begin, end } );
+	}
+
+	void Profiler::count( ProfilerZone const & zone
+		, int64_t value )noexcept
+	{
+		if ( isCapturing() )
+		{
+			getThreadBuffer().push( { &zone, now(), uint64_t( value ) } );
+		}
+	}
+
+	void Profiler::nextFrame()
+	{
+		static constexpr ProfilerZone frameZone{ "Frame", __FILE__, uint32_t( __LINE__ ), ProfilerZone::Kind::eFrame };
+
+		if ( !isCapturing() )
+		{
+			return;
+		}
+
+		auto time = now();
+		getThreadBuffer().push( { &frameZone, time, time } );
+		auto & registry = getRegistry();
+		auto lock = makeUniqueLock( registry.mutex );
+		registry.current.clear();
+
+		for ( auto & buffer : registry.threads )
+		{
+			summarise( *buffer, registry.current );
+		}
+
+		std::sort( registry.current.begin()
+			, registry.current.end()
+			, []( ProfilerZoneSummary const & lhs, ProfilerZoneSummary const & rhs )
+			{
+				return lhs.total > rhs.total;
+			} );
+		// Both vectors keep their capacity, summarising doesn't allocate once warmed up.
+		std::swap( registry.current, registry.last );
+	}
+
+	ProfilerFrameSummary Profiler::getFrameSummary()
+	{
+		auto & registry = getRegistry();
+		auto lock = makeUniqueLock( registry.mutex );
+		return registry.last;
+	}
+
+	void Profiler::writeChromeTrace( std::ostream & stream )
+	{
+		auto & registry = getRegistry();
+		auto lock = makeUniqueLock( registry.mutex );
+		std::vector< Event > events;
+		bool first = true;
+		auto separate = [&stream, &first]()
+		{
+			stream << ( first ? "\n" : ",\n" );
+			first = false;
+		};
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		for ( auto & buffer : registry.threads )
+		{
+			// The thread's events are copied, to keep it recording while they are written.
+			buffer->lock();
+			events.clear();
+
+			for ( auto index = buffer->getFirst( 0u ); index < buffer->written; ++index )
+			{
+				events.push_back( buffer->events[size_t( index % buffer->events.size() )] );
+			}
+
+			buffer->unlock();
+			separate();
+			stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->id << ",\"args\":{\"name\":";
+			writeString( stream, string::stringCast< char >( buffer->name ) );
+			stream << "}}";
+
+			for ( auto & event : events )
+			{
+				separate();
+				stream << "{\"name\":";
+				writeString( stream, event.zone->name );
+				stream << ",\"pid\":0,\"tid\":" << buffer->id << ",\"ts\":";
+				writeTime( stream, event.begin, registry.origin );
+
+				switch ( event.zone->kind )
+				{
+				case ProfilerZone::Kind::eScope:
+					stream << ",\"ph\":\"X\",\"cat\":\"cpu\",\"dur\":";
+					writeTime( stream, event.end, event.begin );
+					stream << ",\"args\":{\"file\":";
+					writeString( stream, event.zone->file );
+					stream << ",\"line\":" << event.zone->line << "}}";
+					break;
+				case ProfilerZone::Kind::eCounter:
+					stream << ",\"ph\":\"C\",\"args\":{\"value\":" << int64_t( event.end ) << "}}";
+					break;
+				case ProfilerZone::Kind::eFrame:
+					stream << ",\"ph\":\"i\",\"s\":\"g\"}";
+					break;
+				}
+			}
+		}
+
+		stream << "\n]}\n";
+	}
+
+	bool Profiler::exportChromeTrace( Path const & path )
+	{
+		std::ostringstream stream;
+		stream.imbue( std::locale::classic() );
+		writeChromeTrace( stream );
+
+		try
+		{
+			TextFile file{ path, File::OpenMode::eWrite };
+			auto text = stream.str();
+			return file.isOk()
+				&& file.writeText( string::stringCast< xchar >( text ) ) == text.size();
+		}
+		catch ( castor::Exception & )
+		{
+			// The file couldn't be opened.
+			return false;
+		}
+	}
+}
@@ -0,0 +1,161 @@
+#include "CastorUtils/Miscellaneous/RadixSort.hpp"
+
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <algorithm>
+
+namespace castor
+{
+	namespace
+	{
+		// 3 passes (11, 11 and 10 bits) keep the histograms in L1.
+		static uint32_t constexpr DigitBits = 11u;
+		static uint32_t constexpr BucketsCount = 1u << DigitBits;
+		static uint32_t constexpr BucketsMask = BucketsCount - 1u;
+		static uint32_t constexpr PassesCount = 3u;
+		static uint32_t constexpr MinItemsPerThread = 32768u;
+
+		inline uint32_t getDigit( uint64_t item
+			, uint32_t pass )
+		{
+			// The key is stored in the 32 upper bits, the index in the lower ones.
+			return uint32_t( item >> ( 32u + pass * DigitBits ) ) & BucketsMask;
+		}
+
+		template< typename FuncT >
+		void dispatchChunks( uint32_t threadsCount
+			, FuncT function )
+		{
+			parallelFor( threadsCount
+				, threadsCount
+				, [&function]( uint32_t chunk, size_t begin, size_t end )
+				{
+					function( chunk );
+				} );
+		}
+	}
+
+	RadixSorter::RadixSorter( uint32_t threadsCount )
+		: m_threadsCount{ threadsCount
+			? threadsCount
+			: getParallelThreadsCount() }
+	{
+	}
+
+	void RadixSorter::sort( uint32_t const * keys
+		, uint32_t * indices
+		, uint32_t count )
+	{
+		m_items.resize( count );
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			m_items[i] = ( uint64_t( keys[indices[i]] ) << 32u ) | indices[i];
+		}
+
+		m_scratch.resize( count );
+		auto threadsCount = doGetThreadsCount( count );
+		auto chunkSize = ( count + threadsCount - 1u ) / threadsCount;
+		m_histograms.resize( size_t( threadsCount ) * BucketsCount );
+		auto src = m_items.data();
+		auto dst = m_scratch.data();
+
+		for ( uint32_t pass = 0u; pass < PassesCount; ++pass )
+		{
+			std::fill( m_histograms.begin(), m_histograms.end(), 0u );
+			dispatchChunks( threadsCount
+				, [&]( uint32_t chunk )
+				{
+					auto histogram = m_histograms.data() + chunk * BucketsCount;
+					auto end = std::min( count, ( chunk + 1u ) * chunkSize );
+
+					for ( auto i = chunk * chunkSize; i < end; ++i )
+					{
+						++histogram[getDigit( src[i], pass )];
+					}
+				} );
+
+			// Turn the histograms into scatter offsets: buckets first, then chunks, to keep the sort stable.
+			uint32_t offset = 0u;
+			bool skip = false;
+
+			for ( uint32_t bucket = 0u; bucket < BucketsCount && !skip; ++bucket )
+			{
+				auto bucketBegin = offset;
+
+				for ( uint32_t chunk = 0u; chunk < threadsCount; ++chunk )
+				{
+					auto & value = m_histograms[chunk * BucketsCount + bucket];
+					auto size = value;
+					value = offset;
+					offset += size;
+				}
+
+				// All the items share this digit, the pass would not move anything.
+				skip = ( offset - bucketBegin ) == count;
+			}
+
+			if ( skip )
+			{
+				continue;
+			}
+
+			dispatchChunks( threadsCount
+				, [&]( uint32_t chunk )
+				{
+					auto offsets = m_histograms.data() + chunk * BucketsCount;
+					auto end = std::min( count, ( chunk + 1u ) * chunkSize );
+
+					for ( auto i = chunk * chunkSize; i < end; ++i )
+					{
+						dst[offsets[getDigit( src[i], pass )]++] = src[i];
+					}
+				} );
+			std::swap( src, dst );
+		}
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			indices[i] = uint32_t( src[i] );
+		}
+	}
+
+	bool RadixSorter::sortCoherent( uint32_t const * keys
+		, uint32_t * indices
+		, uint32_t count )
+	{
+		// Beyond that many moves, the insertion sort is slower than the radix sort.
+		auto budget = std::max( 64u, count / 4u );
+		uint32_t moves = 0u;
+
+		for ( uint32_t i = 1u; i < count && moves <= budget; ++i )
+		{
+			auto index = indices[i];
+			auto key = keys[index];
+			auto j = i;
+
+			while ( j > 0u && keys[indices[j - 1u]] > key )
+			{
+				indices[j] = indices[j - 1u];
+				--j;
+			}
+
+			indices[j] = index;
+			moves += i - j;
+		}
+
+		if ( moves <= budget )
+		{
+			return true;
+		}
+
+		// The indices are still a valid permutation, only partially sorted.
+		sort( keys, indices, count );
+		return false;
+	}
+
+	uint32_t RadixSorter::doGetThreadsCount( uint32_t count )const
+	{
+		return std::max( 1u, std::min( m_threadsCount, count / MinItemsPerThread ) );
+	}
+}
@@ -0,0 +1,201 @@
+#include "CastorUtils/Multithreading/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace castor
+{
+	namespace
+	{
+		struct ParallelForState
+		{
+			ParallelForFunc const * func{ nullptr };
+			size_t count{ 0u };
+			size_t partSize{ 0u };
+			uint32_t partsCount{ 0u };
+			std::atomic_uint32_t next{ 0u };
+			std::mutex mutex;
+			std::condition_variable ended;
+			uint32_t done{ 0u };
+			std::exception_ptr error;
+
+			// Processes the parts not yet claimed, returns when none is left.
+			void run()
+			{
+				uint32_t part;
+
+				while ( ( part = next++ ) < partsCount )
+				{
+					std::exception_ptr partError;
+
+					try
+					{
+						( *func )( part
+							, std::min( count, part * partSize )
+							, std::min( count, ( part + 1u ) * partSize ) );
+					}
+					catch ( ... )
+					{
+						partError = std::current_exception();
+					}
+
+					std::lock_guard< std::mutex > lock{ mutex };
+
+					if ( partError && !error )
+					{
+						error = partError;
+					}
+
+					if ( ++done == partsCount )
+					{
+						ended.notify_all();
+					}
+				}
+			}
+		};
+
+		using ParallelForStatePtr = std::shared_ptr< ParallelForState >;
+
+		class ParallelWorkers
+		{
+		public:
+			explicit ParallelWorkers( uint32_t count )
+			{
+				try
+				{
+					for ( uint32_t i = 0u; i < count; ++i )
+					{
+						m_threads.emplace_back( [this]()
+							{
+								doRun();
+							} );
+					}
+				}
+				catch ( std::system_error & )
+				{
+					// Fewer workers only means that the calling threads process more parts.
+				}
+			}
+
+			~ParallelWorkers()noexcept
+			{
+				{
+					std::lock_guard< std::mutex > lock{ m_mutex };
+					m_terminate = true;
+				}
+				m_wakeUp.notify_all();
+
+				for ( auto & thread : m_threads )
+				{
+					thread.join();
+				}
+			}
+
+			uint32_t getCount()const
+			{
+				return uint32_t( m_threads.size() );
+			}
+
+			void push( ParallelForStatePtr state
+				, uint32_t count )
+			{
+				{
+					std::lock_guard< std::mutex > lock{ m_mutex };
+
+					for ( uint32_t i = 0u; i < count; ++i )
+					{
+						m_pending.push_back( state );
+					}
+				}
+				m_wakeUp.notify_all();
+			}
+
+		private:
+			void doRun()
+			{
+				std::unique_lock< std::mutex > lock{ m_mutex };
+
+				while ( !m_terminate )
+				{
+					if ( m_pending.empty() )
+					{
+						m_wakeUp.wait( lock );
+					}
+					else
+					{
+						auto state = std::move( m_pending.front() );
+						m_pending.pop_front();
+						lock.unlock();
+						// The state may already be fully processed, by the calling thread.
+						state->run();
+						state.reset();
+						lock.lock();
+					}
+				}
+			}
+
+		private:
+			std::vector< std::thread > m_threads;
+			std::mutex m_mutex;
+			std::condition_variable m_wakeUp;
+			std::deque< ParallelForStatePtr > m_pending;
+			bool m_terminate{ false };
+		};
+
+		ParallelWorkers & getWorkers()
+		{
+			// The calling thread processes parts too.
+			static ParallelWorkers result{ getParallelThreadsCount() - 1u };
+			return result;
+		}
+	}
+
+	uint32_t getParallelThreadsCount()
+	{
+		static uint32_t const result = std::max( 1u, std::thread::hardware_concurrency() );
+		return result;
+	}
+
+	void parallelFor( size_t count
+		, uint32_t partsCount
+		, ParallelForFunc const & func )
+	{
+		partsCount = partsCount
+			? partsCount
+			: getParallelThreadsCount();
+
+		if ( partsCount <= 1u )
+		{
+			func( 0u, 0u, count );
+			return;
+		}
+
+		auto state = std::make_shared< ParallelForState >();
+		state->func = &func;
+		state->count = count;
+		state->partSize = ( count + partsCount - 1u ) / partsCount;
+		state->partsCount = partsCount;
+		auto & workers = getWorkers();
+		workers.push( state, std::min( partsCount - 1u, workers.getCount() ) );
+		state->run();
+		std::unique_lock< std::mutex > lock{ state->mutex };
+		state->ended.wait( lock
+			, [&state]()
+			{
+				return state->done == state->partsCount;
+			} );
+
+		if ( state->error )
+		{
+			std::rethrow_exception( state->error );
+		}
+	}
+}
@@ -1,6 +1,7 @@
 #include "CastorUtils/Multithreading/WorkerThread.hpp"
 
 #include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Miscellaneous/Profiler.hpp"
 
 namespace castor
 {
@@ -58,11 +59,17 @@ namespace castor
 
 	void WorkerThread::doRun()
 	{
+		CU_ProfileThread( cuT( "WorkerThread" ) );
+
 		while ( !m_terminate )
 		{
 			if ( m_start )
 			{
-				m_currentJob();
+				{
+					CU_ProfileScope( "WorkerThread::job" );
+					m_currentJob();
+				}
+
 				m_start = false;
 				onEnded( *this );
 			}
@@ -7,6 +7,9 @@
 
 #include <cpuid.h>
 
+#include <algorithm>
+#include <cstdlib>
+
 namespace castor
 {
 	namespace Platform
@@ -17,7 +20,8 @@ namespace castor
 			uint32_t b;
 			uint32_t c;
 			uint32_t d;
-			__get_cpuid( func, &a, &b, &c, &d );
+			// Sub-leaf 0, the extended features leaf (7) depends on it.
+			__get_cpuid_count( func, 0u, &a, &b, &c, &d );
 			p_data[0] = int32_t( a );
 			p_data[1] = int32_t( b );
 			p_data[2] = int32_t( c );
@@ -31,7 +35,8 @@ namespace castor
 			auto read = fread( res, 1, sizeof( res ) - 1, fp );
 			CU_Ensure( read && read < sizeof( res ) );
 			pclose( fp );
-			return uint32_t( res[0] );
+			res[read] = 0;
+			return std::max( 1u, uint32_t( std::strtoul( res, nullptr, 10 ) ) );
 		}
 	}
 }
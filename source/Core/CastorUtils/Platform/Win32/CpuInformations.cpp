@@ -16,7 +16,7 @@ namespace castor
 
 		void callCpuid( uint32_t func, std::array< int32_t, 4 > & p_data )
 		{
-			__cpuid( p_data.data(), func );
+			__cpuidex( p_data.data(), int( func ), 0 );
 		}
 
 #else
@@ -27,7 +27,7 @@ namespace castor
 			uint32_t b;
 			uint32_t c;
 			uint32_t d;
-			__get_cpuid( func, &a, &b, &c, &d );
+			__get_cpuid_count( func, 0u, &a, &b, &c, &d );
 			p_data[0] = int32_t( a );
 			p_data[1] = int32_t( b );
 			p_data[2] = int32_t( c );
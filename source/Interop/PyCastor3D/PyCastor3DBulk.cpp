@@ -0,0 +1,563 @@
+#include "PyCastor3D/PyCastor3DPch.hpp"
+
+#include "PyCastor3D/PyCastor3DPrerequisites.hpp"
+
+#include <Castor3D/Event/Frame/CpuFunctorEvent.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace cpy
+{
+	namespace
+	{
+		// Position (3), orientation quaternion x, y, z, w (4), scale (3).
+		static uint32_t constexpr TransformStride = 10u;
+		// Column major matrix.
+		static uint32_t constexpr MatrixStride = 16u;
+		// Minimum (3), maximum (3).
+		static uint32_t constexpr BoundsStride = 6u;
+
+		void ValueError( char const * message )
+		{
+			PyErr_SetString( PyExc_ValueError, message );
+			py::throw_error_already_set();
+		}
+
+		/**
+		 *\~english
+		 *\brief		Gives access to a C contiguous float32 buffer, through the buffer protocol (NumPy arrays, array.array, memoryview...).
+		 *\~french
+		 *\brief		Donne accès à un tampon float32 contigu, via le buffer protocol (tableaux NumPy, array.array, memoryview...).
+		 */
+		class FloatBuffer
+		{
+		public:
+			FloatBuffer( py::object const & object
+				, uint32_t stride
+				, bool writable )
+			{
+				if ( PyObject_GetBuffer( object.ptr()
+					, &m_view
+					, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | ( writable ? PyBUF_WRITABLE : 0 ) ) )
+				{
+					py::throw_error_already_set();
+				}
+
+				std::string format{ m_view.format ? m_view.format : "B" };
+				auto count = size_t( m_view.len ) / sizeof( float );
+
+				if ( m_view.itemsize != sizeof( float )
+					|| format.empty()
+					|| format.back() != 'f'
+					|| count % stride )
+				{
+					PyBuffer_Release( &m_view );
+					ValueError( "Expected a contiguous float32 buffer, with a whole number of elements" );
+				}
+
+				m_count = count / stride;
+			}
+
+			~FloatBuffer()
+			{
+				PyBuffer_Release( &m_view );
+			}
+
+			FloatBuffer( FloatBuffer const & ) = delete;
+			FloatBuffer & operator=( FloatBuffer const & ) = delete;
+
+			size_t size()const
+			{
+				return m_count;
+			}
+
+			float * data()const
+			{
+				return static_cast< float * >( m_view.buf );
+			}
+
+		private:
+			Py_buffer m_view;
+			size_t m_count{ 0u };
+		};
+
+		/**
+		 *\~english
+		 *\brief		Releases the GIL for its lifetime, so that the render thread can run Python callbacks meanwhile.
+		 *\~french
+		 *\brief		Relâche le GIL pendant sa durée de vie, afin que le thread de rendu puisse exécuter des callbacks Python pendant ce temps.
+		 */
+		class GilRelease
+		{
+		public:
+			GilRelease()
+				: m_state{ PyEval_SaveThread() }
+			{
+			}
+
+			~GilRelease()
+			{
+				PyEval_RestoreThread( m_state );
+			}
+
+			GilRelease( GilRelease const & ) = delete;
+			GilRelease & operator=( GilRelease const & ) = delete;
+
+		private:
+			PyThreadState * m_state;
+		};
+
+		void checkCount( FloatBuffer const & buffer
+			, size_t count )
+		{
+			if ( buffer.size() != count )
+			{
+				ValueError( "The buffer elements count doesn't match the batch size" );
+			}
+		}
+
+		void applyTransform( SceneNode & node
+			, float const * transform )
+		{
+			node.setPosition( Point3f{ transform[0], transform[1], transform[2] } );
+			node.setOrientation( Quaternion{ transform[3], transform[4], transform[5], transform[6] } );
+			node.setScale( Point3f{ transform[7], transform[8], transform[9] } );
+		}
+	}
+
+	enum class PassParameter
+	{
+		eDiffuse,
+		eSpecular,
+		eShininess,
+		eEmissive,
+		eOpacity,
+	};
+
+	uint32_t getComponentCount( PassParameter parameter )
+	{
+		return ( parameter == PassParameter::eDiffuse || parameter == PassParameter::eSpecular )
+			? 3u
+			: 1u;
+	}
+
+	/**
+	 *\~english
+	 *\brief		A set of scene nodes, read and updated at once from float buffers.
+	 *\remarks		The updates are applied by a single CPU event, during the next frame.
+	 *				<br />The reads wait for the render loop to finish updating the scenes, so they can be done from any thread, and give the state of the last updated frame.
+	 *\~french
+	 *\brief		Un ensemble de noeuds de scène, lus et mis à jour en une fois depuis des tampons de flottants.
+	 *\remarks		Les mises à jour sont appliquées par un unique évènement CPU, lors de la prochaine frame.
+	 *				<br />Les lectures attendent que la boucle de rendu ait fini de mettre à jour les scènes, elles peuvent donc être faites depuis n'importe quel thread, et donnent l'état de la dernière frame mise à jour.
+	 */
+	class NodeBatch
+	{
+	public:
+		NodeBatch( Scene & scene
+			, SceneNodePtrArray nodes )
+			: m_scene{ &scene }
+			, m_nodes{ std::move( nodes ) }
+		{
+		}
+
+		size_t size()const
+		{
+			return m_nodes.size();
+		}
+
+		SceneNodeSPtr getNode( size_t index )const
+		{
+			if ( index >= m_nodes.size() )
+			{
+				IndexError();
+				py::throw_error_already_set();
+			}
+
+			return m_nodes[index];
+		}
+
+		void setTransforms( py::object const & transforms )const
+		{
+			FloatBuffer buffer{ transforms, TransformStride, false };
+			checkCount( buffer, m_nodes.size() );
+			// The source buffer may be modified before the event is processed.
+			std::vector< float > values{ buffer.data(), buffer.data() + buffer.size() * TransformStride };
+			m_scene->getEngine()->postEvent( makeCpuFunctorEvent( EventType::ePreRender
+				, [nodes = m_nodes, values = std::move( values )]()
+				{
+					auto transform = values.data();
+
+					for ( auto & node : nodes )
+					{
+						applyTransform( *node, transform );
+						transform += TransformStride;
+					}
+				} ) );
+		}
+
+		void getWorldMatrices( py::object const & matrices )const
+		{
+			FloatBuffer buffer{ matrices, MatrixStride, true };
+			checkCount( buffer, m_nodes.size() );
+			doReadLocked( [this, &buffer]()
+				{
+					auto matrix = buffer.data();
+
+					for ( auto & node : m_nodes )
+					{
+						auto & derived = node->getDerivedTransformationMatrix();
+						std::copy( derived.constPtr(), derived.constPtr() + MatrixStride, matrix );
+						matrix += MatrixStride;
+					}
+				} );
+		}
+
+		void getBounds( py::object const & bounds )const
+		{
+			FloatBuffer buffer{ bounds, BoundsStride, true };
+			checkCount( buffer, m_nodes.size() );
+			doReadLocked( [this, &buffer]()
+				{
+					auto box = buffer.data();
+
+					for ( auto & node : m_nodes )
+					{
+						auto & matrix = node->getDerivedTransformationMatrix();
+						// Taken from the world matrix, since the node's position may be modified by a pending event.
+						auto position = castor::matrix::getTransformed( matrix, Point3f{} );
+						BoundingBox result{ position, position };
+						bool first = true;
+
+						for ( auto & object : node->getObjects() )
+						{
+							if ( object.get().getType() == MovableType::eGeometry )
+							{
+								auto aabb = static_cast< Geometry const & >( object.get() ).getBoundingBox().getAxisAligned( matrix );
+								result = first
+									? aabb
+									: result.getUnion( aabb );
+								first = false;
+							}
+						}
+
+						auto min = result.getMin();
+						auto max = result.getMax();
+						std::copy( min.constPtr(), min.constPtr() + 3u, box );
+						std::copy( max.constPtr(), max.constPtr() + 3u, box + 3u );
+						box += BoundsStride;
+					}
+				} );
+		}
+
+	private:
+		template< typename FuncT >
+		void doReadLocked( FuncT func )const
+		{
+			// Declared first, the GIL is taken back once the locks are released.
+			GilRelease gil;
+			// The render loop updates the scenes while holding the scene cache lock.
+			auto scenesLock( castor::makeUniqueLock( m_scene->getEngine()->getSceneCache() ) );
+			// The geometries are attached to their node while holding the geometry cache lock.
+			auto geometriesLock( castor::makeUniqueLock( m_scene->getGeometryCache() ) );
+			func();
+		}
+
+	private:
+		Scene * m_scene;
+		SceneNodePtrArray m_nodes;
+	};
+
+	/**
+	 *\~english
+	 *\brief		A set of materials, whose passes parameters are read and edited at once from float buffers.
+	 *\remarks		The edits are applied by a single CPU event, during the next frame.
+	 *\~french
+	 *\brief		Un ensemble de matériaux, dont les paramètres des passes sont lus et modifiés en une fois depuis des tampons de flottants.
+	 *\remarks		Les modifications sont appliquées par un unique évènement CPU, lors de la prochaine frame.
+	 */
+	class MaterialBatch
+	{
+	public:
+		MaterialBatch( Engine & engine
+			, MaterialPtrArray materials )
+			: m_engine{ &engine }
+			, m_materials{ std::move( materials ) }
+		{
+		}
+
+		size_t size()const
+		{
+			return m_materials.size();
+		}
+
+		MaterialSPtr getMaterial( size_t index )const
+		{
+			if ( index >= m_materials.size() )
+			{
+				IndexError();
+				py::throw_error_already_set();
+			}
+
+			return m_materials[index];
+		}
+
+		void setParameter( PassParameter parameter
+			, py::object const & values )const
+		{
+			auto stride = getComponentCount( parameter );
+			FloatBuffer buffer{ values, stride, false };
+			checkCount( buffer, m_materials.size() );
+			std::vector< float > copy{ buffer.data(), buffer.data() + buffer.size() * stride };
+			m_engine->postEvent( makeCpuFunctorEvent( EventType::ePreRender
+				, [materials = m_materials, parameter, stride, copy = std::move( copy )]()
+				{
+					auto value = copy.data();
+
+					for ( auto & material : materials )
+					{
+						for ( auto & pass : *material )
+						{
+							doSetParameter( *material, *pass, parameter, value );
+						}
+
+						value += stride;
+					}
+				} ) );
+		}
+
+		void getParameter( PassParameter parameter
+			, py::object const & values )const
+		{
+			auto stride = getComponentCount( parameter );
+			FloatBuffer buffer{ values, stride, true };
+			checkCount( buffer, m_materials.size() );
+			auto value = buffer.data();
+
+			for ( auto & material : m_materials )
+			{
+				// The first pass gives the material's values.
+				if ( material->getPassCount() )
+				{
+					doGetParameter( *material, *material->getPass( 0u ), parameter, value );
+				}
+
+				value += stride;
+			}
+		}
+
+	private:
+		static void doSetParameter( Material const & material
+			, Pass & pass
+			, PassParameter parameter
+			, float const * value )
+		{
+			switch ( parameter )
+			{
+			case PassParameter::eEmissive:
+				pass.setEmissive( value[0] );
+				break;
+			case PassParameter::eOpacity:
+				pass.setOpacity( value[0] );
+				break;
+			default:
+				// Diffuse, specular and shininess only exist for Phong passes.
+				if ( material.getType() == MaterialType::ePhong )
+				{
+					auto & phong = static_cast< PhongPass & >( pass );
+
+					if ( parameter == PassParameter::eDiffuse )
+					{
+						phong.setDiffuse( RgbColour::fromRGB( Point3f{ value[0], value[1], value[2] } ) );
+					}
+					else if ( parameter == PassParameter::eSpecular )
+					{
+						phong.setSpecular( RgbColour::fromRGB( Point3f{ value[0], value[1], value[2] } ) );
+					}
+					else
+					{
+						phong.setShininess( value[0] );
+					}
+				}
+				break;
+			}
+		}
+
+		static void doGetParameter( Material const & material
+			, Pass const & pass
+			, PassParameter parameter
+			, float * value )
+		{
+			switch ( parameter )
+			{
+			case PassParameter::eEmissive:
+				value[0] = pass.getEmissive();
+				break;
+			case PassParameter::eOpacity:
+				value[0] = pass.getOpacity();
+				break;
+			default:
+				if ( material.getType() == MaterialType::ePhong )
+				{
+					auto & phong = static_cast< PhongPass const & >( pass );
+
+					if ( parameter == PassParameter::eShininess )
+					{
+						value[0] = phong.getShininess().value();
+					}
+					else
+					{
+						auto colour = toRGBFloat( parameter == PassParameter::eDiffuse
+							? phong.getDiffuse()
+							: phong.getSpecular() );
+						std::copy( colour.constPtr(), colour.constPtr() + 3u, value );
+					}
+				}
+				break;
+			}
+		}
+
+	private:
+		Engine * m_engine;
+		MaterialPtrArray m_materials;
+	};
+
+	NodeBatch createInstances( Scene & scene
+		, String const & prefix
+		, MeshSPtr mesh
+		, py::object const & transforms
+		, SceneNodeSPtr parent )
+	{
+		FloatBuffer buffer{ transforms, TransformStride, false };
+		SceneNodePtrArray nodes;
+		nodes.reserve( buffer.size() );
+		auto transform = buffer.data();
+
+		// The nodes are not in the scene graph yet, so they can be set up from this thread.
+		for ( size_t i = 0u; i < buffer.size(); ++i )
+		{
+			auto node = std::make_shared< SceneNode >( prefix + string::toString( i ), scene );
+			applyTransform( *node, transform );
+			nodes.push_back( node );
+			transform += TransformStride;
+		}
+
+		if ( !parent )
+		{
+			parent = scene.getObjectRootNode();
+		}
+
+		scene.getEngine()->postEvent( makeCpuFunctorEvent( EventType::ePreRender
+			, [&scene, nodes, mesh, parent]()
+			{
+				auto & nodeCache = scene.getSceneNodeCache();
+				auto & geometryCache = scene.getGeometryCache();
+
+				for ( auto & node : nodes )
+				{
+					// A duplicate name leaves the existing node untouched.
+					if ( nodeCache.add( node->getName(), node ) == node )
+					{
+						node->attachTo( *parent );
+
+						if ( mesh )
+						{
+							geometryCache.add( node->getName(), *node, mesh );
+						}
+					}
+				}
+			} ) );
+		return NodeBatch{ scene, std::move( nodes ) };
+	}
+
+	NodeBatch findNodes( Scene & scene
+		, py::list const & names )
+	{
+		auto & cache = scene.getSceneNodeCache();
+		SceneNodePtrArray nodes;
+		auto count = py::len( names );
+		nodes.reserve( size_t( count ) );
+
+		for ( auto i = 0; i < count; ++i )
+		{
+			auto node = cache.find( py::extract< String >( names[i] )() );
+
+			if ( !node )
+			{
+				KeyError();
+				py::throw_error_already_set();
+			}
+
+			nodes.push_back( node );
+		}
+
+		return NodeBatch{ scene, std::move( nodes ) };
+	}
+
+	MaterialBatch findMaterials( Engine & engine
+		, py::list const & names )
+	{
+		auto & cache = engine.getMaterialCache();
+		MaterialPtrArray materials;
+		auto count = py::len( names );
+		materials.reserve( size_t( count ) );
+
+		for ( auto i = 0; i < count; ++i )
+		{
+			auto material = cache.find( py::extract< String >( names[i] )() );
+
+			if ( !material )
+			{
+				KeyError();
+				py::throw_error_already_set();
+			}
+
+			materials.push_back( material );
+		}
+
+		return MaterialBatch{ engine, std::move( materials ) };
+	}
+}
+
+void ExportCastor3DBulk()
+{
+	// The bulk entry points live in the "castor.gfx" sub-module, created by ExportCastor3D.
+	py::object l_module( py::handle<>( py::borrowed( PyImport_AddModule( "castor.gfx" ) ) ) );
+	py::scope l_scope = l_module;
+	/**@group_name PassParameter */
+	//@{
+	py::enum_< cpy::PassParameter >( "PassParameter" )
+		.value( "DIFFUSE", cpy::PassParameter::eDiffuse )
+		.value( "SPECULAR", cpy::PassParameter::eSpecular )
+		.value( "SHININESS", cpy::PassParameter::eShininess )
+		.value( "EMISSIVE", cpy::PassParameter::eEmissive )
+		.value( "OPACITY", cpy::PassParameter::eOpacity )
+		;
+	//@}
+	/**@group_name NodeBatch */
+	//@{
+	py::class_< cpy::NodeBatch >( "NodeBatch", py::no_init )
+		.def( "__len__", &cpy::NodeBatch::size )
+		.def( "__getitem__", &cpy::NodeBatch::getNode )
+		.def( "set_transforms", &cpy::NodeBatch::setTransforms, "Sets the nodes transforms, from a (N, 10) float32 buffer: position, orientation (x, y, z, w), scale" )
+		.def( "get_world_matrices", &cpy::NodeBatch::getWorldMatrices, "Fills a (N, 16) float32 buffer with the nodes column major world matrices, from the last updated frame (callable from any thread)" )
+		.def( "get_bounds", &cpy::NodeBatch::getBounds, "Fills a (N, 6) float32 buffer with the nodes world bounding boxes: min, max, from the last updated frame (callable from any thread)" )
+		;
+	py::def( "create_instances"
+		, &cpy::createInstances
+		, ( py::arg( "scene" ), py::arg( "prefix" ), py::arg( "mesh" ), py::arg( "transforms" ), py::arg( "parent" ) = SceneNodeSPtr{} )
+		, "Creates one node and geometry per transform of a (N, 10) float32 buffer" );
+	py::def( "find_nodes", &cpy::findNodes, "Creates a batch from existing scene nodes names" );
+	//@}
+	/**@group_name MaterialBatch */
+	//@{
+	py::class_< cpy::MaterialBatch >( "MaterialBatch", py::no_init )
+		.def( "__len__", &cpy::MaterialBatch::size )
+		.def( "__getitem__", &cpy::MaterialBatch::getMaterial )
+		.def( "set_parameter", &cpy::MaterialBatch::setParameter, "Sets a parameter of all the materials passes, from a (N, components) float32 buffer" )
+		.def( "get_parameter", &cpy::MaterialBatch::getParameter, "Fills a (N, components) float32 buffer with a parameter of the materials first pass" )
+		;
+	py::def( "find_materials", &cpy::findMaterials, "Creates a batch from existing materials names" );
+	//@}
+}
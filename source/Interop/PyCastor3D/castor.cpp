@@ -10,5 +10,6 @@ BOOST_PYTHON_MODULE( castor )
 
 	ExportCastorUtils();
 	ExportCastor3D();
+	ExportCastor3DBulk();
 }
 
@@ -2,9 +2,15 @@
 
 #include <Castor3D/Model/Mesh/Mesh.hpp>
 #include <Castor3D/Model/Mesh/Submesh/Submesh.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/FaceIndices.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp>
 #include <Castor3D/Miscellaneous/Parameter.hpp>
 
-#include <random>
+#include <CastorUtils/Graphics/Heightmap.hpp>
+#include <CastorUtils/Log/Logger.hpp>
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
+
+#include <atomic>
 
 using namespace castor;
 using namespace castor3d;
@@ -13,57 +19,109 @@ namespace diamond_square_terrain
 {
 	namespace
 	{
-		struct Matrix
+		struct Chunk
+		{
+			uint32_t minX;
+			uint32_t minY;
+			uint32_t maxX;
+			uint32_t maxY;
+			SubmeshSPtr submesh;
+			TriFaceMappingSPtr mapping;
+		};
+
+		InterleavedVertex makeVertex( Heightmap const & map
+			, uint32_t x
+			, uint32_t y
+			, float offset )
+		{
+			auto max = float( map.getSize() - 1u );
+			InterleavedVertex result;
+			result.pos = Point3f{ float( x ), map( x, y ) - offset, float( y ) };
+			result.nml = map.getNormal( x, y );
+			result.tan = map.getTangent( x, y );
+			result.tex = Point3f{ float( x ) / max, float( y ) / max, 0.0f };
+			return result;
+		}
+
+		void fillChunk( Heightmap const & map
+			, float skirt
+			, Chunk & chunk )
 		{
-			inline explicit Matrix( uint32_t p_size )
-				: m_size{ p_size }
-				, m_max{ m_size - 1 }
+			auto width = chunk.maxX - chunk.minX + 1u;
+			auto height = chunk.maxY - chunk.minY + 1u;
+			auto perimeter = 2u * ( width - 1u ) + 2u * ( height - 1u );
+			std::vector< InterleavedVertex > vertices;
+			std::vector< FaceIndices > faces;
+			vertices.reserve( size_t( width ) * height + ( skirt > 0.0f ? perimeter : 0u ) );
+			faces.reserve( 2u * ( size_t( width - 1u ) * ( height - 1u ) + ( skirt > 0.0f ? perimeter : 0u ) ) );
+			auto getIndex = [&chunk, width]( uint32_t x, uint32_t y )
 			{
-				m_map.resize( size_t( m_size ) * m_size );
-			}
+				return ( y - chunk.minY ) * width + ( x - chunk.minX );
+			};
 
-			inline uint32_t getIndex( uint32_t x, uint32_t y, uint32_t size )const
+			for ( auto y = chunk.minY; y <= chunk.maxY; ++y )
 			{
-				return x * size + y;
+				for ( auto x = chunk.minX; x <= chunk.maxX; ++x )
+				{
+					vertices.push_back( makeVertex( map, x, y, 0.0f ) );
+				}
 			}
 
-			inline uint32_t getIndex( uint32_t x, uint32_t y )const
+			for ( auto y = chunk.minY; y < chunk.maxY; ++y )
 			{
-				return getIndex( x, y,  m_size );
+				for ( auto x = chunk.minX; x < chunk.maxX; ++x )
+				{
+					faces.push_back( { { getIndex( x, y ), getIndex( x + 1u, y ), getIndex( x, y + 1u ) } } );
+					faces.push_back( { { getIndex( x + 1u, y ), getIndex( x + 1u, y + 1u ), getIndex( x, y + 1u ) } } );
+				}
 			}
 
-			inline float & operator()( uint32_t x, uint32_t y )
+			if ( skirt > 0.0f )
 			{
-				auto index = getIndex( x, y );
+				// The skirts hang from the chunk borders, walked clockwise so that they face outwards.
+				std::vector< std::pair< uint32_t, uint32_t > > border;
+				border.reserve( perimeter );
 
-				if ( index >= m_map.size() )
+				for ( auto x = chunk.minX; x < chunk.maxX; ++x )
 				{
-					static float dummy = -1;
-					return dummy;
+					border.emplace_back( x, chunk.minY );
 				}
 
-				return m_map[getIndex( x, y )];
-			}
+				for ( auto y = chunk.minY; y < chunk.maxY; ++y )
+				{
+					border.emplace_back( chunk.maxX, y );
+				}
 
-			inline float const & operator()( uint32_t x, uint32_t y )const
-			{
-				auto index = getIndex( x, y );
+				for ( auto x = chunk.maxX; x > chunk.minX; --x )
+				{
+					border.emplace_back( x, chunk.maxY );
+				}
 
-				if ( index >= m_map.size() )
+				for ( auto y = chunk.maxY; y > chunk.minY; --y )
 				{
-					static float dummy = -1;
-					return dummy;
+					border.emplace_back( chunk.minX, y );
 				}
 
-				return m_map[getIndex( x, y )];
-			}
+				auto base = uint32_t( vertices.size() );
 
+				for ( auto & point : border )
+				{
+					vertices.push_back( makeVertex( map, point.first, point.second, skirt ) );
+				}
 
-		private:
-			std::vector< float > m_map;
-			uint32_t m_size;
-			uint32_t m_max;
-		};
+				for ( auto i = 0u; i < perimeter; ++i )
+				{
+					auto next = ( i + 1u ) % perimeter;
+					auto top0 = getIndex( border[i].first, border[i].second );
+					auto top1 = getIndex( border[next].first, border[next].second );
+					faces.push_back( { { top0, base + i, top1 } } );
+					faces.push_back( { { top1, base + i, base + next } } );
+				}
+			}
+
+			chunk.submesh->addPoints( vertices );
+			chunk.mapping->addFaceGroup( faces );
+		}
 	}
 
 	String const Generator::Type = cuT( "diamond_square_terrain" );
@@ -87,8 +145,14 @@ namespace diamond_square_terrain
 		, Parameters const & p_parameters )
 	{
 		String param;
-		uint32_t size = 0u;
+		uint32_t detail = 0u;
 		float roughness = 0.0f;
+		uint32_t seed = 0u;
+		uint32_t threadsCount = 0u;
+		uint32_t chunkSize = DefaultChunkSize;
+		float skirt = -1.0f;
+		Path importPath;
+		Path exportPath;
 
 		if ( p_parameters.get( cuT( "roughness" ), param ) )
 		{
@@ -97,123 +161,112 @@ namespace diamond_square_terrain
 
 		if ( p_parameters.get( cuT( "detail" ), param ) )
 		{
-			size = uint32_t( pow( 2, string::toUInt( param ) ) + 1u );
+			detail = string::toUInt( param );
 		}
 
-		if ( size )
+		if ( p_parameters.get( cuT( "seed" ), param ) )
 		{
-			Matrix map{ size };
-			auto max = size - 1;
-			std::random_device device;
-
-			auto average = []( std::vector< float > p_values )
-			{
-				auto total = std::accumulate( p_values.begin()
-					, p_values.end()
-					, 0.0f
-					, []( float p_accum, float p_value )
-				{
-					if ( p_value != -1 )
-					{
-						p_accum += p_value;
-					}
+			seed = string::toUInt( param );
+		}
 
-					return p_accum;
-				} );
+		if ( p_parameters.get( cuT( "threads" ), param ) )
+		{
+			threadsCount = string::toUInt( param );
+		}
 
-				return total / 4;
-			};
+		if ( p_parameters.get( cuT( "chunk" ), param ) )
+		{
+			chunkSize = std::max( 1u, string::toUInt( param ) );
+		}
 
-			auto square = [&average, &map]( uint32_t p_x
-				, uint32_t p_y
-				, uint32_t p_size
-				, float p_offset )
-			{
-				auto ave = average( { {
-						map( p_x - p_size, p_y - p_size ),   // upper left
-						map( p_x + p_size, p_y - p_size ),   // upper right
-						map( p_x + p_size, p_y + p_size ),   // lower right
-						map( p_x - p_size, p_y + p_size )    // lower left
-					} } );
-				map( p_x, p_y ) = ave + p_offset;
-			};
+		if ( p_parameters.get( cuT( "skirt" ), param ) )
+		{
+			skirt = string::toFloat( param );
+		}
 
-			auto diamond = [&average, &map]( uint32_t p_x
-				, uint32_t p_y
-				, uint32_t p_size
-				, float p_offset )
-			{
-				auto ave = average( { {
-						map( p_x, p_y - p_size ),      // top
-						map( p_x + p_size, p_y ),      // right
-						map( p_x, p_y + p_size ),      // bottom
-						map( p_x - p_size, p_y )       // left
-					} } );
-				map( p_x, p_y ) = ave + p_offset;
-			};
+		if ( p_parameters.get( cuT( "import" ), param ) )
+		{
+			importPath = Path{ param };
+		}
 
-			std::function< void( uint32_t, float ) > divide = [&max
-				, &square
-				, &diamond
-				, &device
-				, &divide]( uint32_t p_size
-				, float p_roughness )
-			{
-				uint32_t half = p_size / 2;
-				auto scale = p_roughness * p_size;
-				std::uniform_real_distribution< float > distribution;
+		if ( p_parameters.get( cuT( "export" ), param ) )
+		{
+			exportPath = Path{ param };
+		}
 
-				if ( half < 1 ) return;
+		Heightmap map;
 
-				for ( auto y = half; y < max; y += p_size )
-				{
-					for ( auto x = half; x < max; x += p_size )
-					{
-						square( x, y, half, distribution( device ) * scale * 2 - scale );
-					}
-				}
+		if ( !importPath.empty() )
+		{
+			if ( !map.load( importPath ) )
+			{
+				Logger::logError( cuT( "DiamondSquareTerrain - Couldn't import heightmap " ) + importPath );
+				return;
+			}
+		}
+		else if ( detail )
+		{
+			map = Heightmap::generate( detail, roughness, seed, threadsCount );
+		}
+		else
+		{
+			return;
+		}
 
-				for ( auto y = 0u; y <= max; y += half )
-				{
-					for ( auto x = ( y + half ) % p_size; x <= max; x += p_size )
-					{
-						diamond( x, y, half, distribution( device ) * scale * 2 - scale );
-					}
-				}
+		if ( !exportPath.empty()
+			&& !map.save( exportPath ) )
+		{
+			Logger::logError( cuT( "DiamondSquareTerrain - Couldn't export heightmap " ) + exportPath );
+		}
 
-				divide( p_size / 2, p_roughness );
-			};
+		auto max = map.getSize() - 1u;
+		chunkSize = std::min( chunkSize, max );
 
-			divide( size, roughness );
+		if ( skirt < 0.0f )
+		{
+			skirt = roughness * float( chunkSize );
+		}
 
-			auto submesh = p_mesh.createSubmesh();
-			auto mapping = std::make_shared< TriFaceMapping >( *submesh );
+		// The submeshes are created here, and filled in parallel, each chunk touching only its own.
+		std::vector< Chunk > chunks;
 
-			for ( auto y = 1u; y < max; y++ )
+		for ( auto minY = 0u; minY < max; minY += chunkSize )
+		{
+			for ( auto minX = 0u; minX < max; minX += chunkSize )
 			{
-				for ( auto x = 1u; x < max; x++ )
-				{
-					submesh->addPoint( float( x ), map( x, y ), float( y ) );
-				}
+				auto submesh = p_mesh.createSubmesh();
+				chunks.push_back( { minX
+					, minY
+					, std::min( minX + chunkSize, max )
+					, std::min( minY + chunkSize, max )
+					, submesh
+					, std::make_shared< TriFaceMapping >( *submesh ) } );
 			}
+		}
 
-			// Generate quads 
-			for ( auto y = 0u; y < max - 2; y++ )
+		threadsCount = threadsCount ? threadsCount : getParallelThreadsCount();
+		threadsCount = std::min( threadsCount, uint32_t( chunks.size() ) );
+		std::atomic< size_t > next{ 0u };
+		auto worker = [&map, &chunks, &next, skirt]()
+		{
+			for ( auto index = next++; index < chunks.size(); index = next++ )
 			{
-				for ( auto x = 0u; x < max - 2; x++ )
-				{
-					mapping->addFace( map.getIndex( x, y, size - 2 )
-						, map.getIndex( x + 1, y, size - 2 )
-						, map.getIndex( x, y + 1, size - 2 ) );
-					mapping->addFace( map.getIndex( x + 1, y, size - 2 )
-						, map.getIndex( x + 1, y + 1, size - 2 )
-						, map.getIndex( x, y + 1, size - 2 ) );
-				}
+				fillChunk( map, skirt, chunks[index] );
 			}
+		};
+		parallelFor( threadsCount
+			, threadsCount
+			, [&worker]( uint32_t, size_t, size_t )
+			{
+				worker();
+			} );
 
-			mapping->computeNormals( true );
-			submesh->setIndexMapping( mapping );
-			p_mesh.computeContainers();
+		for ( auto & chunk : chunks )
+		{
+			chunk.submesh->setIndexMapping( chunk.mapping );
 		}
+
+		// Each chunk gets its own bounds.
+		p_mesh.computeContainers();
 	}
 }
@@ -8,9 +8,38 @@ See LICENSE file in root folder
 
 namespace diamond_square_terrain
 {
+	/**
+	 *\~english
+	 *\brief		Generates a diamond-square terrain, as a grid of chunks.
+	 *\remarks		Parameters:
+	 *				<br />- detail: the heightmap has 2^detail + 1 samples per side.
+	 *				<br />- roughness: the random offsets scale.
+	 *				<br />- seed: the random seed, a given seed always gives the same terrain.
+	 *				<br />- threads: the threads count, 0 (default) to use the hardware concurrency.
+	 *				<br />- chunk: the quads count per chunk side, each chunk being a submesh.
+	 *				<br />- skirt: the depth of the skirts hanging from the chunks borders, 0 to disable them.
+	 *				<br />- import: a heightmap file, used instead of the generated one.
+	 *				<br />- export: a file the heightmap is saved to.
+	 *\~french
+	 *\brief		Génère un terrain diamond-square, sous la forme d'une grille de morceaux.
+	 *\remarks		Paramètres :
+	 *				<br />- detail : la heightmap a 2^detail + 1 échantillons par côté.
+	 *				<br />- roughness : l'échelle des décalages aléatoires.
+	 *				<br />- seed : la graine aléatoire, une graine donnée donne toujours le même terrain.
+	 *				<br />- threads : le nombre de threads, 0 (défaut) pour utiliser la concurrence matérielle.
+	 *				<br />- chunk : le nombre de quads par côté de morceau, chaque morceau étant un submesh.
+	 *				<br />- skirt : la profondeur des jupes pendant aux bords des morceaux, 0 pour les désactiver.
+	 *				<br />- import : un fichier de heightmap, utilisé à la place de celle générée.
+	 *				<br />- export : un fichier dans lequel la heightmap est sauvegardée.
+	 */
 	class Generator
 		: public castor3d::MeshGenerator
 	{
+	public:
+		//!\~english	The default quads count per chunk side.
+		//!\~french		Le nombre par défaut de quads par côté de morceau.
+		static uint32_t constexpr DefaultChunkSize = 128u;
+
 	public:
 		Generator();
 		virtual ~Generator();
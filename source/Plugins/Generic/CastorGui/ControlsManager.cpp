@@ -10,6 +10,8 @@
 
 #include <Castor3D/Engine.hpp>
 #include <Castor3D/Cache/MaterialCache.hpp>
+#include <Castor3D/Event/Frame/CpuFunctorEvent.hpp>
+#include <Castor3D/Event/Frame/FrameListener.hpp>
 #include <Castor3D/Event/Frame/InitialiseEvent.hpp>
 #include <Castor3D/Event/Frame/GpuFunctorEvent.hpp>
 #include <Castor3D/Overlay/BorderPanelOverlay.hpp>
@@ -22,6 +24,17 @@ namespace CastorGui
 	namespace
 	{
 		using LockType = std::unique_lock< std::mutex >;
+
+		// The cells are at least this large, in pixels.
+		static int32_t constexpr MinCellSize = 32;
+		// The maximum cells count on each axis.
+		static int32_t constexpr MaxCells = 128;
+
+		uint64_t getZIndex( Control const & control )
+		{
+			auto background = control.getBackground();
+			return background->getIndex() + background->getLevel() * 1000ull;
+		}
 	}
 
 	ControlsManager::ControlsManager( Engine & engine )
@@ -119,15 +132,30 @@ namespace CastorGui
 	void ControlsManager::addControl( ControlSPtr p_control )
 	{
 		doAddHandler( p_control );
-		LockType lock{ castor::makeUniqueLock( m_mutexControlsById ) };
+		{
+			LockType lock{ castor::makeUniqueLock( m_mutexControlsById ) };
+
+			if ( m_controlsById.find( p_control->getId() ) != m_controlsById.end() )
+			{
+				CU_Exception( "A control with this ID already exists in the manager" );
+			}
 
-		if ( m_controlsById.find( p_control->getId() ) != m_controlsById.end() )
+			m_controlsById.insert( std::make_pair( p_control->getId(), p_control ) );
+		}
 		{
-			CU_Exception( "A control with this ID already exists in the manager" );
+			LockType lock{ castor::makeUniqueLock( m_mutexControlsByZIndex ) };
+			auto index = getZIndex( *p_control );
+			auto it = std::upper_bound( m_controlsByZIndex.begin()
+				, m_controlsByZIndex.end()
+				, index
+				, []( uint64_t lhs, ControlSPtr const & rhs )
+				{
+					return lhs < getZIndex( *rhs );
+				} );
+			m_controlsByZIndex.insert( it, p_control );
 		}
 
-		m_controlsById.insert( std::make_pair( p_control->getId(), p_control ) );
-		m_changed = true;
+		doScheduleUpdate();
 	}
 
 	void ControlsManager::removeControl( uint32_t p_id )
@@ -257,54 +285,171 @@ namespace CastorGui
 
 	EventHandlerSPtr ControlsManager::doGetMouseTargetableHandler( Position const & p_position )const
 	{
-		if ( m_changed )
+		EventHandlerSPtr result;
+		// Registered before loading the grid, so that doUpdate doesn't destroy it while it is read.
+		++m_hitTestReaders;
+
+		if ( auto grid = m_hitTestGrid.load() )
 		{
-			doUpdate();
+			result = doHitTest( *grid, p_position );
 		}
 
-		auto controls = doGetControlsByZIndex();
-		EventHandlerSPtr result;
-		auto it = controls.rbegin();
+		--m_hitTestReaders;
+		return result;
+	}
+
+	EventHandlerSPtr ControlsManager::doHitTest( HitTestGrid const & grid
+		, Position const & position )
+	{
+		auto x = position.x() - grid.origin.x();
+		auto y = position.y() - grid.origin.y();
 
-		while ( !result && it != controls.rend() )
+		if ( x < 0
+			|| y < 0
+			|| x >= int32_t( grid.columns ) * grid.cellSize
+			|| y >= int32_t( grid.rows ) * grid.cellSize )
 		{
-			ControlSPtr control = *it;
-
-			if ( control->catchesMouseEvents()
-					&& control->getAbsolutePosition().x() <= p_position.x()
-					&& control->getAbsolutePosition().x() + int32_t( control->getSize().getWidth() ) > p_position.x()
-					&& control->getAbsolutePosition().y() <= p_position.y()
-					&& control->getAbsolutePosition().y() + int32_t( control->getSize().getHeight() ) > p_position.y()
-			   )
+			return nullptr;
+		}
+
+		auto cell = uint32_t( y / grid.cellSize ) * grid.columns + uint32_t( x / grid.cellSize );
+
+		for ( auto index = grid.cellsOffsets[cell]; index < grid.cellsOffsets[cell + 1u]; ++index )
+		{
+			auto & entry = grid.controls[grid.cellsControls[index]];
+
+			if ( entry.min.x() <= position.x()
+				&& entry.max.x() > position.x()
+				&& entry.min.y() <= position.y()
+				&& entry.max.y() > position.y()
+				&& entry.control->catchesMouseEvents() )
 			{
-				result = control;
+				return entry.control;
 			}
-
-			++it;
 		}
 
-		return result;
+		return nullptr;
 	}
 
-	void ControlsManager::doUpdate()const
+	void ControlsManager::doUpdate()
 	{
-		LockType lock{ castor::makeUniqueLock( m_mutexControlsByZIndex ) };
+		auto grid = std::make_unique< HitTestGrid >();
+		Position min{ std::numeric_limits< int32_t >::max(), std::numeric_limits< int32_t >::max() };
+		Position max{ std::numeric_limits< int32_t >::lowest(), std::numeric_limits< int32_t >::lowest() };
 		{
-			auto handlers = doGetHandlers();
-			m_controlsByZIndex.clear();
+			LockType lock{ castor::makeUniqueLock( m_mutexControlsByZIndex ) };
+			grid->controls.reserve( m_controlsByZIndex.size() );
 
-			for ( auto handler : handlers )
+			for ( auto it = m_controlsByZIndex.rbegin(); it != m_controlsByZIndex.rend(); ++it )
 			{
-				m_controlsByZIndex.push_back( std::static_pointer_cast< Control >( handler ) );
+				auto & control = *it;
+
+				// Enabling and mouse catching are checked on hit, only visibility changes are notified.
+				if ( control->isVisible()
+					&& control->getSize().getWidth()
+					&& control->getSize().getHeight() )
+				{
+					auto position = control->getAbsolutePosition();
+					Position end{ position.x() + int32_t( control->getSize().getWidth() )
+						, position.y() + int32_t( control->getSize().getHeight() ) };
+					min = Position{ std::min( min.x(), position.x() ), std::min( min.y(), position.y() ) };
+					max = Position{ std::max( max.x(), end.x() ), std::max( max.y(), end.y() ) };
+					grid->controls.push_back( { control, position, end } );
+				}
 			}
 		}
 
-		std::sort( m_controlsByZIndex.begin(), m_controlsByZIndex.end(), []( ControlSPtr p_a, ControlSPtr p_b )
+		if ( grid->controls.empty() )
 		{
-			uint64_t a = p_a->getBackground()->getIndex() + p_a->getBackground()->getLevel() * 1000ull;
-			uint64_t b = p_b->getBackground()->getIndex() + p_b->getBackground()->getLevel() * 1000ull;
-			return a < b;
-		} );
+			doPublish( nullptr );
+			return;
+		}
+
+		auto extent = std::max( max.x() - min.x(), max.y() - min.y() );
+		grid->origin = min;
+		grid->cellSize = std::max( MinCellSize, ( extent + MaxCells - 1 ) / MaxCells );
+		grid->columns = uint32_t( ( max.x() - min.x() + grid->cellSize - 1 ) / grid->cellSize );
+		grid->rows = uint32_t( ( max.y() - min.y() + grid->cellSize - 1 ) / grid->cellSize );
+		grid->cellsOffsets.resize( grid->columns * grid->rows + 1u, 0u );
+
+		auto forEachCell = [&grid]( HitTestGrid::Entry const & entry, auto function )
+		{
+			auto minX = uint32_t( ( entry.min.x() - grid->origin.x() ) / grid->cellSize );
+			auto minY = uint32_t( ( entry.min.y() - grid->origin.y() ) / grid->cellSize );
+			auto maxX = uint32_t( ( entry.max.x() - 1 - grid->origin.x() ) / grid->cellSize );
+			auto maxY = uint32_t( ( entry.max.y() - 1 - grid->origin.y() ) / grid->cellSize );
+
+			for ( auto y = minY; y <= maxY; ++y )
+			{
+				for ( auto x = minX; x <= maxX; ++x )
+				{
+					function( y * grid->columns + x );
+				}
+			}
+		};
+
+		// Count the controls in each cell, then turn the counts into offsets.
+		for ( auto & entry : grid->controls )
+		{
+			forEachCell( entry, [&grid]( uint32_t cell )
+				{
+					++grid->cellsOffsets[cell + 1u];
+				} );
+		}
+
+		for ( size_t cell = 1u; cell < grid->cellsOffsets.size(); ++cell )
+		{
+			grid->cellsOffsets[cell] += grid->cellsOffsets[cell - 1u];
+		}
+
+		// Fill the cells, keeping the decreasing z-index order.
+		auto counts = grid->cellsOffsets;
+		grid->cellsControls.resize( grid->cellsOffsets.back() );
+
+		for ( uint32_t index = 0u; index < grid->controls.size(); ++index )
+		{
+			forEachCell( grid->controls[index], [&grid, &counts, index]( uint32_t cell )
+				{
+					grid->cellsControls[counts[cell]++] = index;
+				} );
+		}
+
+		doPublish( std::move( grid ) );
+	}
+
+	void ControlsManager::doPublish( HitTestGridPtr grid )
+	{
+		if ( m_currentGrid )
+		{
+			m_retiredGrids.push_back( std::move( m_currentGrid ) );
+		}
+
+		m_currentGrid = std::move( grid );
+		m_hitTestGrid.store( m_currentGrid.get() );
+
+		// A hit test starting from now reads the new grid, so the replaced ones are unreachable if none is running.
+		if ( !m_hitTestReaders )
+		{
+			m_retiredGrids.clear();
+		}
+	}
+
+	void ControlsManager::doScheduleUpdate()
+	{
+		if ( !m_changed.exchange( true ) )
+		{
+			getFrameListener().postEvent( makeCpuFunctorEvent( EventType::ePreRender
+				, [this]()
+				{
+					m_changed = false;
+					doUpdate();
+				} ) );
+		}
+	}
+
+	void ControlsManager::doInvalidate()
+	{
+		doScheduleUpdate();
 	}
 
 	void ControlsManager::doFlush()
@@ -324,11 +469,22 @@ namespace CastorGui
 				CU_Exception( "This control does not exist in the manager." );
 			}
 
-			m_controlsById.erase( it );
 			handler = it->second.lock();
+			m_controlsById.erase( it );
+		}
+		{
+			LockType lock{ castor::makeUniqueLock( m_mutexControlsByZIndex ) };
+			auto it = std::find( m_controlsByZIndex.begin()
+				, m_controlsByZIndex.end()
+				, std::static_pointer_cast< Control >( handler ) );
+
+			if ( it != m_controlsByZIndex.end() )
+			{
+				m_controlsByZIndex.erase( it );
+			}
 		}
 
-		m_changed = true;
+		doScheduleUpdate();
 		doRemoveHandler( handler );
 	}
 
@@ -11,6 +11,8 @@ See LICENSE file in root folder
 
 #include <CastorUtils/Graphics/Position.hpp>
 
+#include <atomic>
+
 namespace CastorGui
 {
 	/**
@@ -23,6 +25,7 @@ namespace CastorGui
 		: public std::enable_shared_from_this< ControlsManager >
 		, public castor3d::UserInputListener
 	{
+		friend class Control;
 		friend class ButtonCtrl;
 		friend class ComboBoxCtrl;
 		friend class EditCtrl;
@@ -182,6 +185,38 @@ namespace CastorGui
 		*/
 		void disconnectEvents( SliderCtrl & p_control );
 
+	private:
+		/**
+		*\brief
+		*	The controls that can be targeted by mouse, spread over a grid of screen cells.
+		*\remarks
+		*	Built on the render thread, and never modified once published, so the input thread can read it without locking.
+		*/
+		struct HitTestGrid
+		{
+			struct Entry
+			{
+				ControlSPtr control;
+				castor::Position min;
+				castor::Position max;
+			};
+			//! The position of the first cell.
+			castor::Position origin;
+			//! The cells dimensions, in pixels.
+			int32_t cellSize;
+			//! The cells count on X axis.
+			uint32_t columns;
+			//! The cells count on Y axis.
+			uint32_t rows;
+			//! The controls, sorted by decreasing z-index.
+			std::vector< Entry > controls;
+			//! The index of each cell's first control in cellsControls, plus the end index.
+			std::vector< uint32_t > cellsOffsets;
+			//! The controls of each cell, sorted by decreasing z-index.
+			std::vector< uint32_t > cellsControls;
+		};
+		using HitTestGridPtr = std::unique_ptr< HitTestGrid const >;
+
 	private:
 		/**
 		 *copydoc		castor3d::UserInputListener::doInitialise
@@ -209,9 +244,38 @@ namespace CastorGui
 		castor3d::EventHandlerSPtr doGetMouseTargetableHandler( castor::Position const & p_position )const override;
 		/**
 		*\brief
-		*	Updates the z-index ordered controls array
+		*	Retrieves the first control which can be targeted by mouse, at given position, in a hit test grid
+		*\param[in] grid
+		*	The hit test grid
+		*\param[in] position
+		*	The mouse position
+		*/
+		static castor3d::EventHandlerSPtr doHitTest( HitTestGrid const & grid
+			, castor::Position const & position );
+		/**
+		*\brief
+		*	Rebuilds the hit test grid from the z-index ordered controls array, and publishes it
+		*\remarks
+		*	Called on the render thread, the replaced grids are destroyed once no hit test reads them
+		*/
+		void doUpdate();
+		/**
+		*\brief
+		*	Publishes a hit test grid, and destroys the replaced ones if no hit test is running
+		*\param[in] grid
+		*	The new grid, null if no control can be hit
+		*/
+		void doPublish( HitTestGridPtr grid );
+		/**
+		*\brief
+		*	Schedules the hit test grid rebuild, on the render thread, before the next frame
+		*/
+		void doScheduleUpdate();
+		/**
+		*\brief
+		*	Tells the manager a control has been moved, resized, shown or hidden.
 		*/
-		void doUpdate()const;
+		void doInvalidate();
 		/**
 		*\brief
 		*	Removes a control
@@ -237,14 +301,22 @@ namespace CastorGui
 	private:
 		//! The mutex used to protect the controls by z-index.
 		mutable std::mutex m_mutexControlsByZIndex;
-		//! The controls array
-		mutable std::vector< ControlSPtr > m_controlsByZIndex;
+		//! The controls array, sorted by z-index
+		std::vector< ControlSPtr > m_controlsByZIndex;
+		//! The published hit test grid, read by the input thread without locking.
+		std::atomic< HitTestGrid const * > m_hitTestGrid{ nullptr };
+		//! The hit tests in progress, the replaced grids are destroyed only when there is none.
+		mutable std::atomic< uint32_t > m_hitTestReaders{ 0u };
+		//! The grid currently published, only accessed by the render thread.
+		HitTestGridPtr m_currentGrid;
+		//! The replaced grids, waiting for their last readers, only accessed by the render thread.
+		std::vector< HitTestGridPtr > m_retiredGrids;
 		//! The mutex used to protect the controls by ID.
 		mutable std::mutex m_mutexControlsById;
 		//! The controls map, sorted by ID
 		std::map< uint32_t, ControlWPtr > m_controlsById;
-		//! Tells the controls array has changed
-		bool m_changed;
+		//! Tells the hit test grid rebuild is scheduled
+		std::atomic_bool m_changed;
 		//! The default font used by controls
 		castor::FontWPtr m_defaultFont;
 		//! The button click event connections.
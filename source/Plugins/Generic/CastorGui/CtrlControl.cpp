@@ -103,6 +103,7 @@ namespace CastorGui
 		}
 
 		doSetPosition( m_position );
+		doInvalidate();
 	}
 
 	Position Control::getAbsolutePosition()const
@@ -130,6 +131,7 @@ namespace CastorGui
 		}
 
 		doSetSize( m_size );
+		doInvalidate();
 	}
 
 	void Control::setBackgroundMaterial( MaterialSPtr p_value )
@@ -173,6 +175,7 @@ namespace CastorGui
 		panel->setVisible( p_value );
 		panel.reset();
 		doSetVisible( p_value );
+		doInvalidate();
 	}
 
 	bool Control::isVisible()const
@@ -217,6 +220,16 @@ namespace CastorGui
 		doUpdateStyle();
 	}
 
+	void Control::doInvalidate()
+	{
+		auto manager = getControlsManager();
+
+		if ( manager )
+		{
+			manager->doInvalidate();
+		}
+	}
+
 	bool Control::doIsVisible()const
 	{
 		auto panel = getBackground();
@@ -245,6 +245,11 @@ namespace CastorGui
 		*/
 		bool doIsVisible()const;
 
+	private:
+		/** Tells the controls manager the control hit test area has changed
+		*/
+		void doInvalidate();
+
 	private:
 		/** Creates the control's overlays and sub-controls
 		*/
@@ -0,0 +1,248 @@
+#include "AnimationThrottleTest.hpp"
+
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		// A camera covering 1000 pixels for one unit at one unit of distance.
+		static float constexpr ProjectionScale = 1000.0f;
+		static Milliseconds constexpr FrameTime{ 16u };
+
+		AnimationThrottle::State makeState( uint32_t phase )
+		{
+			AnimationThrottle::State result;
+			result.phase = phase;
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	AnimationThrottleTest::AnimationThrottleTest()
+		: TestCase( "AnimationThrottleTest" )
+	{
+	}
+
+	AnimationThrottleTest::~AnimationThrottleTest()
+	{
+	}
+
+	void AnimationThrottleTest::doRegisterTests()
+	{
+		doRegisterTest( "ProjectedSize", std::bind( &AnimationThrottleTest::ProjectedSize, this ) );
+		doRegisterTest( "Intervals", std::bind( &AnimationThrottleTest::Intervals, this ) );
+		doRegisterTest( "Staggering", std::bind( &AnimationThrottleTest::Staggering, this ) );
+		doRegisterTest( "ElapsedTime", std::bind( &AnimationThrottleTest::ElapsedTime, this ) );
+		doRegisterTest( "PoseBlend", std::bind( &AnimationThrottleTest::PoseBlend, this ) );
+		doRegisterTest( "BoundsScale", std::bind( &AnimationThrottleTest::BoundsScale, this ) );
+		doRegisterTest( "Disabled", std::bind( &AnimationThrottleTest::Disabled, this ) );
+	}
+
+	void AnimationThrottleTest::ProjectedSize()
+	{
+		CT_EQUAL( AnimationThrottle::getProjectedSize( 1.0f, 10.0f, ProjectionScale ), 200.0f );
+		CT_EQUAL( AnimationThrottle::getProjectedSize( 1.0f, 20.0f, ProjectionScale ), 100.0f );
+		// Camera inside of the bounds.
+		CT_EQUAL( AnimationThrottle::getProjectedSize( 1.0f, 0.5f, ProjectionScale ), std::numeric_limits< float >::max() );
+	}
+
+	void AnimationThrottleTest::Intervals()
+	{
+		AnimationThrottle throttle{ 256.0f, 8u, 16u };
+		CT_EQUAL( throttle.getInterval( 1000.0f, true ), 1u );
+		CT_EQUAL( throttle.getInterval( 256.0f, true ), 1u );
+		CT_EQUAL( throttle.getInterval( 128.0f, true ), 2u );
+		CT_EQUAL( throttle.getInterval( 100.0f, true ), 3u );
+		CT_EQUAL( throttle.getInterval( 32.0f, true ), 8u );
+		CT_EQUAL( throttle.getInterval( 1.0f, true ), 8u );
+		CT_EQUAL( throttle.getInterval( 0.0f, true ), 8u );
+		CT_EQUAL( throttle.getInterval( 1000.0f, false ), 16u );
+
+		// The interval never decreases with the distance.
+		uint32_t previous = 1u;
+
+		for ( uint32_t distance = 1u; distance < 1000u; ++distance )
+		{
+			auto size = AnimationThrottle::getProjectedSize( 0.9f, float( distance ), ProjectionScale );
+			auto interval = throttle.getInterval( size, true );
+			CT_CHECK( interval >= previous );
+			previous = interval;
+		}
+
+		CT_EQUAL( previous, 8u );
+	}
+
+	void AnimationThrottleTest::Staggering()
+	{
+		// A crowd of 64 characters, all at the same distance: each frame updates the same share of it.
+		AnimationThrottle throttle{ 256.0f, 8u, 16u };
+		throttle.setEnabled( true );
+		std::vector< AnimationThrottle::State > crowd;
+
+		for ( uint32_t i = 0u; i < 64u; ++i )
+		{
+			crowd.push_back( makeState( i ) );
+		}
+
+		for ( uint32_t frame = 0u; frame < 32u; ++frame )
+		{
+			uint32_t updates = 0u;
+
+			for ( auto & state : crowd )
+			{
+				updates += throttle.step( state, FrameTime, 64.0f, true ) ? 1u : 0u;
+			}
+
+			CT_EQUAL( updates, 16u );
+			throttle.nextFrame();
+		}
+
+		// Hidden, they are updated at the hidden rate.
+		for ( uint32_t frame = 0u; frame < 32u; ++frame )
+		{
+			uint32_t updates = 0u;
+
+			for ( auto & state : crowd )
+			{
+				updates += throttle.step( state, FrameTime, 64.0f, false ) ? 1u : 0u;
+			}
+
+			CT_EQUAL( updates, 4u );
+			throttle.nextFrame();
+		}
+	}
+
+	void AnimationThrottleTest::ElapsedTime()
+	{
+		// Whatever the rate, the animations time stays the same.
+		AnimationThrottle throttle;
+		throttle.setEnabled( true );
+		std::mt19937 engine{ 42u };
+		std::uniform_real_distribution< float > size{ 0.0f, 512.0f };
+		std::bernoulli_distribution visible{ 0.7 };
+
+		for ( uint32_t i = 0u; i < 16u; ++i )
+		{
+			auto state = makeState( i * 7u );
+			Milliseconds applied{ 0u };
+
+			for ( uint32_t frame = 0u; frame < 200u; ++frame )
+			{
+				if ( throttle.step( state, FrameTime, size( engine ), visible( engine ) ) )
+				{
+					applied += state.elapsed;
+				}
+
+				throttle.nextFrame();
+			}
+
+			CT_EQUAL( ( applied + state.accumulated ).count(), ( FrameTime * 200u ).count() );
+		}
+	}
+
+	void AnimationThrottleTest::PoseBlend()
+	{
+		AnimationThrottle throttle{ 256.0f, 4u, 16u };
+		throttle.setEnabled( true );
+		auto state = makeState( 0u );
+		CT_CHECK( throttle.step( state, FrameTime, 64.0f, true ) );
+		CT_EQUAL( state.interval, 4u );
+		CT_EQUAL( state.blend, 0.25f );
+		throttle.nextFrame();
+		CT_CHECK( !throttle.step( state, FrameTime, 64.0f, true ) );
+		CT_EQUAL( state.blend, 0.5f );
+		throttle.nextFrame();
+		CT_CHECK( !throttle.step( state, FrameTime, 64.0f, true ) );
+		CT_EQUAL( state.blend, 0.75f );
+		throttle.nextFrame();
+		// The last computed pose is reached right before the next update.
+		CT_CHECK( !throttle.step( state, FrameTime, 64.0f, true ) );
+		CT_EQUAL( state.blend, 1.0f );
+		throttle.nextFrame();
+		CT_CHECK( throttle.step( state, FrameTime, 64.0f, true ) );
+		CT_EQUAL( state.elapsed.count(), ( FrameTime * 4u ).count() );
+
+		// At full rate, the computed pose is displayed as is.
+		throttle.nextFrame();
+		CT_CHECK( throttle.step( state, FrameTime, 512.0f, true ) );
+		CT_EQUAL( state.blend, 1.0f );
+	}
+
+	void AnimationThrottleTest::BoundsScale()
+	{
+		AnimationThrottle throttle{ 256.0f, 8u, 16u, 0.5f };
+		auto state = makeState( 0u );
+		CT_EQUAL( throttle.getBoundsScale( state ), 1.5f );
+		state.skipped = 8u;
+		CT_EQUAL( throttle.getBoundsScale( state ), 1.75f );
+		state.skipped = 16u;
+		CT_EQUAL( throttle.getBoundsScale( state ), 2.0f );
+		state.skipped = 1000u;
+		CT_EQUAL( throttle.getBoundsScale( state ), 2.0f );
+	}
+
+	void AnimationThrottleTest::Disabled()
+	{
+		// Throttling is disabled by default.
+		AnimationThrottle throttle;
+		CT_CHECK( !throttle.isEnabled() );
+		auto state = makeState( 3u );
+
+		for ( uint32_t frame = 0u; frame < 16u; ++frame )
+		{
+			CT_CHECK( throttle.step( state, FrameTime, 1.0f, false ) );
+			CT_EQUAL( state.elapsed.count(), FrameTime.count() );
+			CT_EQUAL( state.blend, 1.0f );
+			throttle.nextFrame();
+		}
+	}
+
+	//*********************************************************************************************
+
+	AnimationThrottleBench::AnimationThrottleBench()
+		: BenchCase( "AnimationThrottleBench" )
+	{
+		// A crowd of 10000 characters, spread up to 200 units away, a third of them off screen.
+		std::mt19937 engine{ 42u };
+		std::uniform_real_distribution< float > radius{ 0.8f, 1.2f };
+		std::uniform_real_distribution< float > distance{ 2.0f, 200.0f };
+		std::bernoulli_distribution visible{ 0.66 };
+		std::uniform_int_distribution< uint32_t > phase;
+		m_throttle.setEnabled( true );
+
+		for ( uint32_t i = 0u; i < 10000u; ++i )
+		{
+			m_crowd.push_back( { radius( engine ), distance( engine ), visible( engine ), makeState( phase( engine ) ) } );
+		}
+	}
+
+	AnimationThrottleBench::~AnimationThrottleBench()
+	{
+	}
+
+	void AnimationThrottleBench::Execute()
+	{
+		BENCHMARK( StepCrowd, 1000u );
+		std::cout << "*	Crowd ( " << m_crowd.size() << " characters ), updated per frame: "
+			<< 100.0f * float( m_updates ) / float( m_steps ) << "%" << std::endl;
+	}
+
+	void AnimationThrottleBench::StepCrowd()
+	{
+		for ( auto & agent : m_crowd )
+		{
+			auto size = AnimationThrottle::getProjectedSize( agent.radius * m_throttle.getBoundsScale( agent.state )
+				, agent.distance
+				, ProjectionScale );
+			m_updates += m_throttle.step( agent.state, FrameTime, size, agent.visible ) ? 1u : 0u;
+		}
+
+		m_steps += m_crowd.size();
+		m_throttle.nextFrame();
+	}
+}
@@ -0,0 +1,58 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_ANIMATION_THROTTLE_TEST_H___
+#define ___C3DT_ANIMATION_THROTTLE_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Scene/Animation/AnimationThrottle.hpp>
+
+namespace Testing
+{
+	class AnimationThrottleTest
+		: public TestCase
+	{
+	public:
+		AnimationThrottleTest();
+		virtual ~AnimationThrottleTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void ProjectedSize();
+		void Intervals();
+		void Staggering();
+		void ElapsedTime();
+		void PoseBlend();
+		void BoundsScale();
+		void Disabled();
+	};
+
+	class AnimationThrottleBench
+		: public BenchCase
+	{
+	public:
+		AnimationThrottleBench();
+		virtual ~AnimationThrottleBench();
+		virtual void Execute();
+
+	private:
+		void StepCrowd();
+
+	private:
+		struct Agent
+		{
+			float radius;
+			float distance;
+			bool visible;
+			castor3d::AnimationThrottle::State state;
+		};
+
+		castor3d::AnimationThrottle m_throttle;
+		std::vector< Agent > m_crowd;
+		uint64_t m_updates{ 0u };
+		uint64_t m_steps{ 0u };
+	};
+}
+
+#endif
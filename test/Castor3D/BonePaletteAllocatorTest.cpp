@@ -0,0 +1,136 @@
+#include "BonePaletteAllocatorTest.hpp"
+
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		// The bones count reserved per instance by the former fixed stride storage.
+		static uint32_t constexpr FixedStride = 400u;
+	}
+
+	//*********************************************************************************************
+
+	BonePaletteAllocatorTest::BonePaletteAllocatorTest()
+		: TestCase( "BonePaletteAllocatorTest" )
+	{
+	}
+
+	BonePaletteAllocatorTest::~BonePaletteAllocatorTest()
+	{
+	}
+
+	void BonePaletteAllocatorTest::doRegisterTests()
+	{
+		doRegisterTest( "Packing", std::bind( &BonePaletteAllocatorTest::Packing, this ) );
+		doRegisterTest( "Overflow", std::bind( &BonePaletteAllocatorTest::Overflow, this ) );
+		doRegisterTest( "Reset", std::bind( &BonePaletteAllocatorTest::Reset, this ) );
+		doRegisterTest( "LargeSkeleton", std::bind( &BonePaletteAllocatorTest::LargeSkeleton, this ) );
+	}
+
+	void BonePaletteAllocatorTest::Packing()
+	{
+		BonePaletteAllocator palettes{ 1000u };
+		CT_EQUAL( palettes.allocate( 30u ), 0u );
+		CT_EQUAL( palettes.allocate( 60u ), 30u );
+		CT_EQUAL( palettes.allocate( 1u ), 90u );
+		CT_EQUAL( palettes.allocate( 30u ), 91u );
+		CT_EQUAL( palettes.getAllocated(), 121u );
+		CT_EQUAL( palettes.getPalettesCount(), 4u );
+		CT_EQUAL( palettes.getAllocatedBytes(), 121u * 64u );
+	}
+
+	void BonePaletteAllocatorTest::Overflow()
+	{
+		BonePaletteAllocator palettes{ 100u };
+		CT_EQUAL( palettes.allocate( 60u ), 0u );
+		CT_EQUAL( palettes.allocate( 60u ), InvalidIndex );
+		// A failed allocation doesn't consume any space.
+		CT_EQUAL( palettes.getAllocated(), 60u );
+		CT_EQUAL( palettes.allocate( 40u ), 60u );
+		CT_EQUAL( palettes.allocate( 1u ), InvalidIndex );
+		CT_EQUAL( palettes.getPalettesCount(), 2u );
+
+		BonePaletteAllocator empty;
+		CT_EQUAL( empty.allocate( 1u ), InvalidIndex );
+		CT_EQUAL( empty.allocate( 0u ), 0u );
+	}
+
+	void BonePaletteAllocatorTest::Reset()
+	{
+		BonePaletteAllocator palettes{ 100u };
+		palettes.allocate( 70u );
+		palettes.reset();
+		CT_EQUAL( palettes.getAllocated(), 0u );
+		CT_EQUAL( palettes.getPalettesCount(), 0u );
+		CT_EQUAL( palettes.allocate( 70u ), 0u );
+		// The total bytes counter goes through the resets.
+		CT_EQUAL( palettes.getTotalBytes(), 140u * 64u );
+
+		palettes.setCapacity( 200u );
+		CT_EQUAL( palettes.getCapacity(), 200u );
+		CT_EQUAL( palettes.getAllocated(), 0u );
+		CT_EQUAL( palettes.allocate( 200u ), 0u );
+	}
+
+	void BonePaletteAllocatorTest::LargeSkeleton()
+	{
+		// Skeletons above the former fixed stride fit as long as the storage is sized for them.
+		BonePaletteAllocator palettes{ 3u * 1000u };
+		CT_EQUAL( palettes.allocate( 1000u ), 0u );
+		CT_EQUAL( palettes.allocate( 1000u ), 1000u );
+		CT_EQUAL( palettes.allocate( 1000u ), 2000u );
+		CT_EQUAL( palettes.allocate( 1u ), InvalidIndex );
+	}
+
+	//*********************************************************************************************
+
+	BonePaletteAllocatorBench::BonePaletteAllocatorBench()
+		: BenchCase( "BonePaletteAllocatorBench" )
+		, m_palettes{ 0u }
+	{
+		// A mixed crowd of 1000 characters, from simple rigs to detailed ones.
+		std::mt19937 engine{ 42u };
+		std::discrete_distribution< uint32_t > rig{ { 50.0, 30.0, 15.0, 5.0 } };
+		static std::array< uint32_t, 4u > constexpr BonesCounts{ 30u, 60u, 120u, 250u };
+		uint32_t capacity = 0u;
+
+		for ( uint32_t i = 0u; i < 1000u; ++i )
+		{
+			m_crowd.push_back( BonesCounts[rig( engine )] );
+			capacity += m_crowd.back();
+		}
+
+		m_palettes.setCapacity( capacity );
+		m_offsets.resize( m_crowd.size() );
+	}
+
+	BonePaletteAllocatorBench::~BonePaletteAllocatorBench()
+	{
+	}
+
+	void BonePaletteAllocatorBench::Execute()
+	{
+		BENCHMARK( AllocateCrowd, 10000u );
+		auto fixedBytes = uint64_t( m_crowd.size() ) * FixedStride * BonePaletteAllocator::MatrixSize;
+		std::cout << "*	Crowd ( " << m_crowd.size() << " characters ), bones bytes per frame: "
+			<< m_palettes.getAllocatedBytes() << " (fixed stride: " << fixedBytes << ", "
+			<< 100.0f * float( m_palettes.getAllocatedBytes() ) / float( fixedBytes ) << "%)" << std::endl;
+	}
+
+	void BonePaletteAllocatorBench::AllocateCrowd()
+	{
+		m_palettes.reset();
+		auto offset = m_offsets.begin();
+
+		for ( auto bonesCount : m_crowd )
+		{
+			*offset = m_palettes.allocate( bonesCount );
+			++offset;
+		}
+	}
+}
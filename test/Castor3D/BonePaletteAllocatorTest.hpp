@@ -0,0 +1,46 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_BONE_PALETTE_ALLOCATOR_TEST_H___
+#define ___C3DT_BONE_PALETTE_ALLOCATOR_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Model/Skeleton/BonePaletteAllocator.hpp>
+
+namespace Testing
+{
+	class BonePaletteAllocatorTest
+		: public TestCase
+	{
+	public:
+		BonePaletteAllocatorTest();
+		virtual ~BonePaletteAllocatorTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Packing();
+		void Overflow();
+		void Reset();
+		void LargeSkeleton();
+	};
+
+	class BonePaletteAllocatorBench
+		: public BenchCase
+	{
+	public:
+		BonePaletteAllocatorBench();
+		virtual ~BonePaletteAllocatorBench();
+		virtual void Execute();
+
+	private:
+		void AllocateCrowd();
+
+	private:
+		castor3d::BonePaletteAllocator m_palettes;
+		std::vector< uint32_t > m_crowd;
+		std::vector< uint32_t > m_offsets;
+	};
+}
+
+#endif
@@ -0,0 +1,287 @@
+#include "FrameEventQueueTest.hpp"
+
+#include <thread>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		using Clock = FrameEventQueueT<>::Clock;
+		// The events count of a scene loading burst.
+		static uint32_t constexpr BurstSize = 10000u;
+
+		template< typename ... ParamsT >
+		size_t drainAll( FrameEventQueueT< ParamsT... > & queue
+			, ParamsT ... params )
+		{
+			return queue.drain( queue.getSequence()
+				, Clock::time_point::max()
+				, [&params...]( FrameEventFunctorT< ParamsT... > & event )
+				{
+					event( params... );
+				} );
+		}
+	}
+
+	//*********************************************************************************************
+
+	FrameEventQueueTest::FrameEventQueueTest()
+		: TestCase( "FrameEventQueueTest" )
+	{
+	}
+
+	FrameEventQueueTest::~FrameEventQueueTest()
+	{
+	}
+
+	void FrameEventQueueTest::doRegisterTests()
+	{
+		doRegisterTest( "Functor", std::bind( &FrameEventQueueTest::Functor, this ) );
+		doRegisterTest( "Order", std::bind( &FrameEventQueueTest::Order, this ) );
+		doRegisterTest( "Limit", std::bind( &FrameEventQueueTest::Limit, this ) );
+		doRegisterTest( "Budget", std::bind( &FrameEventQueueTest::Budget, this ) );
+		doRegisterTest( "MultipleThreads", std::bind( &FrameEventQueueTest::MultipleThreads, this ) );
+	}
+
+	void FrameEventQueueTest::Functor()
+	{
+		uint32_t value = 0u;
+		FrameEventFunctorT< uint32_t > small{ [&value]( uint32_t add )
+			{
+				value += add;
+			} };
+		CT_CHECK( small.isInline() );
+		small( 2u );
+		CT_EQUAL( value, 2u );
+
+		std::array< uint64_t, 16u > payload{};
+		payload[15] = 5u;
+		FrameEventFunctorT< uint32_t > big{ [&value, payload]( uint32_t add )
+			{
+				value += add + uint32_t( payload[15] );
+			} };
+		CT_CHECK( !big.isInline() );
+		auto moved = std::move( big );
+		CT_CHECK( !big );
+		moved( 1u );
+		CT_EQUAL( value, 8u );
+
+		// Move only callables are accepted, and destroyed with the functor.
+		auto owned = std::make_shared< uint32_t >( 3u );
+		{
+			FrameEventFunctorT< uint32_t > unique{ [pointer = std::make_unique< std::shared_ptr< uint32_t > >( owned ), &value]( uint32_t )
+				{
+					value += **pointer;
+				} };
+			CT_EQUAL( owned.use_count(), 2 );
+			unique( 0u );
+			CT_EQUAL( value, 11u );
+		}
+		CT_EQUAL( owned.use_count(), 1 );
+
+		// The remaining events are destroyed with the queue.
+		{
+			FrameEventQueueT<> queue;
+			queue.push( [owned]()
+				{
+				} );
+			CT_EQUAL( owned.use_count(), 2 );
+		}
+		CT_EQUAL( owned.use_count(), 1 );
+	}
+
+	void FrameEventQueueTest::Order()
+	{
+		FrameEventQueueT< std::vector< uint32_t > & > queue;
+		std::vector< uint32_t > received;
+
+		// Several rounds, to go through the chunks recycling.
+		for ( uint32_t round = 0u; round < 4u; ++round )
+		{
+			received.clear();
+
+			for ( uint32_t i = 0u; i < 3u * FrameEventQueueT<>::ChunkSize + 7u; ++i )
+			{
+				queue.push( [i]( std::vector< uint32_t > & result )
+					{
+						result.push_back( i );
+					} );
+			}
+
+			CT_EQUAL( queue.getPendingCount(), 3u * FrameEventQueueT<>::ChunkSize + 7u );
+			CT_EQUAL( drainAll< std::vector< uint32_t > & >( queue, received ), 3u * FrameEventQueueT<>::ChunkSize + 7u );
+			CT_EQUAL( queue.getPendingCount(), 0u );
+			bool ordered = true;
+
+			for ( uint32_t i = 0u; i < received.size(); ++i )
+			{
+				ordered = ordered && received[i] == i;
+			}
+
+			CT_CHECK( ordered );
+		}
+	}
+
+	void FrameEventQueueTest::Limit()
+	{
+		FrameEventQueueT<> queue;
+		uint32_t calls = 0u;
+		// An event posting another one, left for the next drain.
+		queue.push( [&queue, &calls]()
+			{
+				++calls;
+				queue.push( [&calls]()
+					{
+						++calls;
+					} );
+			} );
+		CT_EQUAL( drainAll( queue ), 1u );
+		CT_EQUAL( calls, 1u );
+		CT_EQUAL( queue.getPendingCount(), 1u );
+		CT_EQUAL( drainAll( queue ), 1u );
+		CT_EQUAL( calls, 2u );
+	}
+
+	void FrameEventQueueTest::Budget()
+	{
+		FrameEventQueueT<> queue;
+		uint32_t calls = 0u;
+
+		for ( uint32_t i = 0u; i < BurstSize; ++i )
+		{
+			queue.push( [&calls]()
+				{
+					++calls;
+				} );
+		}
+
+		// An exhausted budget still processes one event per drain.
+		auto process = []( FrameEventFunctorT<> & event )
+		{
+			event();
+		};
+		CT_EQUAL( queue.drain( queue.getSequence(), Clock::now(), process ), 1u );
+		CT_EQUAL( queue.drain( queue.getSequence(), Clock::now(), process ), 1u );
+		CT_EQUAL( calls, 2u );
+
+		// The burst is spread over several frames.
+		uint32_t frames = 0u;
+
+		while ( queue.getPendingCount() )
+		{
+			queue.drain( queue.getSequence()
+				, Clock::now() + std::chrono::microseconds{ 50 }
+				, []( FrameEventFunctorT<> & event )
+				{
+					event();
+					std::this_thread::sleep_for( std::chrono::microseconds{ 1 } );
+				} );
+			++frames;
+		}
+
+		CT_EQUAL( calls, BurstSize );
+		CT_CHECK( frames > 1u );
+	}
+
+	void FrameEventQueueTest::MultipleThreads()
+	{
+		static uint32_t constexpr ThreadsCount = 4u;
+		FrameEventQueueT< std::vector< uint32_t > & > queue;
+		std::vector< std::thread > threads;
+
+		for ( uint32_t thread = 0u; thread < ThreadsCount; ++thread )
+		{
+			threads.emplace_back( [&queue, thread]()
+				{
+					for ( uint32_t i = 0u; i < BurstSize; ++i )
+					{
+						queue.push( [thread, i]( std::vector< uint32_t > & result )
+							{
+								// Each thread's events are received in their posting order.
+								if ( result[thread] == i )
+								{
+									++result[thread];
+								}
+							} );
+					}
+				} );
+		}
+
+		// Fired while the threads post.
+		std::vector< uint32_t > received( ThreadsCount, 0u );
+		size_t count = 0u;
+
+		while ( count < ThreadsCount * BurstSize )
+		{
+			count += drainAll< std::vector< uint32_t > & >( queue, received );
+		}
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+
+		CT_EQUAL( received, std::vector< uint32_t >( ThreadsCount, BurstSize ) );
+		CT_EQUAL( queue.getPendingCount(), 0u );
+	}
+
+	//*********************************************************************************************
+
+	FrameEventQueueBench::FrameEventQueueBench()
+		: BenchCase( "FrameEventQueueBench" )
+	{
+	}
+
+	FrameEventQueueBench::~FrameEventQueueBench()
+	{
+	}
+
+	void FrameEventQueueBench::Execute()
+	{
+		BENCHMARK( PostFireQueue, 100u );
+		// The former storage, one allocated event per post, fired under a lock.
+		BENCHMARK( PostFireLockedArray, 100u );
+	}
+
+	void FrameEventQueueBench::PostFireQueue()
+	{
+		for ( uint32_t i = 0u; i < BurstSize; ++i )
+		{
+			m_queue.push( [i]( uint32_t & sum )
+				{
+					sum += i;
+				} );
+		}
+
+		drainAll< uint32_t & >( m_queue, m_sum );
+		doNotOptimizeAway( m_sum );
+	}
+
+	void FrameEventQueueBench::PostFireLockedArray()
+	{
+		for ( uint32_t i = 0u; i < BurstSize; ++i )
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			m_events.push_back( std::make_unique< std::function< void( uint32_t & ) > >( [i]( uint32_t & sum )
+				{
+					sum += i;
+				} ) );
+		}
+
+		std::vector< std::unique_ptr< std::function< void( uint32_t & ) > > > events;
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			std::swap( events, m_events );
+		}
+
+		for ( auto & event : events )
+		{
+			( *event )( m_sum );
+		}
+
+		doNotOptimizeAway( m_sum );
+	}
+}
@@ -0,0 +1,52 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_FRAME_EVENT_QUEUE_TEST_H___
+#define ___C3DT_FRAME_EVENT_QUEUE_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Event/Frame/FrameEventQueue.hpp>
+
+#include <functional>
+#include <mutex>
+
+namespace Testing
+{
+	class FrameEventQueueTest
+		: public TestCase
+	{
+	public:
+		FrameEventQueueTest();
+		virtual ~FrameEventQueueTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Functor();
+		void Order();
+		void Limit();
+		void Budget();
+		void MultipleThreads();
+	};
+
+	class FrameEventQueueBench
+		: public BenchCase
+	{
+	public:
+		FrameEventQueueBench();
+		virtual ~FrameEventQueueBench();
+		virtual void Execute();
+
+	private:
+		void PostFireQueue();
+		void PostFireLockedArray();
+
+	private:
+		castor3d::FrameEventQueueT< uint32_t & > m_queue;
+		std::mutex m_mutex;
+		std::vector< std::unique_ptr< std::function< void( uint32_t & ) > > > m_events;
+		uint32_t m_sum{ 0u };
+	};
+}
+
+#endif
@@ -0,0 +1,225 @@
+#include "OverlayDrawBatcherTest.hpp"
+
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		Rectangle makeRect( int32_t left
+			, int32_t top
+			, int32_t width
+			, int32_t height )
+		{
+			return Rectangle{ left, top, left + width, top + height };
+		}
+
+		bool overlaps( Rectangle const & lhs
+			, Rectangle const & rhs )
+		{
+			return lhs.left() < rhs.right()
+				&& rhs.left() < lhs.right()
+				&& lhs.top() < rhs.bottom()
+				&& rhs.top() < lhs.bottom();
+		}
+
+		// A list box: each line has a background panel, a border and a text.
+		void addListBox( std::vector< size_t > & keys
+			, std::vector< Rectangle > & bounds
+			, int32_t left
+			, int32_t top
+			, uint32_t lines )
+		{
+			keys.push_back( 1u );
+			bounds.push_back( makeRect( left, top, 200, int32_t( lines ) * 20 ) );
+
+			for ( uint32_t line = 0u; line < lines; ++line )
+			{
+				auto rect = makeRect( left, top + int32_t( line ) * 20, 200, 20 );
+				keys.push_back( ( line % 2u ) ? 2u : 3u );
+				bounds.push_back( rect );
+				keys.push_back( 4u );
+				bounds.push_back( rect );
+				keys.push_back( 5u );
+				bounds.push_back( makeRect( left + 4, top + int32_t( line ) * 20 + 2, 192, 16 ) );
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	OverlayDrawBatcherTest::OverlayDrawBatcherTest()
+		: TestCase( "OverlayDrawBatcherTest" )
+	{
+	}
+
+	OverlayDrawBatcherTest::~OverlayDrawBatcherTest()
+	{
+	}
+
+	void OverlayDrawBatcherTest::doRegisterTests()
+	{
+		doRegisterTest( "SameKey", std::bind( &OverlayDrawBatcherTest::SameKey, this ) );
+		doRegisterTest( "Overlapping", std::bind( &OverlayDrawBatcherTest::Overlapping, this ) );
+		doRegisterTest( "Reordering", std::bind( &OverlayDrawBatcherTest::Reordering, this ) );
+		doRegisterTest( "Lookback", std::bind( &OverlayDrawBatcherTest::Lookback, this ) );
+		doRegisterTest( "VisualOrder", std::bind( &OverlayDrawBatcherTest::VisualOrder, this ) );
+	}
+
+	void OverlayDrawBatcherTest::SameKey()
+	{
+		OverlayDrawBatcher batcher;
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			CT_EQUAL( batcher.add( 1u, makeRect( int32_t( i ) * 10, 0, 10, 10 ), i ), 0u );
+		}
+
+		CT_EQUAL( batcher.getDrawsCount(), 1u );
+		CT_EQUAL( batcher.getItemsCount(), 100u );
+		CT_EQUAL( batcher.begin()->items.size(), 100u );
+		CT_EQUAL( batcher.begin()->bounds.right(), 1000 );
+
+		batcher.clear();
+		CT_EQUAL( batcher.getDrawsCount(), 0u );
+		CT_EQUAL( batcher.getItemsCount(), 0u );
+		CT_CHECK( batcher.begin() == batcher.end() );
+	}
+
+	void OverlayDrawBatcherTest::Overlapping()
+	{
+		// Text over a panel, over a text: the visual order forbids any merge.
+		OverlayDrawBatcher batcher;
+		CT_EQUAL( batcher.add( 1u, makeRect( 0, 0, 100, 20 ), 0u ), 0u );
+		CT_EQUAL( batcher.add( 2u, makeRect( 0, 0, 100, 20 ), 1u ), 1u );
+		CT_EQUAL( batcher.add( 1u, makeRect( 10, 5, 50, 10 ), 2u ), 2u );
+		CT_EQUAL( batcher.getDrawsCount(), 3u );
+	}
+
+	void OverlayDrawBatcherTest::Reordering()
+	{
+		// Two buttons side by side, each with a background and a text.
+		OverlayDrawBatcher batcher;
+		CT_EQUAL( batcher.add( 1u, makeRect( 0, 0, 100, 20 ), 0u ), 0u );
+		CT_EQUAL( batcher.add( 2u, makeRect( 5, 5, 90, 10 ), 1u ), 1u );
+		CT_EQUAL( batcher.add( 1u, makeRect( 100, 0, 100, 20 ), 2u ), 0u );
+		CT_EQUAL( batcher.add( 2u, makeRect( 105, 5, 90, 10 ), 3u ), 1u );
+		CT_EQUAL( batcher.getDrawsCount(), 2u );
+		auto it = batcher.begin();
+		CT_EQUAL( it->items.size(), 2u );
+		CT_EQUAL( it->items[0], 0u );
+		CT_EQUAL( it->items[1], 2u );
+		++it;
+		CT_EQUAL( it->items[0], 1u );
+		CT_EQUAL( it->items[1], 3u );
+	}
+
+	void OverlayDrawBatcherTest::Lookback()
+	{
+		OverlayDrawBatcher batcher{ 4u };
+		batcher.add( 0u, makeRect( 0, 0, 10, 10 ), 0u );
+
+		for ( uint32_t i = 1u; i <= 4u; ++i )
+		{
+			batcher.add( i, makeRect( int32_t( i ) * 10, 0, 10, 10 ), i );
+		}
+
+		// The first draw is now too far back.
+		CT_EQUAL( batcher.add( 0u, makeRect( 100, 0, 10, 10 ), 5u ), 5u );
+		// But the third one is still reachable.
+		CT_EQUAL( batcher.add( 2u, makeRect( 110, 0, 10, 10 ), 6u ), 2u );
+	}
+
+	void OverlayDrawBatcherTest::VisualOrder()
+	{
+		// Random overlays: any two overlapping ones must keep their relative order.
+		std::mt19937 engine{ 42u };
+		std::uniform_int_distribution< int32_t > position{ 0, 1000 };
+		std::uniform_int_distribution< int32_t > extent{ 5, 100 };
+		std::uniform_int_distribution< size_t > key{ 0u, 7u };
+		std::vector< Rectangle > bounds;
+		std::vector< uint32_t > drawIndices;
+		OverlayDrawBatcher batcher;
+
+		for ( uint32_t i = 0u; i < 2000u; ++i )
+		{
+			bounds.push_back( makeRect( position( engine ), position( engine ), extent( engine ), extent( engine ) ) );
+			batcher.add( key( engine ), bounds.back(), i );
+		}
+
+		std::vector< std::pair< uint32_t, uint32_t > > order( bounds.size() );
+		uint32_t drawIndex = 0u;
+
+		for ( auto & draw : batcher )
+		{
+			for ( uint32_t rank = 0u; rank < draw.items.size(); ++rank )
+			{
+				order[draw.items[rank]] = { drawIndex, rank };
+			}
+
+			++drawIndex;
+		}
+
+		uint32_t errors = 0u;
+
+		for ( uint32_t i = 0u; i < bounds.size(); ++i )
+		{
+			for ( uint32_t j = i + 1u; j < bounds.size(); ++j )
+			{
+				if ( overlaps( bounds[i], bounds[j] )
+					&& order[i] > order[j] )
+				{
+					++errors;
+				}
+			}
+		}
+
+		CT_EQUAL( errors, 0u );
+		CT_CHECK( batcher.getDrawsCount() < bounds.size() );
+	}
+
+	//*********************************************************************************************
+
+	OverlayDrawBatcherBench::OverlayDrawBatcherBench()
+		: BenchCase( "OverlayDrawBatcherBench" )
+	{
+		// 20 list boxes of 100 lines each.
+		std::vector< size_t > keys;
+		std::vector< Rectangle > bounds;
+
+		for ( int32_t i = 0; i < 20; ++i )
+		{
+			addListBox( keys, bounds, ( i % 5 ) * 210, ( i / 5 ) * 2010, 100u );
+		}
+
+		for ( size_t i = 0u; i < keys.size(); ++i )
+		{
+			m_hud.push_back( { keys[i], bounds[i] } );
+		}
+	}
+
+	OverlayDrawBatcherBench::~OverlayDrawBatcherBench()
+	{
+	}
+
+	void OverlayDrawBatcherBench::Execute()
+	{
+		BENCHMARK( BatchHud, 1000u );
+		std::cout << "*	HUD ( " << m_batcher.getItemsCount() << " overlay draws ), merged into "
+			<< m_batcher.getDrawsCount() << " draws" << std::endl;
+	}
+
+	void OverlayDrawBatcherBench::BatchHud()
+	{
+		m_batcher.clear();
+		uint32_t index = 0u;
+
+		for ( auto & item : m_hud )
+		{
+			m_batcher.add( item.key, item.bounds, index++ );
+		}
+	}
+}
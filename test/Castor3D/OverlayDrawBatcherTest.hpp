@@ -0,0 +1,52 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_OVERLAY_DRAW_BATCHER_TEST_H___
+#define ___C3DT_OVERLAY_DRAW_BATCHER_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Overlay/OverlayDrawBatcher.hpp>
+
+namespace Testing
+{
+	class OverlayDrawBatcherTest
+		: public TestCase
+	{
+	public:
+		OverlayDrawBatcherTest();
+		virtual ~OverlayDrawBatcherTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void SameKey();
+		void Overlapping();
+		void Reordering();
+		void Lookback();
+		void VisualOrder();
+	};
+
+	class OverlayDrawBatcherBench
+		: public BenchCase
+	{
+	public:
+		OverlayDrawBatcherBench();
+		virtual ~OverlayDrawBatcherBench();
+		virtual void Execute();
+
+	private:
+		void BatchHud();
+
+	private:
+		struct Item
+		{
+			size_t key;
+			castor::Rectangle bounds;
+		};
+
+		std::vector< Item > m_hud;
+		castor3d::OverlayDrawBatcher m_batcher;
+	};
+}
+
+#endif
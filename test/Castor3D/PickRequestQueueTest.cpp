@@ -0,0 +1,172 @@
+#include "PickRequestQueueTest.hpp"
+
+#include <functional>
+#include <thread>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		// Mimics PickingPass requests: the callback receives the request ID, with an empty result.
+		struct TestRequest
+		{
+			uint32_t id{ 0u };
+			uint32_t tag{ 0u };
+			std::function< void( uint32_t ) > callback;
+		};
+
+		using TestQueue = PickRequestQueueT< TestRequest >;
+	}
+
+	//*********************************************************************************************
+
+	PickRequestQueueTest::PickRequestQueueTest()
+		: TestCase( "PickRequestQueueTest" )
+	{
+	}
+
+	PickRequestQueueTest::~PickRequestQueueTest()
+	{
+	}
+
+	void PickRequestQueueTest::doRegisterTests()
+	{
+		doRegisterTest( "Ids", std::bind( &PickRequestQueueTest::Ids, this ) );
+		doRegisterTest( "Ordering", std::bind( &PickRequestQueueTest::Ordering, this ) );
+		doRegisterTest( "Cancel", std::bind( &PickRequestQueueTest::Cancel, this ) );
+		doRegisterTest( "CancelReentrant", std::bind( &PickRequestQueueTest::CancelReentrant, this ) );
+		doRegisterTest( "ConcurrentPush", std::bind( &PickRequestQueueTest::ConcurrentPush, this ) );
+	}
+
+	void PickRequestQueueTest::Ids()
+	{
+		TestQueue queue;
+		CT_EQUAL( queue.push( {} ), 1u );
+		CT_EQUAL( queue.push( {} ), 2u );
+		CT_EQUAL( queue.size(), size_t( 2u ) );
+		TestRequest request;
+		CT_CHECK( queue.pop( request ) );
+		CT_EQUAL( request.id, 1u );
+		// The IDs are never reused.
+		CT_EQUAL( queue.push( {} ), 3u );
+	}
+
+	void PickRequestQueueTest::Ordering()
+	{
+		TestQueue queue;
+
+		for ( uint32_t tag = 0u; tag < 10u; ++tag )
+		{
+			queue.push( TestRequest{ 0u, tag, nullptr } );
+		}
+
+		TestRequest request;
+
+		for ( uint32_t tag = 0u; tag < 10u; ++tag )
+		{
+			CT_CHECK( queue.pop( request ) );
+			CT_EQUAL( request.tag, tag );
+			CT_EQUAL( request.id, tag + 1u );
+		}
+
+		CT_CHECK( !queue.pop( request ) );
+	}
+
+	void PickRequestQueueTest::Cancel()
+	{
+		TestQueue queue;
+		std::vector< uint32_t > results;
+		std::vector< uint32_t > ids;
+
+		for ( uint32_t i = 0u; i < 5u; ++i )
+		{
+			ids.push_back( queue.push( TestRequest{ 0u
+				, i
+				, [&results]( uint32_t id )
+				{
+					results.push_back( id );
+				} } ) );
+		}
+
+		queue.cancel( []( TestRequest & request )
+			{
+				request.callback( request.id );
+			} );
+
+		// Each request gets its result, in the queue order.
+		CT_CHECK( results == ids );
+		CT_EQUAL( queue.size(), size_t( 0u ) );
+	}
+
+	void PickRequestQueueTest::CancelReentrant()
+	{
+		TestQueue queue;
+		uint32_t resultsCount = 0u;
+
+		for ( uint32_t i = 0u; i < 3u; ++i )
+		{
+			queue.push( TestRequest{ 0u
+				, i
+				, [&queue, &resultsCount]( uint32_t )
+				{
+					// A callback asking for a new pick, like a retry on an empty result.
+					++resultsCount;
+					queue.push( TestRequest{ 0u, 100u, nullptr } );
+				} } );
+		}
+
+		queue.cancel( []( TestRequest & request )
+			{
+				request.callback( request.id );
+			} );
+
+		CT_EQUAL( resultsCount, 3u );
+		// The requests pushed by the callbacks stay queued.
+		CT_EQUAL( queue.size(), size_t( 3u ) );
+		TestRequest request;
+		CT_CHECK( queue.pop( request ) );
+		CT_EQUAL( request.tag, 100u );
+		CT_EQUAL( request.id, 4u );
+	}
+
+	void PickRequestQueueTest::ConcurrentPush()
+	{
+		static uint32_t constexpr ThreadsCount = 4u;
+		static uint32_t constexpr PushesCount = 1000u;
+		TestQueue queue;
+		std::vector< std::thread > threads;
+
+		for ( uint32_t thread = 0u; thread < ThreadsCount; ++thread )
+		{
+			threads.emplace_back( [&queue, thread]()
+				{
+					for ( uint32_t i = 0u; i < PushesCount; ++i )
+					{
+						queue.push( TestRequest{ 0u, thread, nullptr } );
+					}
+				} );
+		}
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+
+		// The IDs are unique, and follow the queue order.
+		TestRequest request;
+		uint32_t expected = 1u;
+		bool ordered = true;
+
+		while ( queue.pop( request ) )
+		{
+			ordered = ordered && request.id == expected;
+			++expected;
+		}
+
+		CT_CHECK( ordered );
+		CT_EQUAL( expected, ThreadsCount * PushesCount + 1u );
+	}
+}
@@ -0,0 +1,30 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_PICK_REQUEST_QUEUE_TEST_H___
+#define ___C3DT_PICK_REQUEST_QUEUE_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Render/PickRequestQueue.hpp>
+
+namespace Testing
+{
+	class PickRequestQueueTest
+		: public TestCase
+	{
+	public:
+		PickRequestQueueTest();
+		virtual ~PickRequestQueueTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Ids();
+		void Ordering();
+		void Cancel();
+		void CancelReentrant();
+		void ConcurrentPush();
+	};
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <Castor3D/Animation/Animation.hpp>
 #include <Castor3D/Animation/AnimationKeyFrame.hpp>
 #include <Castor3D/Binary/BinaryMesh.hpp>
+#include <Castor3D/Binary/BinaryScene.hpp>
 #include <Castor3D/Binary/BinarySkeleton.hpp>
 #include <Castor3D/Cache/CacheView.hpp>
 #include <Castor3D/Cache/MeshCache.hpp>
@@ -32,7 +33,7 @@ namespace Testing
 {
 	namespace
 	{
-		bool ExportScene( Scene const & p_scene, Path const & p_fileName )
+		bool ExportScene( Scene const & p_scene, Path const & p_fileName, bool p_binary )
 		{
 			Path folder = p_fileName.getPath();
 
@@ -51,8 +52,21 @@ namespace Testing
 			}
 
 			Path filePath = folder / p_fileName.getFileName();
-			TextFile scnFile( Path{ filePath + cuT( ".cscn" ) }, File::OpenMode::eWrite, File::EncodingMode::eASCII );
-			auto result = Scene::TextWriter( String() )( p_scene, scnFile );
+			Path binaryPath;
+			bool result = true;
+
+			if ( p_binary )
+			{
+				binaryPath = Path{ p_fileName.getFileName() + cuT( ".cscb" ) };
+				BinaryFile file{ folder / binaryPath, File::OpenMode::eWrite };
+				result = castor3d::BinaryWriter< Scene >{}.write( p_scene, file );
+			}
+
+			if ( result )
+			{
+				TextFile scnFile( Path{ filePath + cuT( ".cscn" ) }, File::OpenMode::eWrite, File::EncodingMode::eASCII );
+				result = Scene::TextWriter( String(), Path{}, binaryPath )( p_scene, scnFile );
+			}
 
 			Path subfolder{ cuT( "Meshes" ) };
 
@@ -152,6 +166,9 @@ namespace Testing
 		doRegisterTest( "SceneExportTest::InstancedScene", std::bind( &SceneExportTest::InstancedScene, this ) );
 		doRegisterTest( "SceneExportTest::AlphaScene", std::bind( &SceneExportTest::AlphaScene, this ) );
 		doRegisterTest( "SceneExportTest::AnimatedScene", std::bind( &SceneExportTest::AnimatedScene, this ) );
+		doRegisterTest( "SceneExportTest::SimpleSceneBinary", std::bind( &SceneExportTest::SimpleSceneBinary, this ) );
+		doRegisterTest( "SceneExportTest::InstancedSceneBinary", std::bind( &SceneExportTest::InstancedSceneBinary, this ) );
+		doRegisterTest( "SceneExportTest::AnimatedSceneBinary", std::bind( &SceneExportTest::AnimatedSceneBinary, this ) );
 	}
 
 	void SceneExportTest::SimpleScene()
@@ -174,6 +191,21 @@ namespace Testing
 		doTestScene( cuT( "Anim.zip" ) );
 	}
 
+	void SceneExportTest::SimpleSceneBinary()
+	{
+		doTestScene( cuT( "light_directional.cscn" ), true );
+	}
+
+	void SceneExportTest::InstancedSceneBinary()
+	{
+		doTestScene( cuT( "instancing.cscn" ), true );
+	}
+
+	void SceneExportTest::AnimatedSceneBinary()
+	{
+		doTestScene( cuT( "Anim.zip" ), true );
+	}
+
 	SceneSPtr SceneExportTest::doParseScene( Path const & p_path )
 	{
 		SceneFileParser dstParser{ m_engine };
@@ -192,11 +224,12 @@ namespace Testing
 		return scene;
 	}
 
-	void SceneExportTest::doTestScene( String const & p_name )
+	void SceneExportTest::doTestScene( String const & p_name
+		, bool p_binary )
 	{
 		SceneSPtr src{ doParseScene( m_testDataFolder / p_name ) };
 		Path path{ cuT( "TestScene.cscn" ) };
-		CT_CHECK( ExportScene( *src, path ) );
+		CT_CHECK( ExportScene( *src, path, p_binary ) );
 		
 		RenameObject( src, m_engine.getSceneCache() );
 		auto srcWindow = getWindow( m_engine, src->getName(), true );
@@ -23,10 +23,14 @@ namespace Testing
 		void InstancedScene();
 		void AlphaScene();
 		void AnimatedScene();
+		void SimpleSceneBinary();
+		void InstancedSceneBinary();
+		void AnimatedSceneBinary();
 
 	private:
 		castor3d::SceneSPtr doParseScene( castor::Path const & p_path );
-		void doTestScene( castor::String const & p_name );
+		void doTestScene( castor::String const & p_name
+			, bool p_binary = false );
 	};
 }
 
@@ -0,0 +1,308 @@
+#include "SubmeshUtilsTest.hpp"
+
+#include <cmath>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace
+	{
+		// A wavy grid, like a terrain or a scan, with its vertices in faces order.
+		void createGrid( uint32_t size
+			, InterleavedVertexArray & points
+			, FaceArray & faces )
+		{
+			points.clear();
+			faces.clear();
+
+			for ( uint32_t y = 0u; y <= size; ++y )
+			{
+				for ( uint32_t x = 0u; x <= size; ++x )
+				{
+					auto fx = float( x ) / float( size );
+					auto fy = float( y ) / float( size );
+					InterleavedVertex vertex;
+					vertex.pos = Point3f{ fx * 10.0f, std::sin( fx * 20.0f ) * std::cos( fy * 13.0f ), fy * 10.0f };
+					vertex.tex = Point3f{ fx, fy, 0.0f };
+					points.push_back( vertex );
+				}
+			}
+
+			for ( uint32_t y = 0u; y < size; ++y )
+			{
+				for ( uint32_t x = 0u; x < size; ++x )
+				{
+					auto index = y * ( size + 1u ) + x;
+					faces.emplace_back( index, index + size + 1u, index + 1u );
+					faces.emplace_back( index + 1u, index + size + 1u, index + size + 2u );
+				}
+			}
+		}
+
+		// The former serial implementation.
+		void computeNormalsSerial( InterleavedVertexArray & points
+			, FaceArray const & faces
+			, bool reverted )
+		{
+			for ( auto & pt : points )
+			{
+				pt.nml = Point3f{};
+				pt.tan = Point3f{};
+			}
+
+			for ( auto const & face : faces )
+			{
+				auto & vtx1 = points[face[0]];
+				auto & vtx2 = points[reverted ? face[2] : face[1]];
+				auto & vtx3 = points[reverted ? face[1] : face[2]];
+				auto const vec2m1 = vtx2.pos - vtx1.pos;
+				auto const vec3m1 = vtx3.pos - vtx1.pos;
+				auto const tex2m1 = vtx2.tex - vtx1.tex;
+				auto const tex3m1 = vtx3.tex - vtx1.tex;
+				auto const faceNormal = -point::cross( vec3m1, vec2m1 );
+				auto const faceTangent = ( vec3m1 * tex2m1[1] ) - ( vec2m1 * tex3m1[1] );
+				vtx1.nml += faceNormal;
+				vtx2.nml += faceNormal;
+				vtx3.nml += faceNormal;
+				vtx1.tan += faceTangent;
+				vtx2.tan += faceTangent;
+				vtx3.tan += faceTangent;
+			}
+
+			for ( auto & vtx : points )
+			{
+				point::normalise( vtx.nml );
+				point::normalise( vtx.tan );
+			}
+		}
+
+		// The former serial implementation.
+		void computeTangentsSerial( InterleavedVertexArray & points
+			, FaceArray const & faces )
+		{
+			Point3fArray arrayTangents( points.size() );
+
+			for ( auto const & face : faces )
+			{
+				auto & vtx1 = points[face[0]];
+				auto & vtx2 = points[face[1]];
+				auto & vtx3 = points[face[2]];
+				auto const vec2m1 = vtx2.pos - vtx1.pos;
+				auto const vec3m1 = vtx3.pos - vtx1.pos;
+				auto const tex2m1 = vtx2.tex - vtx1.tex;
+				auto const tex3m1 = vtx3.tex - vtx1.tex;
+				float dirCorrection = tex2m1[0] * tex3m1[1] - tex2m1[1] * tex3m1[0];
+				Point3f faceTangent;
+
+				if ( dirCorrection )
+				{
+					dirCorrection = 1 / dirCorrection;
+					faceTangent = ( ( vec2m1 * tex3m1[1] ) + ( vec3m1 * -tex2m1[1] ) ) * dirCorrection;
+				}
+
+				arrayTangents[face[0]] += faceTangent;
+				arrayTangents[face[1]] += faceTangent;
+				arrayTangents[face[2]] += faceTangent;
+			}
+
+			for ( size_t i = 0u; i < points.size(); ++i )
+			{
+				auto & point = points[i];
+				Point3f tangent = point::getNormalised( arrayTangents[i] );
+				tangent -= point.nml * point::dot( tangent, point.nml );
+				point.tan = tangent;
+			}
+		}
+
+		float getMaxDifference( InterleavedVertexArray const & lhs
+			, InterleavedVertexArray const & rhs )
+		{
+			float result = 0.0f;
+
+			for ( size_t i = 0u; i < lhs.size(); ++i )
+			{
+				for ( uint32_t c = 0u; c < 3u; ++c )
+				{
+					result = std::max( result, std::abs( lhs[i].nml[c] - rhs[i].nml[c] ) );
+					result = std::max( result, std::abs( lhs[i].tan[c] - rhs[i].tan[c] ) );
+				}
+			}
+
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	SubmeshUtilsTest::SubmeshUtilsTest()
+		: TestCase( "SubmeshUtilsTest" )
+	{
+	}
+
+	SubmeshUtilsTest::~SubmeshUtilsTest()
+	{
+	}
+
+	void SubmeshUtilsTest::doRegisterTests()
+	{
+		doRegisterTest( "NormalsMatchSerial", std::bind( &SubmeshUtilsTest::NormalsMatchSerial, this ) );
+		doRegisterTest( "TangentsMatchSerial", std::bind( &SubmeshUtilsTest::TangentsMatchSerial, this ) );
+		doRegisterTest( "AngleWeighting", std::bind( &SubmeshUtilsTest::AngleWeighting, this ) );
+		doRegisterTest( "MikkTSpaceTangents", std::bind( &SubmeshUtilsTest::MikkTSpaceTangents, this ) );
+	}
+
+	void SubmeshUtilsTest::NormalsMatchSerial()
+	{
+		InterleavedVertexArray points;
+		FaceArray faces;
+		createGrid( 300u, points, faces );
+
+		for ( auto reverted : { false, true } )
+		{
+			auto reference = points;
+			computeNormalsSerial( reference, faces, reverted );
+
+			for ( auto threadsCount : { 1u, 3u, 8u } )
+			{
+				auto result = points;
+				SubmeshUtils::computeNormals( result
+					, faces
+					, reverted
+					, SubmeshUtils::NormalWeighting::eArea
+					, threadsCount );
+				CT_CHECK( getMaxDifference( reference, result ) < 1.0e-4f );
+			}
+		}
+	}
+
+	void SubmeshUtilsTest::TangentsMatchSerial()
+	{
+		InterleavedVertexArray points;
+		FaceArray faces;
+		createGrid( 300u, points, faces );
+		computeNormalsSerial( points, faces, false );
+		auto reference = points;
+		computeTangentsSerial( reference, faces );
+
+		for ( auto threadsCount : { 1u, 3u, 8u } )
+		{
+			auto result = points;
+			SubmeshUtils::computeTangentsFromNormals( result
+				, faces
+				, SubmeshUtils::TangentsMode::eFaceGradient
+				, threadsCount );
+			CT_CHECK( getMaxDifference( reference, result ) < 1.0e-4f );
+		}
+	}
+
+	void SubmeshUtilsTest::AngleWeighting()
+	{
+		// The first face has a right angle at the origin, the second one is bigger, with a narrow angle there.
+		InterleavedVertexArray points( 5u );
+		points[0].pos = Point3f{ 0.0f, 0.0f, 0.0f };
+		points[1].pos = Point3f{ 1.0f, 0.0f, 0.0f };
+		points[2].pos = Point3f{ 0.0f, 1.0f, 0.0f };
+		points[3].pos = Point3f{ 10.0f, 0.0f, 0.0f };
+		points[4].pos = Point3f{ 10.0f, 0.0f, 1.0f };
+		FaceArray faces;
+		faces.emplace_back( 0u, 1u, 2u );
+		faces.emplace_back( 0u, 3u, 4u );
+
+		SubmeshUtils::computeNormals( points, faces, false, SubmeshUtils::NormalWeighting::eArea, 1u );
+		CT_CHECK( points[0].nml[1] < -0.9f );
+		SubmeshUtils::computeNormals( points, faces, false, SubmeshUtils::NormalWeighting::eAngle, 1u );
+		CT_CHECK( points[0].nml[2] > 0.9f );
+		// Vertices used by a single face get the face normal, in both modes.
+		CT_CHECK( std::abs( points[1].nml[2] - 1.0f ) < 1.0e-5f );
+		CT_CHECK( std::abs( points[3].nml[1] + 1.0f ) < 1.0e-5f );
+	}
+
+	void SubmeshUtilsTest::MikkTSpaceTangents()
+	{
+		InterleavedVertexArray points;
+		FaceArray faces;
+		createGrid( 64u, points, faces );
+		// A flat grid, with its texture U axis along X, gets X tangents.
+		for ( auto & point : points )
+		{
+			point.pos[1] = 0.0f;
+		}
+
+		SubmeshUtils::computeNormals( points, faces, false, SubmeshUtils::NormalWeighting::eAngle, 1u );
+		SubmeshUtils::computeTangentsFromNormals( points, faces, SubmeshUtils::TangentsMode::eMikkTSpace, 1u );
+		bool aligned = true;
+
+		for ( auto & point : points )
+		{
+			aligned = aligned
+				&& std::abs( point.tan[0] - 1.0f ) < 1.0e-4f
+				&& std::abs( point::dot( point.tan, point.nml ) ) < 1.0e-4f;
+		}
+
+		CT_CHECK( aligned );
+
+		// Without texture gradient, the tangents are still unit vectors, orthogonal to the normals.
+		for ( auto & point : points )
+		{
+			point.tex = Point3f{};
+		}
+
+		SubmeshUtils::computeTangentsFromNormals( points, faces, SubmeshUtils::TangentsMode::eMikkTSpace, 1u );
+		bool orthonormal = true;
+
+		for ( auto & point : points )
+		{
+			orthonormal = orthonormal
+				&& std::abs( point::length( point.tan ) - 1.0 ) < 1.0e-4
+				&& std::abs( point::dot( point.tan, point.nml ) ) < 1.0e-4f;
+		}
+
+		CT_CHECK( orthonormal );
+	}
+
+	//*********************************************************************************************
+
+	SubmeshUtilsBench::SubmeshUtilsBench()
+		: BenchCase( "SubmeshUtilsBench" )
+	{
+		// 2 millions triangles.
+		createGrid( 1000u, m_points, m_faces );
+		computeNormalsSerial( m_points, m_faces, false );
+	}
+
+	SubmeshUtilsBench::~SubmeshUtilsBench()
+	{
+	}
+
+	void SubmeshUtilsBench::Execute()
+	{
+		// The former serial implementation.
+		BENCHMARK( NormalsSerial, 5u );
+		BENCHMARK( NormalsParallel, 5u );
+		// The former serial implementation.
+		BENCHMARK( TangentsSerial, 5u );
+		BENCHMARK( TangentsParallel, 5u );
+	}
+
+	void SubmeshUtilsBench::NormalsSerial()
+	{
+		computeNormalsSerial( m_points, m_faces, false );
+	}
+
+	void SubmeshUtilsBench::NormalsParallel()
+	{
+		SubmeshUtils::computeNormals( m_points, m_faces );
+	}
+
+	void SubmeshUtilsBench::TangentsSerial()
+	{
+		computeTangentsSerial( m_points, m_faces );
+	}
+
+	void SubmeshUtilsBench::TangentsParallel()
+	{
+		SubmeshUtils::computeTangentsFromNormals( m_points, m_faces );
+	}
+}
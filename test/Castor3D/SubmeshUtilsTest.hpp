@@ -0,0 +1,50 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_SUBMESH_UTILS_TEST_H___
+#define ___C3DT_SUBMESH_UTILS_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Model/VertexGroup.hpp>
+#include <Castor3D/Model/Mesh/Submesh/SubmeshUtils.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/Face.hpp>
+
+namespace Testing
+{
+	class SubmeshUtilsTest
+		: public TestCase
+	{
+	public:
+		SubmeshUtilsTest();
+		virtual ~SubmeshUtilsTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void NormalsMatchSerial();
+		void TangentsMatchSerial();
+		void AngleWeighting();
+		void MikkTSpaceTangents();
+	};
+
+	class SubmeshUtilsBench
+		: public BenchCase
+	{
+	public:
+		SubmeshUtilsBench();
+		virtual ~SubmeshUtilsBench();
+		virtual void Execute();
+
+	private:
+		void NormalsSerial();
+		void NormalsParallel();
+		void TangentsSerial();
+		void TangentsParallel();
+
+	private:
+		castor3d::InterleavedVertexArray m_points;
+		castor3d::FaceArray m_faces;
+	};
+}
+
+#endif
@@ -0,0 +1,171 @@
+#include "UploadRingTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Buffer/UploadQueue.hpp>
+#include <Castor3D/Material/Texture/TextureLayout.hpp>
+#include <Castor3D/Render/RenderDevice.hpp>
+#include <Castor3D/Render/RenderSystem.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	UploadRingTest::UploadRingTest( Engine & engine )
+		: C3DTestCase{ "UploadRingTest", engine }
+	{
+	}
+
+	UploadRingTest::~UploadRingTest()
+	{
+	}
+
+	void UploadRingTest::doRegisterTests()
+	{
+		doRegisterTest( "Alignment", std::bind( &UploadRingTest::Alignment, this ) );
+		doRegisterTest( "FrameBudget", std::bind( &UploadRingTest::FrameBudget, this ) );
+		doRegisterTest( "Wrap", std::bind( &UploadRingTest::Wrap, this ) );
+		doRegisterTest( "Oversized", std::bind( &UploadRingTest::Oversized, this ) );
+		doRegisterTest( "SceneLoad", std::bind( &UploadRingTest::SceneLoad, this ) );
+	}
+
+	void UploadRingTest::Alignment()
+	{
+		UploadRing ring{ 1024u, 1024u };
+		CT_EQUAL( ring.allocate( 3u, 4u ), 0u );
+		CT_EQUAL( ring.allocate( 10u, 12u ), 12u );
+		CT_EQUAL( ring.allocate( 16u, 16u ), 32u );
+		// The padding is consumed by the open batch.
+		CT_EQUAL( ring.getUsed(), 48u );
+		CT_EQUAL( ring.getFrameBytes(), 29u );
+		CT_CHECK( ring.hasOpenBatch() );
+		CT_EQUAL( ring.closeBatch(), 1u );
+		CT_CHECK( !ring.hasOpenBatch() );
+		// Closing an empty batch gives back the last value.
+		CT_EQUAL( ring.closeBatch(), 1u );
+		ring.retire( 1u );
+		CT_EQUAL( ring.getUsed(), 0u );
+		CT_EQUAL( ring.getRetiredValue(), 1u );
+	}
+
+	void UploadRingTest::FrameBudget()
+	{
+		UploadRing ring{ 1024u, 100u };
+		CT_EQUAL( ring.allocate( 60u, 4u ), 0u );
+		CT_EQUAL( ring.allocate( 60u, 4u ), UploadRing::InvalidOffset );
+		CT_EQUAL( ring.allocate( 40u, 4u ), 60u );
+		CT_EQUAL( ring.allocate( 4u, 4u ), UploadRing::InvalidOffset );
+		ring.nextFrame();
+		// The first allocation of a frame may exceed the budget.
+		CT_EQUAL( ring.allocate( 500u, 4u ), 100u );
+		CT_EQUAL( ring.allocate( 4u, 4u ), UploadRing::InvalidOffset );
+		CT_EQUAL( ring.getFrameBytes(), 500u );
+	}
+
+	void UploadRingTest::Wrap()
+	{
+		UploadRing ring{ 100u, 1000u };
+		CT_EQUAL( ring.allocate( 60u, 4u ), 0u );
+		CT_EQUAL( ring.closeBatch(), 1u );
+		CT_EQUAL( ring.allocate( 30u, 4u ), 60u );
+		CT_EQUAL( ring.closeBatch(), 2u );
+		// Not enough room at the end, and the first batch is in flight.
+		CT_EQUAL( ring.allocate( 20u, 4u ), UploadRing::InvalidOffset );
+		ring.retire( 1u );
+		CT_EQUAL( ring.getUsed(), 30u );
+		// Wraps, the skipped end of the ring is accounted to the batch.
+		CT_EQUAL( ring.allocate( 20u, 4u ), 0u );
+		CT_EQUAL( ring.getUsed(), 60u );
+		CT_EQUAL( ring.closeBatch(), 3u );
+		// Only [20, 60) is free.
+		CT_EQUAL( ring.allocate( 44u, 4u ), UploadRing::InvalidOffset );
+		CT_EQUAL( ring.allocate( 40u, 4u ), 20u );
+		CT_EQUAL( ring.allocate( 1u, 1u ), UploadRing::InvalidOffset );
+		CT_EQUAL( ring.closeBatch(), 4u );
+		ring.retire( 4u );
+		CT_EQUAL( ring.getUsed(), 0u );
+		CT_EQUAL( ring.allocate( 100u, 4u ), 0u );
+	}
+
+	void UploadRingTest::Oversized()
+	{
+		UploadRing ring{ 100u, 1000u };
+		CT_CHECK( !ring.isOversized( 100u ) );
+		CT_CHECK( ring.isOversized( 101u ) );
+		CT_EQUAL( ring.allocate( 101u, 4u ), UploadRing::InvalidOffset );
+		CT_EQUAL( ring.getUsed(), 0u );
+		CT_EQUAL( ring.getFrameBytes(), 0u );
+	}
+
+	void UploadRingTest::SceneLoad()
+	{
+		// 256 textures of 16 KB, pushed at once like a scene loading, then uploaded by the frames updates.
+		static uint32_t constexpr TextureDim = 64u;
+		static VkDeviceSize constexpr TextureSize = TextureDim * TextureDim * 4u;
+		static uint32_t constexpr TexturesCount = 256u;
+		static uint32_t constexpr FrameTextures = 32u;
+		auto & device = *m_engine.getRenderSystem()->getMainRenderDevice();
+		std::vector< ashes::ImagePtr > images;
+		std::vector< uint8_t > const data( TextureSize, uint8_t( 0x7F ) );
+		uint32_t ready = 0u;
+		uint64_t ticket = 0u;
+
+		for ( uint32_t i = 0u; i < TexturesCount; ++i )
+		{
+			images.push_back( makeImage( device
+				, ashes::ImageCreateInfo
+				{
+					0u,
+					VK_IMAGE_TYPE_2D,
+					VK_FORMAT_R8G8B8A8_UNORM,
+					{ TextureDim, TextureDim, 1u },
+					1u,
+					1u,
+					VK_SAMPLE_COUNT_1_BIT,
+					VK_IMAGE_TILING_OPTIMAL,
+					VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+				}
+				, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+				, "UploadRingTest" + std::to_string( i ) ) );
+		}
+
+		UploadQueue queue{ device, 2u * FrameTextures * TextureSize, FrameTextures * TextureSize };
+
+		for ( auto & image : images )
+		{
+			ticket = queue.pushUpload( *image
+				, { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u }
+				, castor::makeArrayView( data.data(), data.data() + data.size() )
+				, { VkBufferImageCopy{ 0u, 0u, 0u, { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u }, {}, { TextureDim, TextureDim, 1u } } }
+				, [&ready]()
+				{
+					++ready;
+				} );
+		}
+
+		// Only the first frame budget is processed, the other uploads wait for the next frames.
+		CT_EQUAL( queue.getPendingCount(), size_t( TexturesCount - FrameTextures ) );
+		CT_EQUAL( queue.getSubmitCount(), 0u );
+		uint32_t frames = 0u;
+
+		while ( queue.getPendingCount() && frames < TexturesCount )
+		{
+			queue.update();
+			++frames;
+			CT_CHECK( queue.getRing().getUsed() <= queue.getRing().getCapacity() );
+			CT_CHECK( queue.getRing().getFrameBytes() <= queue.getRing().getFrameBudget() );
+		}
+
+		// One submission per frame budget, instead of one per texture, and the frames never waited for the GPU.
+		// The first update submits the budget processed by the pushes along with its own.
+		CT_EQUAL( queue.getPendingCount(), size_t( 0u ) );
+		CT_EQUAL( frames, TexturesCount / FrameTextures - 1u );
+		CT_EQUAL( queue.getSubmitCount(), frames );
+		CT_EQUAL( queue.getWaitCount(), 0u );
+
+		queue.waitIdle();
+		CT_CHECK( queue.isReady( ticket ) );
+		CT_EQUAL( ready, TexturesCount );
+		CT_EQUAL( queue.getRing().getUsed(), 0u );
+	}
+}
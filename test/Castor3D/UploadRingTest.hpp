@@ -0,0 +1,30 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_UPLOAD_RING_TEST_H___
+#define ___C3DT_UPLOAD_RING_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+#include <Castor3D/Buffer/UploadRing.hpp>
+
+namespace Testing
+{
+	class UploadRingTest
+		: public C3DTestCase
+	{
+	public:
+		explicit UploadRingTest( castor3d::Engine & engine );
+		virtual ~UploadRingTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Alignment();
+		void FrameBudget();
+		void Wrap();
+		void Oversized();
+		void SceneLoad();
+	};
+}
+
+#endif
@@ -1,7 +1,14 @@
 #include "Castor3DTestPrerequisites.hpp"
 
+#include "AnimationThrottleTest.hpp"
 #include "BinaryExportTest.hpp"
+#include "BonePaletteAllocatorTest.hpp"
+#include "FrameEventQueueTest.hpp"
+#include "OverlayDrawBatcherTest.hpp"
+#include "PickRequestQueueTest.hpp"
 #include "SceneExportTest.hpp"
+#include "SubmeshUtilsTest.hpp"
+#include "UploadRingTest.hpp"
 
 #include <Castor3D/Engine.hpp>
 #include <Castor3D/Cache/PluginCache.hpp>
@@ -143,6 +150,18 @@ int main( int argc, char const * argv[] )
 		// Test cases.
 		Testing::registerType( std::make_unique< Testing::BinaryExportTest >( *engine ) );
 		Testing::registerType( std::make_unique< Testing::SceneExportTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::AnimationThrottleTest >() );
+		Testing::registerType( std::make_unique< Testing::AnimationThrottleBench >() );
+		Testing::registerType( std::make_unique< Testing::OverlayDrawBatcherTest >() );
+		Testing::registerType( std::make_unique< Testing::OverlayDrawBatcherBench >() );
+		Testing::registerType( std::make_unique< Testing::BonePaletteAllocatorTest >() );
+		Testing::registerType( std::make_unique< Testing::BonePaletteAllocatorBench >() );
+		Testing::registerType( std::make_unique< Testing::UploadRingTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::FrameEventQueueTest >() );
+		Testing::registerType( std::make_unique< Testing::FrameEventQueueBench >() );
+		Testing::registerType( std::make_unique< Testing::SubmeshUtilsTest >() );
+		Testing::registerType( std::make_unique< Testing::SubmeshUtilsBench >() );
+		Testing::registerType( std::make_unique< Testing::PickRequestQueueTest >() );
 
 		// Tests loop.
 		BENCHLOOP( count, result );
@@ -0,0 +1,178 @@
+#include "CastorUtilsBlockCompressionTest.hpp"
+
+#include <CastorUtils/Graphics/PixelBufferBase.hpp>
+
+#include <cmath>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr Width = 64u;
+		static uint32_t constexpr Height = 64u;
+
+		PxBufferBaseSPtr createSource( uint32_t width
+			, uint32_t height )
+		{
+			auto result = PxBufferBase::create( Size{ width, height }
+				, PixelFormat::eR8G8B8A8_UNORM );
+			auto data = result->getPtr();
+
+			for ( uint32_t y = 0u; y < height; ++y )
+			{
+				for ( uint32_t x = 0u; x < width; ++x )
+				{
+					// Smooth gradients, with a few sharp edges.
+					*data++ = uint8_t( ( x * 255u ) / ( width - 1u ) );
+					*data++ = uint8_t( ( y * 255u ) / ( height - 1u ) );
+					*data++ = uint8_t( ( ( x / 8u + y / 8u ) % 2u ) ? 200u : 40u );
+					*data++ = uint8_t( 255u - ( ( x + y ) * 255u ) / ( width + height - 2u ) );
+				}
+			}
+
+			return result;
+		}
+
+		double getPsnr( PxBufferBase const & lhs
+			, PxBufferBase const & rhs
+			, uint32_t components )
+		{
+			auto lhsData = lhs.getConstPtr();
+			auto rhsData = rhs.getConstPtr();
+			auto count = lhs.getWidth() * lhs.getHeight();
+			double error = 0.0;
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				for ( uint32_t c = 0u; c < components; ++c )
+				{
+					auto diff = double( lhsData[i * 4u + c] ) - double( rhsData[i * 4u + c] );
+					error += diff * diff;
+				}
+			}
+
+			error /= double( count * components );
+			return error == 0.0
+				? 100.0
+				: 10.0 * std::log10( 255.0 * 255.0 / error );
+		}
+	}
+
+	CastorUtilsBlockCompressionTest::CastorUtilsBlockCompressionTest()
+		: TestCase( "CastorUtilsBlockCompressionTest" )
+	{
+	}
+
+	CastorUtilsBlockCompressionTest::~CastorUtilsBlockCompressionTest()
+	{
+	}
+
+	void CastorUtilsBlockCompressionTest::doRegisterTests()
+	{
+		doRegisterTest( "BlockSizes", std::bind( &CastorUtilsBlockCompressionTest::BlockSizes, this ) );
+		doRegisterTest( "RoundTripBC1", std::bind( &CastorUtilsBlockCompressionTest::RoundTripBC1, this ) );
+		doRegisterTest( "RoundTripBC3", std::bind( &CastorUtilsBlockCompressionTest::RoundTripBC3, this ) );
+		doRegisterTest( "RoundTripBC4", std::bind( &CastorUtilsBlockCompressionTest::RoundTripBC4, this ) );
+		doRegisterTest( "RoundTripBC5", std::bind( &CastorUtilsBlockCompressionTest::RoundTripBC5, this ) );
+		doRegisterTest( "RoundTripBC7", std::bind( &CastorUtilsBlockCompressionTest::RoundTripBC7, this ) );
+		doRegisterTest( "PartialBlocks", std::bind( &CastorUtilsBlockCompressionTest::PartialBlocks, this ) );
+	}
+
+	void CastorUtilsBlockCompressionTest::BlockSizes()
+	{
+		auto source = createSource( Width, Height );
+		auto bc1 = PF::compressBuffer( source, PixelFormat::eBC1_RGB_UNORM_BLOCK );
+		CT_CHECK( bc1->getFormat() == PixelFormat::eBC1_RGB_UNORM_BLOCK );
+		CT_EQUAL( bc1->getSize(), ( Width / 4u ) * ( Height / 4u ) * 8u );
+		auto bc7 = PF::compressBuffer( source, PixelFormat::eBC7_UNORM_BLOCK );
+		CT_CHECK( bc7->getFormat() == PixelFormat::eBC7_UNORM_BLOCK );
+		CT_EQUAL( bc7->getSize(), ( Width / 4u ) * ( Height / 4u ) * 16u );
+		CT_CHECK( !PF::isBlockCompressionSupported( PixelFormat::eR8G8B8A8_UNORM ) );
+	}
+
+	void CastorUtilsBlockCompressionTest::RoundTripBC1()
+	{
+		CT_CHECK( doRoundTrip( PixelFormat::eBC1_RGB_UNORM_BLOCK, BlockCompressionQuality::eFast, 3u ) > 30.0 );
+		CT_CHECK( doRoundTrip( PixelFormat::eBC1_RGB_UNORM_BLOCK, BlockCompressionQuality::eNormal, 3u ) > 32.0 );
+	}
+
+	void CastorUtilsBlockCompressionTest::RoundTripBC3()
+	{
+		CT_CHECK( doRoundTrip( PixelFormat::eBC3_UNORM_BLOCK, BlockCompressionQuality::eNormal, 4u ) > 32.0 );
+	}
+
+	void CastorUtilsBlockCompressionTest::RoundTripBC4()
+	{
+		CT_CHECK( doRoundTrip( PixelFormat::eBC4_UNORM_BLOCK, BlockCompressionQuality::eNormal, 1u ) > 45.0 );
+	}
+
+	void CastorUtilsBlockCompressionTest::RoundTripBC5()
+	{
+		CT_CHECK( doRoundTrip( PixelFormat::eBC5_UNORM_BLOCK, BlockCompressionQuality::eNormal, 2u ) > 45.0 );
+	}
+
+	void CastorUtilsBlockCompressionTest::RoundTripBC7()
+	{
+		CT_CHECK( doRoundTrip( PixelFormat::eBC7_UNORM_BLOCK, BlockCompressionQuality::eNormal, 4u ) > 32.0 );
+		CT_CHECK( doRoundTrip( PixelFormat::eBC7_UNORM_BLOCK, BlockCompressionQuality::eHigh, 4u ) > 32.0 );
+	}
+
+	void CastorUtilsBlockCompressionTest::PartialBlocks()
+	{
+		auto source = createSource( 13u, 7u );
+		auto compressed = PF::compressBuffer( source, PixelFormat::eBC1_RGB_UNORM_BLOCK );
+		CT_EQUAL( compressed->getSize(), 4u * 2u * 8u );
+		auto decompressed = PF::decompressBuffer( compressed );
+		CT_EQUAL( decompressed->getWidth(), 13u );
+		CT_EQUAL( decompressed->getHeight(), 7u );
+		CT_CHECK( getPsnr( *source, *decompressed, 3u ) > 28.0 );
+	}
+
+	double CastorUtilsBlockCompressionTest::doRoundTrip( PixelFormat format
+		, BlockCompressionQuality quality
+		, uint32_t components )
+	{
+		auto source = createSource( Width, Height );
+		auto compressed = PF::compressBuffer( source
+			, format
+			, BlockCompressionOptions{ quality, 2u } );
+		auto decompressed = PF::decompressBuffer( compressed );
+		return getPsnr( *source, *decompressed, components );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsBlockCompressionBench::CastorUtilsBlockCompressionBench()
+		: BenchCase( "CastorUtilsBlockCompressionBench" )
+		, m_source{ createSource( 256u, 256u ) }
+	{
+	}
+
+	CastorUtilsBlockCompressionBench::~CastorUtilsBlockCompressionBench()
+	{
+	}
+
+	void CastorUtilsBlockCompressionBench::Execute()
+	{
+		BENCHMARK( CompressBC1, NB_TESTS );
+		BENCHMARK( CompressBC5, NB_TESTS );
+		BENCHMARK( CompressBC7, NB_TESTS );
+	}
+
+	void CastorUtilsBlockCompressionBench::CompressBC1()
+	{
+		doNotOptimizeAway( PF::compressBuffer( m_source, PixelFormat::eBC1_RGB_UNORM_BLOCK ) );
+	}
+
+	void CastorUtilsBlockCompressionBench::CompressBC5()
+	{
+		doNotOptimizeAway( PF::compressBuffer( m_source, PixelFormat::eBC5_UNORM_BLOCK ) );
+	}
+
+	void CastorUtilsBlockCompressionBench::CompressBC7()
+	{
+		doNotOptimizeAway( PF::compressBuffer( m_source, PixelFormat::eBC7_UNORM_BLOCK ) );
+	}
+}
@@ -0,0 +1,54 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsBlockCompressionTest___
+#define ___CUT_CastorUtilsBlockCompressionTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/BlockCompression.hpp>
+
+namespace Testing
+{
+	class CastorUtilsBlockCompressionTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsBlockCompressionTest();
+		virtual ~CastorUtilsBlockCompressionTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void BlockSizes();
+		void RoundTripBC1();
+		void RoundTripBC3();
+		void RoundTripBC4();
+		void RoundTripBC5();
+		void RoundTripBC7();
+		void PartialBlocks();
+
+	private:
+		double doRoundTrip( castor::PixelFormat format
+			, castor::BlockCompressionQuality quality
+			, uint32_t components );
+	};
+
+	class CastorUtilsBlockCompressionBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsBlockCompressionBench();
+		virtual ~CastorUtilsBlockCompressionBench();
+		virtual void Execute();
+
+	private:
+		void CompressBC1();
+		void CompressBC5();
+		void CompressBC7();
+
+	private:
+		castor::PxBufferBaseSPtr m_source;
+	};
+}
+
+#endif
@@ -0,0 +1,260 @@
+#include "CastorUtilsFileParserTest.hpp"
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/FileParser/FileParser.hpp>
+#include <CastorUtils/FileParser/FileParserContext.hpp>
+#include <CastorUtils/FileParser/ParserKeywordTable.hpp>
+#include <CastorUtils/FileParser/ParserParameter.hpp>
+#include <CastorUtils/Log/Logger.hpp>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr RootSection = 0u;
+		static uint32_t constexpr ObjectSection = 1u;
+
+		// The CRLF line ends, the BOM and the comments are handled by the tokeniser.
+		static char const * const Content = "\xEF\xBB\xBF// Header comment\r\n"
+			"define SIZE 3\r\n"
+			"object \"first\"\r\n"
+			"{\r\n"
+			"\tposition 1.5, -2 ; 3e2\r\n"
+			"\tcount 0x10 /* inline */\r\n"
+			"\tcount SIZE\r\n"
+			"}\r\n"
+			"object \"second\" {\n"
+			"\t/* multi\n"
+			"\tline */\n"
+			"\tposition 1 2 3\n"
+			"\tunknown 12\n"
+			"}\n";
+
+		class TestParser
+			: public FileParser
+		{
+		public:
+			TestParser()
+				: FileParser{ RootSection }
+			{
+				addParser( RootSection
+					, cuT( "object" )
+					, [this]( FileParser * parser, ParserParameterArray const & params )
+					{
+						String name;
+						calls.push_back( cuT( "object:" ) + params[0]->get( name ) );
+						parser->getContext()->m_sections.push_back( ObjectSection );
+						return true;
+					}
+					, { makeParameter< ParameterType::eName >() } );
+				addParser( ObjectSection
+					, cuT( "position" )
+					, [this]( FileParser * parser, ParserParameterArray const & params )
+					{
+						Point3f value;
+						params[0]->get( value );
+						auto stream = makeStringStream();
+						stream << cuT( "position@" ) << parser->getContext()->m_line << cuT( ":" ) << value[0] << cuT( " " ) << value[1] << cuT( " " ) << value[2];
+						calls.push_back( stream.str() );
+						return false;
+					}
+					, { makeParameter< ParameterType::ePoint3F >() } );
+				addParser( ObjectSection
+					, cuT( "count" )
+					, [this]( FileParser * parser, ParserParameterArray const & params )
+					{
+						uint32_t value;
+						params[0]->get( value );
+						calls.push_back( cuT( "count@" ) + string::toString( parser->getContext()->m_line ) + cuT( ":" ) + string::toString( value ) );
+						return false;
+					}
+					, { makeParameter< ParameterType::eUInt32 >() } );
+				addParser( ObjectSection
+					, cuT( "}" )
+					, [this]( FileParser * parser, ParserParameterArray const & params )
+					{
+						calls.push_back( cuT( "end" ) );
+						parser->getContext()->m_sections.pop_back();
+						return false;
+					} );
+			}
+
+			StringArray calls;
+
+		private:
+			void doInitialiseParser( Path const & path )override
+			{
+				m_context = std::make_shared< FileParserContext >( m_logger, path );
+			}
+
+			void doCleanupParser()override
+			{
+				m_context.reset();
+			}
+
+			bool doDelegateParser( String const & line )override
+			{
+				return false;
+			}
+
+			bool doDiscardParser( String const & line )override
+			{
+				calls.push_back( cuT( "discard:" ) + line );
+				return true;
+			}
+
+			void doValidate()override
+			{
+				calls.push_back( cuT( "validate" ) );
+			}
+
+			String doGetSectionName( uint32_t section )override
+			{
+				return section == ObjectSection
+					? cuT( "object" )
+					: cuT( "root" );
+			}
+		};
+
+		StringArray const & getExpectedCalls()
+		{
+			static StringArray const result
+			{
+				cuT( "object:first" ),
+				cuT( "position@5:1.5 -2 300" ),
+				cuT( "count@6:16" ),
+				cuT( "count@7:3" ),
+				cuT( "end" ),
+				cuT( "object:second" ),
+				cuT( "position@12:1 2 3" ),
+				cuT( "discard:unknown 12" ),
+				cuT( "end" ),
+				cuT( "validate" ),
+			};
+			return result;
+		}
+	}
+
+	CastorUtilsFileParserTest::CastorUtilsFileParserTest()
+		: TestCase( "CastorUtilsFileParserTest" )
+	{
+	}
+
+	CastorUtilsFileParserTest::~CastorUtilsFileParserTest()
+	{
+	}
+
+	void CastorUtilsFileParserTest::doRegisterTests()
+	{
+		doRegisterTest( "KeywordTable", std::bind( &CastorUtilsFileParserTest::KeywordTable, this ) );
+		doRegisterTest( "Numbers", std::bind( &CastorUtilsFileParserTest::Numbers, this ) );
+		doRegisterTest( "Names", std::bind( &CastorUtilsFileParserTest::Names, this ) );
+		doRegisterTest( "ParseContent", std::bind( &CastorUtilsFileParserTest::ParseContent, this ) );
+		doRegisterTest( "ParseFile", std::bind( &CastorUtilsFileParserTest::ParseFile, this ) );
+	}
+
+	void CastorUtilsFileParserTest::KeywordTable()
+	{
+		CT_CHECK( ParserKeywordTable{ AttributeParserMap{} }.find( cuT( "object" ) ) == nullptr );
+
+		AttributeParserMap parsers;
+		parsers[cuT( "}" )] = {};
+
+		for ( uint32_t i = 0u; i < 500u; ++i )
+		{
+			parsers[cuT( "keyword" ) + string::toString( i )] = {};
+		}
+
+		ParserKeywordTable table{ parsers };
+
+		for ( auto & parser : parsers )
+		{
+			CT_CHECK( table.find( parser.first ) == &parser.second );
+		}
+
+		CT_CHECK( table.find( cuT( "keyword500" ) ) == nullptr );
+		CT_CHECK( table.find( cuT( "keyword" ) ) == nullptr );
+		CT_CHECK( table.find( cuT( "keyword1 " ) ) == nullptr );
+		CT_CHECK( table.find( cuT( "{" ) ) == nullptr );
+		CT_CHECK( table.find( String{} ) == nullptr );
+	}
+
+	void CastorUtilsFileParserTest::Numbers()
+	{
+		auto & logger = *Logger::getSingleton().getInstance();
+		{
+			ParserParameter< ParameterType::ePoint3F > point;
+			String params = cuT( "1.5, -2 ; 3e2 tail" );
+			CT_CHECK( point.parse( logger, params ) );
+			CT_EQUAL( point.m_value, Point3f( 1.5f, -2.0f, 300.0f ) );
+			CT_EQUAL( params, String{ cuT( " tail" ) } );
+		}
+		{
+			ParserParameter< ParameterType::eUInt32 > value;
+			String params = cuT( "0xFF" );
+			CT_CHECK( value.parse( logger, params ) );
+			CT_EQUAL( value.m_value, 255u );
+			CT_CHECK( params.empty() );
+		}
+		{
+			ParserParameter< ParameterType::eInt32 > value;
+			String params = cuT( "\t-7 8" );
+			CT_CHECK( value.parse( logger, params ) );
+			CT_EQUAL( value.m_value, -7 );
+			CT_EQUAL( params, String{ cuT( " 8" ) } );
+		}
+		{
+			// Not a number start, the regex still finds it.
+			ParserParameter< ParameterType::eFloat > value;
+			String params = cuT( "+2.5" );
+			CT_CHECK( value.parse( logger, params ) );
+			CT_EQUAL( value.m_value, 2.5f );
+		}
+		{
+			// The values need a separator.
+			ParserParameter< ParameterType::ePoint2I > point;
+			String params = cuT( "1-2" );
+			CT_CHECK( !point.parse( logger, params ) );
+		}
+	}
+
+	void CastorUtilsFileParserTest::Names()
+	{
+		auto & logger = *Logger::getSingleton().getInstance();
+		{
+			ParserParameter< ParameterType::eName > name;
+			String params = cuT( "\"my object\" 12" );
+			CT_CHECK( name.parse( logger, params ) );
+			CT_EQUAL( name.m_value, String{ cuT( "my object" ) } );
+			CT_EQUAL( params, String{ cuT( " 12" ) } );
+		}
+		{
+			ParserParameter< ParameterType::eName > name;
+			String params = cuT( "\"unterminated" );
+			CT_CHECK( !name.parse( logger, params ) );
+		}
+	}
+
+	void CastorUtilsFileParserTest::ParseContent()
+	{
+		TestParser parser;
+		CT_CHECK( parser.parseFile( Path{ cuT( "content.cscn" ) }, String{ Content } ) );
+		CT_CHECK( parser.calls == getExpectedCalls() );
+	}
+
+	void CastorUtilsFileParserTest::ParseFile()
+	{
+		Path path{ cuT( "FileParserTest.cscn" ) };
+		{
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			file.writeArray( Content, strlen( Content ) );
+		}
+
+		TestParser parser;
+		CT_CHECK( parser.parseFile( path ) );
+		CT_CHECK( parser.calls == getExpectedCalls() );
+		std::remove( string::stringCast< char >( path ).c_str() );
+	}
+}
@@ -0,0 +1,28 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsFileParserTest___
+#define ___CUT_CastorUtilsFileParserTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsFileParserTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsFileParserTest();
+		virtual ~CastorUtilsFileParserTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void KeywordTable();
+		void Numbers();
+		void Names();
+		void ParseContent();
+		void ParseFile();
+	};
+}
+
+#endif
@@ -0,0 +1,163 @@
+#include "CastorUtilsHeightmapTest.hpp"
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/File.hpp>
+
+#include <cmath>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		bool isSame( Heightmap const & lhs
+			, Heightmap const & rhs )
+		{
+			if ( lhs.getSize() != rhs.getSize() )
+			{
+				return false;
+			}
+
+			for ( uint32_t y = 0u; y < lhs.getSize(); ++y )
+			{
+				for ( uint32_t x = 0u; x < lhs.getSize(); ++x )
+				{
+					if ( lhs( x, y ) != rhs( x, y ) )
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		Path getTestFile()
+		{
+			return File::getExecutableDirectory() / cuT( "CastorUtilsHeightmapTest.c3dh" );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsHeightmapTest::CastorUtilsHeightmapTest()
+		: TestCase( "CastorUtilsHeightmapTest" )
+	{
+	}
+
+	CastorUtilsHeightmapTest::~CastorUtilsHeightmapTest()
+	{
+	}
+
+	void CastorUtilsHeightmapTest::doRegisterTests()
+	{
+		doRegisterTest( "ThreadsCountIndependent", std::bind( &CastorUtilsHeightmapTest::ThreadsCountIndependent, this ) );
+		doRegisterTest( "SeedDependent", std::bind( &CastorUtilsHeightmapTest::SeedDependent, this ) );
+		doRegisterTest( "SaveLoad", std::bind( &CastorUtilsHeightmapTest::SaveLoad, this ) );
+		doRegisterTest( "LoadTruncated", std::bind( &CastorUtilsHeightmapTest::LoadTruncated, this ) );
+	}
+
+	void CastorUtilsHeightmapTest::ThreadsCountIndependent()
+	{
+		// 1025 samples per side, enough for the steps to be split across threads.
+		auto reference = Heightmap::generate( 10u, 0.5f, 42u, 1u );
+		CT_EQUAL( reference.getSize(), 1025u );
+
+		for ( auto threadsCount : { 0u, 2u, 3u, 8u } )
+		{
+			auto result = Heightmap::generate( 10u, 0.5f, 42u, threadsCount );
+			CT_CHECK( isSame( reference, result ) );
+		}
+	}
+
+	void CastorUtilsHeightmapTest::SeedDependent()
+	{
+		auto lhs = Heightmap::generate( 8u, 0.5f, 42u, 0u );
+		auto rhs = Heightmap::generate( 8u, 0.5f, 43u, 0u );
+		auto finite = true;
+
+		for ( uint32_t y = 0u; y < lhs.getSize(); ++y )
+		{
+			for ( uint32_t x = 0u; x < lhs.getSize(); ++x )
+			{
+				finite = finite && std::isfinite( lhs( x, y ) );
+			}
+		}
+
+		CT_CHECK( finite );
+		CT_CHECK( !isSame( lhs, rhs ) );
+	}
+
+	void CastorUtilsHeightmapTest::SaveLoad()
+	{
+		auto path = getTestFile();
+		auto source = Heightmap::generate( 7u, 0.5f, 7u, 0u );
+		CT_CHECK( source.save( path ) );
+
+		Heightmap loaded;
+		CT_CHECK( loaded.load( path ) );
+		CT_CHECK( isSame( source, loaded ) );
+
+		File::deleteFile( path );
+		CT_CHECK( !loaded.load( path ) );
+		// A failed load leaves the heightmap untouched.
+		CT_CHECK( isSame( source, loaded ) );
+	}
+
+	void CastorUtilsHeightmapTest::LoadTruncated()
+	{
+		auto path = getTestFile();
+		{
+			// A header announcing far more samples than the file holds.
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			file.write( 0x48443343u );
+			file.write( 0xFFFFFFF0u );
+			file.write( 0.0f );
+		}
+
+		Heightmap loaded;
+		CT_CHECK( !loaded.load( path ) );
+		CT_EQUAL( loaded.getSize(), 0u );
+		File::deleteFile( path );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsHeightmapBench::CastorUtilsHeightmapBench()
+		: BenchCase( "CastorUtilsHeightmapBench" )
+	{
+	}
+
+	CastorUtilsHeightmapBench::~CastorUtilsHeightmapBench()
+	{
+	}
+
+	void CastorUtilsHeightmapBench::Execute()
+	{
+		BENCHMARK( Generate4097Serial, 3u );
+		BENCHMARK( Generate4097Parallel, 3u );
+		BENCHMARK( Generate8193Serial, 3u );
+		BENCHMARK( Generate8193Parallel, 3u );
+	}
+
+	void CastorUtilsHeightmapBench::Generate4097Serial()
+	{
+		Heightmap::generate( 12u, 0.5f, 1u, 1u );
+	}
+
+	void CastorUtilsHeightmapBench::Generate4097Parallel()
+	{
+		Heightmap::generate( 12u, 0.5f, 1u, 0u );
+	}
+
+	void CastorUtilsHeightmapBench::Generate8193Serial()
+	{
+		Heightmap::generate( 13u, 0.5f, 1u, 1u );
+	}
+
+	void CastorUtilsHeightmapBench::Generate8193Parallel()
+	{
+		Heightmap::generate( 13u, 0.5f, 1u, 0u );
+	}
+}
@@ -0,0 +1,44 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsHeightmapTest___
+#define ___CUT_CastorUtilsHeightmapTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/Heightmap.hpp>
+
+namespace Testing
+{
+	class CastorUtilsHeightmapTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsHeightmapTest();
+		virtual ~CastorUtilsHeightmapTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void ThreadsCountIndependent();
+		void SeedDependent();
+		void SaveLoad();
+		void LoadTruncated();
+	};
+
+	class CastorUtilsHeightmapBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsHeightmapBench();
+		virtual ~CastorUtilsHeightmapBench();
+		virtual void Execute();
+
+	private:
+		void Generate4097Serial();
+		void Generate4097Parallel();
+		void Generate8193Serial();
+		void Generate8193Parallel();
+	};
+}
+
+#endif
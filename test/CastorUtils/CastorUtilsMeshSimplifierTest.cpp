@@ -0,0 +1,294 @@
+#include "CastorUtilsMeshSimplifierTest.hpp"
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <tuple>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		void createGrid( uint32_t size
+			, float noise
+			, std::vector< Point3f > & positions
+			, std::vector< uint32_t > & indices )
+		{
+			std::mt19937 engine{ 42u };
+			std::uniform_real_distribution< float > distribution{ -noise, noise };
+
+			for ( uint32_t y = 0u; y <= size; ++y )
+			{
+				for ( uint32_t x = 0u; x <= size; ++x )
+				{
+					positions.push_back( Point3f{ float( x ) / float( size )
+						, noise > 0.0f ? distribution( engine ) : 0.0f
+						, float( y ) / float( size ) } );
+				}
+			}
+
+			for ( uint32_t y = 0u; y < size; ++y )
+			{
+				for ( uint32_t x = 0u; x < size; ++x )
+				{
+					auto a = y * ( size + 1u ) + x;
+					auto b = a + 1u;
+					auto c = a + size + 1u;
+					auto d = c + 1u;
+					indices.insert( indices.end(), { a, c, b, b, c, d } );
+				}
+			}
+		}
+
+		void createSphere( uint32_t subdivisions
+			, std::vector< Point3f > & positions
+			, std::vector< uint32_t > & indices )
+		{
+			// Subdivided octahedron, with the vertices shared between the faces.
+			std::map< std::tuple< long, long, long >, uint32_t > vertices;
+			auto getVertex = [&]( Point3f const & position )
+			{
+				auto key = std::make_tuple( std::lround( position[0] * 100000.0f )
+					, std::lround( position[1] * 100000.0f )
+					, std::lround( position[2] * 100000.0f ) );
+				auto it = vertices.find( key );
+
+				if ( it == vertices.end() )
+				{
+					it = vertices.emplace( key, uint32_t( positions.size() ) ).first;
+					positions.push_back( point::getNormalised( position ) );
+				}
+
+				return it->second;
+			};
+			auto step = 1.0f / float( subdivisions );
+
+			for ( int sx = -1; sx <= 1; sx += 2 )
+			{
+				for ( int sy = -1; sy <= 1; sy += 2 )
+				{
+					for ( int sz = -1; sz <= 1; sz += 2 )
+					{
+						Point3f a{ float( sx ), 0.0f, 0.0f };
+						Point3f b{ 0.0f, float( sy ), 0.0f };
+						Point3f c{ 0.0f, 0.0f, float( sz ) };
+						bool flip = sx * sy * sz < 0;
+						auto getPoint = [&]( uint32_t u, uint32_t v )
+						{
+							auto fu = float( u ) * step;
+							auto fv = float( v ) * step;
+							return getVertex( a * ( 1.0f - fu - fv ) + b * fu + c * fv );
+						};
+						auto addFace = [&]( uint32_t v0, uint32_t v1, uint32_t v2 )
+						{
+							if ( flip )
+							{
+								std::swap( v1, v2 );
+							}
+
+							indices.insert( indices.end(), { v0, v1, v2 } );
+						};
+
+						for ( uint32_t u = 0u; u < subdivisions; ++u )
+						{
+							for ( uint32_t v = 0u; u + v < subdivisions; ++v )
+							{
+								addFace( getPoint( u, v ), getPoint( u + 1u, v ), getPoint( u, v + 1u ) );
+
+								if ( u + v + 1u < subdivisions )
+								{
+									addFace( getPoint( u + 1u, v ), getPoint( u + 1u, v + 1u ), getPoint( u, v + 1u ) );
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		bool isClosedManifold( std::vector< uint32_t > const & indices )
+		{
+			std::map< std::pair< uint32_t, uint32_t >, uint32_t > edges;
+
+			for ( size_t i = 0u; i < indices.size(); i += 3u )
+			{
+				for ( size_t j = 0u; j < 3u; ++j )
+				{
+					auto a = indices[i + j];
+					auto b = indices[i + ( j + 1u ) % 3u];
+					++edges[std::make_pair( std::min( a, b ), std::max( a, b ) )];
+				}
+			}
+
+			for ( auto & edge : edges )
+			{
+				if ( edge.second != 2u )
+				{
+					return false;
+				}
+			}
+
+			return !edges.empty();
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsMeshSimplifierTest::CastorUtilsMeshSimplifierTest()
+		: TestCase( "CastorUtilsMeshSimplifierTest" )
+	{
+	}
+
+	CastorUtilsMeshSimplifierTest::~CastorUtilsMeshSimplifierTest()
+	{
+	}
+
+	void CastorUtilsMeshSimplifierTest::doRegisterTests()
+	{
+		doRegisterTest( "PlanarGrid", std::bind( &CastorUtilsMeshSimplifierTest::PlanarGrid, this ) );
+		doRegisterTest( "ClosedSphere", std::bind( &CastorUtilsMeshSimplifierTest::ClosedSphere, this ) );
+		doRegisterTest( "Progressive", std::bind( &CastorUtilsMeshSimplifierTest::Progressive, this ) );
+		doRegisterTest( "LockedSeams", std::bind( &CastorUtilsMeshSimplifierTest::LockedSeams, this ) );
+	}
+
+	void CastorUtilsMeshSimplifierTest::PlanarGrid()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createGrid( 32u, 0.0f, positions, indices );
+		MeshSimplifier simplifier{ positions, indices };
+		// A plane with straight borders collapses without error, down to a few triangles.
+		auto count = simplifier.simplify( 0u, 0.0001f );
+		CT_CHECK( count < 32u * 3u );
+		CT_CHECK( simplifier.getError() <= 0.0001f );
+
+		// The corners must remain.
+		auto result = simplifier.getIndices();
+		CT_EQUAL( uint32_t( result.size() ), count );
+
+		for ( auto corner : { 0u, 32u, 33u * 32u, 33u * 33u - 1u } )
+		{
+			CT_CHECK( std::find( result.begin(), result.end(), corner ) != result.end() );
+		}
+	}
+
+	void CastorUtilsMeshSimplifierTest::ClosedSphere()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createSphere( 16u, positions, indices );
+		CT_CHECK( isClosedManifold( indices ) );
+		MeshSimplifier simplifier{ positions, indices };
+		auto target = uint32_t( indices.size() / 4u );
+		auto count = simplifier.simplify( target );
+		CT_CHECK( count <= target );
+		CT_CHECK( simplifier.getError() > 0.0f );
+		CT_CHECK( simplifier.getError() < 0.1f );
+		CT_CHECK( isClosedManifold( simplifier.getIndices() ) );
+	}
+
+	void CastorUtilsMeshSimplifierTest::Progressive()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createGrid( 64u, 0.02f, positions, indices );
+		MeshSimplifier simplifier{ positions, indices };
+		auto previousCount = uint32_t( indices.size() );
+		auto previousError = 0.0f;
+
+		for ( auto ratio : { 2u, 4u, 8u, 16u } )
+		{
+			auto count = simplifier.simplify( uint32_t( indices.size() ) / ratio );
+			CT_CHECK( count < previousCount );
+			CT_CHECK( simplifier.getError() >= previousError );
+			previousCount = count;
+			previousError = simplifier.getError();
+		}
+
+		// The error bound stops the simplification.
+		auto count = simplifier.simplify( 0u, previousError );
+		CT_CHECK( count > 0u );
+		CT_CHECK( simplifier.getError() <= previousError );
+	}
+
+	void CastorUtilsMeshSimplifierTest::LockedSeams()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createGrid( 16u, 0.0f, positions, indices );
+		// Split the middle column, as a texture coordinates seam would.
+		auto column = 8u;
+		std::vector< uint32_t > seam;
+		std::vector< uint32_t > duplicates( positions.size(), 0u );
+
+		for ( uint32_t y = 0u; y <= 16u; ++y )
+		{
+			auto vertex = y * 17u + column;
+			duplicates[vertex] = uint32_t( positions.size() );
+			positions.push_back( positions[vertex] );
+			seam.push_back( vertex );
+			seam.push_back( duplicates[vertex] );
+		}
+
+		for ( size_t i = 0u; i < indices.size(); i += 3u )
+		{
+			auto onRight = indices[i + 0u] % 17u >= column
+				&& indices[i + 1u] % 17u >= column
+				&& indices[i + 2u] % 17u >= column;
+
+			for ( size_t j = 0u; onRight && j < 3u; ++j )
+			{
+				if ( indices[i + j] % 17u == column )
+				{
+					indices[i + j] = duplicates[indices[i + j]];
+				}
+			}
+		}
+
+		MeshSimplifier simplifier{ positions, indices };
+		simplifier.simplify( 0u );
+		auto result = simplifier.getIndices();
+
+		for ( auto vertex : seam )
+		{
+			CT_CHECK( std::find( result.begin(), result.end(), vertex ) != result.end() );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsMeshSimplifierBench::CastorUtilsMeshSimplifierBench()
+		: BenchCase( "CastorUtilsMeshSimplifierBench" )
+	{
+		createGrid( 512u, 0.01f, m_terrainPositions, m_terrainIndices );
+		createSphere( 128u, m_spherePositions, m_sphereIndices );
+	}
+
+	CastorUtilsMeshSimplifierBench::~CastorUtilsMeshSimplifierBench()
+	{
+	}
+
+	void CastorUtilsMeshSimplifierBench::Execute()
+	{
+		BENCHMARK( SimplifyTerrain, 5u );
+		std::cout << "*	Terrain ( " << m_terrainIndices.size() / 3u << " triangles, to 10% ) error: " << m_terrainError << std::endl;
+		BENCHMARK( SimplifySphere, 5u );
+		std::cout << "*	Sphere ( " << m_sphereIndices.size() / 3u << " triangles, to 10% ) error: " << m_sphereError << std::endl;
+	}
+
+	void CastorUtilsMeshSimplifierBench::SimplifyTerrain()
+	{
+		MeshSimplifier simplifier{ m_terrainPositions, m_terrainIndices };
+		doNotOptimizeAway( simplifier.simplify( uint32_t( m_terrainIndices.size() / 10u ) ) );
+		m_terrainError = simplifier.getError();
+	}
+
+	void CastorUtilsMeshSimplifierBench::SimplifySphere()
+	{
+		MeshSimplifier simplifier{ m_spherePositions, m_sphereIndices };
+		doNotOptimizeAway( simplifier.simplify( uint32_t( m_sphereIndices.size() / 10u ) ) );
+		m_sphereError = simplifier.getError();
+	}
+}
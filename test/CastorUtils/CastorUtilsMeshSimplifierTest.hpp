@@ -0,0 +1,50 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsMeshSimplifierTest___
+#define ___CUT_CastorUtilsMeshSimplifierTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/MeshSimplifier.hpp>
+
+namespace Testing
+{
+	class CastorUtilsMeshSimplifierTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsMeshSimplifierTest();
+		virtual ~CastorUtilsMeshSimplifierTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void PlanarGrid();
+		void ClosedSphere();
+		void Progressive();
+		void LockedSeams();
+	};
+
+	class CastorUtilsMeshSimplifierBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsMeshSimplifierBench();
+		virtual ~CastorUtilsMeshSimplifierBench();
+		virtual void Execute();
+
+	private:
+		void SimplifyTerrain();
+		void SimplifySphere();
+
+	private:
+		std::vector< castor::Point3f > m_terrainPositions;
+		std::vector< uint32_t > m_terrainIndices;
+		std::vector< castor::Point3f > m_spherePositions;
+		std::vector< uint32_t > m_sphereIndices;
+		float m_terrainError{ 0.0f };
+		float m_sphereError{ 0.0f };
+	};
+}
+
+#endif
@@ -0,0 +1,375 @@
+#include "CastorUtilsMeshletTest.hpp"
+
+#include <CastorUtils/Math/MathModule.hpp>
+
+#include <cmath>
+#include <random>
+#include <set>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		void createGrid( uint32_t size
+			, float noise
+			, std::vector< Point3f > & positions
+			, std::vector< uint32_t > & indices )
+		{
+			std::mt19937 engine{ 42u };
+			std::uniform_real_distribution< float > distribution{ -noise, noise };
+
+			for ( uint32_t y = 0u; y <= size; ++y )
+			{
+				for ( uint32_t x = 0u; x <= size; ++x )
+				{
+					positions.push_back( Point3f{ float( x ) / float( size )
+						, noise > 0.0f ? distribution( engine ) : 0.0f
+						, float( y ) / float( size ) } );
+				}
+			}
+
+			for ( uint32_t y = 0u; y < size; ++y )
+			{
+				for ( uint32_t x = 0u; x < size; ++x )
+				{
+					auto a = y * ( size + 1u ) + x;
+					auto b = a + 1u;
+					auto c = a + size + 1u;
+					auto d = c + 1u;
+					indices.insert( indices.end(), { a, c, b, b, c, d } );
+				}
+			}
+		}
+
+		void createSphere( uint32_t meridians
+			, uint32_t parallels
+			, std::vector< Point3f > & positions
+			, std::vector< uint32_t > & indices )
+		{
+			// UV sphere, counter clockwise seen from the outside.
+			for ( uint32_t p = 0u; p <= parallels; ++p )
+			{
+				auto theta = Pi< float > * float( p ) / float( parallels );
+
+				for ( uint32_t m = 0u; m <= meridians; ++m )
+				{
+					auto phi = 2.0f * Pi< float > * float( m ) / float( meridians );
+					positions.push_back( Point3f{ std::sin( theta ) * std::cos( phi )
+						, std::cos( theta )
+						, -std::sin( theta ) * std::sin( phi ) } );
+				}
+			}
+
+			for ( uint32_t p = 0u; p < parallels; ++p )
+			{
+				for ( uint32_t m = 0u; m < meridians; ++m )
+				{
+					auto a = p * ( meridians + 1u ) + m;
+					auto b = a + 1u;
+					auto c = a + meridians + 1u;
+					auto d = c + 1u;
+					indices.insert( indices.end(), { a, c, d, a, d, b } );
+				}
+			}
+		}
+
+		std::array< PlaneEquation, 6u > getBox( Point3f const & min
+			, Point3f const & max )
+		{
+			return
+			{
+				PlaneEquation{ Point3f{ 1.0f, 0.0f, 0.0f }, min },
+				PlaneEquation{ Point3f{ -1.0f, 0.0f, 0.0f }, max },
+				PlaneEquation{ Point3f{ 0.0f, 1.0f, 0.0f }, min },
+				PlaneEquation{ Point3f{ 0.0f, -1.0f, 0.0f }, max },
+				PlaneEquation{ Point3f{ 0.0f, 0.0f, 1.0f }, min },
+				PlaneEquation{ Point3f{ 0.0f, 0.0f, -1.0f }, max },
+			};
+		}
+
+		Point3f getNormal( std::vector< Point3f > const & positions
+			, uint32_t const * triangle )
+		{
+			auto & a = positions[triangle[0]];
+			return point::cross( positions[triangle[1]] - a
+				, positions[triangle[2]] - a );
+		}
+
+		bool isCovered( MeshletRangeArray const & ranges
+			, uint32_t index )
+		{
+			return std::any_of( ranges.begin()
+				, ranges.end()
+				, [index]( MeshletRange const & range )
+				{
+					return index >= range.firstIndex
+						&& index < range.firstIndex + range.indexCount;
+				} );
+		}
+
+		std::multiset< std::array< uint32_t, 3u > > getTriangles( std::vector< uint32_t > const & indices )
+		{
+			std::multiset< std::array< uint32_t, 3u > > result;
+
+			for ( size_t i = 0u; i < indices.size(); i += 3u )
+			{
+				result.insert( { indices[i], indices[i + 1u], indices[i + 2u] } );
+			}
+
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsMeshletTest::CastorUtilsMeshletTest()
+		: TestCase( "CastorUtilsMeshletTest" )
+	{
+	}
+
+	CastorUtilsMeshletTest::~CastorUtilsMeshletTest()
+	{
+	}
+
+	void CastorUtilsMeshletTest::doRegisterTests()
+	{
+		doRegisterTest( "Limits", std::bind( &CastorUtilsMeshletTest::Limits, this ) );
+		doRegisterTest( "Bounds", std::bind( &CastorUtilsMeshletTest::Bounds, this ) );
+		doRegisterTest( "FrustumCulling", std::bind( &CastorUtilsMeshletTest::FrustumCulling, this ) );
+		doRegisterTest( "BackFaceCulling", std::bind( &CastorUtilsMeshletTest::BackFaceCulling, this ) );
+		doRegisterTest( "ParallelCulling", std::bind( &CastorUtilsMeshletTest::ParallelCulling, this ) );
+	}
+
+	void CastorUtilsMeshletTest::Limits()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createGrid( 64u, 0.01f, positions, indices );
+		auto source = indices;
+		auto meshlets = meshlet::build( positions, indices );
+		CT_CHECK( !meshlets.empty() );
+		CT_CHECK( getTriangles( source ) == getTriangles( indices ) );
+		uint32_t firstIndex = 0u;
+
+		for ( auto & meshlet : meshlets )
+		{
+			CT_EQUAL( meshlet.firstIndex, firstIndex );
+			CT_CHECK( meshlet.indexCount <= meshlet::MaxTriangles * 3u );
+			std::set< uint32_t > vertices{ indices.begin() + meshlet.firstIndex
+				, indices.begin() + meshlet.firstIndex + meshlet.indexCount };
+			CT_CHECK( vertices.size() <= meshlet::MaxVertices );
+			firstIndex += meshlet.indexCount;
+		}
+
+		CT_EQUAL( firstIndex, uint32_t( indices.size() ) );
+		// The clustering must fill the meshlets, on a regular grid.
+		CT_CHECK( meshlets.size() < 2u * indices.size() / ( 3u * meshlet::MaxTriangles ) );
+	}
+
+	void CastorUtilsMeshletTest::Bounds()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createSphere( 48u, 24u, positions, indices );
+		auto meshlets = meshlet::build( positions, indices );
+		uint32_t cones = 0u;
+
+		for ( auto & meshlet : meshlets )
+		{
+			auto begin = indices.data() + meshlet.firstIndex;
+			auto end = begin + meshlet.indexCount;
+
+			for ( auto it = begin; it != end; ++it )
+			{
+				CT_CHECK( point::distance( positions[*it], meshlet.center ) <= meshlet.radius + 0.0001f );
+			}
+
+			if ( meshlet.coneCutoff < 1.0f )
+			{
+				++cones;
+				auto minDot = std::sqrt( 1.0f - meshlet.coneCutoff * meshlet.coneCutoff );
+
+				for ( auto it = begin; it != end; it += 3 )
+				{
+					auto normal = getNormal( positions, it );
+
+					if ( point::length( normal ) > 0.000001f )
+					{
+						CT_CHECK( point::dot( point::getNormalised( normal ), meshlet.coneAxis ) >= minDot - 0.0001f );
+					}
+				}
+			}
+		}
+
+		// Small patches of a sphere have usable cones.
+		CT_CHECK( cones > meshlets.size() / 2u );
+	}
+
+	void CastorUtilsMeshletTest::FrustumCulling()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createGrid( 64u, 0.0f, positions, indices );
+		auto meshlets = meshlet::build( positions, indices );
+		MeshletRangeArray ranges;
+		Matrix4x4f identity{ 1.0f };
+		auto visible = meshlet::cull( meshlets
+			, getBox( Point3f{ 0.5f, -1.0f, -1.0f }, Point3f{ 2.0f, 1.0f, 2.0f } )
+			, identity
+			, Point3f{ 1.0f, 1.0f, 1.0f }
+			, Point3f{ 0.0f, 10.0f, 0.0f }
+			, true
+			, ranges );
+		CT_CHECK( visible < uint32_t( indices.size() ) );
+		CT_CHECK( visible >= uint32_t( indices.size() / 2u ) );
+		uint32_t covered = 0u;
+
+		for ( auto & range : ranges )
+		{
+			covered += range.indexCount;
+		}
+
+		CT_EQUAL( covered, visible );
+
+		for ( uint32_t i = 0u; i < indices.size(); i += 3u )
+		{
+			if ( positions[indices[i]][0] >= 0.5f
+				|| positions[indices[i + 1u]][0] >= 0.5f
+				|| positions[indices[i + 2u]][0] >= 0.5f )
+			{
+				CT_CHECK( isCovered( ranges, i ) );
+			}
+		}
+
+		// Everything is rejected when the frustum doesn't intersect the grid.
+		visible = meshlet::cull( meshlets
+			, getBox( Point3f{ 2.0f, -1.0f, -1.0f }, Point3f{ 3.0f, 1.0f, 2.0f } )
+			, identity
+			, Point3f{ 1.0f, 1.0f, 1.0f }
+			, Point3f{ 0.0f, 10.0f, 0.0f }
+			, true
+			, ranges );
+		CT_EQUAL( visible, 0u );
+		CT_CHECK( ranges.empty() );
+	}
+
+	void CastorUtilsMeshletTest::BackFaceCulling()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createSphere( 64u, 32u, positions, indices );
+		auto meshlets = meshlet::build( positions, indices );
+		MeshletRangeArray ranges;
+		Point3f camera{ 0.0f, 0.0f, 5.0f };
+		auto box = getBox( Point3f{ -10.0f, -10.0f, -10.0f }, Point3f{ 10.0f, 10.0f, 10.0f } );
+		auto visible = meshlet::cull( meshlets
+			, box
+			, Matrix4x4f{ 1.0f }
+			, Point3f{ 1.0f, 1.0f, 1.0f }
+			, camera
+			, true
+			, ranges );
+		// The far side of the sphere is mostly rejected.
+		CT_CHECK( visible < uint32_t( indices.size() * 7u / 10u ) );
+
+		// No front facing triangle may be rejected, the degenerate ones at the poles are ignored.
+		for ( uint32_t i = 0u; i < indices.size(); i += 3u )
+		{
+			auto normal = getNormal( positions, indices.data() + i );
+
+			if ( point::length( normal ) > 0.000001f
+				&& point::dot( positions[indices[i]] - camera, normal ) < 0.0f )
+			{
+				CT_CHECK( isCovered( ranges, i ) );
+			}
+		}
+
+		// Without back faces culling, the sphere is fully visible.
+		visible = meshlet::cull( meshlets
+			, box
+			, Matrix4x4f{ 1.0f }
+			, Point3f{ 1.0f, 1.0f, 1.0f }
+			, camera
+			, false
+			, ranges );
+		CT_EQUAL( visible, uint32_t( indices.size() ) );
+		CT_EQUAL( ranges.size(), 1u );
+	}
+
+	void CastorUtilsMeshletTest::ParallelCulling()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createGrid( 256u, 0.01f, positions, indices );
+		auto meshlets = meshlet::build( positions, indices );
+		CT_CHECK( meshlets.size() >= 1024u );
+		auto box = getBox( Point3f{ 0.25f, -1.0f, 0.1f }, Point3f{ 0.6f, 1.0f, 0.9f } );
+		MeshletRangeArray sequential;
+		MeshletRangeArray parallel;
+		auto sequentialCount = meshlet::cull( meshlets, box, Matrix4x4f{ 1.0f }, Point3f{ 1.0f, 1.0f, 1.0f }, Point3f{ 0.5f, 2.0f, 0.5f }, true, sequential, 1u );
+		auto parallelCount = meshlet::cull( meshlets, box, Matrix4x4f{ 1.0f }, Point3f{ 1.0f, 1.0f, 1.0f }, Point3f{ 0.5f, 2.0f, 0.5f }, true, parallel, 4u );
+		CT_EQUAL( sequentialCount, parallelCount );
+		CT_EQUAL( sequential.size(), parallel.size() );
+
+		for ( size_t i = 0u; i < std::min( sequential.size(), parallel.size() ); ++i )
+		{
+			CT_EQUAL( sequential[i].firstIndex, parallel[i].firstIndex );
+			CT_EQUAL( sequential[i].indexCount, parallel[i].indexCount );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsMeshletBench::CastorUtilsMeshletBench()
+		: BenchCase( "CastorUtilsMeshletBench" )
+	{
+		createGrid( 512u, 0.01f, m_terrainPositions, m_terrainIndices );
+		createSphere( 512u, 256u, m_spherePositions, m_sphereIndices );
+		m_terrainMeshlets = meshlet::build( m_terrainPositions, m_terrainIndices );
+		m_sphereMeshlets = meshlet::build( m_spherePositions, m_sphereIndices );
+	}
+
+	CastorUtilsMeshletBench::~CastorUtilsMeshletBench()
+	{
+	}
+
+	void CastorUtilsMeshletBench::Execute()
+	{
+		BENCHMARK( BuildTerrain, 5u );
+		std::cout << "*	Terrain ( " << m_terrainIndices.size() / 3u << " triangles ): " << m_terrainMeshlets.size() << " meshlets" << std::endl;
+		BENCHMARK( CullTerrain, 100u );
+		std::cout << "*	Terrain, quarter in frustum, rejected triangles: " << 100.0f * ( 1.0f - float( m_terrainVisible ) / float( m_terrainIndices.size() ) ) << "%" << std::endl;
+		BENCHMARK( CullSphere, 100u );
+		std::cout << "*	Sphere ( " << m_sphereMeshlets.size() << " meshlets ), back faces, rejected triangles: " << 100.0f * ( 1.0f - float( m_sphereVisible ) / float( m_sphereIndices.size() ) ) << "%" << std::endl;
+	}
+
+	void CastorUtilsMeshletBench::BuildTerrain()
+	{
+		auto indices = m_terrainIndices;
+		doNotOptimizeAway( meshlet::build( m_terrainPositions, indices ) );
+	}
+
+	void CastorUtilsMeshletBench::CullTerrain()
+	{
+		m_terrainVisible = meshlet::cull( m_terrainMeshlets
+			, getBox( Point3f{ 0.0f, -1.0f, 0.0f }, Point3f{ 0.5f, 1.0f, 0.5f } )
+			, Matrix4x4f{ 1.0f }
+			, Point3f{ 1.0f, 1.0f, 1.0f }
+			, Point3f{ 0.25f, 2.0f, 0.25f }
+			, true
+			, m_ranges );
+	}
+
+	void CastorUtilsMeshletBench::CullSphere()
+	{
+		m_sphereVisible = meshlet::cull( m_sphereMeshlets
+			, getBox( Point3f{ -10.0f, -10.0f, -10.0f }, Point3f{ 10.0f, 10.0f, 10.0f } )
+			, Matrix4x4f{ 1.0f }
+			, Point3f{ 1.0f, 1.0f, 1.0f }
+			, Point3f{ 0.0f, 0.0f, 5.0f }
+			, true
+			, m_ranges );
+	}
+}
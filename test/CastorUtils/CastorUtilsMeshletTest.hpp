@@ -0,0 +1,55 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsMeshletTest___
+#define ___CUT_CastorUtilsMeshletTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/Meshlet.hpp>
+
+namespace Testing
+{
+	class CastorUtilsMeshletTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsMeshletTest();
+		virtual ~CastorUtilsMeshletTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Limits();
+		void Bounds();
+		void FrustumCulling();
+		void BackFaceCulling();
+		void ParallelCulling();
+	};
+
+	class CastorUtilsMeshletBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsMeshletBench();
+		virtual ~CastorUtilsMeshletBench();
+		virtual void Execute();
+
+	private:
+		void BuildTerrain();
+		void CullTerrain();
+		void CullSphere();
+
+	private:
+		std::vector< castor::Point3f > m_terrainPositions;
+		std::vector< uint32_t > m_terrainIndices;
+		castor::MeshletArray m_terrainMeshlets;
+		std::vector< castor::Point3f > m_spherePositions;
+		std::vector< uint32_t > m_sphereIndices;
+		castor::MeshletArray m_sphereMeshlets;
+		castor::MeshletRangeArray m_ranges;
+		uint32_t m_terrainVisible{ 0u };
+		uint32_t m_sphereVisible{ 0u };
+	};
+}
+
+#endif
@@ -0,0 +1,214 @@
+#include "CastorUtilsMipmapGenerationTest.hpp"
+
+#include <CastorUtils/Data/File.hpp>
+#include <CastorUtils/Graphics/PixelBufferBase.hpp>
+#include <CastorUtils/Graphics/PixelBufferCache.hpp>
+#include <CastorUtils/Log/Logger.hpp>
+
+#include <cstring>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		PxBufferBaseSPtr createCheckerboard( uint32_t width
+			, uint32_t height
+			, uint32_t levels
+			, PixelFormat format )
+		{
+			auto result = PxBufferBase::create( Size{ width, height }
+				, 1u
+				, levels
+				, format );
+			auto components = uint32_t( PF::getComponentsCount( format ) );
+			auto data = result->getPtr();
+
+			for ( uint32_t y = 0u; y < height; ++y )
+			{
+				for ( uint32_t x = 0u; x < width; ++x )
+				{
+					for ( uint32_t c = 0u; c < components; ++c )
+					{
+						*data++ = ( ( x + y ) % 2u ) ? 255u : 0u;
+					}
+				}
+			}
+
+			return result;
+		}
+	}
+
+	CastorUtilsMipmapGenerationTest::CastorUtilsMipmapGenerationTest()
+		: TestCase( "CastorUtilsMipmapGenerationTest" )
+	{
+	}
+
+	CastorUtilsMipmapGenerationTest::~CastorUtilsMipmapGenerationTest()
+	{
+	}
+
+	void CastorUtilsMipmapGenerationTest::doRegisterTests()
+	{
+		doRegisterTest( "UnsupportedFormat", std::bind( &CastorUtilsMipmapGenerationTest::UnsupportedFormat, this ) );
+		doRegisterTest( "LinearBox", std::bind( &CastorUtilsMipmapGenerationTest::LinearBox, this ) );
+		doRegisterTest( "GammaCorrectBox", std::bind( &CastorUtilsMipmapGenerationTest::GammaCorrectBox, this ) );
+		doRegisterTest( "FloatBox", std::bind( &CastorUtilsMipmapGenerationTest::FloatBox, this ) );
+		doRegisterTest( "NonPowerOfTwo", std::bind( &CastorUtilsMipmapGenerationTest::NonPowerOfTwo, this ) );
+		doRegisterTest( "MultiThreaded", std::bind( &CastorUtilsMipmapGenerationTest::MultiThreaded, this ) );
+		doRegisterTest( "CacheRoundTrip", std::bind( &CastorUtilsMipmapGenerationTest::CacheRoundTrip, this ) );
+		doRegisterTest( "CacheEviction", std::bind( &CastorUtilsMipmapGenerationTest::CacheEviction, this ) );
+	}
+
+	void CastorUtilsMipmapGenerationTest::UnsupportedFormat()
+	{
+		CT_CHECK( !PF::isMipmapGenerationSupported( PixelFormat::eBC1_RGB_UNORM_BLOCK ) );
+		CT_CHECK( PF::isMipmapGenerationSupported( PixelFormat::eR8G8B8A8_UNORM ) );
+		auto buffer = PxBufferBase::create( Size{ 8u, 8u }
+			, 1u
+			, 4u
+			, PixelFormat::eR16G16B16A16_SFLOAT );
+		CT_CHECK( !PF::generateMipmaps( *buffer ) );
+	}
+
+	void CastorUtilsMipmapGenerationTest::LinearBox()
+	{
+		auto buffer = createCheckerboard( 4u, 4u, 3u, PixelFormat::eR8G8B8A8_UNORM );
+		CT_REQUIRE( PF::generateMipmaps( *buffer ) );
+		auto data = buffer->getConstPtr();
+		auto level1 = data + 4u * 4u * 4u;
+		auto level2 = level1 + 2u * 2u * 4u;
+
+		for ( uint32_t i = 0u; i < 2u * 2u * 4u; ++i )
+		{
+			CT_EQUAL( uint32_t( level1[i] ), 128u );
+		}
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			CT_EQUAL( uint32_t( level2[i] ), 128u );
+		}
+	}
+
+	void CastorUtilsMipmapGenerationTest::GammaCorrectBox()
+	{
+		auto buffer = createCheckerboard( 2u, 2u, 2u, PixelFormat::eR8G8B8A8_SRGB );
+		CT_REQUIRE( PF::generateMipmaps( *buffer ) );
+		auto level1 = buffer->getConstPtr() + 2u * 2u * 4u;
+		// Colour is averaged in linear space, alpha isn't.
+		CT_EQUAL( uint32_t( level1[0] ), 188u );
+		CT_EQUAL( uint32_t( level1[1] ), 188u );
+		CT_EQUAL( uint32_t( level1[2] ), 188u );
+		CT_EQUAL( uint32_t( level1[3] ), 128u );
+
+		buffer = createCheckerboard( 2u, 2u, 2u, PixelFormat::eR8G8B8A8_UNORM );
+		CT_REQUIRE( PF::generateMipmaps( *buffer, { true, 1u } ) );
+		level1 = buffer->getConstPtr() + 2u * 2u * 4u;
+		CT_EQUAL( uint32_t( level1[0] ), 188u );
+		CT_EQUAL( uint32_t( level1[3] ), 128u );
+	}
+
+	void CastorUtilsMipmapGenerationTest::FloatBox()
+	{
+		auto buffer = PxBufferBase::create( Size{ 2u, 2u }
+			, 1u
+			, 2u
+			, PixelFormat::eR32_SFLOAT );
+		auto data = reinterpret_cast< float * >( buffer->getPtr() );
+		data[0] = 1.0f;
+		data[1] = 2.0f;
+		data[2] = 3.0f;
+		data[3] = 10.0f;
+		CT_REQUIRE( PF::generateMipmaps( *buffer, { true, 1u } ) );
+		CT_EQUAL( data[4], 4.0f );
+	}
+
+	void CastorUtilsMipmapGenerationTest::NonPowerOfTwo()
+	{
+		auto buffer = PxBufferBase::create( Size{ 3u, 1u }
+			, 1u
+			, 2u
+			, PixelFormat::eR8_UNORM );
+		auto data = buffer->getPtr();
+		data[0] = 0u;
+		data[1] = 100u;
+		data[2] = 200u;
+		CT_REQUIRE( PF::generateMipmaps( *buffer ) );
+		// Level 1 is 1x1, built from the clamped top-left 2x2 footprint.
+		CT_EQUAL( uint32_t( data[3] ), 50u );
+	}
+
+	void CastorUtilsMipmapGenerationTest::MultiThreaded()
+	{
+		auto single = createCheckerboard( 256u, 256u, 9u, PixelFormat::eR8G8B8A8_SRGB );
+		auto multi = createCheckerboard( 256u, 256u, 9u, PixelFormat::eR8G8B8A8_SRGB );
+		CT_REQUIRE( PF::generateMipmaps( *single, { false, 1u } ) );
+		CT_REQUIRE( PF::generateMipmaps( *multi, { false, 4u } ) );
+		CT_EQUAL( single->getSize(), multi->getSize() );
+		CT_CHECK( std::memcmp( single->getConstPtr(), multi->getConstPtr(), single->getSize() ) == 0 );
+	}
+
+	void CastorUtilsMipmapGenerationTest::CacheRoundTrip()
+	{
+		PxBufferCache cache{ *Logger::getSingleton().getInstance()
+			, File::getExecutableDirectory() / cuT( "MipmapGenerationTestCache" ) };
+		auto buffer = createCheckerboard( 16u, 16u, 5u, PixelFormat::eR8G8B8A8_UNORM );
+		CT_REQUIRE( PF::generateMipmaps( *buffer ) );
+		CT_CHECK( cache.load( 42u ) == nullptr );
+		CT_REQUIRE( cache.save( 42u, *buffer ) );
+		auto loaded = cache.load( 42u );
+		CT_REQUIRE( loaded != nullptr );
+		CT_CHECK( loaded->getFormat() == buffer->getFormat() );
+		CT_EQUAL( loaded->getWidth(), buffer->getWidth() );
+		CT_EQUAL( loaded->getHeight(), buffer->getHeight() );
+		CT_EQUAL( loaded->getLevels(), buffer->getLevels() );
+		CT_EQUAL( loaded->getSize(), buffer->getSize() );
+		CT_CHECK( std::memcmp( loaded->getConstPtr(), buffer->getConstPtr(), buffer->getSize() ) == 0 );
+		cache.clear();
+		CT_CHECK( cache.load( 42u ) == nullptr );
+		File::directoryDelete( cache.getDirectory() );
+	}
+
+	void CastorUtilsMipmapGenerationTest::CacheEviction()
+	{
+		auto buffer = createCheckerboard( 16u, 16u, 5u, PixelFormat::eR8G8B8A8_UNORM );
+		CT_REQUIRE( PF::generateMipmaps( *buffer ) );
+		auto directory = File::getExecutableDirectory() / cuT( "MipmapGenerationTestEviction" );
+		uint64_t entrySize{};
+		{
+			PxBufferCache cache{ *Logger::getSingleton().getInstance(), directory };
+			cache.clear();
+			CT_REQUIRE( cache.save( 1u, *buffer ) );
+			entrySize = cache.getSize();
+		}
+		// Room for two entries.
+		PxBufferCache cache{ *Logger::getSingleton().getInstance()
+			, directory
+			, 2u * entrySize + entrySize / 2u };
+		// The entry saved by the previous session is listed.
+		CT_EQUAL( cache.getSize(), entrySize );
+		CT_REQUIRE( cache.save( 2u, *buffer ) );
+		CT_CHECK( cache.load( 1u ) != nullptr );
+		CT_REQUIRE( cache.save( 3u, *buffer ) );
+		// The least recently used entry is evicted.
+		CT_EQUAL( cache.getSize(), 2u * entrySize );
+		CT_CHECK( cache.load( 2u ) == nullptr );
+		CT_CHECK( cache.load( 1u ) != nullptr );
+		CT_CHECK( cache.load( 3u ) != nullptr );
+		// No temporary file is left behind.
+		auto others = File::filterDirectoryFiles( directory
+			, []( Path const & folder, String const & name )
+			{
+				return Path{ name }.getExtension() != cuT( "cpx" );
+			} );
+		CT_CHECK( others.empty() );
+		// An entry larger than the cache isn't saved.
+		PxBufferCache small{ *Logger::getSingleton().getInstance()
+			, directory
+			, entrySize / 2u };
+		CT_CHECK( !small.save( 4u, *buffer ) );
+		cache.clear();
+		File::directoryDelete( directory );
+	}
+}
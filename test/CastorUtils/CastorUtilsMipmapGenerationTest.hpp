@@ -0,0 +1,33 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsMipmapGenerationTest___
+#define ___CUT_CastorUtilsMipmapGenerationTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/MipmapGeneration.hpp>
+
+namespace Testing
+{
+	class CastorUtilsMipmapGenerationTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsMipmapGenerationTest();
+		virtual ~CastorUtilsMipmapGenerationTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void UnsupportedFormat();
+		void LinearBox();
+		void GammaCorrectBox();
+		void FloatBox();
+		void NonPowerOfTwo();
+		void MultiThreaded();
+		void CacheRoundTrip();
+		void CacheEviction();
+	};
+}
+
+#endif
@@ -0,0 +1,414 @@
+#include "CastorUtilsOcclusionBufferTest.hpp"
+
+#include <CastorUtils/Math/Angle.hpp>
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+#include <random>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		// 90 degrees, square, looking down -Z from the origin: at a distance d, the view spans [-d, d] on X and Y.
+		Matrix4x4f getViewProjection( Point3f const & eye = Point3f{ 0.0f, 0.0f, 0.0f }
+			, Point3f const & center = Point3f{ 0.0f, 0.0f, -1.0f } )
+		{
+			Matrix4x4f projection;
+			matrix::perspective( projection, 90.0_degrees, 1.0f, 0.1f, 1000.0f );
+			return projection * matrix::lookAt( eye, center, Point3f{ 0.0f, 1.0f, 0.0f } );
+		}
+
+		Matrix4x4f getTransform( Point3f const & min
+			, Point3f const & max )
+		{
+			Matrix4x4f result{ 1.0f };
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				result[i][i] = max[i] - min[i];
+				result[3][i] = min[i];
+			}
+
+			return result;
+		}
+
+		void createBox( Point3f const & min
+			, Point3f const & max
+			, std::vector< Point3f > & positions
+			, std::vector< uint32_t > & indices )
+		{
+			auto base = uint32_t( positions.size() );
+
+			for ( uint32_t corner = 0u; corner < 8u; ++corner )
+			{
+				positions.push_back( Point3f{ ( corner & 1u ) ? max[0] : min[0]
+					, ( corner & 2u ) ? max[1] : min[1]
+					, ( corner & 4u ) ? max[2] : min[2] } );
+			}
+
+			for ( uint32_t index : { 0u, 2u, 1u, 1u, 2u, 3u
+				, 4u, 5u, 6u, 5u, 7u, 6u
+				, 0u, 1u, 4u, 1u, 5u, 4u
+				, 2u, 6u, 3u, 3u, 6u, 7u
+				, 0u, 4u, 2u, 2u, 4u, 6u
+				, 1u, 3u, 5u, 3u, 7u, 5u } )
+			{
+				indices.push_back( base + index );
+			}
+		}
+
+		void createGrid( uint32_t size
+			, Point3f const & min
+			, Point3f const & max
+			, std::vector< Point3f > & positions
+			, std::vector< uint32_t > & indices )
+		{
+			for ( uint32_t y = 0u; y <= size; ++y )
+			{
+				for ( uint32_t x = 0u; x <= size; ++x )
+				{
+					positions.push_back( Point3f{ min[0] + ( max[0] - min[0] ) * float( x ) / float( size )
+						, min[1] + ( max[1] - min[1] ) * float( y ) / float( size )
+						, min[2] + ( max[2] - min[2] ) * float( x + y ) / float( 2u * size ) } );
+				}
+			}
+
+			for ( uint32_t y = 0u; y < size; ++y )
+			{
+				for ( uint32_t x = 0u; x < size; ++x )
+				{
+					auto a = y * ( size + 1u ) + x;
+					auto b = a + 1u;
+					auto c = a + size + 1u;
+					auto d = c + 1u;
+					indices.insert( indices.end(), { a, b, c, b, d, c } );
+				}
+			}
+		}
+
+		bool isVisible( OcclusionBuffer const & buffer
+			, Point3f const & min
+			, Point3f const & max )
+		{
+			return buffer.isVisible( BoundingBox{ min, max }, Matrix4x4f{ 1.0f } );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsOcclusionBufferTest::CastorUtilsOcclusionBufferTest()
+		: TestCase( "CastorUtilsOcclusionBufferTest" )
+	{
+	}
+
+	CastorUtilsOcclusionBufferTest::~CastorUtilsOcclusionBufferTest()
+	{
+	}
+
+	void CastorUtilsOcclusionBufferTest::doRegisterTests()
+	{
+		doRegisterTest( "Empty", std::bind( &CastorUtilsOcclusionBufferTest::Empty, this ) );
+		doRegisterTest( "Hierarchy", std::bind( &CastorUtilsOcclusionBufferTest::Hierarchy, this ) );
+		doRegisterTest( "FullOcclusion", std::bind( &CastorUtilsOcclusionBufferTest::FullOcclusion, this ) );
+		doRegisterTest( "PartialOcclusion", std::bind( &CastorUtilsOcclusionBufferTest::PartialOcclusion, this ) );
+		doRegisterTest( "Conservative", std::bind( &CastorUtilsOcclusionBufferTest::Conservative, this ) );
+		doRegisterTest( "ParallelRasterisation", std::bind( &CastorUtilsOcclusionBufferTest::ParallelRasterisation, this ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::Empty()
+	{
+		OcclusionBuffer buffer{ 128u, 64u };
+		CT_EQUAL( buffer.getLevelsCount(), 8u );
+		buffer.clear( getViewProjection() );
+		buffer.rasterise();
+		CT_EQUAL( buffer.getTrianglesCount(), 0u );
+		CT_EQUAL( buffer.getDepth( 0u, 0u ), OcclusionBuffer::FarDepth );
+		CT_EQUAL( buffer.getDepth( 0u, 0u, buffer.getLevelsCount() - 1u ), OcclusionBuffer::FarDepth );
+		CT_CHECK( isVisible( buffer, Point3f{ -1.0f, -1.0f, -500.0f }, Point3f{ 1.0f, 1.0f, -499.0f } ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::Hierarchy()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		// Left half of the screen, at a distance of 10.
+		createBox( Point3f{ -20.0f, -20.0f, -11.0f }, Point3f{ 0.0f, 20.0f, -10.0f }, positions, indices );
+		OcclusionBuffer buffer{ 64u, 64u };
+		buffer.clear( getViewProjection() );
+		buffer.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		buffer.rasterise();
+
+		for ( uint32_t y = 0u; y < 64u; ++y )
+		{
+			for ( uint32_t x = 0u; x < 64u; ++x )
+			{
+				if ( x < 32u )
+				{
+					CT_CHECK( buffer.getDepth( x, y ) < 1.0f );
+				}
+				else
+				{
+					CT_EQUAL( buffer.getDepth( x, y ), OcclusionBuffer::FarDepth );
+				}
+			}
+		}
+
+		// Each texel holds the farthest of the four texels below it.
+		for ( uint32_t level = 1u; level < buffer.getLevelsCount(); ++level )
+		{
+			auto size = 64u >> level;
+
+			for ( uint32_t y = 0u; y < size; ++y )
+			{
+				for ( uint32_t x = 0u; x < size; ++x )
+				{
+					CT_EQUAL( buffer.getDepth( x, y, level )
+						, std::max( { buffer.getDepth( x * 2u, y * 2u, level - 1u )
+							, buffer.getDepth( x * 2u + 1u, y * 2u, level - 1u )
+							, buffer.getDepth( x * 2u, y * 2u + 1u, level - 1u )
+							, buffer.getDepth( x * 2u + 1u, y * 2u + 1u, level - 1u ) } ) );
+				}
+			}
+		}
+
+		CT_CHECK( buffer.getDepth( 0u, 0u, 5u ) < 1.0f );
+		CT_EQUAL( buffer.getDepth( 0u, 0u, 6u ), OcclusionBuffer::FarDepth );
+	}
+
+	void CastorUtilsOcclusionBufferTest::FullOcclusion()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		// A wall covering the whole screen, at a distance of 10.
+		createBox( Point3f{ -20.0f, -20.0f, -11.0f }, Point3f{ 20.0f, 20.0f, -10.0f }, positions, indices );
+		OcclusionBuffer buffer{ 128u, 128u };
+		buffer.clear( getViewProjection() );
+		buffer.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		buffer.rasterise();
+		CT_EQUAL( buffer.getDepth( 0u, 0u, buffer.getLevelsCount() - 1u ) < 1.0f, true );
+
+		// Behind the wall.
+		CT_CHECK( !isVisible( buffer, Point3f{ -1.0f, -1.0f, -16.0f }, Point3f{ 1.0f, 1.0f, -15.0f } ) );
+		CT_CHECK( !isVisible( buffer, Point3f{ -30.0f, -30.0f, -100.0f }, Point3f{ 30.0f, 30.0f, -50.0f } ) );
+		CT_CHECK( !isVisible( buffer, Point3f{ 5.0f, 5.0f, -12.0f }, Point3f{ 6.0f, 6.0f, -11.5f } ) );
+		// In front of the wall.
+		CT_CHECK( isVisible( buffer, Point3f{ -1.0f, -1.0f, -6.0f }, Point3f{ 1.0f, 1.0f, -5.0f } ) );
+		// The occluder itself.
+		CT_CHECK( isVisible( buffer, Point3f{ -20.0f, -20.0f, -11.0f }, Point3f{ 20.0f, 20.0f, -10.0f } ) );
+		// Going through the wall.
+		CT_CHECK( isVisible( buffer, Point3f{ -1.0f, -1.0f, -15.0f }, Point3f{ 1.0f, 1.0f, -9.0f } ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::PartialOcclusion()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		// Two walls, with a gap between x = -2 and x = 2.
+		createBox( Point3f{ -20.0f, -20.0f, -11.0f }, Point3f{ -2.0f, 20.0f, -10.0f }, positions, indices );
+		createBox( Point3f{ 2.0f, -20.0f, -11.0f }, Point3f{ 20.0f, 20.0f, -10.0f }, positions, indices );
+		OcclusionBuffer buffer{ 128u, 128u };
+		buffer.clear( getViewProjection() );
+		buffer.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		buffer.rasterise();
+
+		struct Expected
+		{
+			Point3f min;
+			Point3f max;
+			bool visible;
+		};
+		std::vector< Expected > const expected
+		{
+			// Behind the left wall.
+			{ Point3f{ -9.0f, -1.0f, -20.0f }, Point3f{ -7.0f, 1.0f, -19.0f }, false },
+			// Behind the right wall.
+			{ Point3f{ 7.0f, 3.0f, -20.0f }, Point3f{ 9.0f, 5.0f, -19.0f }, false },
+			// Seen through the gap.
+			{ Point3f{ -1.0f, -1.0f, -40.0f }, Point3f{ 1.0f, 1.0f, -39.0f }, true },
+			// Behind the left wall, the gap side is seen through the gap.
+			{ Point3f{ -6.0f, -1.0f, -20.0f }, Point3f{ -2.0f, 1.0f, -19.0f }, true },
+			// Farther, wider than the gap.
+			{ Point3f{ -10.0f, -1.0f, -60.0f }, Point3f{ 10.0f, 1.0f, -59.0f }, true },
+			// Behind the left wall, and above the screen.
+			{ Point3f{ -9.0f, 15.0f, -20.0f }, Point3f{ -7.0f, 25.0f, -19.0f }, false },
+		};
+
+		for ( auto & box : expected )
+		{
+			CT_EQUAL( isVisible( buffer, box.min, box.max ), box.visible );
+		}
+	}
+
+	void CastorUtilsOcclusionBufferTest::Conservative()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createBox( Point3f{ -20.0f, -20.0f, -11.0f }, Point3f{ 20.0f, 20.0f, -10.0f }, positions, indices );
+		// A triangle crossing the camera near plane, covering the screen, is ignored.
+		positions.push_back( Point3f{ -50.0f, -50.0f, 1.0f } );
+		positions.push_back( Point3f{ 50.0f, -50.0f, -1.0f } );
+		positions.push_back( Point3f{ 0.0f, 50.0f, -1.0f } );
+		indices.insert( indices.end(), { 8u, 9u, 10u } );
+		OcclusionBuffer buffer{ 128u, 128u };
+		buffer.clear( getViewProjection() );
+		buffer.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		// Only the front and back faces of the wall are on screen.
+		CT_EQUAL( buffer.getTrianglesCount(), 4u );
+		buffer.rasterise();
+
+		// Crossing the near plane.
+		CT_CHECK( isVisible( buffer, Point3f{ -1.0f, -1.0f, -20.0f }, Point3f{ 1.0f, 1.0f, 1.0f } ) );
+		// Behind the camera.
+		CT_CHECK( isVisible( buffer, Point3f{ -1.0f, -1.0f, 5.0f }, Point3f{ 1.0f, 1.0f, 6.0f } ) );
+		// Out of the screen.
+		CT_CHECK( isVisible( buffer, Point3f{ 100.0f, -1.0f, -20.0f }, Point3f{ 101.0f, 1.0f, -19.0f } ) );
+		// A thin box, right behind the wall.
+		CT_CHECK( !isVisible( buffer, Point3f{ -1.0f, -1.0f, -11.01f }, Point3f{ 1.0f, 1.0f, -11.001f } ) );
+
+		// Only the pixels entirely covered by the occluder are written.
+		positions.clear();
+		indices.clear();
+		createBox( Point3f{ -3.3f, -3.3f, -11.0f }, Point3f{ 3.3f, 3.3f, -10.0f }, positions, indices );
+		buffer.clear( getViewProjection() );
+		buffer.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		buffer.rasterise();
+		// [-3.3, 3.3] at a distance of 10 covers the pixels ]42.88, 85.12[.
+		CT_EQUAL( buffer.getDepth( 42u, 64u ), OcclusionBuffer::FarDepth );
+		CT_CHECK( buffer.getDepth( 43u, 64u ) < 1.0f );
+		CT_CHECK( buffer.getDepth( 84u, 64u ) < 1.0f );
+		CT_EQUAL( buffer.getDepth( 85u, 64u ), OcclusionBuffer::FarDepth );
+		// The box is larger than the occluder by less than a pixel.
+		CT_CHECK( isVisible( buffer, Point3f{ -3.72f, -1.0f, -11.5f }, Point3f{ 0.0f, 1.0f, -11.2f } ) );
+		CT_CHECK( !isVisible( buffer, Point3f{ -3.3f, -0.2f, -11.5f }, Point3f{ -3.0f, 0.2f, -11.2f } ) );
+
+		// [-3.25, 3.25] covers the pixels ]43.2, 84.8[, so the pixels 43 and 84 are partly covered, their center included.
+		positions.clear();
+		indices.clear();
+		createBox( Point3f{ -3.25f, -3.25f, -11.0f }, Point3f{ 3.25f, 3.25f, -10.0f }, positions, indices );
+		buffer.clear( getViewProjection() );
+		buffer.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		buffer.rasterise();
+		CT_EQUAL( buffer.getDepth( 43u, 64u ), OcclusionBuffer::FarDepth );
+		CT_CHECK( buffer.getDepth( 44u, 64u ) < 1.0f );
+		CT_CHECK( buffer.getDepth( 83u, 64u ) < 1.0f );
+		CT_EQUAL( buffer.getDepth( 84u, 64u ), OcclusionBuffer::FarDepth );
+		// A box peeking past the occluder edge, by less than a pixel, stays visible.
+		CT_CHECK( isVisible( buffer, Point3f{ -3.6f, -1.0f, -11.5f }, Point3f{ -3.0f, 1.0f, -11.2f } ) );
+		// The occluder diagonals leave no crack.
+		for ( uint32_t i = 44u; i <= 83u; ++i )
+		{
+			CT_CHECK( buffer.getDepth( i, i ) < 1.0f );
+			CT_CHECK( buffer.getDepth( i, 127u - i ) < 1.0f );
+		}
+	}
+
+	void CastorUtilsOcclusionBufferTest::ParallelRasterisation()
+	{
+		std::vector< Point3f > positions;
+		std::vector< uint32_t > indices;
+		createGrid( 48u, Point3f{ -15.0f, -12.0f, -10.0f }, Point3f{ 15.0f, 12.0f, -30.0f }, positions, indices );
+		OcclusionBuffer sequential{ 200u, 150u };
+		OcclusionBuffer parallel{ 200u, 150u };
+		auto viewProjection = getViewProjection( Point3f{ 1.0f, 2.0f, 0.0f }, Point3f{ 0.0f, 0.0f, -20.0f } );
+		sequential.clear( viewProjection );
+		parallel.clear( viewProjection );
+		sequential.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		parallel.addOccluder( positions, indices, Matrix4x4f{ 1.0f } );
+		CT_CHECK( parallel.getTrianglesCount() >= 2048u );
+		sequential.rasterise( 1u );
+		parallel.rasterise( 4u );
+		uint32_t differences = 0u;
+		uint32_t covered = 0u;
+
+		for ( uint32_t level = 0u; level < sequential.getLevelsCount(); ++level )
+		{
+			auto width = std::max( 1u, ( 200u + ( 1u << level ) - 1u ) >> level );
+			auto height = std::max( 1u, ( 150u + ( 1u << level ) - 1u ) >> level );
+
+			for ( uint32_t y = 0u; y < height; ++y )
+			{
+				for ( uint32_t x = 0u; x < width; ++x )
+				{
+					differences += ( sequential.getDepth( x, y, level ) != parallel.getDepth( x, y, level ) ) ? 1u : 0u;
+					covered += ( level == 0u && sequential.getDepth( x, y ) < 1.0f ) ? 1u : 0u;
+				}
+			}
+		}
+
+		CT_EQUAL( differences, 0u );
+		CT_CHECK( covered > 200u * 150u / 2u );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsOcclusionBufferBench::CastorUtilsOcclusionBufferBench()
+		: BenchCase( "CastorUtilsOcclusionBufferBench" )
+		, m_buffer{ 256u, 128u }
+	{
+		std::mt19937 engine{ 42u };
+		std::uniform_real_distribution< float > height{ 5.0f, 40.0f };
+		std::uniform_real_distribution< float > offset{ 0.0f, 6.0f };
+		std::uniform_real_distribution< float > size{ 0.5f, 3.0f };
+		createBox( Point3f{ 0.0f, 0.0f, 0.0f }, Point3f{ 1.0f, 1.0f, 1.0f }, m_positions, m_indices );
+		matrix::perspective( m_viewProjection, 60.0_degrees, 2.0f, 0.1f, 1000.0f );
+		m_viewProjection = m_viewProjection * matrix::lookAt( Point3f{ 0.0f, 2.0f, 0.0f }
+			, Point3f{ 0.0f, 2.0f, -1.0f }
+			, Point3f{ 0.0f, 1.0f, 0.0f } );
+
+		// A city of 32x32 blocks, 10 units wide, in front of the camera.
+		for ( int32_t z = 0; z < 32; ++z )
+		{
+			for ( int32_t x = -16; x < 16; ++x )
+			{
+				auto min = Point3f{ float( x ) * 10.0f + 1.0f, 0.0f, -float( z ) * 10.0f - 9.0f };
+				m_occluders.push_back( getTransform( min
+					, min + Point3f{ 8.0f, height( engine ), 8.0f } ) );
+
+				// Small props in the streets.
+				for ( uint32_t i = 0u; i < 4u; ++i )
+				{
+					auto propMin = Point3f{ min[0] - 1.0f + offset( engine ) * 1.5f, 0.0f, min[2] - 1.0f };
+					m_occludees.push_back( getTransform( propMin
+						, propMin + Point3f{ size( engine ), size( engine ), size( engine ) } ) );
+				}
+			}
+		}
+	}
+
+	CastorUtilsOcclusionBufferBench::~CastorUtilsOcclusionBufferBench()
+	{
+	}
+
+	void CastorUtilsOcclusionBufferBench::Execute()
+	{
+		BENCHMARK( Rasterise, 100u );
+		std::cout << "*	City ( " << m_occluders.size() << " buildings ), " << m_buffer.getTrianglesCount() << " rasterised triangles" << std::endl;
+		BENCHMARK( TestOccludees, 100u );
+		std::cout << "*	City ( " << m_occludees.size() << " props ), hidden: " << 100.0f * float( m_hidden ) / float( m_occludees.size() ) << "%" << std::endl;
+	}
+
+	void CastorUtilsOcclusionBufferBench::Rasterise()
+	{
+		m_buffer.clear( m_viewProjection );
+
+		for ( auto & transform : m_occluders )
+		{
+			m_buffer.addOccluder( m_positions, m_indices, transform );
+		}
+
+		m_buffer.rasterise();
+	}
+
+	void CastorUtilsOcclusionBufferBench::TestOccludees()
+	{
+		BoundingBox box{ Point3f{ 0.0f, 0.0f, 0.0f }, Point3f{ 1.0f, 1.0f, 1.0f } };
+		m_hidden = 0u;
+
+		for ( auto & transform : m_occludees )
+		{
+			m_hidden += m_buffer.isVisible( box, transform ) ? 0u : 1u;
+		}
+	}
+}
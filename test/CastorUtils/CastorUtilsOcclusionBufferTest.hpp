@@ -0,0 +1,53 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsOcclusionBufferTest___
+#define ___CUT_CastorUtilsOcclusionBufferTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/OcclusionBuffer.hpp>
+
+namespace Testing
+{
+	class CastorUtilsOcclusionBufferTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsOcclusionBufferTest();
+		virtual ~CastorUtilsOcclusionBufferTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Empty();
+		void Hierarchy();
+		void FullOcclusion();
+		void PartialOcclusion();
+		void Conservative();
+		void ParallelRasterisation();
+	};
+
+	class CastorUtilsOcclusionBufferBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsOcclusionBufferBench();
+		virtual ~CastorUtilsOcclusionBufferBench();
+		virtual void Execute();
+
+	private:
+		void Rasterise();
+		void TestOccludees();
+
+	private:
+		castor::OcclusionBuffer m_buffer;
+		castor::Matrix4x4f m_viewProjection;
+		std::vector< castor::Point3f > m_positions;
+		std::vector< uint32_t > m_indices;
+		std::vector< castor::Matrix4x4f > m_occluders;
+		std::vector< castor::Matrix4x4f > m_occludees;
+		uint32_t m_hidden{ 0u };
+	};
+}
+
+#endif
@@ -0,0 +1,147 @@
+#include "CastorUtilsParallelForTest.hpp"
+
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	CastorUtilsParallelForTest::CastorUtilsParallelForTest()
+		: TestCase( "CastorUtilsParallelForTest" )
+	{
+	}
+
+	CastorUtilsParallelForTest::~CastorUtilsParallelForTest()
+	{
+	}
+
+	void CastorUtilsParallelForTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsParallelForTest::Parts", std::bind( &CastorUtilsParallelForTest::Parts, this ) );
+		doRegisterTest( "CastorUtilsParallelForTest::Exception", std::bind( &CastorUtilsParallelForTest::Exception, this ) );
+		doRegisterTest( "CastorUtilsParallelForTest::Nested", std::bind( &CastorUtilsParallelForTest::Nested, this ) );
+		doRegisterTest( "CastorUtilsParallelForTest::Concurrent", std::bind( &CastorUtilsParallelForTest::Concurrent, this ) );
+	}
+
+	void CastorUtilsParallelForTest::Parts()
+	{
+		CT_CHECK( getParallelThreadsCount() >= 1u );
+
+		for ( uint32_t partsCount : { 0u, 1u, 3u, 7u, 64u } )
+		{
+			for ( size_t count : { size_t( 0u ), size_t( 5u ), size_t( 1000u ) } )
+			{
+				auto expectedParts = partsCount ? partsCount : getParallelThreadsCount();
+				std::vector< std::atomic_uint32_t > visits( count );
+				std::vector< std::atomic_uint32_t > parts( expectedParts );
+				parallelFor( count
+					, partsCount
+					, [&]( uint32_t part, size_t begin, size_t end )
+					{
+						++parts[part];
+
+						for ( auto i = begin; i < end; ++i )
+						{
+							++visits[i];
+						}
+					} );
+
+				for ( auto & visit : visits )
+				{
+					CT_EQUAL( visit.load(), 1u );
+				}
+
+				for ( auto & part : parts )
+				{
+					CT_EQUAL( part.load(), 1u );
+				}
+			}
+		}
+	}
+
+	void CastorUtilsParallelForTest::Exception()
+	{
+		std::atomic_uint32_t processed{ 0u };
+		bool thrown = false;
+
+		try
+		{
+			parallelFor( 64u
+				, 8u
+				, [&processed]( uint32_t part, size_t begin, size_t end )
+				{
+					if ( part == 3u )
+					{
+						throw std::runtime_error{ "part 3" };
+					}
+
+					std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+					++processed;
+				} );
+		}
+		catch ( std::runtime_error & exc )
+		{
+			thrown = std::string{ exc.what() } == "part 3";
+		}
+
+		// The other parts are all processed when the exception reaches the caller.
+		CT_CHECK( thrown );
+		CT_EQUAL( processed.load(), 7u );
+	}
+
+	void CastorUtilsParallelForTest::Nested()
+	{
+		std::atomic< size_t > sum{ 0u };
+		parallelFor( 16u
+			, 0u
+			, [&sum]( uint32_t, size_t begin, size_t end )
+			{
+				for ( auto i = begin; i < end; ++i )
+				{
+					parallelFor( 100u
+						, 0u
+						, [&sum, i]( uint32_t, size_t innerBegin, size_t innerEnd )
+						{
+							sum += ( innerEnd - innerBegin ) * i;
+						} );
+				}
+			} );
+		CT_EQUAL( sum.load(), size_t( 100u * ( 15u * 16u / 2u ) ) );
+	}
+
+	void CastorUtilsParallelForTest::Concurrent()
+	{
+		auto sumRange = []()
+		{
+			std::atomic< size_t > sum{ 0u };
+
+			for ( uint32_t i = 0u; i < 100u; ++i )
+			{
+				parallelFor( 1000u
+					, 0u
+					, [&sum]( uint32_t, size_t begin, size_t end )
+					{
+						for ( auto j = begin; j < end; ++j )
+						{
+							sum += j;
+						}
+					} );
+			}
+
+			return sum.load();
+		};
+		size_t other{ 0u };
+		std::thread thread{ [&other, &sumRange]()
+			{
+				other = sumRange();
+			} };
+		auto mine = sumRange();
+		thread.join();
+		CT_EQUAL( mine, size_t( 100u * ( 999u * 1000u / 2u ) ) );
+		CT_EQUAL( other, mine );
+	}
+}
@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_ParallelForTest_H___
+#define ___CUT_ParallelForTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsParallelForTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsParallelForTest();
+		virtual ~CastorUtilsParallelForTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Parts();
+		void Exception();
+		void Nested();
+		void Concurrent();
+	};
+}
+
+#endif
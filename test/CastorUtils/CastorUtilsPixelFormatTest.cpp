@@ -2,6 +2,11 @@
 
 #include <CastorUtils/Graphics/PixelBuffer.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+
 using namespace castor;
 
 namespace
@@ -452,6 +457,93 @@ namespace
 	{
 		BufferConversionChecker< PF >()();
 	}
+
+	// Enough pixels for the fast conversions to be split across threads, and not a multiple of the SIMD widths.
+	static size_t constexpr FastConversionPixels = 262144u + 13u;
+
+	std::vector< uint8_t > makeRandomBytes( size_t size )
+	{
+		std::mt19937 engine{ 42u };
+		std::uniform_int_distribution< uint32_t > distribution{ 0u, 255u };
+		std::vector< uint8_t > result( size );
+
+		for ( auto & value : result )
+		{
+			value = uint8_t( distribution( engine ) );
+		}
+
+		return result;
+	}
+
+	std::vector< float > makeUnitFloats( size_t count )
+	{
+		std::mt19937 engine{ 42u };
+		std::uniform_real_distribution< float > distribution{ 0.0f, 1.0f };
+		std::vector< float > result( count );
+
+		for ( auto & value : result )
+		{
+			value = distribution( engine );
+		}
+
+		// The bounds.
+		result[0] = 0.0f;
+		result[1] = 1.0f;
+		return result;
+	}
+
+	std::vector< float > makeAnyFloats( size_t count )
+	{
+		std::mt19937 engine{ 42u };
+		std::uniform_int_distribution< uint32_t > exponent{ 90u, 150u };
+		std::uniform_int_distribution< uint32_t > bits{};
+		std::vector< float > result( count );
+		uint32_t const specials[] =
+		{
+			0x00000000u, 0x80000000u, // Signed zeroes
+			0x00000001u, 0x807FFFFFu, // Denormals
+			0x7F800000u, 0xFF800000u, // Infinites
+			0x7FC00000u, 0xFF800001u, // NaNs
+			0x477FE000u, 0x477FF000u, // Largest half, rounded up to infinite
+			0x38800000u, 0x387FF000u, // Smallest normal half, and rounded up to it
+			0x33800000u, 0x33000000u, // Smallest denormal half, and rounded up to it
+			0x3F801000u, 0x3F800FFFu, // Rounding half up
+		};
+		std::transform( result.begin()
+			, result.end()
+			, result.begin()
+			, [&]( float )
+			{
+				// Mostly around the halves range.
+				auto value = bits( engine );
+				value = ( value & 0x807FFFFFu ) | ( exponent( engine ) << 23u );
+				float f;
+				std::memcpy( &f, &value, sizeof( f ) );
+				return f;
+			} );
+		std::memcpy( result.data(), specials, sizeof( specials ) );
+		return result;
+	}
+
+	template< typename ValueT >
+	std::vector< uint8_t > toBytes( std::vector< ValueT > const & values )
+	{
+		std::vector< uint8_t > result( values.size() * sizeof( ValueT ) );
+		std::memcpy( result.data(), values.data(), result.size() );
+		return result;
+	}
+
+	template< PixelFormat PFSrc >
+	std::vector< uint8_t > convertScalar( std::vector< uint8_t > const & source
+		, PixelFormat dstFormat )
+	{
+		auto count = source.size() / PixelDefinitions< PFSrc >::Size;
+		std::vector< uint8_t > result( count * PF::getBytesPerPixel( dstFormat ) );
+		uint8_t const * src = source.data();
+		uint8_t * dst = result.data();
+		PixelDefinitions< PFSrc >::convert( src, uint32_t( source.size() ), dstFormat, dst, uint32_t( result.size() ) );
+		return result;
+	}
 }
 
 namespace Testing
@@ -469,6 +561,7 @@ namespace Testing
 	{
 		doRegisterTest( "TestPixelConversions", std::bind( &CastorUtilsPixelFormatTest::TestPixelConversions, this ) );
 		doRegisterTest( "TestBufferConversions", std::bind( &CastorUtilsPixelFormatTest::TestBufferConversions, this ) );
+		doRegisterTest( "TestFastBufferConversions", std::bind( &CastorUtilsPixelFormatTest::TestFastBufferConversions, this ) );
 	}
 
 	void CastorUtilsPixelFormatTest::TestPixelConversions()
@@ -506,4 +599,93 @@ namespace Testing
 		CheckBufferConversions< PixelFormat::eD24_UNORM_S8_UINT >();
 		CheckBufferConversions< PixelFormat::eS8_UINT >();
 	}
+
+	void CastorUtilsPixelFormatTest::TestFastBufferConversions()
+	{
+		std::vector< PixelFormat > const bytesFormats
+		{
+			PixelFormat::eR8G8B8_UNORM,
+			PixelFormat::eR8G8B8_SRGB,
+			PixelFormat::eB8G8R8_UNORM,
+			PixelFormat::eR8G8B8A8_UNORM,
+			PixelFormat::eR8G8B8A8_SRGB,
+			PixelFormat::eA8B8G8R8_UNORM,
+		};
+		std::vector< PixelFormat > const floatsFormats
+		{
+			PixelFormat::eR16G16B16A16_SFLOAT,
+			PixelFormat::eR32G32B32A32_SFLOAT,
+		};
+		auto allFormats = bytesFormats;
+		allFormats.insert( allFormats.end(), floatsFormats.begin(), floatsFormats.end() );
+
+		doCheckFastConversions< PixelFormat::eR8_UNORM >( makeRandomBytes( FastConversionPixels ), allFormats );
+		doCheckFastConversions< PixelFormat::eR8A8_UNORM >( makeRandomBytes( FastConversionPixels * 2u ), { PixelFormat::eR8G8B8A8_UNORM, PixelFormat::eA8B8G8R8_SRGB, PixelFormat::eR32G32B32A32_SFLOAT } );
+		doCheckFastConversions< PixelFormat::eR8G8B8_UNORM >( makeRandomBytes( FastConversionPixels * 3u ), allFormats );
+		doCheckFastConversions< PixelFormat::eB8G8R8_SRGB >( makeRandomBytes( FastConversionPixels * 3u ), allFormats );
+		doCheckFastConversions< PixelFormat::eR8G8B8A8_UNORM >( makeRandomBytes( FastConversionPixels * 4u ), allFormats );
+		doCheckFastConversions< PixelFormat::eA8B8G8R8_UNORM >( makeRandomBytes( FastConversionPixels * 4u ), allFormats );
+
+		// The scalar float to byte conversion is only defined for representable results.
+		auto unitFloats = makeUnitFloats( FastConversionPixels * 4u );
+		std::vector< uint16_t > unitHalves( unitFloats.size() );
+
+		for ( size_t i = 0u; i < unitFloats.size(); ++i )
+		{
+			floatToHalf( &unitHalves[i], unitFloats[i] );
+		}
+
+		doCheckFastConversions< PixelFormat::eR32G32B32A32_SFLOAT >( toBytes( unitFloats ), bytesFormats );
+		doCheckFastConversions< PixelFormat::eR16G16B16A16_SFLOAT >( toBytes( unitHalves ), bytesFormats );
+
+		// All the halves, and the floats rounding cases.
+		std::vector< uint16_t > allHalves( 65536u );
+		std::iota( allHalves.begin(), allHalves.end(), uint16_t( 0u ) );
+		doCheckFastConversions< PixelFormat::eR16G16B16A16_SFLOAT >( toBytes( allHalves ), floatsFormats );
+		doCheckFastConversions< PixelFormat::eR32G32B32A32_SFLOAT >( toBytes( makeAnyFloats( FastConversionPixels * 4u ) ), floatsFormats );
+
+		// The formats pairs without fast path are left to the scalar conversion.
+		std::vector< uint8_t > grey( 16u );
+		std::vector< uint8_t > rgb( 48u );
+		CT_CHECK( !PF::convertBufferFast( PixelConversionSimd::eNone, PixelFormat::eR8G8B8A8_UNORM, rgb.data(), 48u, PixelFormat::eR8_UNORM, grey.data(), 12u, 1u ) );
+		CT_CHECK( !PF::convertBufferFast( PixelConversionSimd::eNone, PixelFormat::eR5G6B5_UNORM, rgb.data(), 32u, PixelFormat::eR8G8B8_UNORM, rgb.data(), 48u, 1u ) );
+	}
+
+	template< PixelFormat PFSrc >
+	void CastorUtilsPixelFormatTest::doCheckFastConversions( std::vector< uint8_t > const & source
+		, std::vector< PixelFormat > const & dstFormats )
+	{
+		for ( auto dstFormat : dstFormats )
+		{
+			auto reference = convertScalar< PFSrc >( source, dstFormat );
+			std::vector< uint8_t > result( reference.size() );
+
+			for ( auto simd = PixelConversionSimd::eNone; simd <= PF::getConversionSimd(); simd = PixelConversionSimd( uint32_t( simd ) + 1u ) )
+			{
+				for ( auto threadsCount : { 1u, 3u } )
+				{
+					std::fill( result.begin(), result.end(), uint8_t( 0xCD ) );
+					CT_CHECK( PF::convertBufferFast( simd
+						, PFSrc
+						, source.data()
+						, uint32_t( source.size() )
+						, dstFormat
+						, result.data()
+						, uint32_t( result.size() )
+						, threadsCount ) );
+					CT_CHECK( result == reference );
+				}
+			}
+
+			// The generic conversion takes the fast path.
+			std::fill( result.begin(), result.end(), uint8_t( 0xCD ) );
+			PF::convertBuffer( PFSrc
+				, source.data()
+				, uint32_t( source.size() )
+				, dstFormat
+				, result.data()
+				, uint32_t( result.size() ) );
+			CT_CHECK( result == reference );
+		}
+	}
 }
@@ -19,6 +19,11 @@ namespace Testing
 	private:
 		void TestPixelConversions();
 		void TestBufferConversions();
+		void TestFastBufferConversions();
+
+		template< castor::PixelFormat PFSrc >
+		void doCheckFastConversions( std::vector< uint8_t > const & source
+			, std::vector< castor::PixelFormat > const & dstFormats );
 	};
 }
 
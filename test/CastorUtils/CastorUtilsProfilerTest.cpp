@@ -0,0 +1,255 @@
+#include "CastorUtilsProfilerTest.hpp"
+
+#include <CastorUtils/Data/File.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static constexpr ProfilerZone outerZone{ "Outer", __FILE__, uint32_t( __LINE__ ), ProfilerZone::Kind::eScope };
+		static constexpr ProfilerZone innerZone{ "Inner \"quoted\"", __FILE__, uint32_t( __LINE__ ), ProfilerZone::Kind::eScope };
+		static constexpr ProfilerZone counterZone{ "Counter", __FILE__, uint32_t( __LINE__ ), ProfilerZone::Kind::eCounter };
+
+		void profileNested( uint32_t innerCount )
+		{
+			ProfilerScope outer{ outerZone };
+
+			for ( uint32_t i = 0u; i < innerCount; ++i )
+			{
+				ProfilerScope inner{ innerZone };
+			}
+		}
+
+		ProfilerZoneSummary const * findZone( ProfilerFrameSummary const & summary
+			, ProfilerZone const & zone )
+		{
+			auto it = std::find_if( summary.begin()
+				, summary.end()
+				, [&zone]( ProfilerZoneSummary const & lookup )
+				{
+					return lookup.zone == &zone;
+				} );
+			return it == summary.end()
+				? nullptr
+				: &( *it );
+		}
+
+		void restart()
+		{
+			Profiler::stopCapture();
+			Profiler::clear();
+			Profiler::startCapture();
+		}
+
+		size_t countOccurences( std::string const & text
+			, std::string const & lookup )
+		{
+			size_t result = 0u;
+			auto index = text.find( lookup );
+
+			while ( index != std::string::npos )
+			{
+				++result;
+				index = text.find( lookup, index + lookup.size() );
+			}
+
+			return result;
+		}
+	}
+
+	CastorUtilsProfilerTest::CastorUtilsProfilerTest()
+		: TestCase( "CastorUtilsProfilerTest" )
+	{
+	}
+
+	CastorUtilsProfilerTest::~CastorUtilsProfilerTest()
+	{
+		Profiler::stopCapture();
+		Profiler::clear();
+	}
+
+	void CastorUtilsProfilerTest::doRegisterTests()
+	{
+		doRegisterTest( "NotCapturing", std::bind( &CastorUtilsProfilerTest::NotCapturing, this ) );
+		doRegisterTest( "FrameSummary", std::bind( &CastorUtilsProfilerTest::FrameSummary, this ) );
+		doRegisterTest( "Counters", std::bind( &CastorUtilsProfilerTest::Counters, this ) );
+		doRegisterTest( "RingBuffer", std::bind( &CastorUtilsProfilerTest::RingBuffer, this ) );
+		doRegisterTest( "MultiThreaded", std::bind( &CastorUtilsProfilerTest::MultiThreaded, this ) );
+		doRegisterTest( "ChromeTrace", std::bind( &CastorUtilsProfilerTest::ChromeTrace, this ) );
+	}
+
+	void CastorUtilsProfilerTest::NotCapturing()
+	{
+		restart();
+		Profiler::stopCapture();
+		CT_CHECK( !Profiler::isCapturing() );
+		profileNested( 4u );
+		Profiler::count( counterZone, 1 );
+		Profiler::startCapture();
+		Profiler::nextFrame();
+		CT_CHECK( Profiler::getFrameSummary().empty() );
+		Profiler::stopCapture();
+	}
+
+	void CastorUtilsProfilerTest::FrameSummary()
+	{
+		restart();
+		profileNested( 3u );
+		Profiler::nextFrame();
+		auto summary = Profiler::getFrameSummary();
+		CT_EQUAL( summary.size(), 2u );
+		auto outer = findZone( summary, outerZone );
+		auto inner = findZone( summary, innerZone );
+		CT_REQUIRE( outer != nullptr );
+		CT_REQUIRE( inner != nullptr );
+		CT_EQUAL( outer->count, 1u );
+		CT_EQUAL( inner->count, 3u );
+		CT_CHECK( outer->total >= inner->total );
+		CT_CHECK( inner->max <= inner->total );
+		// Sorted by decreasing total.
+		CT_CHECK( summary.front().zone == &outerZone );
+
+		// Only the events recorded since the previous frame are summarised.
+		profileNested( 1u );
+		Profiler::nextFrame();
+		summary = Profiler::getFrameSummary();
+		inner = findZone( summary, innerZone );
+		CT_REQUIRE( inner != nullptr );
+		CT_EQUAL( inner->count, 1u );
+		Profiler::stopCapture();
+	}
+
+	void CastorUtilsProfilerTest::Counters()
+	{
+		restart();
+		Profiler::count( counterZone, 5 );
+		Profiler::count( counterZone, 12 );
+		Profiler::count( counterZone, -3 );
+		Profiler::nextFrame();
+		auto summary = Profiler::getFrameSummary();
+		auto counter = findZone( summary, counterZone );
+		CT_REQUIRE( counter != nullptr );
+		CT_EQUAL( counter->count, 3u );
+		CT_EQUAL( counter->total, 14 );
+		CT_EQUAL( counter->max, 12 );
+		Profiler::stopCapture();
+	}
+
+	void CastorUtilsProfilerTest::RingBuffer()
+	{
+		restart();
+		Profiler::setThreadCapacity( 8u );
+		// The capacity applies to the threads recording their first event from now on.
+		std::thread thread{ []()
+			{
+				Profiler::setThreadName( "Ring" );
+				profileNested( 20u );
+			} };
+		thread.join();
+		Profiler::setThreadCapacity( Profiler::DefaultThreadCapacity );
+		Profiler::nextFrame();
+		auto summary = Profiler::getFrameSummary();
+		auto outer = findZone( summary, outerZone );
+		auto inner = findZone( summary, innerZone );
+		CT_REQUIRE( outer != nullptr );
+		CT_REQUIRE( inner != nullptr );
+		// The outer scope is recorded last, only the 7 last inner scopes remain.
+		CT_EQUAL( outer->count, 1u );
+		CT_EQUAL( inner->count, 7u );
+
+		std::ostringstream stream;
+		Profiler::writeChromeTrace( stream );
+		CT_CHECK( stream.str().find( "\"Ring\"" ) != std::string::npos );
+
+		// The ended threads buffers are released on clear.
+		Profiler::clear();
+		stream.str( std::string{} );
+		Profiler::writeChromeTrace( stream );
+		CT_CHECK( stream.str().find( "\"Ring\"" ) == std::string::npos );
+		Profiler::stopCapture();
+	}
+
+	void CastorUtilsProfilerTest::MultiThreaded()
+	{
+		restart();
+		uint32_t constexpr threadsCount = 4u;
+		uint32_t constexpr framesCount = 50u;
+		std::atomic< bool > done{ false };
+		std::vector< std::thread > threads;
+
+		for ( uint32_t i = 0u; i < threadsCount; ++i )
+		{
+			threads.emplace_back( [&done]()
+				{
+					while ( !done )
+					{
+						profileNested( 2u );
+					}
+				} );
+		}
+
+		uint64_t outers = 0u;
+		uint64_t inners = 0u;
+
+		// Frames are summarised while the threads are recording.
+		for ( uint32_t i = 0u; i < framesCount; ++i )
+		{
+			std::this_thread::sleep_for( std::chrono::microseconds( 200 ) );
+			Profiler::nextFrame();
+			auto summary = Profiler::getFrameSummary();
+
+			if ( auto outer = findZone( summary, outerZone ) )
+			{
+				outers += outer->count;
+			}
+
+			if ( auto inner = findZone( summary, innerZone ) )
+			{
+				inners += inner->count;
+			}
+		}
+
+		done = true;
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+
+		CT_CHECK( outers > 0u );
+		CT_CHECK( inners >= outers );
+		Profiler::stopCapture();
+	}
+
+	void CastorUtilsProfilerTest::ChromeTrace()
+	{
+		restart();
+		Profiler::setThreadName( "Main" );
+		profileNested( 2u );
+		Profiler::count( counterZone, 42 );
+		Profiler::nextFrame();
+		Profiler::stopCapture();
+		std::ostringstream stream;
+		Profiler::writeChromeTrace( stream );
+		auto trace = stream.str();
+		CT_CHECK( trace.find( "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" ) == 0u );
+		CT_CHECK( trace.find( "\n]}\n" ) == trace.size() - 4u );
+		CT_CHECK( trace.find( "\"args\":{\"name\":\"Main\"}" ) != std::string::npos );
+		CT_EQUAL( countOccurences( trace, "\"ph\":\"X\"" ), 3u );
+		CT_EQUAL( countOccurences( trace, "\"name\":\"Inner \\\"quoted\\\"\"" ), 2u );
+		CT_CHECK( trace.find( "\"ph\":\"C\",\"args\":{\"value\":42}" ) != std::string::npos );
+		CT_CHECK( trace.find( "\"name\":\"Frame\"" ) != std::string::npos );
+
+		auto path = File::getExecutableDirectory() / cuT( "ProfilerTrace.json" );
+		CT_CHECK( Profiler::exportChromeTrace( path ) );
+		CT_CHECK( File::fileExists( path ) );
+		File::deleteFile( path );
+	}
+}
@@ -0,0 +1,31 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsProfilerTest___
+#define ___CUT_CastorUtilsProfilerTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
+namespace Testing
+{
+	class CastorUtilsProfilerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsProfilerTest();
+		virtual ~CastorUtilsProfilerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void NotCapturing();
+		void FrameSummary();
+		void Counters();
+		void RingBuffer();
+		void MultiThreaded();
+		void ChromeTrace();
+	};
+}
+
+#endif
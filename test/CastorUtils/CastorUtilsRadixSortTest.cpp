@@ -0,0 +1,146 @@
+#include "CastorUtilsRadixSortTest.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		std::vector< uint32_t > createIndices( size_t count )
+		{
+			std::vector< uint32_t > result( count );
+			std::iota( result.begin(), result.end(), 0u );
+			return result;
+		}
+
+		std::vector< uint32_t > createKeys( std::vector< float > const & values )
+		{
+			std::vector< uint32_t > result;
+			result.reserve( values.size() );
+
+			for ( auto value : values )
+			{
+				result.push_back( floatToRadixKey( value ) );
+			}
+
+			return result;
+		}
+
+		std::vector< float > createValues( size_t count
+			, float min
+			, float max )
+		{
+			std::mt19937 engine{ 42u };
+			std::uniform_real_distribution< float > distribution{ min, max };
+			std::vector< float > result( count );
+
+			for ( auto & value : result )
+			{
+				value = distribution( engine );
+			}
+
+			return result;
+		}
+
+		bool isSorted( std::vector< float > const & values
+			, std::vector< uint32_t > const & indices )
+		{
+			return std::is_sorted( indices.begin()
+				, indices.end()
+				, [&values]( uint32_t lhs, uint32_t rhs )
+				{
+					return values[lhs] < values[rhs];
+				} );
+		}
+	}
+
+	CastorUtilsRadixSortTest::CastorUtilsRadixSortTest()
+		: TestCase( "CastorUtilsRadixSortTest" )
+	{
+	}
+
+	CastorUtilsRadixSortTest::~CastorUtilsRadixSortTest()
+	{
+	}
+
+	void CastorUtilsRadixSortTest::doRegisterTests()
+	{
+		doRegisterTest( "FloatKeys", std::bind( &CastorUtilsRadixSortTest::FloatKeys, this ) );
+		doRegisterTest( "Stability", std::bind( &CastorUtilsRadixSortTest::Stability, this ) );
+		doRegisterTest( "MultiThreaded", std::bind( &CastorUtilsRadixSortTest::MultiThreaded, this ) );
+		doRegisterTest( "CoherentFastPath", std::bind( &CastorUtilsRadixSortTest::CoherentFastPath, this ) );
+		doRegisterTest( "CoherentFallback", std::bind( &CastorUtilsRadixSortTest::CoherentFallback, this ) );
+	}
+
+	void CastorUtilsRadixSortTest::FloatKeys()
+	{
+		CT_CHECK( floatToRadixKey( -2.0f ) < floatToRadixKey( -1.0f ) );
+		CT_CHECK( floatToRadixKey( -1.0f ) < floatToRadixKey( 0.0f ) );
+		CT_CHECK( floatToRadixKey( 0.0f ) < floatToRadixKey( 0.5f ) );
+		CT_CHECK( floatToRadixKey( 0.5f ) < floatToRadixKey( 1000.0f ) );
+
+		auto values = createValues( 1000u, -100.0f, 100.0f );
+		auto keys = createKeys( values );
+		auto indices = createIndices( values.size() );
+		RadixSorter sorter{ 1u };
+		sorter.sort( keys.data(), indices.data(), uint32_t( indices.size() ) );
+		CT_CHECK( isSorted( values, indices ) );
+	}
+
+	void CastorUtilsRadixSortTest::Stability()
+	{
+		std::vector< uint32_t > keys{ 3u, 1u, 3u, 0u, 1u, 3u, 0u };
+		auto indices = createIndices( keys.size() );
+		RadixSorter sorter{ 1u };
+		sorter.sort( keys.data(), indices.data(), uint32_t( indices.size() ) );
+		std::vector< uint32_t > expected{ 3u, 6u, 1u, 4u, 0u, 2u, 5u };
+		CT_CHECK( indices == expected );
+	}
+
+	void CastorUtilsRadixSortTest::MultiThreaded()
+	{
+		auto values = createValues( 200000u, 0.0f, 1000.0f );
+		auto keys = createKeys( values );
+		auto single = createIndices( values.size() );
+		auto multi = createIndices( values.size() );
+		RadixSorter singleSorter{ 1u };
+		RadixSorter multiSorter{ 4u };
+		singleSorter.sort( keys.data(), single.data(), uint32_t( single.size() ) );
+		multiSorter.sort( keys.data(), multi.data(), uint32_t( multi.size() ) );
+		CT_CHECK( isSorted( values, multi ) );
+		CT_CHECK( single == multi );
+	}
+
+	void CastorUtilsRadixSortTest::CoherentFastPath()
+	{
+		auto values = createValues( 1000u, 0.0f, 1000.0f );
+		auto keys = createKeys( values );
+		auto indices = createIndices( values.size() );
+		RadixSorter sorter{ 1u };
+		sorter.sort( keys.data(), indices.data(), uint32_t( indices.size() ) );
+		// Swap a few neighbours, as a slight camera move would.
+		for ( size_t i = 0u; i + 1u < indices.size(); i += 100u )
+		{
+			std::swap( indices[i], indices[i + 1u] );
+		}
+
+		CT_CHECK( sorter.sortCoherent( keys.data(), indices.data(), uint32_t( indices.size() ) ) );
+		CT_CHECK( isSorted( values, indices ) );
+	}
+
+	void CastorUtilsRadixSortTest::CoherentFallback()
+	{
+		auto values = createValues( 1000u, 0.0f, 1000.0f );
+		auto keys = createKeys( values );
+		auto indices = createIndices( values.size() );
+		RadixSorter sorter{ 1u };
+		sorter.sort( keys.data(), indices.data(), uint32_t( indices.size() ) );
+		std::reverse( indices.begin(), indices.end() );
+		CT_CHECK( !sorter.sortCoherent( keys.data(), indices.data(), uint32_t( indices.size() ) ) );
+		CT_CHECK( isSorted( values, indices ) );
+	}
+}
@@ -0,0 +1,30 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsRadixSortTest___
+#define ___CUT_CastorUtilsRadixSortTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Miscellaneous/RadixSort.hpp>
+
+namespace Testing
+{
+	class CastorUtilsRadixSortTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsRadixSortTest();
+		virtual ~CastorUtilsRadixSortTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void FloatKeys();
+		void Stability();
+		void MultiThreaded();
+		void CoherentFastPath();
+		void CoherentFallback();
+	};
+}
+
+#endif
@@ -3,7 +3,9 @@
 #include <CastorUtils/Design/Signal.hpp>
 #include <CastorUtils/Exception/Exception.hpp>
 
+#include <atomic>
 #include <random>
+#include <thread>
 
 using castor::Signal;
 
@@ -23,6 +25,10 @@ namespace Testing
 		doRegisterTest( "Creation", std::bind( &CastorUtilsSignalTest::Creation, this ) );
 		doRegisterTest( "Assignment", std::bind( &CastorUtilsSignalTest::Assignment, this ) );
 		doRegisterTest( "MultipleSignalConnectionAssignment", std::bind( &CastorUtilsSignalTest::MultipleSignalConnectionAssignment, this ) );
+		doRegisterTest( "DisconnectDuringEmission", std::bind( &CastorUtilsSignalTest::DisconnectDuringEmission, this ) );
+		doRegisterTest( "ConnectDuringEmission", std::bind( &CastorUtilsSignalTest::ConnectDuringEmission, this ) );
+		doRegisterTest( "DeferredEmission", std::bind( &CastorUtilsSignalTest::DeferredEmission, this ) );
+		doRegisterTest( "ThreadSafeEmission", std::bind( &CastorUtilsSignalTest::ThreadSafeEmission, this ) );
 	}
 
 	void CastorUtilsSignalTest::Creation()
@@ -70,4 +76,189 @@ namespace Testing
 		CT_CHECK_THROW( signal2() );
 		CT_CHECK_THROW( signal1() );
 	}
+
+	void CastorUtilsSignalTest::DisconnectDuringEmission()
+	{
+		Signal< std::function< void() > > signal;
+		Signal< std::function< void() > >::connection conn1;
+		Signal< std::function< void() > >::connection conn2;
+		uint32_t calls1 = 0u;
+		uint32_t calls2 = 0u;
+		// The first slot disconnects itself and the second one, while being called.
+		conn1 = signal.connect( [&]()
+			{
+				++calls1;
+				conn1.disconnect();
+				conn2.disconnect();
+			} );
+		conn2 = signal.connect( [&]()
+			{
+				++calls2;
+			} );
+		signal();
+		CT_EQUAL( calls1, 1u );
+		CT_EQUAL( calls2, 0u );
+		signal();
+		CT_EQUAL( calls1, 1u );
+		CT_EQUAL( calls2, 0u );
+		auto conn3 = signal.connect( [&]()
+			{
+				++calls2;
+			} );
+		signal();
+		CT_EQUAL( calls2, 1u );
+	}
+
+	void CastorUtilsSignalTest::ConnectDuringEmission()
+	{
+		Signal< std::function< void() > > signal;
+		std::vector< Signal< std::function< void() > >::connection > connections;
+		uint32_t calls = 0u;
+		connections.reserve( 16u );
+		// Each call connects a new slot, called from the next emission only.
+		connections.push_back( signal.connect( [&]()
+			{
+				++calls;
+				connections.push_back( signal.connect( [&calls]()
+					{
+						++calls;
+					} ) );
+			} ) );
+		signal();
+		CT_EQUAL( calls, 1u );
+		signal();
+		CT_EQUAL( calls, 3u );
+		CT_EQUAL( connections.size(), 3u );
+	}
+
+	void CastorUtilsSignalTest::DeferredEmission()
+	{
+		Signal< std::function< void( uint32_t ) > > signal;
+		std::vector< uint32_t > received;
+		auto connection = signal.connect( [&]( uint32_t value )
+			{
+				received.push_back( value );
+
+				if ( value == 2u )
+				{
+					// Deferred from a slot, done with the next flush.
+					signal.defer( 10u );
+				}
+			} );
+		signal.defer( 1u );
+		signal.defer( 2u );
+		signal.defer( 3u );
+		CT_EQUAL( signal.getDeferredCount(), 3u );
+		CT_CHECK( received.empty() );
+		signal.flush();
+		CT_EQUAL( received, ( std::vector< uint32_t >{ 1u, 2u, 3u } ) );
+		CT_EQUAL( signal.getDeferredCount(), 1u );
+		signal.flush();
+		CT_EQUAL( received, ( std::vector< uint32_t >{ 1u, 2u, 3u, 10u } ) );
+		CT_EQUAL( signal.getDeferredCount(), 0u );
+	}
+
+	void CastorUtilsSignalTest::ThreadSafeEmission()
+	{
+		castor::MtSignal< std::function< void( uint32_t ) > > signal;
+		std::atomic< uint64_t > sum{ 0u };
+		auto connection = signal.connect( [&sum]( uint32_t value )
+			{
+				sum += value;
+			} );
+		std::atomic_bool stop{ false };
+		// A thread connects and disconnects while others emit.
+		std::thread churn{ [&signal, &stop]()
+			{
+				while ( !stop )
+				{
+					auto temp = signal.connect( []( uint32_t )
+						{
+						} );
+				}
+			} };
+		std::vector< std::thread > emitters;
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			emitters.emplace_back( [&signal]()
+				{
+					for ( uint32_t j = 0u; j < 10000u; ++j )
+					{
+						signal( 1u );
+					}
+				} );
+		}
+
+		for ( auto & emitter : emitters )
+		{
+			emitter.join();
+		}
+
+		stop = true;
+		churn.join();
+		CT_EQUAL( sum, 40000u );
+	}
+
+	//*********************************************************************************************
+
+	namespace
+	{
+		static uint32_t constexpr SlotsCount = 32u;
+		static uint32_t constexpr CallsCount = 100000u;
+	}
+
+	CastorUtilsSignalBench::CastorUtilsSignalBench()
+		: BenchCase( "CastorUtilsSignalBench" )
+	{
+		// The captures are bigger than std::function's small buffer, so each copy allocates.
+		std::array< uint64_t, 4u > payload{ 1u, 2u, 3u, 4u };
+
+		for ( uint32_t i = 0u; i < SlotsCount; ++i )
+		{
+			auto function = [this, payload]( uint32_t value )
+			{
+				m_sum += value + payload[value % payload.size()];
+			};
+			m_connections.push_back( m_signal.connect( function ) );
+			m_slotsMap.emplace( i + 1u, function );
+		}
+	}
+
+	CastorUtilsSignalBench::~CastorUtilsSignalBench()
+	{
+	}
+
+	void CastorUtilsSignalBench::Execute()
+	{
+		BENCHMARK( EmitSignal, CallsCount );
+		// The former emission, copying each slot.
+		BENCHMARK( EmitSlotsMapCopy, CallsCount );
+		BENCHMARK( ConnectDisconnect, CallsCount );
+	}
+
+	void CastorUtilsSignalBench::EmitSignal()
+	{
+		m_signal( 1u );
+		doNotOptimizeAway( m_sum );
+	}
+
+	void CastorUtilsSignalBench::EmitSlotsMapCopy()
+	{
+		for ( auto it : m_slotsMap )
+		{
+			it.second( 1u );
+		}
+
+		doNotOptimizeAway( m_sum );
+	}
+
+	void CastorUtilsSignalBench::ConnectDisconnect()
+	{
+		auto connection = m_signal.connect( [this]( uint32_t value )
+			{
+				m_sum += value;
+			} );
+		connection.disconnect();
+	}
 }
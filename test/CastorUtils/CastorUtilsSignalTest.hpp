@@ -4,6 +4,7 @@
 
 #include "CastorUtilsTestPrerequisites.hpp"
 
+#include <CastorUtils/Design/Signal.hpp>
 #include <CastorUtils/Math/SquareMatrix.hpp>
 #if defined( CASTOR_USE_GLM )
 #	include <glm/glm.hpp>
@@ -25,6 +26,31 @@ namespace Testing
 		void Creation();
 		void Assignment();
 		void MultipleSignalConnectionAssignment();
+		void DisconnectDuringEmission();
+		void ConnectDuringEmission();
+		void DeferredEmission();
+		void ThreadSafeEmission();
+	};
+
+	class CastorUtilsSignalBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsSignalBench();
+		virtual ~CastorUtilsSignalBench();
+		virtual void Execute();
+
+	private:
+		void EmitSignal();
+		void EmitSlotsMapCopy();
+		void ConnectDisconnect();
+
+	private:
+		using Function = std::function< void( uint32_t ) >;
+		castor::Signal< Function > m_signal;
+		std::vector< castor::Signal< Function >::connection > m_connections;
+		std::map< uint32_t, Function > m_slotsMap;
+		uint64_t m_sum{ 0u };
 	};
 }
 
@@ -0,0 +1,165 @@
+#include "CastorUtilsSlotMapTest.hpp"
+
+#include <CastorUtils/Design/SlotMap.hpp>
+
+#include <algorithm>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		using IntSlotMap = SlotMap< int >;
+
+		int sum( IntSlotMap::Snapshot const & snapshot )
+		{
+			int result = 0;
+
+			for ( auto & element : snapshot )
+			{
+				result += *element;
+			}
+
+			return result;
+		}
+	}
+
+	CastorUtilsSlotMapTest::CastorUtilsSlotMapTest()
+		: TestCase{ "CastorUtilsSlotMapTest" }
+	{
+	}
+
+	CastorUtilsSlotMapTest::~CastorUtilsSlotMapTest()
+	{
+	}
+
+	void CastorUtilsSlotMapTest::doRegisterTests()
+	{
+		doRegisterTest( "SlotMapDeferredInsertTest", std::bind( &CastorUtilsSlotMapTest::deferredInsertTest, this ) );
+		doRegisterTest( "SlotMapStaleHandleTest", std::bind( &CastorUtilsSlotMapTest::staleHandleTest, this ) );
+		doRegisterTest( "SlotMapDenseEraseTest", std::bind( &CastorUtilsSlotMapTest::denseEraseTest, this ) );
+		doRegisterTest( "SlotMapSnapshotIsolationTest", std::bind( &CastorUtilsSlotMapTest::snapshotIsolationTest, this ) );
+		doRegisterTest( "SlotMapClearTest", std::bind( &CastorUtilsSlotMapTest::clearTest, this ) );
+		doRegisterTest( "SlotMapHandleValueTest", std::bind( &CastorUtilsSlotMapTest::handleValueTest, this ) );
+	}
+
+	void CastorUtilsSlotMapTest::deferredInsertTest()
+	{
+		IntSlotMap map;
+		auto handle = map.insert( std::make_shared< int >( 42 ) );
+		CT_CHECK( handle.isValid() );
+		CT_CHECK( map.isAlive( handle ) );
+		CT_CHECK( map.acquire()->empty() );
+		CT_CHECK( map.acquire()->get( handle ) == nullptr );
+
+		CT_CHECK( map.flush() );
+		CT_CHECK( !map.flush() );
+		auto snapshot = map.acquire();
+		CT_EQUAL( snapshot->size(), 1u );
+		CT_REQUIRE( snapshot->get( handle ) != nullptr );
+		CT_EQUAL( *snapshot->get( handle ), 42 );
+	}
+
+	void CastorUtilsSlotMapTest::staleHandleTest()
+	{
+		IntSlotMap map;
+		auto first = map.insert( std::make_shared< int >( 1 ) );
+		map.flush();
+		CT_CHECK( map.erase( first ) );
+		CT_CHECK( !map.erase( first ) );
+		CT_CHECK( !map.isAlive( first ) );
+
+		// The slot is reused, with a new generation.
+		auto second = map.insert( std::make_shared< int >( 2 ) );
+		CT_EQUAL( second.index, first.index );
+		CT_CHECK( second.generation != first.generation );
+		map.flush();
+		auto snapshot = map.acquire();
+		CT_CHECK( snapshot->get( first ) == nullptr );
+		CT_REQUIRE( snapshot->get( second ) != nullptr );
+		CT_EQUAL( *snapshot->get( second ), 2 );
+		CT_CHECK( snapshot->get( SlotHandle{} ) == nullptr );
+	}
+
+	void CastorUtilsSlotMapTest::denseEraseTest()
+	{
+		IntSlotMap map;
+		std::vector< SlotHandle > handles;
+
+		for ( int i = 0; i < 10; ++i )
+		{
+			handles.push_back( map.insert( std::make_shared< int >( i ) ) );
+		}
+
+		map.flush();
+		CT_EQUAL( sum( *map.acquire() ), 45 );
+
+		// Erase from the front, middle and back, and in the same batch as an insert.
+		map.erase( handles[0] );
+		map.erase( handles[5] );
+		map.erase( handles[9] );
+		auto added = map.insert( std::make_shared< int >( 100 ) );
+		map.flush();
+		auto snapshot = map.acquire();
+		CT_EQUAL( snapshot->size(), 8u );
+		CT_EQUAL( sum( *snapshot ), 45 - 0 - 5 - 9 + 100 );
+
+		for ( int i = 1; i < 9; ++i )
+		{
+			if ( i != 5 )
+			{
+				CT_REQUIRE( snapshot->get( handles[i] ) != nullptr );
+				CT_EQUAL( *snapshot->get( handles[i] ), i );
+			}
+		}
+
+		CT_REQUIRE( snapshot->get( added ) != nullptr );
+		CT_EQUAL( *snapshot->get( added ), 100 );
+	}
+
+	void CastorUtilsSlotMapTest::snapshotIsolationTest()
+	{
+		IntSlotMap map;
+		auto handle = map.insert( std::make_shared< int >( 3 ) );
+		map.flush();
+		auto before = map.acquire();
+		map.erase( handle );
+		map.insert( std::make_shared< int >( 4 ) );
+		map.flush();
+		auto after = map.acquire();
+
+		// The previous snapshot is left untouched.
+		CT_EQUAL( before->size(), 1u );
+		CT_REQUIRE( before->get( handle ) != nullptr );
+		CT_EQUAL( *before->get( handle ), 3 );
+		CT_EQUAL( after->size(), 1u );
+		CT_CHECK( after->get( handle ) == nullptr );
+		CT_EQUAL( sum( *after ), 4 );
+	}
+
+	void CastorUtilsSlotMapTest::clearTest()
+	{
+		IntSlotMap map;
+		auto first = map.insert( std::make_shared< int >( 1 ) );
+		map.insert( std::make_shared< int >( 2 ) );
+		map.flush();
+		map.clear();
+		CT_CHECK( !map.isAlive( first ) );
+		auto third = map.insert( std::make_shared< int >( 3 ) );
+		map.flush();
+		auto snapshot = map.acquire();
+		CT_EQUAL( snapshot->size(), 1u );
+		CT_CHECK( snapshot->get( first ) == nullptr );
+		CT_REQUIRE( snapshot->get( third ) != nullptr );
+		CT_EQUAL( *snapshot->get( third ), 3 );
+	}
+
+	void CastorUtilsSlotMapTest::handleValueTest()
+	{
+		SlotHandle handle{ 12u, 34u };
+		CT_CHECK( SlotHandle::fromValue( handle.getValue() ) == handle );
+		CT_CHECK( !SlotHandle{}.isValid() );
+		CT_CHECK( handle.isValid() );
+	}
+}
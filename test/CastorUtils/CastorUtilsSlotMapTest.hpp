@@ -0,0 +1,29 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_SlotMapTest_H___
+#define ___CUT_SlotMapTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsSlotMapTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsSlotMapTest();
+		virtual ~CastorUtilsSlotMapTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void deferredInsertTest();
+		void staleHandleTest();
+		void denseEraseTest();
+		void snapshotIsolationTest();
+		void clearTest();
+		void handleValueTest();
+	};
+}
+
+#endif
@@ -0,0 +1,114 @@
+#include "CastorUtilsSphericalHarmonicsTest.hpp"
+
+#include <CastorUtils/Graphics/ImageLayout.hpp>
+#include <CastorUtils/Graphics/PixelBufferBase.hpp>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		PxBufferBaseSPtr createCube( uint32_t size
+			, Point3f const & colour
+			, Point3f const & topColour )
+		{
+			auto result = PxBufferBase::create( Size{ size, size }
+				, 6u
+				, 1u
+				, PixelFormat::eR32G32B32A32_SFLOAT );
+			ImageLayout layout{ ImageLayout::e2DArray, *result };
+
+			for ( uint32_t face = 0u; face < 6u; ++face )
+			{
+				auto texels = reinterpret_cast< float * >( layout.layerMipBuffer( *result, face, 0u ).data() );
+				// Face 2 is +Y.
+				auto & value = face == 2u ? topColour : colour;
+
+				for ( uint32_t i = 0u; i < size * size; ++i )
+				{
+					*texels++ = value[0];
+					*texels++ = value[1];
+					*texels++ = value[2];
+					*texels++ = 1.0f;
+				}
+			}
+
+			return result;
+		}
+
+		bool isClose( Point3f const & lhs
+			, Point3f const & rhs
+			, float epsilon )
+		{
+			return std::abs( lhs[0] - rhs[0] ) < epsilon
+				&& std::abs( lhs[1] - rhs[1] ) < epsilon
+				&& std::abs( lhs[2] - rhs[2] ) < epsilon;
+		}
+	}
+
+	CastorUtilsSphericalHarmonicsTest::CastorUtilsSphericalHarmonicsTest()
+		: TestCase( "CastorUtilsSphericalHarmonicsTest" )
+	{
+	}
+
+	CastorUtilsSphericalHarmonicsTest::~CastorUtilsSphericalHarmonicsTest()
+	{
+	}
+
+	void CastorUtilsSphericalHarmonicsTest::doRegisterTests()
+	{
+		doRegisterTest( "ConstantEnvironment", std::bind( &CastorUtilsSphericalHarmonicsTest::ConstantEnvironment, this ) );
+		doRegisterTest( "DirectionalEnvironment", std::bind( &CastorUtilsSphericalHarmonicsTest::DirectionalEnvironment, this ) );
+		doRegisterTest( "IrradianceCube", std::bind( &CastorUtilsSphericalHarmonicsTest::IrradianceCube, this ) );
+		doRegisterTest( "MultiThreaded", std::bind( &CastorUtilsSphericalHarmonicsTest::MultiThreaded, this ) );
+	}
+
+	void CastorUtilsSphericalHarmonicsTest::ConstantEnvironment()
+	{
+		Point3f colour{ 0.25f, 0.5f, 2.0f };
+		auto cube = createCube( 16u, colour, colour );
+		auto sh = SphericalHarmonics::fromCube( *cube, 1u );
+		// A constant environment reflects its own colour on a white lambertian surface, whatever the normal.
+		CT_CHECK( isClose( sh.evaluateIrradiance( Point3f{ 0.0f, 1.0f, 0.0f } ), colour, 0.001f ) );
+		CT_CHECK( isClose( sh.evaluateIrradiance( Point3f{ 1.0f, 0.0f, 0.0f } ), colour, 0.001f ) );
+		CT_CHECK( isClose( sh.evaluate( Point3f{ 0.0f, 0.0f, -1.0f } ), colour, 0.001f ) );
+	}
+
+	void CastorUtilsSphericalHarmonicsTest::DirectionalEnvironment()
+	{
+		auto cube = createCube( 16u, Point3f{ 0.0f, 0.0f, 0.0f }, Point3f{ 1.0f, 1.0f, 1.0f } );
+		auto sh = SphericalHarmonics::fromCube( *cube, 1u );
+		auto up = sh.evaluateIrradiance( Point3f{ 0.0f, 1.0f, 0.0f } );
+		auto side = sh.evaluateIrradiance( Point3f{ 1.0f, 0.0f, 0.0f } );
+		auto down = sh.evaluateIrradiance( Point3f{ 0.0f, -1.0f, 0.0f } );
+		CT_CHECK( up[0] > side[0] );
+		CT_CHECK( side[0] > down[0] );
+		CT_CHECK( down[0] >= 0.0f );
+	}
+
+	void CastorUtilsSphericalHarmonicsTest::IrradianceCube()
+	{
+		Point3f colour{ 0.25f, 0.5f, 2.0f };
+		auto cube = createCube( 16u, colour, colour );
+		auto irradiance = SphericalHarmonics::fromCube( *cube ).toIrradianceCube( 8u );
+		CT_EQUAL( irradiance->getLayers(), 6u );
+		CT_EQUAL( irradiance->getWidth(), 8u );
+		CT_CHECK( irradiance->getFormat() == PixelFormat::eR32G32B32A32_SFLOAT );
+		ImageLayout layout{ ImageLayout::e2DArray, *irradiance };
+		auto texels = reinterpret_cast< float const * >( layout.layerMipBuffer( *irradiance, 5u, 0u ).data() );
+		CT_CHECK( isClose( Point3f{ texels[0], texels[1], texels[2] }, colour, 0.001f ) );
+	}
+
+	void CastorUtilsSphericalHarmonicsTest::MultiThreaded()
+	{
+		auto cube = createCube( 32u, Point3f{ 0.1f, 0.2f, 0.3f }, Point3f{ 4.0f, 2.0f, 1.0f } );
+		auto single = SphericalHarmonics::fromCube( *cube, 1u );
+		auto multi = SphericalHarmonics::fromCube( *cube, 6u );
+
+		for ( uint32_t i = 0u; i < SphericalHarmonics::CoefficientsCount; ++i )
+		{
+			CT_CHECK( isClose( single.getCoefficients()[i], multi.getCoefficients()[i], 0.0001f ) );
+		}
+	}
+}
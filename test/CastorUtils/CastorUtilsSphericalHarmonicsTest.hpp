@@ -0,0 +1,29 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsSphericalHarmonicsTest___
+#define ___CUT_CastorUtilsSphericalHarmonicsTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/SphericalHarmonics.hpp>
+
+namespace Testing
+{
+	class CastorUtilsSphericalHarmonicsTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsSphericalHarmonicsTest();
+		virtual ~CastorUtilsSphericalHarmonicsTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void ConstantEnvironment();
+		void DirectionalEnvironment();
+		void IrradianceCube();
+		void MultiThreaded();
+	};
+}
+
+#endif
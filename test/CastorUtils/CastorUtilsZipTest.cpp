@@ -5,11 +5,80 @@
 #include <CastorUtils/Data/TextFile.hpp>
 
 #include <cstring>
+#include <stdexcept>
 
 using namespace castor;
 
 namespace Testing
 {
+	namespace
+	{
+		struct Archive
+		{
+			Archive()
+			{
+				for ( uint32_t i = 0u; i < 8u; ++i )
+				{
+					data.emplace_back( 1024u * ( i + 1u ) );
+
+					for ( size_t j = 0u; j < data.back().size(); ++j )
+					{
+						data.back()[j] = uint8_t( ( j * ( i + 3u ) ) % 251u );
+					}
+				}
+
+				if ( !File::directoryExists( folder1 ) )
+				{
+					File::directoryCreate( folder1 );
+				}
+
+				if ( !File::directoryExists( folder2 ) )
+				{
+					File::directoryCreate( folder2 );
+				}
+
+				{
+					ZipArchive def( name, File::OpenMode::eWrite );
+
+					for ( uint32_t i = 0u; i < data.size(); ++i )
+					{
+						auto file = getFile( i );
+						{
+							BinaryFile binary( file, File::OpenMode::eWrite );
+							binary.writeArray( data[i].data(), data[i].size() );
+						}
+						def.addFile( file );
+					}
+
+					def.deflate();
+				}
+
+				for ( uint32_t i = 0u; i < data.size(); ++i )
+				{
+					std::remove( string::stringCast< char >( getFile( i ) ).c_str() );
+				}
+
+				File::directoryDelete( folder2 );
+				File::directoryDelete( folder1 );
+			}
+
+			~Archive()
+			{
+				std::remove( string::stringCast< char >( name ).c_str() );
+			}
+
+			Path getFile( uint32_t index )const
+			{
+				return ( index % 2u ? folder2 : folder1 ) / ( cuT( "file" ) + string::toString( index ) + cuT( ".bin" ) );
+			}
+
+			Path folder1{ cuT( "memory1" ) };
+			Path folder2{ folder1 / cuT( "memory2" ) };
+			Path name{ cuT( "memoryFile.zip" ) };
+			std::vector< ByteArray > data;
+		};
+	}
+
 	CastorUtilsZipTest::CastorUtilsZipTest()
 		:	TestCase( "CastorUtilsZipTest" )
 	{
@@ -22,6 +91,8 @@ namespace Testing
 	void CastorUtilsZipTest::doRegisterTests()
 	{
 		doRegisterTest( "ZipFile", std::bind( &CastorUtilsZipTest::ZipFile, this ) );
+		doRegisterTest( "ReadInMemory", std::bind( &CastorUtilsZipTest::ReadInMemory, this ) );
+		doRegisterTest( "ExtractCached", std::bind( &CastorUtilsZipTest::ExtractCached, this ) );
 	}
 
 	void CastorUtilsZipTest::ZipFile()
@@ -121,4 +192,86 @@ namespace Testing
 			std::cout << "	Couldn't create first folder" << std::endl;
 		}
 	}
+
+	void CastorUtilsZipTest::ReadInMemory()
+	{
+		Archive archive;
+		auto zip = std::make_shared< ZipArchive >( archive.name, File::OpenMode::eRead );
+		CT_EQUAL( zip->listFiles().size(), archive.data.size() );
+		CT_CHECK( zip->findFile( archive.getFile( 1u ) ) );
+		CT_CHECK( zip->findFolder( archive.folder2 ) );
+		CT_CHECK( !zip->findFile( cuT( "missing.bin" ) ) );
+
+		std::cout << "	Read on demand" << std::endl;
+		ByteArray data;
+		CT_CHECK( zip->readFile( archive.getFile( 0u ), data ) );
+		CT_CHECK( data == archive.data[0] );
+		CT_CHECK( !zip->readFile( Path{ cuT( "missing.bin" ) }, data ) );
+
+		std::cout << "	Read prefetched" << std::endl;
+		zip->prefetch( zip->listFiles(), 4u );
+
+		for ( uint32_t i = 0u; i < archive.data.size(); ++i )
+		{
+			CT_CHECK( zip->readFile( archive.getFile( i ), data ) );
+			CT_CHECK( data == archive.data[i] );
+		}
+
+		std::cout << "	Read mounted" << std::endl;
+		Path root{ cuT( "virtual" ) };
+		ZipArchive::mount( root, zip );
+		CT_CHECK( ZipArchive::findMountedFile( root / archive.getFile( 3u ) ) );
+		CT_CHECK( ZipArchive::readMountedFile( root / archive.getFile( 3u ), data ) );
+		CT_CHECK( data == archive.data[3] );
+		CT_EQUAL( ZipArchive::listMountedFiles( root / archive.folder2 ).size(), archive.data.size() / 2u );
+		ZipArchive::unmount( root );
+		CT_CHECK( !ZipArchive::findMountedFile( root / archive.getFile( 3u ) ) );
+		CT_CHECK( !ZipArchive::readMountedFile( root / archive.getFile( 3u ), data ) );
+
+		std::cout << "	Mount guard" << std::endl;
+		try
+		{
+			ZipArchive::MountGuard guard{ root, zip };
+			CT_CHECK( ZipArchive::findMountedFile( root / archive.getFile( 3u ) ) );
+			throw std::runtime_error{ "Parsing failure" };
+		}
+		catch ( std::runtime_error & )
+		{
+		}
+
+		CT_CHECK( !ZipArchive::findMountedFile( root / archive.getFile( 3u ) ) );
+	}
+
+	void CastorUtilsZipTest::ExtractCached()
+	{
+		Archive archive;
+		Path cache{ cuT( "zipCache" ) };
+		Path folder;
+		{
+			ZipArchive zip( archive.name, File::OpenMode::eRead );
+			CT_CHECK( zip.extract( cache, folder ) );
+			CT_CHECK( File::fileExists( folder / cuT( ".complete" ) ) );
+			CT_CHECK( File::fileExists( folder / archive.getFile( 5u ) ) );
+		}
+		{
+			// Same content, same folder, reused as is.
+			std::remove( string::stringCast< char >( folder / archive.getFile( 5u ) ).c_str() );
+			ZipArchive zip( archive.name, File::OpenMode::eRead );
+			Path reused;
+			CT_CHECK( zip.extract( cache, reused ) );
+			CT_EQUAL( reused, folder );
+			CT_CHECK( !File::fileExists( folder / archive.getFile( 5u ) ) );
+		}
+
+		for ( uint32_t i = 0u; i < archive.data.size(); ++i )
+		{
+			std::remove( string::stringCast< char >( folder / archive.getFile( i ) ).c_str() );
+		}
+
+		std::remove( string::stringCast< char >( folder / cuT( ".complete" ) ).c_str() );
+		File::directoryDelete( folder / archive.folder2 );
+		File::directoryDelete( folder / archive.folder1 );
+		File::directoryDelete( folder );
+		File::directoryDelete( cache );
+	}
 }
@@ -18,6 +18,8 @@ namespace Testing
 
 	private:
 		void ZipFile();
+		void ReadInMemory();
+		void ExtractCached();
 	};
 }
 
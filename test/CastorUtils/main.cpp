@@ -1,15 +1,27 @@
 #include "OpenClBench.hpp"
 #include "CastorUtilsArrayViewTest.hpp"
+#include "CastorUtilsBlockCompressionTest.hpp"
 #include "CastorUtilsBuddyAllocatorTest.hpp"
 #include "CastorUtilsDynamicBitsetTest.hpp"
+#include "CastorUtilsFileParserTest.hpp"
+#include "CastorUtilsHeightmapTest.hpp"
 #include "CastorUtilsMatrixTest.hpp"
+#include "CastorUtilsMeshSimplifierTest.hpp"
+#include "CastorUtilsMeshletTest.hpp"
+#include "CastorUtilsMipmapGenerationTest.hpp"
+#include "CastorUtilsOcclusionBufferTest.hpp"
+#include "CastorUtilsParallelForTest.hpp"
 #include "CastorUtilsPixelFormatTest.hpp"
+#include "CastorUtilsProfilerTest.hpp"
 #include "CastorUtilsStringTest.hpp"
 #include "CastorUtilsZipTest.hpp"
 #include "CastorUtilsUniqueTest.hpp"
 #include "CastorUtilsObjectsPoolTest.hpp"
 #include "CastorUtilsQuaternionTest.hpp"
+#include "CastorUtilsRadixSortTest.hpp"
 #include "CastorUtilsSignalTest.hpp"
+#include "CastorUtilsSlotMapTest.hpp"
+#include "CastorUtilsSphericalHarmonicsTest.hpp"
 #include "CastorUtilsThreadPoolTest.hpp"
 #include "CastorUtilsWorkerThreadTest.hpp"
 
@@ -42,17 +54,35 @@ int main( int argc, char const * argv[] )
 	Testing::registerType( std::make_unique< Testing::CastorUtilsDynamicBitsetTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsBuddyAllocatorTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsSignalTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsSignalBench >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsWorkerThreadTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsThreadPoolTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsParallelForTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsArrayViewTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsUniqueTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsMatrixTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsMatrixBench >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsPixelFormatTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsBlockCompressionTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsBlockCompressionBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMipmapGenerationTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsSphericalHarmonicsTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMeshSimplifierTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMeshSimplifierBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMeshletTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsMeshletBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsOcclusionBufferTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsOcclusionBufferBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsHeightmapTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsHeightmapBench >() );
 	//Testing::registerType( std::make_unique< Testing::CastorUtilsStringTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsZipTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsObjectsPoolTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsQuaternionTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsSlotMapTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsRadixSortTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsProfilerTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsFileParserTest >() );
 	BENCHLOOP( iCount, iReturn );
 	castor::Logger::cleanup();
 	return iReturn;
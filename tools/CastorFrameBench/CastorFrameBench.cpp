@@ -0,0 +1,623 @@
+#include "CastorFrameBench/CastorFrameBench.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Cache/PluginCache.hpp>
+#include <Castor3D/Render/CpuFrameTimings.hpp>
+#include <Castor3D/Render/RenderLoop.hpp>
+#include <Castor3D/Render/RenderWindow.hpp>
+#include <Castor3D/Scene/SceneFileParser.hpp>
+
+#include <CastorUtils/Data/File.hpp>
+#include <CastorUtils/Log/Logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+
+using StringArray = std::vector< std::string >;
+
+struct Options
+{
+	castor::Path input;
+	castor::Path output;
+	castor::Path samples;
+	castor::Path baseline;
+	std::string renderer{ "test" };
+	uint32_t frames{ 200u };
+	uint32_t warmup{ 10u };
+	castor::Size size{ 800u, 600u };
+	double tolerance{ 10.0 };
+	double minTime{ 50.0 };
+};
+
+struct Stats
+{
+	std::string name;
+	double min{};
+	double mean{};
+	double p50{};
+	double p90{};
+	double p95{};
+	double p99{};
+	double max{};
+};
+
+using StatsArray = std::vector< Stats >;
+using Samples = std::vector< std::vector< double > >;
+
+static std::string const TotalName = "total";
+
+void printUsage()
+{
+	std::cout << "Castor Frame Bench renders a scene offscreen, and measures the CPU time spent in each phase of the frames." << std::endl;
+	std::cout << "It uses Ashes test renderer by default, so no GPU is needed." << std::endl;
+	std::cout << "Usage:" << std::endl;
+	std::cout << "CastorFrameBench FILE [options]" << std::endl;
+	std::cout << "  FILE must be a .cscn or .zip scene file." << std::endl;
+	std::cout << "Options:" << std::endl;
+	std::cout << "  -f N        Number of measured frames (default 200)." << std::endl;
+	std::cout << "  -w N        Number of frames rendered before measuring (default 10)." << std::endl;
+	std::cout << "  -s WxH      Render window size (default 800x600)." << std::endl;
+	std::cout << "  -r NAME     Renderer plug-in name (default test)." << std::endl;
+	std::cout << "  -o FILE     Output statistics file, .json or .csv (default prints CSV)." << std::endl;
+	std::cout << "  -p FILE     Output per frame samples CSV file." << std::endl;
+	std::cout << "  -b FILE     Baseline statistics CSV file, to compare with." << std::endl;
+	std::cout << "  -t PCT      Allowed regression against baseline, in percent (default 10)." << std::endl;
+	std::cout << "  -m US       Phases under this baseline median, in microseconds, aren't compared (default 50)." << std::endl;
+	std::cout << "The process returns a non zero value if a phase median or 95th percentile regressed." << std::endl << std::endl;
+}
+
+bool doGetValue( StringArray const & args
+	, std::string const & option
+	, std::string & value )
+{
+	auto it = std::find( args.begin(), args.end(), option );
+
+	if ( it == args.end() )
+	{
+		return true;
+	}
+
+	if ( ++it == args.end() )
+	{
+		std::cerr << "Missing parameter for " << option << " option." << std::endl << std::endl;
+		return false;
+	}
+
+	value = *it;
+	return true;
+}
+
+bool doParseArgs( int argc
+	, char * argv[]
+	, Options & options )
+{
+	StringArray args{ argv + 1, argv + argc };
+
+	if ( args.empty() )
+	{
+		std::cerr << "Missing scene file parameter." << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+
+	if ( std::find( args.begin(), args.end(), "-h" ) != args.end()
+		|| std::find( args.begin(), args.end(), "--help" ) != args.end() )
+	{
+		printUsage();
+		return false;
+	}
+
+	options.input = castor::Path{ castor::string::stringCast< castor::xchar >( args[0] ) };
+	std::string frames;
+	std::string warmup;
+	std::string size;
+	std::string output;
+	std::string samples;
+	std::string baseline;
+	std::string tolerance;
+	std::string minTime;
+
+	if ( !doGetValue( args, "-f", frames )
+		|| !doGetValue( args, "-w", warmup )
+		|| !doGetValue( args, "-s", size )
+		|| !doGetValue( args, "-r", options.renderer )
+		|| !doGetValue( args, "-o", output )
+		|| !doGetValue( args, "-p", samples )
+		|| !doGetValue( args, "-b", baseline )
+		|| !doGetValue( args, "-t", tolerance )
+		|| !doGetValue( args, "-m", minTime ) )
+	{
+		printUsage();
+		return false;
+	}
+
+	try
+	{
+		if ( !frames.empty() )
+		{
+			options.frames = std::max( 1u, uint32_t( std::stoul( frames ) ) );
+		}
+
+		if ( !warmup.empty() )
+		{
+			options.warmup = uint32_t( std::stoul( warmup ) );
+		}
+
+		if ( !size.empty() )
+		{
+			auto pos = size.find( 'x' );
+
+			if ( pos == std::string::npos )
+			{
+				std::cerr << "Invalid window size [" << size << "]." << std::endl << std::endl;
+				printUsage();
+				return false;
+			}
+
+			options.size = castor::Size{ uint32_t( std::stoul( size.substr( 0u, pos ) ) )
+				, uint32_t( std::stoul( size.substr( pos + 1u ) ) ) };
+		}
+
+		if ( !tolerance.empty() )
+		{
+			options.tolerance = std::stod( tolerance );
+		}
+
+		if ( !minTime.empty() )
+		{
+			options.minTime = std::stod( minTime );
+		}
+	}
+	catch ( std::exception & )
+	{
+		std::cerr << "Invalid numeric parameter." << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+
+	options.output = castor::Path{ castor::string::stringCast< castor::xchar >( output ) };
+	options.samples = castor::Path{ castor::string::stringCast< castor::xchar >( samples ) };
+	options.baseline = castor::Path{ castor::string::stringCast< castor::xchar >( baseline ) };
+	return true;
+}
+
+void loadPlugins( castor3d::Engine & engine )
+{
+	castor::PathArray files;
+	castor::File::listDirectoryFiles( castor3d::Engine::getPluginsDirectory(), files );
+	castor::PathArray arrayFailed;
+
+	for ( auto file : files )
+	{
+		if ( file.getExtension() == CU_SharedLibExt )
+		{
+			if ( !engine.getPluginCache().loadPlugin( file ) )
+			{
+				arrayFailed.push_back( file );
+			}
+		}
+	}
+
+	if ( !arrayFailed.empty() )
+	{
+		castor::Logger::logWarning( cuT( "Some plug-ins couldn't be loaded :" ) );
+
+		for ( auto file : arrayFailed )
+		{
+			castor::Logger::logWarning( castor::Path( file ).getFileName() );
+		}
+	}
+
+	castor::Logger::logInfo( cuT( "Plugins loaded" ) );
+}
+
+bool doInitialiseEngine( castor3d::Engine & engine
+	, Options const & options )
+{
+	if ( !castor::File::directoryExists( castor3d::Engine::getEngineDirectory() ) )
+	{
+		castor::File::directoryCreate( castor3d::Engine::getEngineDirectory() );
+	}
+
+	auto & renderers = engine.getRenderersList();
+	bool result = false;
+
+	if ( renderers.empty() )
+	{
+		std::cerr << "No renderer plug-ins" << std::endl;
+	}
+	else
+	{
+		auto renderer = renderers.find( options.renderer );
+
+		if ( renderer != renderers.end() )
+		{
+			if ( engine.loadRenderer( renderer->name ) )
+			{
+				loadPlugins( engine );
+				engine.initialise( 1, false );
+				result = true;
+			}
+			else
+			{
+				std::cerr << "Couldn't load renderer." << std::endl;
+			}
+		}
+		else
+		{
+			std::cerr << "Couldn't find " << options.renderer << " renderer." << std::endl;
+		}
+	}
+
+	return result;
+}
+
+castor3d::RenderWindowSPtr doLoadScene( castor3d::Engine & engine
+	, Options const & options )
+{
+	castor3d::RenderWindowSPtr result;
+
+	try
+	{
+		castor3d::SceneFileParser parser( engine );
+
+		if ( parser.parseFile( options.input ) )
+		{
+			result = parser.getRenderWindow();
+		}
+		else
+		{
+			std::cerr << "Can't read scene file." << std::endl;
+		}
+	}
+	catch ( std::exception & exc )
+	{
+		std::cerr << "Failed to parse the scene file, with following error: " << exc.what() << std::endl;
+	}
+
+	if ( result
+		&& !result->initialise( options.size
+			, ashes::WindowHandle{ std::make_unique< DummyWindowHandle >() } ) )
+	{
+		std::cerr << "Can't initialise the render window." << std::endl;
+		result.reset();
+	}
+
+	return result;
+}
+
+double toMicroseconds( castor::Nanoseconds const & value )
+{
+	return double( value.count() ) / 1000.0;
+}
+
+Samples doRunFrames( castor3d::Engine & engine
+	, Options const & options )
+{
+	auto & loop = engine.getRenderLoop();
+
+	for ( uint32_t i = 0u; i < options.warmup; ++i )
+	{
+		loop.renderSyncFrame();
+	}
+
+	Samples result( size_t( castor3d::CpuFramePhase::eCount ) + 1u );
+
+	for ( auto & phase : result )
+	{
+		phase.reserve( options.frames );
+	}
+
+	for ( uint32_t i = 0u; i < options.frames; ++i )
+	{
+		loop.renderSyncFrame();
+		auto timings = loop.getLastCpuTimings();
+
+		for ( size_t phase = 0u; phase < timings.phases.size(); ++phase )
+		{
+			result[phase].push_back( toMicroseconds( timings.phases[phase] ) );
+		}
+
+		result.back().push_back( toMicroseconds( timings.total ) );
+	}
+
+	return result;
+}
+
+std::string getPhaseName( size_t index )
+{
+	return index < size_t( castor3d::CpuFramePhase::eCount )
+		? castor::string::stringCast< char >( castor3d::getName( castor3d::CpuFramePhase( index ) ) )
+		: TotalName;
+}
+
+double getPercentile( std::vector< double > const & sorted
+	, double percentile )
+{
+	// Nearest rank method.
+	auto rank = size_t( std::ceil( percentile / 100.0 * double( sorted.size() ) ) );
+	return sorted[std::min( sorted.size(), std::max( size_t( 1u ), rank ) ) - 1u];
+}
+
+StatsArray doComputeStats( Samples const & samples )
+{
+	StatsArray result;
+
+	for ( size_t index = 0u; index < samples.size(); ++index )
+	{
+		auto sorted = samples[index];
+		std::sort( sorted.begin(), sorted.end() );
+		Stats stats;
+		stats.name = getPhaseName( index );
+		stats.min = sorted.front();
+		stats.max = sorted.back();
+		stats.mean = std::accumulate( sorted.begin(), sorted.end(), 0.0 ) / double( sorted.size() );
+		stats.p50 = getPercentile( sorted, 50.0 );
+		stats.p90 = getPercentile( sorted, 90.0 );
+		stats.p95 = getPercentile( sorted, 95.0 );
+		stats.p99 = getPercentile( sorted, 99.0 );
+		result.push_back( stats );
+	}
+
+	return result;
+}
+
+void doWriteCsv( std::ostream & stream
+	, StatsArray const & stats )
+{
+	stream << std::fixed << std::setprecision( 3 );
+	stream << "phase,min_us,mean_us,p50_us,p90_us,p95_us,p99_us,max_us" << std::endl;
+
+	for ( auto & phase : stats )
+	{
+		stream << phase.name
+			<< "," << phase.min
+			<< "," << phase.mean
+			<< "," << phase.p50
+			<< "," << phase.p90
+			<< "," << phase.p95
+			<< "," << phase.p99
+			<< "," << phase.max << std::endl;
+	}
+}
+
+void doWriteJson( std::ostream & stream
+	, Options const & options
+	, StatsArray const & stats )
+{
+	auto scene = castor::string::stringCast< char >( options.input.getFileName( true ) );
+	stream << std::fixed << std::setprecision( 3 );
+	stream << "{" << std::endl;
+	stream << "  \"scene\": \"" << scene << "\"," << std::endl;
+	stream << "  \"renderer\": \"" << options.renderer << "\"," << std::endl;
+	stream << "  \"frames\": " << options.frames << "," << std::endl;
+	stream << "  \"warmup\": " << options.warmup << "," << std::endl;
+	stream << "  \"width\": " << options.size.getWidth() << "," << std::endl;
+	stream << "  \"height\": " << options.size.getHeight() << "," << std::endl;
+	stream << "  \"unit\": \"us\"," << std::endl;
+	stream << "  \"phases\": {";
+	std::string sep = "\n";
+
+	for ( auto & phase : stats )
+	{
+		stream << sep << "    \"" << phase.name << "\": { "
+			<< "\"min\": " << phase.min
+			<< ", \"mean\": " << phase.mean
+			<< ", \"p50\": " << phase.p50
+			<< ", \"p90\": " << phase.p90
+			<< ", \"p95\": " << phase.p95
+			<< ", \"p99\": " << phase.p99
+			<< ", \"max\": " << phase.max << " }";
+		sep = ",\n";
+	}
+
+	stream << std::endl << "  }" << std::endl;
+	stream << "}" << std::endl;
+}
+
+void doWriteSamples( std::ostream & stream
+	, Samples const & samples )
+{
+	stream << std::fixed << std::setprecision( 3 );
+	stream << "frame";
+
+	for ( size_t index = 0u; index < samples.size(); ++index )
+	{
+		stream << "," << getPhaseName( index ) << "_us";
+	}
+
+	stream << std::endl;
+
+	for ( size_t frame = 0u; frame < samples.back().size(); ++frame )
+	{
+		stream << frame;
+
+		for ( auto & phase : samples )
+		{
+			stream << "," << phase[frame];
+		}
+
+		stream << std::endl;
+	}
+}
+
+bool doReadBaseline( castor::Path const & path
+	, std::map< std::string, Stats > & baseline )
+{
+	std::ifstream stream{ castor::string::stringCast< char >( path ) };
+
+	if ( !stream )
+	{
+		std::cerr << "Couldn't open baseline file [" << path << "]." << std::endl;
+		return false;
+	}
+
+	std::string line;
+	// Skip header.
+	std::getline( stream, line );
+
+	while ( std::getline( stream, line ) )
+	{
+		std::replace( line.begin(), line.end(), ',', ' ' );
+		std::istringstream lineStream{ line };
+		Stats stats;
+
+		if ( lineStream >> stats.name >> stats.min >> stats.mean >> stats.p50 >> stats.p90 >> stats.p95 >> stats.p99 >> stats.max )
+		{
+			baseline.emplace( stats.name, stats );
+		}
+	}
+
+	return true;
+}
+
+bool doCompare( StatsArray const & stats
+	, Options const & options )
+{
+	std::map< std::string, Stats > baseline;
+
+	if ( !doReadBaseline( options.baseline, baseline ) )
+	{
+		return false;
+	}
+
+	bool result = true;
+	auto factor = 1.0 + options.tolerance / 100.0;
+	auto check = [&result, factor]( std::string const & phase
+		, char const * name
+		, double reference
+		, double value )
+	{
+		if ( value > reference * factor )
+		{
+			std::cerr << std::fixed << std::setprecision( 3 )
+				<< "Regression on " << phase << " " << name << ": "
+				<< value << "us (baseline " << reference << "us)" << std::endl;
+			result = false;
+		}
+	};
+
+	for ( auto & phase : stats )
+	{
+		auto it = baseline.find( phase.name );
+
+		if ( it != baseline.end()
+			&& it->second.p50 >= options.minTime )
+		{
+			check( phase.name, "p50", it->second.p50, phase.p50 );
+			check( phase.name, "p95", it->second.p95, phase.p95 );
+		}
+	}
+
+	return result;
+}
+
+bool doOutput( StatsArray const & stats
+	, Samples const & samples
+	, Options const & options )
+{
+	if ( options.output.empty() )
+	{
+		doWriteCsv( std::cout, stats );
+	}
+	else
+	{
+		std::ofstream stream{ castor::string::stringCast< char >( options.output ) };
+
+		if ( !stream )
+		{
+			std::cerr << "Couldn't open output file [" << options.output << "]." << std::endl;
+			return false;
+		}
+
+		if ( castor::string::lowerCase( options.output.getExtension() ) == cuT( "json" ) )
+		{
+			doWriteJson( stream, options, stats );
+		}
+		else
+		{
+			doWriteCsv( stream, stats );
+		}
+	}
+
+	if ( !options.samples.empty() )
+	{
+		std::ofstream stream{ castor::string::stringCast< char >( options.samples ) };
+
+		if ( !stream )
+		{
+			std::cerr << "Couldn't open samples file [" << options.samples << "]." << std::endl;
+			return false;
+		}
+
+		doWriteSamples( stream, samples );
+	}
+
+	return true;
+}
+
+int main( int argc, char * argv[] )
+{
+	Options options;
+
+	if ( !doParseArgs( argc, argv, options ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	if ( !castor::File::fileExists( options.input ) )
+	{
+		std::cerr << "File [" << options.input << "] does not exist." << std::endl << std::endl;
+		printUsage();
+		return EXIT_FAILURE;
+	}
+
+	auto extension = castor::string::lowerCase( options.input.getExtension() );
+
+	if ( extension != cuT( "cscn" ) && extension != cuT( "zip" ) )
+	{
+		std::cerr << "Wrong file type (expect .cscn or .zip extensions)." << std::endl << std::endl;
+		printUsage();
+		return EXIT_FAILURE;
+	}
+
+	castor::Logger::initialise( castor::LogType::eWarning );
+	castor::Logger::setFileName( castor::File::getExecutableDirectory() / cuT( "CastorFrameBench.log" ) );
+	int result = EXIT_FAILURE;
+
+	{
+		castor3d::Engine engine
+		{
+			cuT( "CastorFrameBench" ),
+			castor3d::Version{ CastorFrameBench_VERSION_MAJOR, CastorFrameBench_VERSION_MINOR, CastorFrameBench_VERSION_BUILD },
+			false
+		};
+
+		if ( doInitialiseEngine( engine, options ) )
+		{
+			if ( doLoadScene( engine, options ) )
+			{
+				auto samples = doRunFrames( engine, options );
+				auto stats = doComputeStats( samples );
+
+				if ( doOutput( stats, samples, options ) )
+				{
+					result = ( options.baseline.empty() || doCompare( stats, options ) )
+						? EXIT_SUCCESS
+						: EXIT_FAILURE;
+				}
+			}
+
+			engine.cleanup();
+		}
+	}
+
+	castor::Logger::cleanup();
+	return result;
+}
@@ -0,0 +1,329 @@
+#include "CastorSceneConverter/CastorSceneConverter.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Binary/BinaryMesh.hpp>
+#include <Castor3D/Binary/BinaryScene.hpp>
+#include <Castor3D/Binary/BinarySkeleton.hpp>
+#include <Castor3D/Cache/MeshCache.hpp>
+#include <Castor3D/Cache/PluginCache.hpp>
+#include <Castor3D/Model/Mesh/Mesh.hpp>
+#include <Castor3D/Model/Skeleton/Skeleton.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+#include <Castor3D/Scene/SceneFileParser.hpp>
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/TextFile.hpp>
+#include <CastorUtils/Log/Logger.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+using StringArray = std::vector< std::string >;
+
+struct Options
+{
+	castor::Path input;
+	castor::Path output;
+	bool text{ false };
+};
+
+void printUsage()
+{
+	std::cout << "Castor Scene Converter is a tool that allows you to convert a scene file between its text and binary forms." << std::endl;
+	std::cout << "In binary form, the objects nodes, lights and geometries are written in a .cscb file, included by the .cscn file." << std::endl;
+	std::cout << "The other scene elements (materials, cameras, overlays, particle systems...) stay in the .cscn file." << std::endl;
+	std::cout << "Usage:" << std::endl;
+	std::cout << "CastorSceneConverter FILE [-o NAME] [-t]" << std::endl;
+	std::cout << "  FILE must be a .cscn or .zip scene file." << std::endl;
+	std::cout << "Options:" << std::endl;
+	std::cout << "  -o NAME     Allows you to specify the output folder, the written files use its name." << std::endl;
+	std::cout << "              If you don't use this option, the files are written in FILE's folder, in a subfolder named after FILE." << std::endl;
+	std::cout << "  -t          Writes the whole scene in text form, instead of the binary form." << std::endl << std::endl;
+}
+
+bool doParseArgs( int argc
+	, char * argv[]
+	, Options & options )
+{
+	StringArray args{ argv + 1, argv + argc };
+
+	if ( args.empty() )
+	{
+		std::cerr << "Missing scene file parameter." << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+
+	if ( std::find( args.begin(), args.end(), "-h" ) != args.end()
+		|| std::find( args.begin(), args.end(), "--help" ) != args.end() )
+	{
+		printUsage();
+		return false;
+	}
+
+	options.input = castor::Path{ castor::string::stringCast< castor::xchar >( args[0] ) };
+	options.text = std::find( args.begin(), args.end(), "-t" ) != args.end();
+	auto it = std::find( args.begin(), args.end(), "-o" );
+
+	if ( it == args.end() )
+	{
+		options.output = options.input.getPath() / ( options.input.getFileName() + ( options.text ? cuT( "Text" ) : cuT( "Binary" ) ) );
+	}
+	else if ( ++it == args.end() )
+	{
+		std::cerr << "Missing NAME parameter for -o option." << std::endl << std::endl;
+		printUsage();
+		return false;
+	}
+	else
+	{
+		options.output = castor::Path{ castor::string::stringCast< castor::xchar >( *it ) };
+	}
+
+	return true;
+}
+
+void loadPlugins( castor3d::Engine & engine )
+{
+	castor::PathArray files;
+	castor::File::listDirectoryFiles( castor3d::Engine::getPluginsDirectory(), files );
+	castor::PathArray arrayFailed;
+
+	for ( auto file : files )
+	{
+		if ( file.getExtension() == CU_SharedLibExt )
+		{
+			if ( !engine.getPluginCache().loadPlugin( file ) )
+			{
+				arrayFailed.push_back( file );
+			}
+		}
+	}
+
+	if ( !arrayFailed.empty() )
+	{
+		castor::Logger::logWarning( cuT( "Some plug-ins couldn't be loaded :" ) );
+
+		for ( auto file : arrayFailed )
+		{
+			castor::Logger::logWarning( castor::Path( file ).getFileName() );
+		}
+	}
+
+	castor::Logger::logInfo( cuT( "Plugins loaded" ) );
+}
+
+bool doInitialiseEngine( castor3d::Engine & engine )
+{
+	if ( !castor::File::directoryExists( castor3d::Engine::getEngineDirectory() ) )
+	{
+		castor::File::directoryCreate( castor3d::Engine::getEngineDirectory() );
+	}
+
+	auto & renderers = engine.getRenderersList();
+	bool result = false;
+
+	if ( renderers.empty() )
+	{
+		std::cerr << "No renderer plug-ins" << std::endl;
+	}
+	else
+	{
+		auto renderer = renderers.find( "test" );
+
+		if ( renderer != renderers.end() )
+		{
+			if ( engine.loadRenderer( renderer->name ) )
+			{
+				// Importer plug-ins may be needed by the scene's meshes.
+				loadPlugins( engine );
+				engine.initialise( 1, false );
+				result = true;
+			}
+			else
+			{
+				std::cerr << "Couldn't load renderer." << std::endl;
+			}
+		}
+		else
+		{
+			std::cerr << "Couldn't load test renderer." << std::endl;
+		}
+	}
+
+	return result;
+}
+
+castor3d::SceneSPtr doLoadScene( castor3d::Engine & engine
+	, castor::Path const & path )
+{
+	castor3d::SceneSPtr result;
+
+	try
+	{
+		castor3d::SceneFileParser parser( engine );
+
+		if ( parser.parseFile( path )
+			&& parser.scenesBegin() != parser.scenesEnd() )
+		{
+			result = parser.scenesBegin()->second;
+		}
+		else
+		{
+			std::cerr << "Can't read scene file." << std::endl;
+		}
+	}
+	catch ( std::exception & exc )
+	{
+		std::cerr << "Failed to parse the scene file, with following error: " << exc.what() << std::endl;
+	}
+
+	return result;
+}
+
+bool doWriteMeshes( castor3d::Scene const & scene
+	, castor::Path const & folder )
+{
+	castor::Path subfolder{ folder / cuT( "Meshes" ) };
+
+	if ( !castor::File::directoryExists( subfolder ) )
+	{
+		castor::File::directoryCreate( subfolder );
+	}
+
+	auto lock( castor::makeUniqueLock( scene.getMeshCache() ) );
+	bool result = true;
+
+	for ( auto const & it : scene.getMeshCache() )
+	{
+		auto & mesh = *it.second;
+
+		if ( result && mesh.isSerialisable() )
+		{
+			castor::BinaryFile file{ subfolder / ( mesh.getName() + cuT( ".cmsh" ) ), castor::File::OpenMode::eWrite };
+			result = castor3d::BinaryWriter< castor3d::Mesh >{}.write( mesh, file );
+			auto skeleton = mesh.getSkeleton();
+
+			if ( result && skeleton )
+			{
+				castor::BinaryFile file{ subfolder / ( mesh.getName() + cuT( ".cskl" ) ), castor::File::OpenMode::eWrite };
+				result = castor3d::BinaryWriter< castor3d::Skeleton >{}.write( *skeleton, file );
+			}
+		}
+	}
+
+	return result;
+}
+
+bool doWriteScene( castor3d::Scene const & scene
+	, Options const & options )
+{
+	bool result = false;
+
+	try
+	{
+		auto & folder = options.output;
+
+		if ( !castor::File::directoryExists( folder ) )
+		{
+			castor::File::directoryCreate( folder );
+		}
+
+		auto name = folder.getFileName();
+		castor::Path binaryFile;
+		result = true;
+
+		if ( !options.text )
+		{
+			binaryFile = castor::Path{ name + cuT( ".cscb" ) };
+			castor::BinaryFile file{ folder / binaryFile, castor::File::OpenMode::eWrite };
+			result = castor3d::BinaryWriter< castor3d::Scene >{}.write( scene, file );
+		}
+
+		if ( result )
+		{
+			castor::TextFile file{ folder / ( name + cuT( ".cscn" ) ), castor::File::OpenMode::eWrite, castor::File::EncodingMode::eASCII };
+			result = castor3d::Scene::TextWriter( castor::String{}, castor::Path{}, binaryFile )( scene, file );
+		}
+
+		if ( result )
+		{
+			result = doWriteMeshes( scene, folder );
+		}
+	}
+	catch ( castor::Exception & exc )
+	{
+		std::cerr << "Error encountered while writing files : " << exc.what() << std::endl;
+	}
+	catch ( std::exception & exc )
+	{
+		std::cerr << "Error encountered while writing files : " << exc.what() << std::endl;
+	}
+
+	if ( !result )
+	{
+		std::cerr << "Couldn't write the scene in [" << options.output << "]." << std::endl;
+	}
+
+	return result;
+}
+
+int main( int argc, char * argv[] )
+{
+	Options options;
+
+	if ( !doParseArgs( argc, argv, options ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	if ( !castor::File::fileExists( options.input ) )
+	{
+		std::cerr << "File [" << options.input << "] does not exist." << std::endl << std::endl;
+		printUsage();
+		return EXIT_FAILURE;
+	}
+
+	auto extension = castor::string::lowerCase( options.input.getExtension() );
+
+	if ( extension != cuT( "cscn" ) && extension != cuT( "zip" ) )
+	{
+		std::cerr << "Wrong file type (expect .cscn or .zip extensions)." << std::endl << std::endl;
+		printUsage();
+		return EXIT_FAILURE;
+	}
+
+#if defined( NDEBUG )
+	castor::Logger::initialise( castor::LogType::eInfo );
+#else
+	castor::Logger::initialise( castor::LogType::eDebug );
+#endif
+
+	castor::Logger::setFileName( castor::File::getExecutableDirectory() / cuT( "CastorSceneConverter.log" ) );
+	int result = EXIT_FAILURE;
+
+	{
+		castor3d::Engine engine
+		{
+			cuT( "CastorSceneConverter" ),
+			castor3d::Version{ CastorSceneConverter_VERSION_MAJOR, CastorSceneConverter_VERSION_MINOR, CastorSceneConverter_VERSION_BUILD },
+			false
+		};
+
+		if ( doInitialiseEngine( engine ) )
+		{
+			if ( auto scene = doLoadScene( engine, options.input ) )
+			{
+				if ( doWriteScene( *scene, options ) )
+				{
+					result = EXIT_SUCCESS;
+				}
+			}
+
+			engine.cleanup();
+		}
+	}
+
+	castor::Logger::cleanup();
+	return result;
+}
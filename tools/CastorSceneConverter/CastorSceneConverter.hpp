@@ -0,0 +1,5 @@
+/* See LICENSE file in root folder */
+#ifndef ___CastorSceneConverter_HPP___
+#define ___CastorSceneConverter_HPP___
+
+#endif